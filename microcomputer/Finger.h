@@ -29,7 +29,7 @@ class Finger {
   public:  
 	
 	 /* Default and explicit constructor functions */
-	 inline Finger( ) : defined(false) { }          
+	 inline Finger( ) : defined(false), flex(0.0), contactTip(false), contactMid(false) { }          
          inline Finger( double flexVal, bool contactTipVal, bool contactMidVal ) : 
          defined(true), flex(flexVal), contactTip(contactTipVal), contactMid(contactMidVal) { }
 
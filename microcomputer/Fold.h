@@ -29,7 +29,7 @@ class Fold {
   public:  
 	
 	 /* Default and explicit constructor functions */
-	 inline Fold( ) : defined(false) { }          
+	 inline Fold( ) : defined(false), contactTip(false) { }          
          inline Fold( bool contactTipVal ) : defined(true), contactTip(contactTipVal) { }
 
 	 /* Accessor functions */
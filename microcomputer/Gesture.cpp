@@ -31,7 +31,7 @@ void add_border( char border[MAX_CHAR], int border_len, char c_div, char v_div )
 
 -----------------------------------------------------------------------------------*/
 
-void Gesture::Set( Hand lHand, Hand rHand ) {
+void Gesture::Set( const Hand &lHand, const Hand &rHand ) {
 
     left  = lHand ;
     right = rHand ;
@@ -245,12 +245,12 @@ string Gesture::AsString( ) {
     sprintf( header + strlen(header), "%c\n", h_div ) ;
     for( j = 0 ; j < NUM_303 ; j++ ){
         sprintf( entry[0] + strlen(entry[0]), "%c %-*s %-*s %c (%+07.1f, %+07.1f, %+07.1f) ", h_div, (int)strlen("right"), (hand_name[0]).c_str(), 
-                 (int)strlen("bottom"), (left.Lsm303Vals(j).Side()).c_str(), h_div, 
+                 (int)strlen("bottom"), left.Lsm303Vals(j).SideName(), h_div, 
                  left.Lsm303Vals(j).AccelX(), left.Lsm303Vals(j).AccelY(), left.Lsm303Vals(j).AccelZ() ) ;
         sprintf( entry[0] + strlen(entry[0]), "%c (%+07.1f, %+07.1f, %+07.1f) %c\n", h_div,
                  left.Lsm303Vals(j).MagX(), left.Lsm303Vals(j).MagY(), left.Lsm303Vals(j).MagZ(), h_div ) ;
         sprintf( entry[1] + strlen(entry[1]), "%c %-*s %-*s %c (%+07.1f, %+07.1f, %+07.1f) ", h_div, (int)strlen("right"), (hand_name[1]).c_str(), 
-                 (int)strlen("bottom"), (right.Lsm303Vals(j).Side()).c_str(), h_div, 
+                 (int)strlen("bottom"), right.Lsm303Vals(j).SideName(), h_div, 
                  right.Lsm303Vals(j).AccelX(), right.Lsm303Vals(j).AccelY(), right.Lsm303Vals(j).AccelZ() ) ;
         sprintf( entry[1] + strlen(entry[1]), "%c (%+07.1f, %+07.1f, %+07.1f) %c\n", h_div,
                  right.Lsm303Vals(j).MagX(), right.Lsm303Vals(j).MagY(), right.Lsm303Vals(j).MagZ(), h_div ) ;
@@ -276,14 +276,14 @@ string Gesture::AsString( ) {
     sprintf( header + strlen(header), "%c\n", h_div ) ;
     for( j = 0 ; j < NUM_9DOF ; j++ ){
         sprintf( entry[0] + strlen(entry[0]), "%c %-*s %-*s %c (%+08.1f, %+08.1f, %+08.1f) ", h_div, (int)strlen("right"), (hand_name[0]).c_str(), 
-                 (int)strlen("bottom"), (left.Lsm9dofVals(j).Side()).c_str(), h_div, 
+                 (int)strlen("bottom"), left.Lsm9dofVals(j).SideName(), h_div, 
                  left.Lsm9dofVals(j).AccelX(), left.Lsm9dofVals(j).AccelY(), left.Lsm9dofVals(j).AccelZ() ) ;
         sprintf( entry[0] + strlen(entry[0]), "%c (%+08.1f, %+08.1f, %+08.1f) ", h_div,
                  left.Lsm9dofVals(j).MagX(), left.Lsm9dofVals(j).MagY(), left.Lsm9dofVals(j).MagZ() ) ;
         sprintf( entry[0] + strlen(entry[0]), "%c (%+08.1f, %+08.1f, %+08.1f) %c\n", h_div,
                  left.Lsm9dofVals(j).GyroX(), left.Lsm9dofVals(j).GyroY(), left.Lsm9dofVals(j).GyroZ(), h_div ) ;
         sprintf( entry[1] + strlen(entry[1]), "%c %-*s %-*s %c (%+08.1f, %+08.1f, %+08.1f) ", h_div, (int)strlen("right"), (hand_name[1]).c_str(), 
-                 (int)strlen("bottom"), (right.Lsm9dofVals(j).Side()).c_str(), h_div, 
+                 (int)strlen("bottom"), right.Lsm9dofVals(j).SideName(), h_div, 
                  right.Lsm9dofVals(j).AccelX(), right.Lsm9dofVals(j).AccelY(), right.Lsm9dofVals(j).AccelZ() ) ;
         sprintf( entry[1] + strlen(entry[1]), "%c (%+08.1f, %+08.1f, %+08.1f) ", h_div,
                  right.Lsm9dofVals(j).MagX(), right.Lsm9dofVals(j).MagY(), right.Lsm9dofVals(j).MagZ() ) ;
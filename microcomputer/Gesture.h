@@ -31,15 +31,15 @@ class Gesture {
 	
 	 /* Default and explicit constructor functions */
 	 inline Gesture( ) : defined(false) { }          
-         inline Gesture( Hand lHand, Hand rHand ) : defined(true), left(lHand), right(rHand) { }
+         inline Gesture( const Hand &lHand, const Hand &rHand ) : defined(true), left(lHand), right(rHand) { }
 
 	 /* Accessor functions */
-   	 inline Hand Left( )       const { return left       ; }  /* Access left hand.  */
-	 inline Hand Right( )      const { return right      ; }  /* Access right hand.  */
+   	 inline const Hand &Left( )  const { return left       ; }  /* Access left hand.  */
+	 inline const Hand &Right( ) const { return right      ; }  /* Access right hand.  */
 	 inline bool Defined( )    const { return defined ; }      /* Access defined value. */
 	 
 	 /* Mutator function */
-	 void Set( Hand lHand, Hand rHand ) ;            /* Sets left hand and right hand. */
+	 void Set( const Hand &lHand, const Hand &rHand ) ;            /* Sets left hand and right hand. */
 			  
 	 /* Input/Output functions */
 	 void Show( ostream &os = cout ) const ;
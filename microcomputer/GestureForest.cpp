@@ -0,0 +1,178 @@
+/***********GestureForest.cpp********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The GestureForest constructor, and the Classify(), Features(), and
+            HandFeatures() functions are defined in this module.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <string.h>
+#include <math.h>
+#include "GestureForest.h"
+
+/*----------GestureForest::GestureForest( )------------------------------------------
+
+  PURPOSE:  Explicit constructor. Classifies with the given forest, such as one that
+            tools/forest_train has just trained, instead of the compiled forest, which
+            need not be linked in. The tables are not copied.
+
+  INPUT  PARAMETERS:  model -- the trained forest.
+
+-----------------------------------------------------------------------------------*/
+
+GestureForest::GestureForest( const ForestModel &model ) : model( &model ) {
+
+}
+
+/*----------GestureForest::HandFeatures( )-------------------------------------------
+
+  PURPOSE:  Compute the features of a single hand: the quantized flex values, the
+            contact sensors, and the direction of each accelerometer reading.
+            Accelerometers that read nothing point nowhere.
+
+  INPUT  PARAMETERS:  hand     -- the hand.
+
+  OUTPUT PARAMETERS:  features -- the FOREST_HAND_FEATURES features of the hand.
+
+-----------------------------------------------------------------------------------*/
+
+void GestureForest::HandFeatures( const Hand &hand, int16_t features[FOREST_HAND_FEATURES] ){
+
+    uint8_t flex[FLEX_VECTOR_LEN] ;      /* The quantized flex values. */
+    uint16_t sig ;                       /* The contact sensors. */
+    double a[3] ;                        /* The next accelerometer reading. */
+    double len ;                         /* Length of the reading. */
+    unsigned int n = 0 ;                 /* The next feature. */
+    unsigned int i ;                     /* An iterator. */
+    unsigned int d ;                     /* An iterator over the axes. */
+
+    if( !hand.Defined() ){
+        memset( features, 0, FOREST_HAND_FEATURES * sizeof(int16_t) ) ;
+        return ;
+    }
+    hand.FlexVector( flex ) ;
+    for( i = 0 ; i < FOREST_HAND_FLEX ; i++ ){
+        features[n++] = flex[i] ;
+    }
+    sig = hand.ContactSignature() ;
+    for( i = 0 ; i < NUM_CONTACT_BITS ; i++ ){
+        features[n++] = (sig >> i) & 0x01 ;
+    }
+    for( i = 0 ; i < FOREST_HAND_IMUS ; i++ ){
+        if( i < NUM_LSM303 ){
+            const Lsm303 &imu = hand.Lsm303Vals( i ) ;
+            a[0] = imu.AccelX() ; a[1] = imu.AccelY() ; a[2] = imu.AccelZ() ;
+        }
+        else{
+            const Lsm9dof &imu = hand.Lsm9dofVals( i - NUM_LSM303 ) ;
+            a[0] = imu.AccelX() ; a[1] = imu.AccelY() ; a[2] = imu.AccelZ() ;
+        }
+        len = sqrt( a[0] * a[0] + a[1] * a[1] + a[2] * a[2] ) ;
+        for( d = 0 ; d < 3 ; d++ ){
+            features[n++] = (len > 0.0) ? (int16_t)floor( (FOREST_GRAVITY_SCALE * a[d] / len) + 0.5 ) : 0 ;
+        }
+    }
+
+    return ;
+
+}
+
+/*----------GestureForest::Features( )-----------------------------------------------
+
+  PURPOSE:  Compute the features of a gesture, the left hand first.
+
+  INPUT  PARAMETERS:  gesture  -- the gesture.
+
+  OUTPUT PARAMETERS:  features -- the FOREST_FEATURES features of the gesture.
+
+-----------------------------------------------------------------------------------*/
+
+void GestureForest::Features( const Gesture &gesture, int16_t features[FOREST_FEATURES] ){
+
+    HandFeatures( gesture.Left(), features ) ;
+    HandFeatures( gesture.Right(), features + FOREST_HAND_FEATURES ) ;
+
+    return ;
+
+}
+
+/*----------GestureForest::Classify( )-----------------------------------------------
+
+  PURPOSE:  Classify the features of a gesture. Each tree is walked from the root to
+            a leaf, which votes for its class; the class with the most votes wins,
+            the first class on a tie.
+
+  INPUT  PARAMETERS:  features -- the features of the gesture.
+
+  OUTPUT PARAMETERS:  result   -- the class, its votes, and its share of the votes.
+
+-----------------------------------------------------------------------------------*/
+
+void GestureForest::Classify( const int16_t features[FOREST_FEATURES], ForestResult &result ) const {
+
+    uint8_t votes[FOREST_MAX_CLASSES] ;  /* Votes for each class. */
+    unsigned int node[FOREST_TREES] ;    /* The current node of each tree. */
+    const ForestNode* n ;                /* The current node of a tree. */
+    unsigned int best = 0 ;              /* The class with the most votes so far. */
+    unsigned int t ;                     /* An iterator over the trees. */
+    unsigned int d ;                     /* An iterator over the levels. */
+    unsigned int c ;                     /* An iterator over the classes. */
+
+    memset( votes, 0, model->classes ) ;
+    /* The trees are walked a level at a time, so the loads of one tree do not wait on
+       those of the next. */
+    for( t = 0 ; t < FOREST_TREES ; t++ ){
+        node[t] = 0 ;
+    }
+    for( d = 0 ; d < FOREST_DEPTH ; d++ ){
+        for( t = 0 ; t < FOREST_TREES ; t++ ){
+            n = model->nodes + t * FOREST_NODES + node[t] ;
+            node[t] = 2 * node[t] + 1 + (features[n->feature] > n->threshold) ;
+        }
+    }
+    for( t = 0 ; t < FOREST_TREES ; t++ ){
+        votes[model->leaves[t * FOREST_LEAVES + (node[t] - FOREST_NODES)]]++ ;
+    }
+    for( c = 1 ; c < model->classes ; c++ ){
+        best = (votes[c] > votes[best]) ? c : best ;
+    }
+    result.label = best ;
+    result.votes = votes[best] ;
+    result.confidence = (double)votes[best] / FOREST_TREES ;
+
+    return ;
+
+}
+
+/*----------GestureForest::Classify( )-----------------------------------------------
+
+  PURPOSE:  Classify a gesture.
+
+  INPUT  PARAMETERS:  gesture -- the gesture.
+
+  OUTPUT PARAMETERS:  result  -- the class, its votes, and its share of the votes.
+
+  RETURN VALUE:  true if the gesture was classified
+                 false if no hand was worn or the forest has no classes.
+
+-----------------------------------------------------------------------------------*/
+
+bool GestureForest::Classify( const Gesture &gesture, ForestResult &result ) const {
+
+    int16_t features[FOREST_FEATURES] ;  /* The features of the gesture. */
+
+    if( (model->classes == 0) || (!gesture.Left().Defined() && !gesture.Right().Defined()) )
+        return false ;
+    Features( gesture, features ) ;
+    Classify( features, result ) ;
+
+    return true ;
+
+}
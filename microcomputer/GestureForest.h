@@ -0,0 +1,116 @@
+/***********GestureForest.h**********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the class "GestureForest", a decision forest
+            trained offline by tools/forest_train on labelled captures and sessions,
+            and compiled into sign2speech as the tables in GestureForestModel.cpp.
+            It classifies the poses that do not match a gesture of the gesture
+            database exactly. Recognize.h and GestureForest.cpp include this file.
+
+            Every tree is complete, FOREST_DEPTH levels deep, and stored as an
+            implicit heap: the children of node i are nodes 2i + 1 and 2i + 2, and
+            the leaves follow the last level of nodes. A branch that the trainer
+            stopped early is padded with nodes that always go left to leaves of the
+            same class. Evaluating a tree is then FOREST_DEPTH loads and compares
+            with no branch on the data, and a forest is FOREST_TREES of those and a
+            vote, with nothing allocated.
+
+            Both the trainer and the classifier compute the features of a gesture
+            with Features(), so the model always sees the values it was trained on:
+
+              flex     the quantized index, middle, ring, and pinky flex values.
+              contact  each of the contact sensors, 0 or 1.
+              gravity  the direction of each accelerometer reading, in hundredths.
+
+            for the left hand and then the right hand. A hand that is not worn
+            reads zero throughout.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef GESTUREFOREST_H
+#define GESTUREFOREST_H
+
+#include <stdint.h>
+#include "Gesture.h"
+
+using namespace std ;
+
+#define FOREST_TREES          16   /* Number of trees. */
+#define FOREST_DEPTH           8   /* Number of levels of nodes in every tree. */
+#define FOREST_NODES         ((1 << FOREST_DEPTH) - 1)  /* Nodes per tree. */
+#define FOREST_LEAVES        (1 << FOREST_DEPTH)        /* Leaves per tree. */
+#define FOREST_MAX_CLASSES   256   /* Most classes a leaf can name. */
+#define FOREST_HAND_FLEX       4   /* Flex features per hand (index, middle, ring, pinky). */
+#define FOREST_HAND_IMUS       4   /* Accelerometers per hand, the LSM303s and then the LSM9DOFs. */
+#define FOREST_HAND_FEATURES (FOREST_HAND_FLEX + NUM_CONTACT_BITS + 3 * FOREST_HAND_IMUS)  /* Features per hand. */
+#define FOREST_FEATURES      (2 * FOREST_HAND_FEATURES)  /* Features per gesture. */
+#define FOREST_GRAVITY_SCALE 100   /* Value of a gravity feature for an accelerometer reading 1 g along its axis. */
+#define FOREST_MIN_CONFIDENCE 0.5  /* Smallest share of the votes gesture_to_text() accepts. */
+#define FOREST_MAX_DISTANCE    5   /* Largest distance to the closest gesture, in flex steps, for gesture_to_text() to ask the forest. */
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "ForestNode" is a node of a tree: go to the right child if the feature is
+   greater than the threshold, otherwise to the left child. */
+
+struct ForestNode {
+	 int16_t threshold ;                             /* The largest value that goes left. */
+	 uint8_t feature ;                               /* The feature compared. */
+	 uint8_t reserved ;                              /* Always zero. */
+} ;
+
+/* Type "ForestModel" points to the tables of a trained forest. */
+
+struct ForestModel {
+	 unsigned int classes ;                          /* Number of classes. */
+	 const char* const* text ;                       /* The gesture text of each class. */
+	 const ForestNode* nodes ;                       /* FOREST_NODES nodes of each tree. */
+	 const uint8_t* leaves ;                         /* FOREST_LEAVES classes of each tree. */
+} ;
+
+/* Type "ForestResult" represents the result of classifying a gesture. */
+
+struct ForestResult {
+	 unsigned int label ;                            /* The class with the most votes. */
+	 unsigned int votes ;                            /* Number of trees that voted for it. */
+	 double confidence ;                             /* Share of the trees that voted for it, up to 1.0. */
+} ;
+
+/* The forest compiled into sign2speech, defined in GestureForestModel.cpp. */
+
+extern const ForestModel gestureForestModel ;
+
+/* Type "GestureForest" classifies gestures with a trained forest. */
+
+class GestureForest {
+
+  public:
+
+	 /* Default and explicit constructor functions */
+	 inline GestureForest( ) : model(&gestureForestModel) { }  /* Uses the compiled forest. */
+	 GestureForest( const ForestModel &model ) ;
+
+	 /* Accessor functions */
+	 inline unsigned int Classes( ) const { return model->classes ; }                   /* Access number of classes. */
+	 inline const char* Text( unsigned int label ) const { return model->text[label] ; }  /* Access gesture text of a class. */
+	 bool Classify( const Gesture &gesture, ForestResult &result ) const ;                 /* Classify a gesture. */
+	 void Classify( const int16_t features[FOREST_FEATURES], ForestResult &result ) const ;  /* Classify features. */
+
+	 /* Feature functions */
+	 static void Features( const Gesture &gesture, int16_t features[FOREST_FEATURES] ) ;
+	 static void HandFeatures( const Hand &hand, int16_t features[FOREST_HAND_FEATURES] ) ;
+
+  private:
+
+	 const ForestModel* model ;                      /* The trained forest. */
+
+} ;
+
+#endif
@@ -0,0 +1,1011 @@
+/***********GestureForestModel.cpp***************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The decision forest compiled into sign2speech, as trained by
+            tools/forest_train on 8200 labelled gestures of 41 classes, with an
+            out of bag accuracy of 99.9%. Written by "make forest"; do not edit.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include "GestureForest.h"
+
+/* The tables only hold a forest of the layout they were trained for. */
+typedef char forest_layout_check[((FOREST_TREES == 16) && (FOREST_DEPTH == 8) && (FOREST_FEATURES == 58)) ? 1 : -1] ;
+
+static const char* const forestText[41] = {
+    " ", "1", "2", "3", "4", "5", "6", "7", "8", "9", "A", "B",
+    "C", "D", "E", "F", "G", "H", "I", "J1", "J2", "J3", "K", "L",
+    "M", "N", "O", "P", "Q", "R", "S", "T", "U", "V", "W", "X",
+    "Y", "Z1", "Z2", "Z3", "Z4"
+} ;
+
+static const ForestNode forestNodes[FOREST_TREES * FOREST_NODES] = {
+    /* Tree 0 */
+    { 60, 54, 0 }, { 11, 32, 0 }, { 41, 50, 0 }, { 4, 31, 0 }, { 50, 54, 0 }, { 91, 57, 0 },
+    { -30, 55, 0 }, { 44, 54, 0 }, { 30, 54, 0 }, { 17, 32, 0 }, { 12, 29, 0 }, { -46, 52, 0 },
+    { 87, 48, 0 }, { 15, 32, 0 }, { 36, 53, 0 }, { 1, 29, 0 }, { -18, 56, 0 }, { -13, 53, 0 },
+    { -21, 56, 0 }, { 39, 57, 0 }, { -99, 46, 0 }, { 1, 30, 0 }, { 85, 57, 0 }, { -30, 56, 0 },
+    { -23, 55, 0 }, { -1, 53, 0 }, { -11, 53, 0 }, { -70, 52, 0 }, { 33, 53, 0 }, { -67, 52, 0 },
+    { 61, 54, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 30, 53, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 44, 54, 0 }, { 32767, 0, 0 }, { 85, 57, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { -9, 56, 0 }, { 39, 48, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 85, 57, 0 }, { 32767, 0, 0 }, { 10, 31, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 21, 50, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 1, 29, 0 }, { 25, 53, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { -23, 55, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 1, 31, 0 },
+    { 0, 39, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 12, 49, 0 }, { -12, 46, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    /* Tree 1 */
+    { -69, 52, 0 }, { 46, 54, 0 }, { 73, 54, 0 }, { 1, 32, 0 }, { 55, 54, 0 }, { 7, 29, 0 },
+    { -40, 46, 0 }, { 44, 54, 0 }, { 15, 31, 0 }, { 34, 53, 0 }, { 82, 57, 0 }, { -60, 52, 0 },
+    { 62, 54, 0 }, { -18, 56, 0 }, { -31, 56, 0 }, { 82, 57, 0 }, { -51, 55, 0 }, { -52, 54, 0 },
+    { -78, 49, 0 }, { 1, 31, 0 }, { 15, 29, 0 }, { 1, 30, 0 }, { 90, 57, 0 }, { 1, 31, 0 },
+    { 64, 54, 0 }, { 42, 53, 0 }, { -25, 56, 0 }, { 11, 32, 0 }, { 22, 53, 0 }, { -11, 53, 0 },
+    { 32767, 0, 0 }, { 26, 48, 0 }, { 10, 29, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 9, 54, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 0, 42, 0 }, { 85, 57, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -9, 47, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 66, 47, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { -44, 56, 0 }, { -15, 56, 0 }, { 32767, 0, 0 }, { 1, 31, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    /* Tree 2 */
+    { 60, 54, 0 }, { 11, 32, 0 }, { 25, 53, 0 }, { 1, 30, 0 }, { -14, 56, 0 }, { 78, 48, 0 },
+    { 36, 53, 0 }, { 45, 54, 0 }, { 0, 44, 0 }, { 11, 29, 0 }, { 55, 54, 0 }, { -69, 52, 0 },
+    { -31, 56, 0 }, { -25, 56, 0 }, { 40, 53, 0 }, { 1, 32, 0 }, { 0, 44, 0 }, { 35, 53, 0 },
+    { 60, 47, 0 }, { -18, 56, 0 }, { 16, 32, 0 }, { -79, 52, 0 }, { 0, 29, 0 }, { 1, 30, 0 },
+    { -57, 47, 0 }, { -20, 46, 0 }, { 87, 48, 0 }, { -21, 55, 0 }, { 86, 57, 0 }, { -62, 52, 0 },
+    { -63, 52, 0 }, { -55, 55, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 0, 38, 0 }, { -14, 53, 0 },
+    { 0, 34, 0 }, { 20, 50, 0 }, { -8, 56, 0 }, { 16, 32, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 51, 54, 0 }, { 32767, 0, 0 }, { -6, 56, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 10, 31, 0 }, { -32, 56, 0 }, { 15, 47, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 33, 53, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 90, 57, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { -9, 56, 0 }, { 12, 30, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 50, 53, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 17, 49, 0 }, { 29, 50, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 12, 49, 0 }, { 1, 31, 0 }, { 1, 31, 0 }, { 0, 31, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    /* Tree 3 */
+    { -69, 52, 0 }, { -18, 56, 0 }, { 10, 30, 0 }, { 11, 32, 0 }, { 82, 57, 0 }, { -13, 55, 0 },
+    { -59, 52, 0 }, { 85, 57, 0 }, { 3, 29, 0 }, { 44, 54, 0 }, { 1, 31, 0 }, { 36, 53, 0 },
+    { -11, 53, 0 }, { 87, 57, 0 }, { -18, 56, 0 }, { 4, 31, 0 }, { 1, 30, 0 }, { -4, 53, 0 },
+    { 0, 43, 0 }, { -81, 46, 0 }, { 14, 32, 0 }, { 29, 53, 0 }, { 42, 53, 0 }, { 11, 32, 0 },
+    { -23, 55, 0 }, { 10, 49, 0 }, { 2, 50, 0 }, { 10, 32, 0 }, { -24, 56, 0 }, { -6, 50, 0 },
+    { -48, 55, 0 }, { 1, 31, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -9, 47, 0 },
+    { -24, 56, 0 }, { 44, 54, 0 }, { 32767, 0, 0 }, { 17, 32, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 1, 29, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -79, 52, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 1, 31, 0 }, { -9, 46, 0 }, { 15, 49, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 33, 53, 0 }, { 32767, 0, 0 }, { -43, 52, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 0, 32, 0 }, { 32767, 0, 0 }, { 1, 31, 0 }, { 0, 36, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 1, 31, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 1, 31, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    /* Tree 4 */
+    { -46, 55, 0 }, { 46, 54, 0 }, { 68, 54, 0 }, { 82, 57, 0 }, { -9, 56, 0 }, { 39, 53, 0 },
+    { 90, 48, 0 }, { -18, 56, 0 }, { 35, 53, 0 }, { 28, 53, 0 }, { 55, 54, 0 }, { -69, 52, 0 },
+    { 92, 57, 0 }, { 88, 51, 0 }, { 91, 57, 0 }, { -91, 55, 0 }, { 1, 30, 0 }, { 84, 57, 0 },
+    { -44, 49, 0 }, { -51, 55, 0 }, { 55, 48, 0 }, { 42, 48, 0 }, { -56, 55, 0 }, { 85, 51, 0 },
+    { 15, 30, 0 }, { 52, 54, 0 }, { -71, 52, 0 }, { -57, 52, 0 }, { -1, 53, 0 }, { 32767, 0, 0 },
+    { -17, 52, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -20, 51, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 1, 32, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { -45, 49, 0 }, { 59, 54, 0 }, { 32767, 0, 0 }, { 25, 53, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 55, 48, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 61, 54, 0 }, { 16, 31, 0 }, { 32767, 0, 0 }, { -26, 53, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 1, 31, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 53, 47, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    /* Tree 5 */
+    { 31, 53, 0 }, { -24, 56, 0 }, { 0, 43, 0 }, { 3, 50, 0 }, { -79, 52, 0 }, { -71, 52, 0 },
+    { 85, 57, 0 }, { -26, 53, 0 }, { -11, 53, 0 }, { -96, 46, 0 }, { 30, 47, 0 }, { -80, 52, 0 },
+    { -30, 55, 0 }, { 12, 29, 0 }, { -45, 55, 0 }, { -57, 47, 0 }, { -61, 46, 0 }, { 99, 48, 0 },
+    { 1, 31, 0 }, { 37, 57, 0 }, { -84, 52, 0 }, { 15, 47, 0 }, { -73, 52, 0 }, { -21, 56, 0 },
+    { 11, 29, 0 }, { 65, 54, 0 }, { -21, 55, 0 }, { -55, 55, 0 }, { 42, 48, 0 }, { 10, 32, 0 },
+    { -21, 55, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 23, 50, 0 },
+    { 1, 31, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 1, 29, 0 }, { -20, 51, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 87, 51, 0 }, { 32767, 0, 0 }, { 15, 32, 0 }, { 1, 32, 0 },
+    { -55, 55, 0 }, { -64, 46, 0 }, { 84, 57, 0 }, { 62, 54, 0 }, { 14, 32, 0 }, { -67, 52, 0 },
+    { -26, 56, 0 }, { 0, 33, 0 }, { 32767, 0, 0 }, { 27, 48, 0 }, { 32767, 0, 0 }, { 34, 53, 0 },
+    { 32767, 0, 0 }, { 40, 53, 0 }, { -20, 56, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -18, 46, 0 },
+    { -19, 46, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 85, 57, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 35, 53, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { -50, 55, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { -19, 56, 0 }, { -75, 52, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -21, 56, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 13, 32, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 1, 31, 0 }, { 32767, 0, 0 }, { 1, 31, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 86, 57, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 8, 29, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { -21, 49, 0 }, { 0, 33, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    /* Tree 6 */
+    { 60, 54, 0 }, { -14, 56, 0 }, { 88, 51, 0 }, { 1, 29, 0 }, { -4, 56, 0 }, { 92, 57, 0 },
+    { -30, 56, 0 }, { 4, 31, 0 }, { -50, 49, 0 }, { 1, 32, 0 }, { 12, 29, 0 }, { 65, 54, 0 },
+    { -19, 56, 0 }, { 91, 57, 0 }, { 15, 47, 0 }, { 85, 57, 0 }, { 0, 45, 0 }, { 34, 51, 0 },
+    { -34, 55, 0 }, { -5, 56, 0 }, { 15, 32, 0 }, { 51, 53, 0 }, { 42, 50, 0 }, { 90, 57, 0 },
+    { -45, 55, 0 }, { 36, 53, 0 }, { 16, 31, 0 }, { -44, 56, 0 }, { 9, 49, 0 }, { 1, 32, 0 },
+    { -16, 49, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 17, 54, 0 }, { 9, 54, 0 }, { 15, 31, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -53, 55, 0 }, { 32767, 0, 0 }, { 3, 29, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -59, 47, 0 },
+    { 32767, 0, 0 }, { 28, 53, 0 }, { 32767, 0, 0 }, { 1, 30, 0 }, { 1, 31, 0 }, { 32767, 0, 0 },
+    { -23, 55, 0 }, { -41, 46, 0 }, { -42, 55, 0 }, { 1, 31, 0 }, { -11, 46, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { -51, 55, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -79, 49, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -51, 55, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -32, 56, 0 }, { 6, 47, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 68, 54, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 1, 31, 0 }, { 1, 31, 0 }, { 26, 50, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    /* Tree 7 */
+    { 3, 29, 0 }, { 90, 57, 0 }, { -14, 56, 0 }, { 55, 54, 0 }, { -26, 56, 0 }, { 30, 53, 0 },
+    { -74, 52, 0 }, { -19, 56, 0 }, { 22, 53, 0 }, { -9, 53, 0 }, { -23, 55, 0 }, { -13, 53, 0 },
+    { -71, 52, 0 }, { 0, 43, 0 }, { -53, 55, 0 }, { 34, 53, 0 }, { -4, 53, 0 }, { -7, 47, 0 },
+    { 60, 54, 0 }, { 1, 30, 0 }, { 1, 32, 0 }, { -61, 52, 0 }, { 68, 54, 0 }, { -57, 47, 0 },
+    { -18, 56, 0 }, { -20, 56, 0 }, { 1, 32, 0 }, { -81, 52, 0 }, { 42, 50, 0 }, { 12, 29, 0 },
+    { 39, 53, 0 }, { 1, 31, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -99, 52, 0 }, { -44, 56, 0 },
+    { 32767, 0, 0 }, { 0, 45, 0 }, { 32767, 0, 0 }, { 1, 31, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 65, 54, 0 }, { -55, 52, 0 }, { 43, 48, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { -52, 54, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 73, 51, 0 }, { 32767, 0, 0 }, { 82, 57, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 86, 57, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 14, 32, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 0, 44, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 58, 47, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    /* Tree 8 */
+    { -45, 55, 0 }, { -12, 56, 0 }, { -23, 55, 0 }, { 11, 32, 0 }, { 39, 53, 0 }, { -33, 55, 0 },
+    { 16, 31, 0 }, { 85, 57, 0 }, { 21, 48, 0 }, { -56, 55, 0 }, { 17, 31, 0 }, { 15, 30, 0 },
+    { 94, 57, 0 }, { 95, 57, 0 }, { -16, 55, 0 }, { 1, 32, 0 }, { 0, 36, 0 }, { 17, 32, 0 },
+    { 68, 54, 0 }, { -79, 52, 0 }, { 1, 29, 0 }, { 51, 53, 0 }, { 0, 34, 0 }, { 25, 53, 0 },
+    { 3, 50, 0 }, { 14, 32, 0 }, { 40, 53, 0 }, { -11, 53, 0 }, { 58, 48, 0 }, { 95, 57, 0 },
+    { 64, 54, 0 }, { -98, 52, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 86, 57, 0 }, { 32767, 0, 0 },
+    { -52, 54, 0 }, { 32767, 0, 0 }, { -51, 55, 0 }, { 32767, 0, 0 }, { 14, 32, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 1, 32, 0 }, { 12, 29, 0 }, { -2, 56, 0 }, { 32767, 0, 0 },
+    { -35, 55, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 86, 54, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { -4, 55, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { -63, 52, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 1, 32, 0 }, { 18, 31, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 98, 48, 0 }, { 20, 50, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 0, 31, 0 }, { 0, 31, 0 }, { 32767, 0, 0 }, { -11, 46, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    /* Tree 9 */
+    { -46, 55, 0 }, { -13, 56, 0 }, { 68, 54, 0 }, { 39, 54, 0 }, { 39, 53, 0 }, { -69, 52, 0 },
+    { 16, 31, 0 }, { -18, 56, 0 }, { 50, 54, 0 }, { 82, 57, 0 }, { 15, 30, 0 }, { 33, 53, 0 },
+    { 64, 54, 0 }, { -21, 52, 0 }, { 88, 51, 0 }, { 37, 57, 0 }, { -99, 55, 0 }, { 86, 57, 0 },
+    { -51, 55, 0 }, { 52, 54, 0 }, { 29, 53, 0 }, { 51, 53, 0 }, { 15, 29, 0 }, { 85, 51, 0 },
+    { 44, 54, 0 }, { -26, 49, 0 }, { -12, 49, 0 }, { 10, 31, 0 }, { 98, 54, 0 }, { -23, 55, 0 },
+    { 84, 48, 0 }, { 32767, 0, 0 }, { 2, 47, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 84, 57, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 59, 54, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 0, 44, 0 }, { 1, 32, 0 }, { 32767, 0, 0 }, { 25, 53, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 15, 32, 0 }, { -25, 56, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 0, 30, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 20, 50, 0 }, { 86, 54, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 1, 31, 0 }, { -14, 46, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -31, 55, 0 }, { -1, 53, 0 }, { 32767, 0, 0 },
+    { -31, 55, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -2, 47, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { -47, 52, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    /* Tree 10 */
+    { 10, 30, 0 }, { -21, 56, 0 }, { -71, 52, 0 }, { 2, 53, 0 }, { 31, 53, 0 }, { -56, 55, 0 },
+    { -24, 56, 0 }, { -11, 53, 0 }, { -46, 55, 0 }, { -98, 46, 0 }, { 94, 57, 0 }, { 11, 54, 0 },
+    { 46, 54, 0 }, { -24, 53, 0 }, { 3, 29, 0 }, { -32, 56, 0 }, { 1, 31, 0 }, { 39, 54, 0 },
+    { -26, 56, 0 }, { 32767, 0, 0 }, { 1, 29, 0 }, { -30, 49, 0 }, { -60, 52, 0 }, { 16, 30, 0 },
+    { 16, 31, 0 }, { 30, 54, 0 }, { -35, 49, 0 }, { 78, 48, 0 }, { 62, 54, 0 }, { -63, 52, 0 },
+    { -14, 56, 0 }, { 24, 50, 0 }, { 0, 31, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -56, 55, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 61, 54, 0 }, { 32767, 0, 0 }, { -20, 51, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 18, 30, 0 }, { 32767, 0, 0 }, { -44, 49, 0 }, { -9, 56, 0 },
+    { 32767, 0, 0 }, { -60, 46, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 53, 48, 0 },
+    { -1, 53, 0 }, { 32767, 0, 0 }, { 39, 53, 0 }, { 23, 50, 0 }, { 11, 49, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 3, 29, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 99, 48, 0 }, { -13, 46, 0 }, { 1, 31, 0 }, { 0, 35, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    /* Tree 11 */
+    { 60, 54, 0 }, { -55, 55, 0 }, { 73, 54, 0 }, { -81, 52, 0 }, { 46, 54, 0 }, { -30, 55, 0 },
+    { 10, 30, 0 }, { 10, 29, 0 }, { 14, 32, 0 }, { 85, 57, 0 }, { -9, 56, 0 }, { -69, 52, 0 },
+    { 1, 29, 0 }, { 1, 31, 0 }, { 86, 54, 0 }, { 37, 57, 0 }, { -8, 50, 0 }, { 13, 30, 0 },
+    { -46, 49, 0 }, { 30, 53, 0 }, { 1, 32, 0 }, { 62, 47, 0 }, { 55, 54, 0 }, { 65, 54, 0 },
+    { 16, 31, 0 }, { 72, 47, 0 }, { 64, 54, 0 }, { 98, 54, 0 }, { -11, 53, 0 }, { 74, 54, 0 },
+    { 15, 47, 0 }, { 32767, 0, 0 }, { 1, 32, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 1, 30, 0 }, { 32767, 0, 0 }, { 1, 32, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 34, 53, 0 }, { 32767, 0, 0 }, { 29, 53, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 85, 51, 0 }, { 1, 30, 0 }, { 32767, 0, 0 }, { -60, 52, 0 }, { 43, 53, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 88, 51, 0 }, { 32767, 0, 0 },
+    { -6, 50, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 0, 43, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    /* Tree 12 */
+    { 60, 54, 0 }, { 46, 54, 0 }, { 92, 57, 0 }, { -55, 55, 0 }, { 3, 29, 0 }, { 22, 53, 0 },
+    { -19, 55, 0 }, { 11, 54, 0 }, { -51, 55, 0 }, { 82, 57, 0 }, { 15, 30, 0 }, { -41, 46, 0 },
+    { 28, 53, 0 }, { 1, 30, 0 }, { 2, 53, 0 }, { -9, 53, 0 }, { 1, 29, 0 }, { 36, 48, 0 },
+    { -84, 52, 0 }, { 31, 53, 0 }, { 50, 54, 0 }, { 47, 53, 0 }, { 34, 53, 0 }, { -61, 46, 0 },
+    { 64, 54, 0 }, { 85, 51, 0 }, { 39, 53, 0 }, { 16, 31, 0 }, { -67, 52, 0 }, { 1, 31, 0 },
+    { 65, 48, 0 }, { -13, 53, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -57, 55, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 38, 48, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 42, 53, 0 }, { -69, 52, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -19, 56, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 61, 54, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -3, 55, 0 },
+    { 32767, 0, 0 }, { 96, 57, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    /* Tree 13 */
+    { -69, 52, 0 }, { -53, 55, 0 }, { 49, 47, 0 }, { -8, 56, 0 }, { 1, 30, 0 }, { -3, 49, 0 },
+    { -30, 55, 0 }, { 11, 54, 0 }, { 13, 30, 0 }, { 4, 31, 0 }, { 3, 29, 0 }, { 93, 51, 0 },
+    { -11, 53, 0 }, { 62, 54, 0 }, { -21, 55, 0 }, { 1, 32, 0 }, { -2, 53, 0 }, { -4, 56, 0 },
+    { 45, 47, 0 }, { -84, 52, 0 }, { -24, 56, 0 }, { 58, 48, 0 }, { -34, 55, 0 }, { 85, 57, 0 },
+    { 86, 54, 0 }, { 90, 51, 0 }, { 1, 31, 0 }, { -66, 52, 0 }, { 1, 29, 0 }, { 1, 29, 0 },
+    { -63, 52, 0 }, { 32767, 0, 0 }, { -99, 52, 0 }, { 32767, 0, 0 }, { 30, 54, 0 }, { 1, 29, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 82, 57, 0 }, { -26, 56, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 87, 57, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 0, 43, 0 }, { -26, 53, 0 }, { 15, 47, 0 }, { 32767, 0, 0 }, { 95, 51, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 68, 54, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { -19, 46, 0 }, { 1, 31, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 5, 47, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    /* Tree 14 */
+    { 31, 53, 0 }, { -4, 53, 0 }, { 39, 53, 0 }, { 68, 54, 0 }, { -51, 55, 0 }, { 11, 32, 0 },
+    { -35, 55, 0 }, { -81, 46, 0 }, { -21, 52, 0 }, { -84, 52, 0 }, { 17, 31, 0 }, { 1, 32, 0 },
+    { 3, 29, 0 }, { -73, 52, 0 }, { 1, 30, 0 }, { 11, 48, 0 }, { -69, 52, 0 }, { 10, 30, 0 },
+    { 95, 51, 0 }, { 62, 51, 0 }, { -56, 55, 0 }, { 67, 54, 0 }, { 73, 48, 0 }, { -81, 52, 0 },
+    { -84, 52, 0 }, { 16, 31, 0 }, { -45, 55, 0 }, { 16, 31, 0 }, { 42, 53, 0 }, { 40, 53, 0 },
+    { -20, 56, 0 }, { -99, 52, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 0, 32, 0 }, { 11, 49, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 55, 54, 0 }, { 32767, 0, 0 }, { 86, 57, 0 }, { 32767, 0, 0 }, { -31, 55, 0 }, { 0, 45, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 33, 53, 0 }, { 34, 53, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 1, 32, 0 }, { -24, 56, 0 }, { -53, 55, 0 }, { 32767, 0, 0 },
+    { -19, 55, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 1, 31, 0 }, { -18, 52, 0 }, { 1, 31, 0 },
+    { 1, 31, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    /* Tree 15 */
+    { 13, 32, 0 }, { 58, 54, 0 }, { 85, 57, 0 }, { 35, 53, 0 }, { 94, 57, 0 }, { -2, 53, 0 },
+    { 15, 30, 0 }, { 1, 31, 0 }, { -55, 55, 0 }, { 10, 30, 0 }, { 64, 48, 0 }, { 9, 54, 0 },
+    { -56, 55, 0 }, { 61, 54, 0 }, { 86, 54, 0 }, { 0, 34, 0 }, { 1, 29, 0 }, { -57, 55, 0 },
+    { -79, 52, 0 }, { -9, 53, 0 }, { -73, 52, 0 }, { -60, 52, 0 }, { 1, 31, 0 }, { -99, 52, 0 },
+    { -28, 49, 0 }, { 59, 54, 0 }, { 80, 51, 0 }, { 11, 29, 0 }, { 68, 54, 0 }, { -8, 47, 0 },
+    { 16, 32, 0 }, { 46, 54, 0 }, { 30, 53, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 1, 30, 0 }, { 18, 31, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 42, 48, 0 }, { 36, 53, 0 }, { 95, 57, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 39, 57, 0 }, { 32767, 0, 0 }, { 14, 32, 0 }, { 32767, 0, 0 }, { 42, 53, 0 },
+    { 32767, 0, 0 }, { 1, 29, 0 }, { 32767, 0, 0 }, { -45, 55, 0 }, { 49, 47, 0 }, { 32767, 0, 0 },
+    { 3, 29, 0 }, { 93, 57, 0 }, { 93, 57, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 94, 57, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 },
+    { 32767, 0, 0 }, { 32767, 0, 0 }, { 32767, 0, 0 }
+} ;
+
+static const uint8_t forestLeaves[FOREST_TREES * FOREST_LEAVES] = {
+    /* Tree 0 */
+    6, 6, 6, 6, 6, 6, 6, 6, 15, 15, 15, 15, 15, 15, 15, 15,
+    9, 9, 9, 9, 8, 8, 8, 8, 11, 11, 11, 11, 11, 11, 11, 11,
+    20, 20, 20, 20, 20, 20, 20, 20, 19, 19, 19, 19, 19, 19, 19, 19,
+    7, 7, 7, 7, 7, 7, 7, 7, 18, 18, 18, 18, 26, 26, 26, 26,
+    17, 17, 17, 17, 17, 17, 17, 17, 14, 14, 14, 14, 31, 31, 31, 31,
+    16, 16, 16, 16, 16, 16, 16, 16, 21, 21, 21, 21, 21, 21, 21, 21,
+    22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 13, 13, 13, 13,
+    14, 14, 14, 14, 10, 10, 10, 10, 30, 30, 30, 30, 30, 30, 30, 30,
+    39, 39, 39, 39, 39, 39, 39, 39, 23, 23, 23, 23, 25, 25, 25, 25,
+    40, 40, 40, 40, 40, 40, 40, 40, 27, 27, 27, 27, 28, 28, 28, 28,
+    38, 38, 38, 38, 38, 38, 38, 38, 37, 37, 37, 37, 37, 37, 37, 37,
+    5, 5, 0, 0, 5, 0, 5, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 36, 36, 36, 36,
+    3, 3, 3, 3, 1, 1, 1, 1, 24, 24, 24, 24, 24, 24, 24, 24,
+    35, 35, 35, 35, 35, 35, 35, 35, 29, 29, 29, 29, 29, 29, 29, 29,
+    32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 34, 34, 34, 34,
+    /* Tree 1 */
+    20, 20, 20, 20, 18, 18, 18, 18, 15, 15, 15, 15, 19, 19, 19, 19,
+    9, 9, 9, 9, 9, 9, 9, 9, 8, 8, 8, 8, 8, 8, 8, 8,
+    21, 21, 21, 21, 21, 21, 21, 21, 6, 6, 6, 6, 6, 6, 6, 6,
+    16, 16, 16, 16, 17, 17, 17, 17, 31, 31, 31, 31, 31, 31, 31, 31,
+    11, 11, 11, 11, 11, 11, 11, 11, 7, 7, 7, 7, 10, 10, 10, 10,
+    12, 12, 12, 12, 30, 30, 30, 30, 14, 14, 14, 14, 14, 14, 14, 14,
+    22, 22, 22, 22, 22, 22, 22, 22, 13, 13, 13, 13, 13, 13, 13, 13,
+    39, 39, 39, 39, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1,
+    34, 34, 34, 34, 34, 34, 34, 34, 2, 2, 2, 2, 32, 32, 32, 32,
+    28, 28, 28, 28, 28, 28, 28, 28, 33, 33, 33, 33, 33, 33, 33, 33,
+    36, 36, 36, 36, 36, 36, 36, 36, 26, 26, 26, 26, 26, 26, 26, 26,
+    35, 35, 35, 35, 35, 35, 35, 35, 24, 24, 24, 24, 24, 24, 24, 24,
+    29, 29, 29, 29, 29, 29, 29, 29, 40, 40, 40, 40, 38, 38, 38, 38,
+    37, 37, 37, 37, 23, 23, 23, 23, 25, 25, 25, 25, 25, 25, 25, 25,
+    5, 5, 5, 5, 0, 0, 0, 0, 27, 27, 27, 27, 27, 27, 27, 27,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    /* Tree 2 */
+    15, 15, 15, 15, 9, 9, 9, 9, 6, 6, 6, 6, 6, 6, 6, 6,
+    7, 7, 7, 7, 7, 7, 7, 7, 11, 11, 11, 11, 7, 7, 7, 7,
+    20, 20, 20, 20, 8, 8, 8, 8, 19, 19, 18, 18, 18, 18, 26, 26,
+    20, 20, 20, 20, 8, 8, 8, 8, 19, 19, 19, 19, 18, 18, 26, 26,
+    31, 31, 31, 31, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17,
+    30, 30, 30, 30, 30, 30, 30, 30, 21, 21, 21, 21, 21, 21, 21, 21,
+    10, 10, 10, 10, 10, 10, 10, 10, 14, 14, 14, 14, 12, 12, 12, 12,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 13, 13, 13, 13,
+    3, 3, 3, 3, 3, 3, 3, 3, 39, 39, 39, 39, 39, 39, 39, 39,
+    28, 28, 28, 28, 28, 28, 28, 28, 23, 23, 23, 23, 23, 23, 23, 23,
+    27, 27, 27, 27, 40, 40, 40, 40, 5, 0, 5, 0, 5, 0, 5, 0,
+    38, 38, 38, 38, 37, 37, 37, 37, 4, 4, 4, 4, 4, 4, 4, 4,
+    35, 35, 35, 35, 35, 35, 35, 35, 29, 29, 29, 29, 29, 29, 29, 29,
+    25, 25, 25, 25, 25, 25, 25, 25, 1, 1, 1, 1, 2, 2, 2, 2,
+    24, 24, 24, 24, 24, 24, 24, 24, 33, 33, 33, 33, 33, 33, 33, 33,
+    36, 36, 36, 36, 32, 32, 32, 32, 34, 34, 34, 34, 34, 34, 34, 34,
+    /* Tree 3 */
+    9, 9, 9, 9, 6, 6, 6, 6, 20, 20, 20, 20, 20, 20, 20, 20,
+    7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8,
+    39, 39, 39, 39, 16, 16, 16, 16, 3, 3, 3, 3, 1, 1, 1, 1,
+    31, 31, 31, 31, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    17, 17, 17, 17, 21, 21, 21, 21, 18, 18, 18, 18, 18, 18, 18, 18,
+    13, 13, 13, 13, 13, 13, 13, 13, 22, 22, 22, 22, 10, 10, 10, 10,
+    11, 11, 11, 11, 11, 11, 11, 11, 15, 15, 15, 15, 15, 15, 15, 15,
+    12, 12, 12, 12, 12, 12, 12, 12, 19, 19, 19, 19, 14, 14, 14, 14,
+    29, 29, 29, 29, 29, 29, 29, 29, 2, 2, 2, 2, 2, 2, 2, 2,
+    33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 32, 32, 32, 32,
+    5, 0, 0, 0, 5, 5, 5, 5, 5, 5, 0, 0, 5, 0, 0, 0,
+    27, 27, 27, 27, 27, 27, 27, 27, 4, 4, 4, 4, 4, 4, 4, 4,
+    26, 26, 26, 26, 26, 26, 26, 26, 23, 23, 23, 23, 23, 23, 23, 23,
+    35, 35, 35, 35, 36, 36, 36, 36, 24, 24, 24, 24, 24, 24, 24, 24,
+    40, 40, 40, 40, 28, 28, 28, 28, 38, 38, 38, 38, 38, 38, 38, 38,
+    25, 25, 25, 25, 25, 25, 25, 25, 37, 37, 37, 37, 37, 37, 37, 37,
+    /* Tree 4 */
+    16, 16, 16, 16, 16, 16, 16, 16, 20, 20, 20, 20, 20, 20, 20, 20,
+    17, 17, 17, 17, 17, 17, 17, 17, 21, 21, 21, 21, 18, 18, 18, 18,
+    9, 9, 9, 9, 9, 9, 9, 9, 8, 8, 8, 8, 8, 8, 8, 8,
+    19, 19, 19, 19, 6, 6, 6, 6, 15, 15, 15, 15, 15, 15, 15, 15,
+    23, 23, 23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 25, 25, 25, 25,
+    12, 12, 12, 12, 12, 12, 12, 12, 7, 7, 7, 7, 7, 7, 7, 7,
+    14, 14, 14, 14, 14, 14, 14, 14, 10, 10, 10, 10, 11, 11, 11, 11,
+    13, 13, 13, 13, 22, 22, 13, 13, 26, 26, 26, 26, 26, 26, 26, 26,
+    3, 3, 3, 3, 1, 1, 1, 1, 39, 39, 39, 39, 39, 39, 39, 39,
+    24, 24, 24, 24, 24, 24, 24, 24, 35, 35, 35, 35, 28, 28, 28, 28,
+    30, 30, 30, 30, 30, 30, 30, 30, 36, 36, 36, 36, 36, 36, 36, 36,
+    31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 34, 34, 34, 34,
+    2, 2, 2, 2, 29, 29, 29, 29, 33, 33, 33, 33, 33, 33, 33, 33,
+    40, 40, 40, 40, 38, 38, 38, 38, 37, 37, 37, 37, 37, 37, 37, 37,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    5, 5, 5, 5, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    /* Tree 5 */
+    28, 28, 28, 28, 28, 28, 28, 28, 40, 40, 40, 40, 40, 40, 40, 40,
+    39, 39, 39, 39, 39, 39, 39, 39, 27, 27, 27, 27, 27, 27, 27, 27,
+    0, 0, 5, 0, 5, 5, 5, 0, 5, 5, 5, 5, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 3,
+    16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 20, 20, 20, 20,
+    21, 21, 21, 21, 9, 9, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11,
+    38, 38, 38, 38, 38, 38, 38, 38, 23, 23, 23, 23, 37, 37, 37, 37,
+    22, 22, 22, 22, 22, 22, 22, 22, 25, 25, 25, 25, 23, 23, 25, 37,
+    7, 7, 7, 7, 6, 6, 6, 6, 15, 15, 15, 15, 8, 8, 8, 8,
+    13, 13, 12, 12, 31, 31, 31, 31, 19, 19, 19, 19, 30, 30, 30, 30,
+    26, 26, 36, 36, 1, 1, 1, 1, 2, 2, 2, 2, 24, 24, 24, 24,
+    35, 35, 35, 35, 33, 33, 33, 33, 29, 29, 29, 29, 34, 34, 32, 32,
+    18, 15, 13, 13, 18, 18, 18, 18, 12, 12, 12, 12, 12, 12, 12, 12,
+    19, 19, 19, 19, 14, 14, 14, 14, 10, 10, 10, 10, 10, 10, 10, 10,
+    7, 7, 8, 8, 26, 26, 26, 26, 24, 24, 24, 24, 24, 24, 24, 24,
+    2, 33, 35, 1, 30, 30, 30, 30, 34, 34, 34, 34, 32, 32, 32, 32,
+    /* Tree 6 */
+    6, 6, 6, 6, 6, 6, 6, 6, 8, 8, 8, 8, 8, 8, 8, 8,
+    17, 17, 17, 17, 7, 7, 7, 7, 16, 16, 16, 16, 17, 17, 7, 7,
+    21, 21, 21, 21, 20, 20, 20, 20, 9, 9, 9, 9, 9, 9, 9, 9,
+    30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31,
+    19, 19, 19, 19, 11, 11, 11, 11, 15, 15, 15, 15, 15, 15, 15, 15,
+    13, 13, 13, 13, 12, 12, 12, 12, 22, 22, 22, 22, 22, 22, 22, 22,
+    18, 18, 18, 18, 18, 18, 18, 18, 26, 26, 26, 26, 26, 26, 26, 26,
+    10, 10, 10, 10, 10, 10, 10, 10, 14, 14, 14, 14, 14, 14, 14, 14,
+    28, 28, 28, 28, 36, 36, 36, 36, 1, 1, 1, 1, 1, 1, 1, 1,
+    23, 23, 25, 25, 24, 24, 24, 24, 3, 3, 3, 3, 3, 3, 3, 3,
+    29, 29, 29, 29, 35, 35, 35, 35, 34, 34, 34, 34, 32, 32, 32, 32,
+    2, 2, 2, 2, 2, 2, 2, 2, 33, 33, 33, 33, 32, 32, 32, 32,
+    40, 40, 40, 40, 28, 28, 28, 28, 39, 39, 39, 39, 27, 27, 27, 27,
+    5, 5, 5, 5, 0, 0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 5,
+    4, 4, 4, 4, 4, 4, 4, 4, 38, 38, 38, 38, 38, 38, 38, 38,
+    23, 23, 23, 23, 24, 24, 25, 25, 37, 37, 37, 37, 37, 37, 37, 37,
+    /* Tree 7 */
+    8, 8, 8, 8, 7, 7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6,
+    16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 11, 11, 8, 8,
+    40, 40, 40, 40, 39, 39, 39, 39, 23, 23, 23, 23, 23, 23, 23, 23,
+    22, 22, 22, 22, 13, 13, 22, 22, 3, 3, 3, 3, 3, 3, 3, 3,
+    5, 5, 5, 5, 0, 0, 0, 0, 27, 27, 27, 27, 27, 27, 27, 27,
+    4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 29,
+    1, 1, 1, 1, 2, 2, 2, 2, 33, 33, 33, 33, 38, 38, 38, 38,
+    32, 32, 32, 32, 34, 34, 34, 34, 37, 37, 37, 37, 37, 37, 37, 37,
+    28, 28, 28, 28, 28, 28, 28, 28, 20, 20, 20, 20, 20, 20, 20, 20,
+    9, 9, 9, 9, 9, 9, 9, 9, 21, 21, 21, 21, 25, 25, 25, 25,
+    30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31,
+    36, 36, 36, 36, 36, 36, 36, 36, 35, 35, 35, 35, 35, 35, 35, 35,
+    15, 15, 15, 15, 15, 15, 15, 15, 19, 19, 19, 19, 18, 18, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 18, 18, 18, 18, 15, 15, 19, 19,
+    12, 12, 12, 12, 12, 12, 12, 12, 14, 14, 14, 14, 14, 14, 14, 14,
+    24, 24, 24, 24, 24, 24, 24, 24, 26, 26, 26, 26, 26, 26, 26, 26,
+    /* Tree 8 */
+    20, 20, 20, 20, 9, 9, 9, 9, 6, 6, 6, 6, 6, 6, 6, 6,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8,
+    17, 17, 17, 17, 17, 17, 17, 17, 21, 21, 21, 21, 16, 16, 16, 16,
+    24, 24, 24, 24, 24, 24, 24, 24, 23, 23, 23, 23, 25, 25, 25, 25,
+    10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 13, 13, 22, 22, 22, 22,
+    11, 11, 11, 11, 11, 11, 11, 11, 15, 15, 15, 15, 15, 15, 15, 15,
+    18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 26, 26, 26, 26,
+    12, 12, 12, 12, 19, 19, 14, 14, 26, 26, 12, 12, 14, 14, 14, 14,
+    3, 3, 3, 3, 3, 3, 3, 3, 36, 36, 36, 36, 30, 30, 30, 30,
+    39, 39, 39, 39, 39, 39, 39, 39, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 40, 40, 40, 40, 38, 38, 38, 38,
+    33, 33, 33, 33, 33, 33, 33, 33, 31, 31, 31, 31, 31, 31, 31, 31,
+    5, 0, 5, 0, 5, 5, 0, 5, 27, 27, 27, 27, 27, 27, 27, 27,
+    34, 34, 34, 34, 34, 34, 34, 34, 4, 4, 4, 4, 4, 4, 4, 4,
+    35, 35, 35, 35, 35, 35, 35, 35, 32, 32, 32, 32, 37, 37, 37, 37,
+    28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29,
+    /* Tree 9 */
+    16, 16, 16, 16, 16, 16, 16, 16, 20, 20, 20, 20, 6, 6, 6, 6,
+    21, 21, 21, 21, 21, 21, 21, 21, 17, 17, 17, 17, 17, 17, 17, 17,
+    9, 9, 9, 9, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8,
+    23, 23, 23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 25, 25, 25, 25,
+    10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 13, 13, 22, 22, 22, 22,
+    11, 11, 11, 11, 11, 11, 11, 11, 15, 15, 15, 15, 15, 15, 15, 15,
+    18, 18, 18, 18, 18, 18, 18, 18, 26, 26, 26, 26, 19, 19, 19, 19,
+    19, 19, 19, 19, 12, 12, 12, 12, 14, 14, 14, 14, 14, 14, 14, 14,
+    3, 3, 3, 3, 1, 1, 1, 1, 39, 39, 39, 39, 39, 39, 39, 39,
+    31, 31, 31, 31, 31, 31, 31, 31, 30, 30, 30, 30, 30, 30, 30, 30,
+    36, 36, 36, 36, 36, 36, 36, 36, 32, 32, 32, 32, 28, 28, 28, 28,
+    35, 35, 35, 35, 24, 24, 24, 24, 34, 34, 34, 34, 34, 34, 34, 34,
+    27, 27, 27, 27, 27, 27, 27, 27, 2, 2, 2, 2, 2, 2, 2, 2,
+    5, 5, 0, 0, 0, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+    33, 33, 33, 33, 33, 33, 33, 33, 29, 29, 29, 29, 29, 29, 29, 29,
+    38, 38, 37, 40, 38, 38, 37, 37, 40, 40, 40, 40, 38, 38, 37, 37,
+    /* Tree 10 */
+    5, 5, 0, 5, 5, 0, 0, 5, 5, 5, 5, 5, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 27, 27, 27, 27, 27, 27, 27, 27,
+    6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7,
+    29, 29, 29, 29, 29, 29, 29, 29, 3, 3, 3, 3, 3, 3, 3, 3,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    22, 22, 22, 22, 11, 11, 11, 11, 9, 9, 9, 9, 9, 9, 9, 9,
+    15, 15, 15, 15, 15, 15, 15, 15, 2, 2, 2, 2, 2, 2, 2, 2,
+    32, 32, 32, 32, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33,
+    21, 21, 21, 21, 20, 20, 20, 20, 16, 16, 16, 16, 16, 16, 16, 16,
+    18, 18, 18, 18, 18, 18, 18, 18, 13, 13, 10, 10, 10, 10, 10, 10,
+    19, 19, 19, 19, 19, 19, 19, 19, 8, 8, 8, 8, 31, 31, 31, 31,
+    12, 12, 12, 12, 14, 14, 14, 14, 30, 30, 30, 30, 30, 30, 30, 30,
+    39, 39, 39, 39, 28, 28, 28, 28, 40, 40, 40, 40, 40, 40, 40, 40,
+    36, 36, 36, 36, 36, 36, 36, 36, 35, 35, 35, 35, 35, 35, 35, 35,
+    1, 1, 1, 1, 23, 23, 23, 23, 38, 38, 38, 38, 37, 37, 37, 37,
+    25, 25, 25, 25, 25, 25, 25, 25, 24, 24, 24, 24, 26, 26, 26, 26,
+    /* Tree 11 */
+    16, 16, 16, 16, 16, 16, 16, 16, 15, 15, 15, 15, 17, 17, 17, 17,
+    21, 21, 21, 21, 21, 21, 21, 21, 20, 20, 20, 20, 20, 20, 20, 20,
+    18, 18, 18, 18, 18, 18, 18, 18, 13, 13, 13, 13, 13, 13, 13, 13,
+    10, 10, 10, 10, 10, 10, 10, 10, 22, 22, 22, 22, 10, 10, 10, 10,
+    9, 9, 9, 9, 9, 9, 9, 9, 19, 19, 19, 19, 6, 6, 6, 6,
+    8, 8, 8, 8, 8, 8, 8, 8, 31, 31, 31, 31, 31, 31, 31, 31,
+    7, 7, 7, 7, 12, 12, 12, 12, 30, 30, 30, 30, 30, 30, 30, 30,
+    11, 11, 11, 11, 14, 14, 14, 14, 26, 26, 26, 26, 26, 26, 26, 26,
+    1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 3, 39, 39, 39, 39,
+    2, 2, 2, 2, 36, 36, 36, 36, 24, 24, 24, 24, 24, 24, 24, 24,
+    34, 34, 32, 32, 33, 33, 33, 33, 34, 34, 34, 34, 32, 32, 32, 32,
+    28, 28, 28, 28, 28, 28, 28, 28, 35, 35, 35, 35, 35, 35, 35, 35,
+    5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29, 27, 27, 27, 27,
+    23, 23, 23, 23, 23, 23, 23, 23, 40, 40, 40, 40, 25, 25, 25, 25,
+    38, 38, 38, 38, 38, 38, 38, 38, 37, 37, 37, 37, 37, 37, 37, 37,
+    /* Tree 12 */
+    20, 20, 20, 20, 21, 21, 21, 21, 16, 16, 16, 16, 16, 16, 16, 16,
+    17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 15, 15, 15, 15,
+    19, 19, 19, 19, 19, 19, 19, 19, 9, 9, 9, 9, 9, 9, 9, 9,
+    6, 6, 6, 6, 6, 6, 6, 6, 31, 31, 31, 31, 8, 8, 8, 8,
+    22, 22, 22, 22, 22, 22, 22, 22, 13, 13, 13, 13, 13, 13, 13, 13,
+    7, 7, 7, 7, 7, 7, 7, 7, 11, 11, 11, 11, 11, 11, 11, 11,
+    30, 30, 30, 30, 30, 30, 30, 30, 26, 26, 26, 26, 26, 26, 26, 26,
+    10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 14, 14, 14, 14,
+    39, 39, 39, 39, 23, 23, 23, 23, 40, 40, 40, 40, 40, 40, 40, 40,
+    28, 28, 28, 28, 28, 28, 28, 28, 27, 27, 27, 27, 27, 27, 27, 27,
+    3, 3, 3, 3, 3, 3, 3, 3, 25, 25, 25, 25, 25, 25, 25, 25,
+    1, 1, 1, 1, 24, 24, 24, 24, 36, 36, 36, 36, 36, 36, 36, 36,
+    2, 2, 2, 2, 2, 2, 2, 2, 32, 32, 32, 32, 33, 33, 33, 33,
+    35, 35, 35, 35, 35, 35, 35, 35, 38, 38, 38, 38, 38, 38, 38, 38,
+    5, 5, 5, 5, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    29, 29, 29, 29, 34, 34, 34, 34, 37, 37, 37, 37, 37, 37, 37, 37,
+    /* Tree 13 */
+    20, 20, 20, 20, 20, 20, 20, 20, 16, 16, 16, 16, 21, 21, 21, 21,
+    17, 17, 17, 17, 17, 17, 17, 17, 19, 19, 19, 19, 12, 12, 12, 12,
+    22, 22, 22, 22, 15, 15, 15, 15, 18, 18, 18, 18, 18, 18, 18, 18,
+    10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 13, 13, 14, 14, 14, 14,
+    6, 6, 6, 6, 9, 9, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11,
+    3, 3, 3, 3, 3, 3, 3, 3, 7, 7, 7, 7, 7, 7, 7, 7,
+    8, 8, 8, 8, 1, 1, 1, 1, 39, 39, 39, 39, 39, 39, 39, 39,
+    30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31,
+    23, 23, 23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 24, 24, 24, 24,
+    40, 40, 40, 40, 25, 25, 25, 25, 38, 38, 38, 38, 37, 37, 37, 37,
+    28, 28, 28, 28, 28, 28, 28, 28, 5, 5, 0, 5, 5, 5, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 27, 27, 27, 27, 27, 27, 27, 27,
+    36, 36, 36, 36, 36, 36, 36, 36, 26, 26, 26, 26, 26, 26, 26, 26,
+    2, 2, 2, 2, 2, 2, 2, 2, 24, 24, 24, 24, 24, 24, 24, 24,
+    33, 33, 33, 33, 33, 33, 33, 33, 35, 35, 35, 35, 35, 35, 35, 35,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 34, 34, 34, 29, 29, 29, 29,
+    /* Tree 14 */
+    16, 16, 16, 16, 21, 21, 21, 21, 20, 20, 20, 20, 20, 20, 20, 20,
+    39, 39, 39, 39, 39, 39, 39, 39, 28, 28, 28, 28, 28, 28, 28, 28,
+    27, 27, 27, 27, 27, 27, 27, 27, 40, 40, 40, 40, 40, 40, 40, 40,
+    5, 5, 0, 0, 5, 5, 0, 0, 5, 5, 0, 0, 5, 5, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 9, 9, 9, 9, 9, 9, 9, 9,
+    22, 22, 22, 22, 22, 22, 22, 22, 11, 11, 11, 11, 23, 23, 23, 23,
+    3, 3, 3, 3, 3, 3, 3, 3, 25, 25, 25, 25, 4, 4, 4, 4,
+    25, 25, 25, 25, 25, 25, 25, 25, 38, 38, 38, 38, 37, 37, 37, 37,
+    8, 8, 8, 8, 15, 15, 15, 15, 7, 7, 7, 7, 7, 7, 7, 7,
+    6, 6, 6, 6, 6, 6, 6, 6, 29, 29, 29, 29, 29, 29, 29, 29,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 13, 13, 13, 13,
+    10, 10, 10, 10, 24, 24, 24, 24, 35, 35, 35, 35, 35, 35, 35, 35,
+    18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 12, 12, 12, 12,
+    36, 36, 36, 36, 12, 12, 12, 12, 14, 14, 14, 14, 26, 26, 26, 26,
+    33, 33, 33, 33, 33, 33, 33, 33, 32, 32, 32, 32, 34, 34, 34, 34,
+    30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31,
+    /* Tree 15 */
+    8, 8, 8, 8, 11, 11, 11, 11, 9, 9, 9, 9, 8, 8, 8, 8,
+    7, 7, 7, 7, 7, 7, 7, 7, 20, 20, 20, 20, 20, 20, 20, 20,
+    18, 18, 18, 18, 18, 18, 18, 18, 15, 15, 15, 15, 15, 15, 15, 15,
+    6, 6, 6, 6, 19, 19, 19, 19, 26, 26, 26, 26, 12, 12, 12, 12,
+    27, 27, 27, 27, 27, 27, 27, 27, 2, 2, 2, 2, 2, 2, 2, 2,
+    13, 13, 13, 13, 13, 13, 13, 13, 36, 36, 36, 36, 36, 36, 36, 36,
+    32, 32, 32, 32, 34, 34, 34, 34, 29, 29, 29, 29, 33, 33, 33, 33,
+    5, 5, 5, 5, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 21, 21, 21, 21, 21, 21, 21, 21,
+    17, 17, 17, 17, 39, 39, 39, 39, 28, 28, 28, 28, 28, 28, 28, 28,
+    13, 13, 13, 13, 10, 10, 10, 10, 22, 22, 22, 22, 22, 22, 22, 22,
+    12, 12, 12, 12, 14, 14, 14, 14, 23, 23, 23, 23, 23, 23, 23, 23,
+    32, 32, 32, 32, 31, 31, 31, 31, 30, 30, 30, 30, 30, 30, 30, 30,
+    24, 24, 24, 24, 3, 3, 3, 3, 25, 25, 25, 25, 2, 2, 33, 33,
+    40, 40, 40, 40, 40, 40, 40, 40, 1, 1, 1, 1, 35, 35, 35, 35,
+    38, 38, 38, 38, 37, 37, 37, 37, 38, 38, 38, 38, 37, 37, 37, 37
+} ;
+
+const ForestModel gestureForestModel = { 41, forestText, forestNodes, forestLeaves } ;
@@ -0,0 +1,943 @@
+/***********GestureIndex.cpp*********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The Add(), Build(), Clear(), Save(), Load(), Match(), both Nearest(),
+            MakeKey(), and HandKey() functions are defined in this module.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <algorithm>
+#include <map>
+#include <string.h>
+#include <stdio.h>
+#include <climits>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "GestureIndex.h"
+#include "../microcontroller/sensor_frame.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#define KEY_HAND_BIT   13   /* Bit used to store the hand. Bits 0-12 store the contact sensors. */
+#define KEY_FLEX_SHIFT 16   /* Bit position of the first flex sensor value. */
+#define KEY_FLEX_BITS   8   /* Number of bits per flex sensor value. */
+#define KEY_FLEX_MAX  255   /* Largest flex sensor value that can be stored in the key. */
+#define INVALID_KEY (~(uint64_t)0)  /* Key of a gesture that can not be matched exactly. Bits 14-15 are never set by MakeKey(). */
+
+/*----------entry_less( )------------------------------------------------------------
+
+  PURPOSE:  Order gestures by the hands they use, two-handed gestures first, then by
+            key, then by text. Among gestures with the same keys this matches the
+            "ORDER BY gest" used when the database was queried directly.
+
+-----------------------------------------------------------------------------------*/
+
+static bool entry_less( const GestureEntry &a, const GestureEntry &b ){
+
+    if( a.hands != b.hands )
+        return a.hands > b.hands ;
+    if( a.key[INDEX_RIGHT] != b.key[INDEX_RIGHT] )
+        return a.key[INDEX_RIGHT] < b.key[INDEX_RIGHT] ;
+    if( a.key[INDEX_LEFT] != b.key[INDEX_LEFT] )
+        return a.key[INDEX_LEFT] < b.key[INDEX_LEFT] ;
+    return a.gest < b.gest ;
+
+}
+
+/*----------merge_hand( )------------------------------------------------------------
+
+  PURPOSE:  Copy one hand of a gesture into another gesture, making it a two-handed
+            gesture.
+
+  INPUT  PARAMETERS:  from -- the gesture holding the hand.
+                      side -- the position of the hand.
+
+  OUTPUT PARAMETERS:  to   -- the gesture to add the hand to.
+
+-----------------------------------------------------------------------------------*/
+
+static void merge_hand( GestureEntry &to, const GestureEntry &from, unsigned int side ){
+
+    uint32_t sigMask = (uint32_t)0xFFFF << (side * INDEX_SIG_SHIFT) ;   /* The contact sensors of the hand. */
+
+    to.key[side] = from.key[side] ;
+    to.hands |= from.hands ;
+    to.signature = (to.signature & ~sigMask) | (from.signature & sigMask) ;
+    memcpy( &to.flex[side * INDEX_NUM_FLEX], &from.flex[side * INDEX_NUM_FLEX], INDEX_NUM_FLEX ) ;
+    memcpy( to.lsm303[side], from.lsm303[side], sizeof(to.lsm303[side]) ) ;
+    memcpy( to.lsm9dof[side], from.lsm9dof[side], sizeof(to.lsm9dof[side]) ) ;
+
+    return ;
+
+}
+
+/*----------file_align( )------------------------------------------------------------
+
+  PURPOSE:  Round an offset within a compiled gesture file up to the next section.
+
+-----------------------------------------------------------------------------------*/
+
+static inline uint32_t file_align( size_t offset ){
+
+    return (uint32_t)(((offset + INDEX_FILE_ALIGN - 1) / INDEX_FILE_ALIGN) * INDEX_FILE_ALIGN) ;
+
+}
+
+/*----------valid_header( )----------------------------------------------------------
+
+  PURPOSE:  Check that a compiled gesture file was written with the same layout as
+            this program uses, and that every section lies within the file, in order.
+
+  INPUT  PARAMETERS:  header -- the header of the file.
+                      size   -- the size of the file.
+
+  RETURN VALUE:  true if the header can be trusted
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+static bool valid_header( const IndexFileHeader &header, size_t size ){
+
+    uint64_t padded = (((uint64_t)header.count + INDEX_BLOCK - 1) / INDEX_BLOCK) * INDEX_BLOCK ;  /* The expected padded count. */
+
+    return (header.magic == INDEX_FILE_MAGIC) && (header.version == INDEX_FILE_VERSION) &&
+           (header.headerSize == sizeof(IndexFileHeader)) && (header.recordSize == sizeof(IndexFileRecord)) &&
+           (header.flexLen == FLEX_VECTOR_LEN) && (header.block == INDEX_BLOCK) && (header.padded == padded) &&
+           (header.fileSize == size) &&
+           ((header.flexOffset % INDEX_FILE_ALIGN) == 0) && ((header.sigOffset % INDEX_FILE_ALIGN) == 0) &&
+           ((header.handOffset % INDEX_FILE_ALIGN) == 0) && ((header.recordOffset % INDEX_FILE_ALIGN) == 0) &&
+           (header.flexOffset >= sizeof(IndexFileHeader)) &&
+           ((header.flexOffset + (padded * FLEX_VECTOR_LEN)) <= header.sigOffset) &&
+           ((header.sigOffset + (padded * sizeof(uint32_t))) <= header.handOffset) &&
+           ((header.handOffset + padded) <= header.recordOffset) &&
+           ((header.recordOffset + ((uint64_t)header.count * sizeof(IndexFileRecord))) <= header.textOffset) &&
+           (header.textOffset <= header.fileSize) ;
+
+}
+
+/*----------GestureIndex::GestureIndex( )--------------------------------------------
+
+  PURPOSE:  Create an empty index.
+
+-----------------------------------------------------------------------------------*/
+
+GestureIndex::GestureIndex( ) : sorted(true), flexScan(NULL), sigScan(NULL), handScan(NULL), scanLen(0),
+                                mapping(NULL), mappingLen(0) {
+
+}
+
+/*----------GestureIndex::~GestureIndex( )-------------------------------------------
+
+  PURPOSE:  Unmap the compiled gesture file, if one was loaded.
+
+-----------------------------------------------------------------------------------*/
+
+GestureIndex::~GestureIndex( ){
+
+    Unmap() ;
+
+}
+
+/*----------GestureIndex::MakeKey( )-------------------------------------------------
+
+  PURPOSE:  Pack a hand, its flex sensor values, and its contact sensor values into a
+            single key. Contact sensors are packed in the same order as
+            Hand::ContactSignature().
+
+  INPUT  PARAMETERS:  rightHand -- true for the right hand, false for the left hand.
+                      flex      -- the index, middle, ring, and pinky flex values.
+                      contact   -- the contact sensor values.
+
+  OUTPUT PARAMETERS:  key       -- the packed key.
+
+  RETURN VALUE:  true if the values could be packed
+                 false if a flex value is not a whole number in the range 0-255.
+
+-----------------------------------------------------------------------------------*/
+
+bool GestureIndex::MakeKey( bool rightHand, const double flex[INDEX_NUM_FLEX], const bool contact[INDEX_NUM_CONTACTS], uint64_t &key ){
+
+    unsigned int i ;   /* An iterator. */
+    double rounded ;   /* The flex value rounded to a whole number. */
+
+    key = 0 ;
+    for( i = 0 ; i < INDEX_NUM_CONTACTS ; i++ ){
+        if( contact[i] )
+            key |= ((uint64_t)1 << i) ;
+    }
+    if( rightHand )
+        key |= ((uint64_t)1 << KEY_HAND_BIT) ;
+    for( i = 0 ; i < INDEX_NUM_FLEX ; i++ ){
+        /* Flex values are quantized by i2c_transfer, so an exact match requires a whole number. */
+        rounded = floor( flex[i] + 0.5 ) ;
+        if( (rounded != flex[i]) || (rounded < 0) || (rounded > KEY_FLEX_MAX) )
+            return false ;
+        key |= ((uint64_t)rounded << (KEY_FLEX_SHIFT + (i * KEY_FLEX_BITS))) ;
+    }
+
+    return true ;
+
+}
+
+/*----------GestureIndex::HandKey( )-------------------------------------------------
+
+  PURPOSE:  Pack the flex and contact sensor values of a "Hand" into a key.
+
+  INPUT  PARAMETERS:  hand      -- the hand to pack.
+                      rightHand -- true for the right hand, false for the left hand.
+
+  OUTPUT PARAMETERS:  key       -- the packed key.
+
+  RETURN VALUE:  true if the values could be packed
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool GestureIndex::HandKey( const Hand &hand, bool rightHand, uint64_t &key ){
+
+    double flex[INDEX_NUM_FLEX] = { hand.Index().Flex(), hand.Middle().Flex(), hand.Ring().Flex(), hand.Pinky().Flex() } ;
+    bool contact[INDEX_NUM_CONTACTS] ;     /* The contact sensor values. */
+    uint16_t sig = hand.ContactSignature() ;
+    unsigned int i ;                       /* An iterator. */
+
+    for( i = 0 ; i < INDEX_NUM_CONTACTS ; i++ ){
+        contact[i] = ((sig >> i) & 0x01) != 0 ;
+    }
+
+    return MakeKey( rightHand, flex, contact, key ) ;
+
+}
+
+/*----------GestureIndex::Add( )-----------------------------------------------------
+
+  PURPOSE:  Add a row of the gesture database to the index. Build() must be called
+            once all rows have been added.
+
+  INPUT  PARAMETERS:  rightHand -- true for the right hand, false for the left hand.
+                      flex      -- the index, middle, ring, and pinky flex values.
+                      contact   -- the contact sensor values.
+                      lsm303    -- the LSM303 accelerometer values.
+                      lsm9dof   -- the LSM9DOF accelerometer values.
+                      gest      -- the text that corresponds to the gesture.
+
+-----------------------------------------------------------------------------------*/
+
+void GestureIndex::Add( bool rightHand, const double flex[INDEX_NUM_FLEX], const bool contact[INDEX_NUM_CONTACTS],
+                        const double lsm303[INDEX_NUM_LSM303][INDEX_LSM303_VALS],
+                        const double lsm9dof[INDEX_NUM_LSM9DOF][INDEX_LSM9DOF_VALS], const string &gest ){
+
+    GestureEntry entry ;                                      /* The next gesture to add. */
+    unsigned int side = rightHand ? INDEX_RIGHT : INDEX_LEFT ;  /* Position of the hand within the gesture. */
+    unsigned int i ;                                          /* An iterator. */
+    unsigned int j ;                                          /* An iterator. */
+
+    memset( entry.key, 0, sizeof(entry.key) ) ;
+    memset( entry.flex, 0, sizeof(entry.flex) ) ;
+    memset( entry.lsm303, 0, sizeof(entry.lsm303) ) ;
+    memset( entry.lsm9dof, 0, sizeof(entry.lsm9dof) ) ;
+    if( !MakeKey(rightHand, flex, contact, entry.key[side]) ){
+        /* The gesture can never be matched exactly, but it can still be the nearest gesture. */
+        entry.key[side] = INVALID_KEY ;
+    }
+    for( i = 0 ; i < INDEX_NUM_LSM303 ; i++ ){
+        for( j = 0 ; j < INDEX_LSM303_VALS ; j++ ){
+            entry.lsm303[side][i][j] = lsm303[i][j] ;
+        }
+    }
+    for( i = 0 ; i < INDEX_NUM_LSM9DOF ; i++ ){
+        for( j = 0 ; j < INDEX_LSM9DOF_VALS ; j++ ){
+            entry.lsm9dof[side][i][j] = lsm9dof[i][j] ;
+        }
+    }
+    entry.hands = rightHand ? INDEX_USES_RIGHT : INDEX_USES_LEFT ;
+    entry.signature = 0 ;
+    for( i = 0 ; i < INDEX_NUM_CONTACTS ; i++ ){
+        if( contact[i] )
+            entry.signature |= (uint32_t)1 << ((side * INDEX_SIG_SHIFT) + i) ;
+    }
+    for( i = 0 ; i < INDEX_NUM_FLEX ; i++ ){
+        entry.flex[(side * INDEX_NUM_FLEX) + i] = Hand::QuantizeFlex( flex[i] ) ;
+    }
+    entry.gest = gest ;
+    entries.push_back( entry ) ;
+    sorted = false ;
+
+    return ;
+
+}
+
+/*----------GestureIndex::Build( )---------------------------------------------------
+
+  PURPOSE:  Pair the left and right rows of each two-handed gesture, sort the
+            gestures, and lay out the quantized flex values, contact signatures, and
+            hands of every gesture for the search. The tables are padded to a
+            multiple of INDEX_BLOCK gestures.
+
+-----------------------------------------------------------------------------------*/
+
+void GestureIndex::Build( ){
+
+    map<string, size_t> right ;            /* The right handed gesture not yet paired, by text. */
+    map<string, size_t>::iterator found ;  /* The right handed gesture with the same text as a left handed one. */
+    vector<bool> paired ;                  /* True for the left handed gestures moved into a two-handed one. */
+    vector<GestureEntry> kept ;            /* The gestures left after pairing. */
+    size_t padded ;                        /* Number of gestures rounded up to a whole block. */
+    size_t i ;                             /* An iterator. */
+
+    if( sorted ){
+        return ;
+    }
+    /* A text with both a left and a right row is a two-handed sign. */
+    for( i = 0 ; i < entries.size() ; i++ ){
+        if( entries[i].hands == INDEX_USES_RIGHT )
+            right.insert( make_pair(entries[i].gest, i) ) ;
+    }
+    paired.assign( entries.size(), false ) ;
+    for( i = 0 ; i < entries.size() ; i++ ){
+        if( (entries[i].hands != INDEX_USES_LEFT) || ((found = right.find(entries[i].gest)) == right.end()) )
+            continue ;
+        merge_hand( entries[found->second], entries[i], INDEX_LEFT ) ;
+        right.erase( found ) ;
+        paired[i] = true ;
+    }
+    for( i = 0 ; i < entries.size() ; i++ ){
+        if( !paired[i] )
+            kept.push_back( entries[i] ) ;
+    }
+    entries.swap( kept ) ;
+    stable_sort( entries.begin(), entries.end(), entry_less ) ;
+    padded = ((entries.size() + INDEX_BLOCK - 1) / INDEX_BLOCK) * INDEX_BLOCK ;
+    flexTable.assign( padded * FLEX_VECTOR_LEN, 0 ) ;
+    sigTable.assign( padded / 2, 0 ) ;
+    handTable.assign( padded, 0xFF ) ;
+    for( i = 0 ; i < entries.size() ; i++ ){
+        memcpy( &flexTable[i * FLEX_VECTOR_LEN], entries[i].flex, FLEX_VECTOR_LEN ) ;
+        sigTable[i / 2] |= (uint64_t)entries[i].signature << (32 * (i % 2)) ;
+        handTable[i] = entries[i].hands ;
+    }
+    /* Gestures added after a compiled file was loaded now live in the tables. */
+    Unmap() ;
+    flexScan = flexTable.data() ;
+    sigScan = sigTable.data() ;
+    handScan = handTable.data() ;
+    scanLen = padded ;
+    sorted = true ;
+
+    return ;
+
+}
+
+/*----------GestureIndex::Clear( )---------------------------------------------------
+
+  PURPOSE:  Remove all gestures from the index.
+
+-----------------------------------------------------------------------------------*/
+
+void GestureIndex::Clear( ){
+
+    Unmap() ;
+    entries.clear() ;
+    flexTable.clear() ;
+    sigTable.clear() ;
+    handTable.clear() ;
+    flexScan = NULL ;
+    sigScan = NULL ;
+    handScan = NULL ;
+    scanLen = 0 ;
+    sorted = true ;
+
+    return ;
+
+}
+
+/*----------GestureIndex::Save( )----------------------------------------------------
+
+  PURPOSE:  Write the gestures to a compiled gesture file, in the layout described in
+            GestureIndex.h. The file is written next to its final name and renamed
+            into place, so a running program never maps a partly written file.
+
+  INPUT  PARAMETERS:  fName -- the compiled gesture file.
+
+  RETURN VALUE:  true if the file was written
+                 false if the index has not been built or the file could not be written.
+
+-----------------------------------------------------------------------------------*/
+
+bool GestureIndex::Save( const char* fName ) const {
+
+    IndexFileHeader header ;                     /* The file header. */
+    IndexFileRecord record ;                     /* The next record. */
+    vector<uint8_t> file ;                       /* The whole file. */
+    string text ;                                /* The text section. */
+    string tmpName = string(fName) + ".tmp" ;    /* The file being written. */
+    FILE* output ;                               /* The file being written. */
+    bool written ;                               /* True if the file was written in full. */
+    size_t i ;                                   /* An iterator. */
+
+    if( !sorted ){
+        return false ;
+    }
+    memset( &header, 0, sizeof(header) ) ;
+    header.magic = INDEX_FILE_MAGIC ;
+    header.version = INDEX_FILE_VERSION ;
+    header.headerSize = sizeof(IndexFileHeader) ;
+    header.recordSize = sizeof(IndexFileRecord) ;
+    header.flexLen = FLEX_VECTOR_LEN ;
+    header.block = INDEX_BLOCK ;
+    header.count = (uint32_t)entries.size() ;
+    header.padded = (uint32_t)scanLen ;
+    header.flexOffset = file_align( sizeof(IndexFileHeader) ) ;
+    header.sigOffset = file_align( header.flexOffset + (scanLen * FLEX_VECTOR_LEN) ) ;
+    header.handOffset = file_align( header.sigOffset + (scanLen * sizeof(uint32_t)) ) ;
+    header.recordOffset = file_align( header.handOffset + scanLen ) ;
+    header.textOffset = file_align( header.recordOffset + (entries.size() * sizeof(IndexFileRecord)) ) ;
+    for( i = 0 ; i < entries.size() ; i++ ){
+        text += entries[i].gest ;
+        text += '\0' ;
+    }
+    header.fileSize = (uint32_t)(header.textOffset + text.size()) ;
+    file.assign( header.fileSize, 0 ) ;
+    if( scanLen > 0 ){
+        memcpy( &file[header.flexOffset], flexScan, scanLen * FLEX_VECTOR_LEN ) ;
+        memcpy( &file[header.sigOffset], sigScan, (scanLen / 2) * sizeof(uint64_t) ) ;
+        memcpy( &file[header.handOffset], handScan, scanLen ) ;
+    }
+    memset( &record, 0, sizeof(record) ) ;
+    for( i = 0 ; i < entries.size() ; i++ ){
+        memcpy( record.key, entries[i].key, sizeof(record.key) ) ;
+        record.signature = entries[i].signature ;
+        record.hands = entries[i].hands ;
+        memcpy( record.lsm303, entries[i].lsm303, sizeof(record.lsm303) ) ;
+        memcpy( record.lsm9dof, entries[i].lsm9dof, sizeof(record.lsm9dof) ) ;
+        memcpy( &file[header.recordOffset + (i * sizeof(IndexFileRecord))], &record, sizeof(record) ) ;
+        record.text += (uint32_t)(entries[i].gest.size() + 1) ;
+    }
+    if( !text.empty() ){
+        memcpy( &file[header.textOffset], text.data(), text.size() ) ;
+    }
+    header.crc = frame_crc32( &file[sizeof(IndexFileHeader)], file.size() - sizeof(IndexFileHeader) ) ;
+    memcpy( &file[0], &header, sizeof(header) ) ;
+    output = fopen( tmpName.c_str(), "wb" ) ;
+    if( output == NULL ){
+        return false ;
+    }
+    written = (fwrite( &file[0], 1, file.size(), output ) == file.size()) ;
+    written = (fclose( output ) == 0) && written ;
+    if( !written || (rename( tmpName.c_str(), fName ) != 0) ){
+        remove( tmpName.c_str() ) ;
+        return false ;
+    }
+
+    return true ;
+
+}
+
+/*----------GestureIndex::Load( )----------------------------------------------------
+
+  PURPOSE:  Replace the gestures with those of a compiled gesture file. The file is
+            mapped read only and checked against its CRC; the scan tables used by
+            Nearest() are then read in place, and only the records and text are
+            copied into the entries. The index is left unchanged if the file is
+            missing, corrupt, or was compiled with a different layout.
+
+  INPUT  PARAMETERS:  fName -- the compiled gesture file.
+
+  RETURN VALUE:  true if the file was loaded
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool GestureIndex::Load( const char* fName ){
+
+    int fd = open( fName, O_RDONLY | O_CLOEXEC ) ;   /* The compiled gesture file. */
+    struct stat st ;                                  /* The size of the file. */
+    void* map ;                                       /* The mapped file. */
+    const uint8_t* base ;                             /* The start of the mapped file. */
+    const IndexFileRecord* records ;                  /* The records within the file. */
+    const char* text ;                                /* The text section within the file. */
+    IndexFileHeader header ;                          /* The file header. */
+    size_t i ;                                        /* An iterator. */
+
+    if( fd < 0 ){
+        return false ;
+    }
+    if( (fstat(fd, &st) != 0) || (st.st_size < (off_t)sizeof(IndexFileHeader)) ){
+        close( fd ) ;
+        return false ;
+    }
+    map = mmap( NULL, st.st_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0 ) ;
+    close( fd ) ;
+    if( map == MAP_FAILED ){
+        return false ;
+    }
+    base = (const uint8_t*)map ;
+    memcpy( &header, base, sizeof(header) ) ;
+    if( !valid_header(header, st.st_size) ||
+        (header.crc != frame_crc32( base + sizeof(IndexFileHeader), header.fileSize - sizeof(IndexFileHeader) )) ||
+        ((header.count > 0) && (base[header.fileSize - 1] != '\0')) ){
+        munmap( map, st.st_size ) ;
+        return false ;
+    }
+    Clear() ;
+    mapping = map ;
+    mappingLen = st.st_size ;
+    flexScan = base + header.flexOffset ;
+    sigScan = (const uint64_t*)(base + header.sigOffset) ;
+    handScan = base + header.handOffset ;
+    scanLen = header.padded ;
+    records = (const IndexFileRecord*)(base + header.recordOffset) ;
+    text = (const char*)(base + header.textOffset) ;
+    entries.resize( header.count ) ;
+    for( i = 0 ; i < header.count ; i++ ){
+        memcpy( entries[i].key, records[i].key, sizeof(entries[i].key) ) ;
+        entries[i].hands = records[i].hands ;
+        entries[i].signature = records[i].signature ;
+        memcpy( entries[i].flex, flexScan + (i * FLEX_VECTOR_LEN), FLEX_VECTOR_LEN ) ;
+        memcpy( entries[i].lsm303, records[i].lsm303, sizeof(entries[i].lsm303) ) ;
+        memcpy( entries[i].lsm9dof, records[i].lsm9dof, sizeof(entries[i].lsm9dof) ) ;
+        entries[i].gest = (records[i].text < (header.fileSize - header.textOffset)) ? string( text + records[i].text ) : string() ;
+    }
+    sorted = true ;
+
+    return true ;
+
+}
+
+/*----------GestureIndex::Unmap( )---------------------------------------------------
+
+  PURPOSE:  Release the compiled gesture file, if one is mapped.
+
+-----------------------------------------------------------------------------------*/
+
+void GestureIndex::Unmap( ){
+
+    if( mapping != NULL ){
+        munmap( mapping, mappingLen ) ;
+        mapping = NULL ;
+        mappingLen = 0 ;
+    }
+
+    return ;
+
+}
+
+/*----------make_query( )------------------------------------------------------------
+
+  PURPOSE:  Pack the hands of a gesture in the layout of the tables. A copy of the
+            flex vector and contact signature is made for each combination of hands,
+            with the values of the other hand cleared, so that every gesture in a
+            block is compared only on the hands it uses. Since the tables hold zeros
+            for the hands a gesture does not use, those hands add nothing to the
+            distance.
+
+  INPUT  PARAMETERS:  gesture -- the gesture to pack.
+
+  OUTPUT PARAMETERS:  flex    -- the quantized flex vector, for each combination of hands.
+                      sig     -- the contact signature, for each combination of hands.
+
+  RETURN VALUE:  The hands defined in the gesture, as INDEX_USES_LEFT and INDEX_USES_RIGHT.
+
+-----------------------------------------------------------------------------------*/
+
+static uint8_t make_query( const Gesture &gesture, uint8_t flex[INDEX_USES_BOTH + 1][FLEX_VECTOR_LEN],
+                           uint32_t sig[INDEX_USES_BOTH + 1] ){
+
+    uint8_t vec[FLEX_VECTOR_LEN] ;   /* The quantized flex values of a hand. */
+    uint8_t present = 0 ;            /* The hands defined in the gesture. */
+    unsigned int side ;              /* An iterator over the hands. */
+    unsigned int uses ;              /* An iterator over the combinations of hands. */
+
+    memset( flex, 0, (INDEX_USES_BOTH + 1) * FLEX_VECTOR_LEN ) ;
+    memset( sig, 0, (INDEX_USES_BOTH + 1) * sizeof(uint32_t) ) ;
+    for( side = 0 ; side < INDEX_HANDS ; side++ ){
+        const Hand &hand = (side == INDEX_LEFT) ? gesture.Left() : gesture.Right() ;
+        if( !hand.Defined() )
+            continue ;
+        /* INDEX_USES_LEFT and INDEX_USES_RIGHT are the bits of INDEX_LEFT and INDEX_RIGHT. */
+        present |= (uint8_t)(1 << side) ;
+        hand.FlexVector( vec ) ;
+        for( uses = 0 ; uses <= INDEX_USES_BOTH ; uses++ ){
+            if( (uses & (1 << side)) == 0 )
+                continue ;
+            memcpy( &flex[uses][side * INDEX_NUM_FLEX], vec, INDEX_NUM_FLEX ) ;
+            sig[uses] |= (uint32_t)hand.ContactSignature() << (side * INDEX_SIG_SHIFT) ;
+        }
+    }
+
+    return present ;
+
+}
+
+/*----------flex_distance( )---------------------------------------------------------
+
+  PURPOSE:  Compute the sum of absolute differences between the query and a block of
+            INDEX_BLOCK quantized flex vectors. Each vector holds both hands, so a
+            single pass compares one-handed and two-handed gestures alike.
+
+  INPUT  PARAMETERS:  table -- the first flex vector of the block.
+                      hands -- the hands used by each gesture of the block.
+                      query -- the quantized flex vector, for each combination of hands.
+
+  OUTPUT PARAMETERS:  dist  -- the distance to each flex vector in the block.
+
+-----------------------------------------------------------------------------------*/
+
+static inline void flex_distance( const uint8_t* table, const uint8_t* hands, const uint8_t query[INDEX_USES_BOTH + 1][FLEX_VECTOR_LEN],
+                                  unsigned int dist[INDEX_BLOCK] ){
+
+    unsigned int i ;  /* An iterator. */
+
+#if defined(__SSE2__)
+    /* Two flex vectors fit in a register. _mm_sad_epu8 sums each 8 byte half. */
+    for( i = 0 ; i < INDEX_BLOCK ; i += 2 ){
+        __m128i v = _mm_loadu_si128( (const __m128i*)(table + (i * FLEX_VECTOR_LEN)) ) ;
+        __m128i qv = _mm_unpacklo_epi64( _mm_loadl_epi64((const __m128i*)query[hands[i] & INDEX_USES_BOTH]),
+                                         _mm_loadl_epi64((const __m128i*)query[hands[i + 1] & INDEX_USES_BOTH]) ) ;
+        __m128i sad = _mm_sad_epu8( v, qv ) ;
+        dist[i]     = (unsigned int)_mm_cvtsi128_si32( sad ) ;
+        dist[i + 1] = (unsigned int)_mm_cvtsi128_si32( _mm_srli_si128(sad, 8) ) ;
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    for( i = 0 ; i < INDEX_BLOCK ; i += 2 ){
+        uint8x16_t v = vld1q_u8( table + (i * FLEX_VECTOR_LEN) ) ;
+        uint8x16_t qv = vcombine_u8( vld1_u8(query[hands[i] & INDEX_USES_BOTH]), vld1_u8(query[hands[i + 1] & INDEX_USES_BOTH]) ) ;
+        uint64x2_t sad = vpaddlq_u32( vpaddlq_u16(vpaddlq_u8(vabdq_u8(v, qv))) ) ;
+        dist[i]     = (unsigned int)vgetq_lane_u64( sad, 0 ) ;
+        dist[i + 1] = (unsigned int)vgetq_lane_u64( sad, 1 ) ;
+    }
+#else
+    unsigned int j ;
+    for( i = 0 ; i < INDEX_BLOCK ; i++ ){
+        const uint8_t* q = query[hands[i] & INDEX_USES_BOTH] ;
+        dist[i] = 0 ;
+        for( j = 0 ; j < FLEX_VECTOR_LEN ; j++ ){
+            int d = (int)table[(i * FLEX_VECTOR_LEN) + j] - (int)q[j] ;
+            dist[i] += (unsigned int)((d < 0) ? -d : d) ;
+        }
+    }
+#endif
+
+    return ;
+
+}
+
+/*----------contact_distance( )------------------------------------------------------
+
+  PURPOSE:  Count the contact sensors that differ between the query and a block of
+            INDEX_BLOCK contact signatures. The table holds the signatures of two
+            gestures per 64 bit word, the first in the low 32 bits, and each word
+            is counted within its two 32 bit lanes at once.
+
+  INPUT  PARAMETERS:  table -- the first pair of contact signatures of the block.
+                      hands -- the hands used by each gesture of the block.
+                      query -- the contact signature, for each combination of hands.
+
+  OUTPUT PARAMETERS:  dist  -- the number of differing contact sensors for each signature.
+
+-----------------------------------------------------------------------------------*/
+
+static inline void contact_distance( const uint64_t* table, const uint8_t* hands, const uint32_t query[INDEX_USES_BOTH + 1],
+                                     unsigned int dist[INDEX_BLOCK] ){
+
+    uint64_t x ;      /* The differing contact sensors of two gestures. */
+    unsigned int i ;  /* An iterator. */
+
+    for( i = 0 ; i < INDEX_BLOCK ; i += 2 ){
+        x = table[i / 2] ^ ((uint64_t)query[hands[i] & INDEX_USES_BOTH] | ((uint64_t)query[hands[i + 1] & INDEX_USES_BOTH] << 32)) ;
+        x = x - ((x >> 1) & 0x5555555555555555ULL) ;
+        x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL) ;
+        x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL ;
+        x = (x + (x >> 8)) & 0x00FF00FF00FF00FFULL ;
+        x = (x + (x >> 16)) & 0x0000FFFF0000FFFFULL ;
+        dist[i]     = (unsigned int)(x & 0xFFFF) ;
+        dist[i + 1] = (unsigned int)(x >> 32) ;
+    }
+
+    return ;
+
+}
+
+/*----------within_tolerance( )------------------------------------------------------
+
+  PURPOSE:  Compare the accelerometer values of one hand of a gesture against a hand.
+
+  INPUT  PARAMETERS:  entry      -- the gesture.
+                      side       -- the position of the hand within the gesture.
+                      hand       -- the hand to compare.
+                      lsm303Tol  -- the tolerance to use for the LSM303 values.
+                      lsm9dofTol -- the tolerance to use for the LSM9DOF values.
+
+  RETURN VALUE:  true if every value is within tolerance
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+static bool within_tolerance( const GestureEntry &entry, unsigned int side, const Hand &hand, double lsm303Tol, double lsm9dofTol ){
+
+    bool found = true ;   /* True if the accelerometer values are within tolerance. */
+    unsigned int i ;      /* An iterator. */
+
+    for( i = 0 ; found && (i < INDEX_NUM_LSM303) ; i++ ){
+        const Lsm303 &lsm = hand.Lsm303Vals(i) ;
+        const double* v = entry.lsm303[side][i] ;
+        found = (fabs(v[0] - lsm.AccelX()) <= lsm303Tol) &&
+                (fabs(v[1] - lsm.AccelY()) <= lsm303Tol) &&
+                (fabs(v[2] - lsm.AccelZ()) <= lsm303Tol) &&
+                (fabs(v[3] - lsm.MagX())   <= lsm303Tol) &&
+                (fabs(v[4] - lsm.MagY())   <= lsm303Tol) &&
+                (fabs(v[5] - lsm.MagZ())   <= lsm303Tol) ;
+    }
+    for( i = 0 ; found && (i < INDEX_NUM_LSM9DOF) ; i++ ){
+        const Lsm9dof &lsm = hand.Lsm9dofVals(i) ;
+        const double* v = entry.lsm9dof[side][i] ;
+        found = (fabs(v[0] - lsm.AccelX()) <= lsm9dofTol) &&
+                (fabs(v[1] - lsm.AccelY()) <= lsm9dofTol) &&
+                (fabs(v[2] - lsm.AccelZ()) <= lsm9dofTol) &&
+                (fabs(v[3] - lsm.MagX())   <= lsm9dofTol) &&
+                (fabs(v[4] - lsm.MagY())   <= lsm9dofTol) &&
+                (fabs(v[5] - lsm.MagZ())   <= lsm9dofTol) &&
+                (fabs(v[6] - lsm.GyroX())  <= lsm9dofTol) &&
+                (fabs(v[7] - lsm.GyroY())  <= lsm9dofTol) &&
+                (fabs(v[8] - lsm.GyroZ())  <= lsm9dofTol) ;
+    }
+
+    return found ;
+
+}
+
+/*----------GestureIndex::Match( )---------------------------------------------------
+
+  PURPOSE:  Find the first gesture whose flex and contact sensor values match the
+            hands it uses exactly. Both hands are compared against every gesture in
+            the same pass as Nearest() makes; a gesture at distance zero is then
+            checked against the keys of the hands, so that only exact values match.
+            Two-handed gestures are found before one-handed ones, and among
+            gestures with the same values the first in text order is used. If the
+            gesture involves motion, the accelerometer values must also fall within
+            the given tolerances.
+
+  INPUT  PARAMETERS:  gesture    -- the left and right hand to match. A hand that is not
+                                    defined only matches gestures that do not use it.
+                      motion     -- true if the accelerometer values should be compared.
+                      lsm303Tol  -- the tolerance to use for the LSM303 values.
+                      lsm9dofTol -- the tolerance to use for the LSM9DOF values.
+
+  OUTPUT PARAMETERS:  gest       -- the text of the matching gesture.
+
+  RETURN VALUE:  true if a matching gesture was found
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool GestureIndex::Match( const Gesture &gesture, bool motion, double lsm303Tol, double lsm9dofTol,
+                          string &gest ) const {
+
+    uint8_t flexQuery[INDEX_USES_BOTH + 1][FLEX_VECTOR_LEN] ;  /* The quantized flex values of the hands. */
+    uint32_t sigQuery[INDEX_USES_BOTH + 1] ;                  /* The contact signature of the hands. */
+    uint64_t key[INDEX_HANDS] = { 0, 0 } ;                   /* The packed hands. */
+    unsigned int flexDist[INDEX_BLOCK] ;                      /* Flex distance to each gesture in a block. */
+    unsigned int conDist[INDEX_BLOCK] ;                       /* Contact distance to each gesture in a block. */
+    uint8_t present ;                                         /* The hands that can be matched exactly. */
+    bool found ;                                              /* True if the gesture matches. */
+    unsigned int side ;                                       /* An iterator over the hands. */
+    size_t i ;                                                /* An iterator. */
+    size_t j ;                                                /* An iterator. */
+
+    if( !sorted || !gesture.Defined() ){
+        return false ;
+    }
+    present = make_query( gesture, flexQuery, sigQuery ) ;
+    for( side = 0 ; side < INDEX_HANDS ; side++ ){
+        const Hand &hand = (side == INDEX_LEFT) ? gesture.Left() : gesture.Right() ;
+        if( hand.Defined() && !HandKey(hand, side == INDEX_RIGHT, key[side]) )
+            present &= (uint8_t)~(1 << side) ;
+    }
+    if( present == 0 ){
+        return false ;
+    }
+    for( i = 0 ; i < scanLen ; i += INDEX_BLOCK ){
+        flex_distance( flexScan + (i * FLEX_VECTOR_LEN), handScan + i, flexQuery, flexDist ) ;
+        contact_distance( sigScan + (i / 2), handScan + i, sigQuery, conDist ) ;
+        for( j = 0 ; j < INDEX_BLOCK ; j++ ){
+            if( ((handScan[i + j] & ~present) != 0) || ((flexDist[j] | conDist[j]) != 0) )
+                continue ;
+            const GestureEntry &entry = entries[i + j] ;
+            found = true ;
+            for( side = 0 ; found && (side < INDEX_HANDS) ; side++ ){
+                if( (entry.hands & (1 << side)) == 0 )
+                    continue ;
+                found = (entry.key[side] == key[side]) ;
+                if( found && motion ){
+                    /* Gesture involves motion, compare the accelerometer values as well. */
+                    found = within_tolerance( entry, side, (side == INDEX_LEFT) ? gesture.Left() : gesture.Right(),
+                                              lsm303Tol, lsm9dofTol ) ;
+                }
+            }
+            if( found ){
+                gest = entry.gest ;
+                return true ;
+            }
+        }
+    }
+
+    return false ;
+
+}
+
+/*----------GestureIndex::Nearest( )-------------------------------------------------
+
+  PURPOSE:  Find the gesture closest to the hands by scanning every gesture that
+            uses only the hands defined. The distance is the number of flex steps
+            that differ plus CONTACT_WEIGHT for every contact sensor that differs,
+            over the hands the gesture uses. When gestures are equally close, the
+            first in the order of Build() is used, so a two-handed gesture is
+            preferred. The confidence compares the closest gesture to the next
+            closest one: 1.0 when only the closest gesture is near the hands, 0.0
+            when two gestures are equally close.
+
+  INPUT  PARAMETERS:  gesture -- the left and right hand to match.
+
+  OUTPUT PARAMETERS:  match   -- the closest gesture.
+
+  RETURN VALUE:  true if a gesture was found for the hands defined
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool GestureIndex::Nearest( const Gesture &gesture, GestureMatch &match ) const {
+
+    uint8_t flexQuery[INDEX_USES_BOTH + 1][FLEX_VECTOR_LEN] ;  /* The quantized flex values of the hands. */
+    uint32_t sigQuery[INDEX_USES_BOTH + 1] ;                  /* The contact signature of the hands. */
+    unsigned int flexDist[INDEX_BLOCK] ;                      /* Flex distance to each gesture in a block. */
+    unsigned int conDist[INDEX_BLOCK] ;                       /* Contact distance to each gesture in a block. */
+    unsigned int best = UINT_MAX ;                            /* The smallest distance found. */
+    unsigned int second = UINT_MAX ;                          /* The second smallest distance found. */
+    unsigned int bestEntry = 0 ;                              /* The closest gesture. */
+    uint8_t present ;                                         /* The hands defined in the gesture. */
+    unsigned int d ;                                          /* The distance to the next gesture. */
+    size_t i ;                                                /* An iterator. */
+    size_t j ;                                                /* An iterator. */
+
+    if( !sorted || !gesture.Defined() || entries.empty() ){
+        return false ;
+    }
+    present = make_query( gesture, flexQuery, sigQuery ) ;
+    if( present == 0 ){
+        return false ;
+    }
+    for( i = 0 ; i < scanLen ; i += INDEX_BLOCK ){
+        flex_distance( flexScan + (i * FLEX_VECTOR_LEN), handScan + i, flexQuery, flexDist ) ;
+        contact_distance( sigScan + (i / 2), handScan + i, sigQuery, conDist ) ;
+        for( j = 0 ; j < INDEX_BLOCK ; j++ ){
+            if( (handScan[i + j] & ~present) != 0 )
+                continue ;
+            d = flexDist[j] + (CONTACT_WEIGHT * conDist[j]) ;
+            if( d < best ){
+                second = best ;
+                best = d ;
+                bestEntry = (unsigned int)(i + j) ;
+            }
+            else if( d < second ){
+                second = d ;
+            }
+        }
+    }
+    if( best == UINT_MAX ){
+        /* No gestures for these hands. */
+        return false ;
+    }
+    match.entry = bestEntry ;
+    match.distance = best ;
+    if( second == UINT_MAX )
+        match.confidence = 1.0 ;
+    else if( (best + second) == 0 )
+        match.confidence = 0.0 ;
+    else
+        match.confidence = (double)(second - best) / (double)(second + best) ;
+
+    return true ;
+
+}
+
+/*----------GestureIndex::Nearest( )-------------------------------------------------
+
+  PURPOSE:  Find the k gestures closest to the hands, in the same pass and with the
+            same distance as the closest gesture alone. Equally close gestures are
+            kept in the order of Build(). The confidence of each gesture compares it
+            to the one after it.
+
+  INPUT  PARAMETERS:  gesture -- the left and right hand to match.
+                      k       -- the most gestures to find.
+
+  OUTPUT PARAMETERS:  matches -- the closest gestures, closest first.
+
+  RETURN VALUE:  The number of gestures found, 0 if none were found for the hands
+                 defined.
+
+-----------------------------------------------------------------------------------*/
+
+unsigned int GestureIndex::Nearest( const Gesture &gesture, GestureMatch matches[], unsigned int k ) const {
+
+    uint8_t flexQuery[INDEX_USES_BOTH + 1][FLEX_VECTOR_LEN] ;  /* The quantized flex values of the hands. */
+    uint32_t sigQuery[INDEX_USES_BOTH + 1] ;                  /* The contact signature of the hands. */
+    unsigned int flexDist[INDEX_BLOCK] ;                      /* Flex distance to each gesture in a block. */
+    unsigned int conDist[INDEX_BLOCK] ;                       /* Contact distance to each gesture in a block. */
+    unsigned int found = 0 ;                                  /* Number of gestures kept. */
+    uint8_t present ;                                         /* The hands defined in the gesture. */
+    unsigned int d ;                                          /* The distance to the next gesture. */
+    unsigned int m ;                                          /* Position of the next gesture among those kept. */
+    size_t i ;                                                /* An iterator. */
+    size_t j ;                                                /* An iterator. */
+
+    if( !sorted || !gesture.Defined() || entries.empty() || (k == 0) ){
+        return 0 ;
+    }
+    present = make_query( gesture, flexQuery, sigQuery ) ;
+    if( present == 0 ){
+        return 0 ;
+    }
+    for( i = 0 ; i < scanLen ; i += INDEX_BLOCK ){
+        flex_distance( flexScan + (i * FLEX_VECTOR_LEN), handScan + i, flexQuery, flexDist ) ;
+        contact_distance( sigScan + (i / 2), handScan + i, sigQuery, conDist ) ;
+        for( j = 0 ; j < INDEX_BLOCK ; j++ ){
+            if( (handScan[i + j] & ~present) != 0 )
+                continue ;
+            d = flexDist[j] + (CONTACT_WEIGHT * conDist[j]) ;
+            if( (found == k) && (d >= matches[k - 1].distance) )
+                continue ;
+            /* Insert after any gesture as close, so that earlier gestures are preferred. */
+            m = (found < k) ? found++ : (k - 1) ;
+            while( (m > 0) && (d < matches[m - 1].distance) ){
+                matches[m] = matches[m - 1] ;
+                m-- ;
+            }
+            matches[m].entry = (unsigned int)(i + j) ;
+            matches[m].distance = d ;
+        }
+    }
+    for( m = 0 ; m < found ; m++ ){
+        if( (m + 1) == found )
+            matches[m].confidence = 1.0 ;
+        else if( (matches[m].distance + matches[m + 1].distance) == 0 )
+            matches[m].confidence = 0.0 ;
+        else
+            matches[m].confidence = (double)(matches[m + 1].distance - matches[m].distance) /
+                                    (double)(matches[m + 1].distance + matches[m].distance) ;
+    }
+
+    return found ;
+
+}
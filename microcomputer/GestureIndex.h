@@ -0,0 +1,186 @@
+/***********GestureIndex.h***********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the class "GestureIndex", an in-memory copy
+            of the gesture database used to match gestures without querying the
+            database for every frame. Parser.h and GestureIndex.cpp include this file.
+
+            Both hands are classified together. Each gesture uses the left hand,
+            the right hand, or both: a gesture with a row for each hand in the
+            gesture database is a two-handed sign, and every other row is a
+            one-handed sign. The flex values of both hands share a single
+            FLEX_VECTOR_LEN byte vector, left hand first, and the contact sensors a
+            single 32 bit signature, so one pass over the tables compares a frame
+            against every gesture, whichever hands it uses.
+
+            An index can also be saved to a compiled gesture file by
+            tools/gesture_compile, and loaded back with a single mmap(), so that
+            sign2speech starts without a database server. The file is laid out as
+            below, every section starting on a cache line, in host byte order:
+
+              IndexFileHeader    magic, version, layout, section offsets, CRC
+              flex table         FLEX_VECTOR_LEN bytes per gesture, padded to INDEX_BLOCK
+              signature table    uint64_t per two gestures, the first in the low 32 bits
+              hand table         uint8_t hands used per gesture, 0xFF for padding
+              records            IndexFileRecord per gesture, sorted as after Build()
+              text               the gesture text, NUL terminated
+
+            The flex, signature, and hand tables are scanned in place by Match() and
+            Nearest(); only the records and text are copied into the entries.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef GESTUREINDEX_H
+#define GESTUREINDEX_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include "Gesture.h"
+
+using namespace std ;
+
+#define INDEX_NUM_FLEX      4   /* Number of flex sensors used as part of the key (index, middle, ring, pinky). */
+#define INDEX_NUM_CONTACTS 13   /* Number of contact sensors used as part of the key. */
+#define INDEX_NUM_LSM303    2   /* Number of LSM303 accelerometers per entry. */
+#define INDEX_NUM_LSM9DOF   2   /* Number of LSM9DOF accelerometers per entry. */
+#define INDEX_HANDS         2   /* Number of hands per entry. */
+#define INDEX_LEFT          0   /* Position of the left hand, as in the sensor frame. */
+#define INDEX_RIGHT         1   /* Position of the right hand. */
+#define INDEX_USES_LEFT     0x01  /* The gesture uses the left hand. */
+#define INDEX_USES_RIGHT    0x02  /* The gesture uses the right hand. */
+#define INDEX_USES_BOTH     0x03  /* The gesture uses both hands. */
+#define INDEX_SIG_SHIFT     16  /* Bits between the contact signatures of the left and right hand. */
+#define INDEX_LSM303_VALS   6   /* Number of values per LSM303 accelerometer. */
+#define INDEX_LSM9DOF_VALS  9   /* Number of values per LSM9DOF accelerometer. */
+#define INDEX_BLOCK         4   /* Number of gestures compared at a time when searching for the nearest gesture. */
+#define CONTACT_WEIGHT      4   /* Distance added for each contact sensor that does not match, in flex steps. */
+#define INDEX_FILE_MAGIC    0x49475332  /* Marks a compiled gesture file ("2SGI"). */
+#define INDEX_FILE_VERSION  2           /* The compiled gesture file layout. Increment whenever the layout changes. */
+#define INDEX_FILE_ALIGN    64          /* Alignment of each section of the file, in bytes. */
+
+/* The flex values of both hands must fill the flex vector exactly. */
+typedef char index_flex_check[((INDEX_HANDS * INDEX_NUM_FLEX) == FLEX_VECTOR_LEN) ? 1 : -1] ;
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "GestureEntry" represents a gesture of the gesture database: a single row for a
+   one-handed sign, or the left and right rows of a two-handed sign. The values of a
+   hand the gesture does not use are zero. */
+
+struct GestureEntry {
+	 uint64_t key[INDEX_HANDS] ;                                           /* Packed hand, flex, and contact values of each hand. */
+	 uint8_t hands ;                                                       /* INDEX_USES_LEFT, INDEX_USES_RIGHT, or INDEX_USES_BOTH. */
+	 uint32_t signature ;                                                  /* Packed contact sensor values, left hand in the low 16 bits. */
+	 uint8_t flex[FLEX_VECTOR_LEN] ;                                       /* Quantized flex sensor values, left hand first. */
+	 double lsm303[INDEX_HANDS][INDEX_NUM_LSM303][INDEX_LSM303_VALS] ;     /* LSM303 accelerometer and magnetometer values. */
+	 double lsm9dof[INDEX_HANDS][INDEX_NUM_LSM9DOF][INDEX_LSM9DOF_VALS] ;  /* LSM9DOF accelerometer, magnetometer, and gyrometer values. */
+	 string gest ;                                                         /* The text that corresponds to the gesture. */
+} ;
+
+/* Type "GestureMatch" represents the result of a nearest gesture search. */
+
+struct GestureMatch {
+	 unsigned int entry ;                                                  /* Position of the gesture within the index. */
+	 unsigned int distance ;                                               /* Distance to the gesture, in flex steps. */
+	 double confidence ;                                                   /* 0.0 if ambiguous, up to 1.0 for a clear match. */
+} ;
+
+/* Type "IndexFileHeader" starts a compiled gesture file. The layout fields let the loader
+   reject a file compiled with different sizes. Offsets are from the start of the file. */
+
+struct IndexFileHeader {
+	 uint32_t magic ;                                                      /* INDEX_FILE_MAGIC. */
+	 uint32_t version ;                                                    /* INDEX_FILE_VERSION. */
+	 uint32_t headerSize ;                                                 /* sizeof(IndexFileHeader). */
+	 uint32_t recordSize ;                                                 /* sizeof(IndexFileRecord). */
+	 uint32_t flexLen ;                                                    /* FLEX_VECTOR_LEN. */
+	 uint32_t block ;                                                      /* INDEX_BLOCK. */
+	 uint32_t count ;                                                      /* Number of gestures. */
+	 uint32_t padded ;                                                     /* Number of gestures rounded up to a whole block. */
+	 uint32_t flexOffset ;                                                 /* Start of the flex table. */
+	 uint32_t sigOffset ;                                                  /* Start of the signature table. */
+	 uint32_t handOffset ;                                                 /* Start of the hand table. */
+	 uint32_t recordOffset ;                                               /* Start of the records. */
+	 uint32_t textOffset ;                                                 /* Start of the text. */
+	 uint32_t fileSize ;                                                   /* Size of the whole file. */
+	 uint32_t crc ;                                                        /* CRC-32 of everything after the header. */
+	 uint32_t reserved ;                                                   /* Always zero. */
+} ;
+
+/* Type "IndexFileRecord" holds the parts of a gesture that the scan tables do not. */
+
+struct IndexFileRecord {
+	 uint64_t key[INDEX_HANDS] ;                                           /* Packed hand, flex, and contact values of each hand. */
+	 uint32_t text ;                                                       /* Offset of the gesture text within the text section. */
+	 uint32_t signature ;                                                  /* Packed contact sensor values of both hands. */
+	 uint8_t hands ;                                                       /* The hands used. */
+	 uint8_t reserved[7] ;                                                 /* Always zero. */
+	 double lsm303[INDEX_HANDS][INDEX_NUM_LSM303][INDEX_LSM303_VALS] ;     /* LSM303 accelerometer and magnetometer values. */
+	 double lsm9dof[INDEX_HANDS][INDEX_NUM_LSM9DOF][INDEX_LSM9DOF_VALS] ;  /* LSM9DOF accelerometer, magnetometer, and gyrometer values. */
+} ;
+
+/* Type "GestureIndex" represents the set of known gestures. Two-handed gestures are
+   sorted first, then right handed and left handed ones, each by key and then by text,
+   so that the first gesture a scan finds is the most specific one. */
+
+class GestureIndex {
+
+  public:
+
+	 /* Default constructor and destructor functions */
+	 GestureIndex( ) ;
+	 ~GestureIndex( ) ;
+
+	 /* Accessor functions */
+	 inline size_t Size( )  const { return entries.size() ; }  /* Access number of gestures. */
+	 bool Match( const Gesture &gesture, bool motion, double lsm303Tol, double lsm9dofTol,
+	             string &gest ) const ;                                  /* Find the matching gesture. */
+	 bool Nearest( const Gesture &gesture, GestureMatch &match ) const ;   /* Find the closest gesture. */
+	 unsigned int Nearest( const Gesture &gesture, GestureMatch matches[], unsigned int k ) const ;  /* Find the k closest gestures. */
+	 inline const string &Text( unsigned int i ) const { return entries[i].gest ; }  /* Access gesture text. */
+	 inline const GestureEntry &Entry( unsigned int i ) const { return entries[i] ; }  /* Access a gesture. */
+
+	 /* Mutator functions */
+	 void Add( bool rightHand, const double flex[INDEX_NUM_FLEX], const bool contact[INDEX_NUM_CONTACTS],
+	           const double lsm303[INDEX_NUM_LSM303][INDEX_LSM303_VALS],
+	           const double lsm9dof[INDEX_NUM_LSM9DOF][INDEX_LSM9DOF_VALS], const string &gest ) ;  /* Adds a gesture. */
+	 void Build( ) ;                                                       /* Pairs and sorts the gestures once all have been added. */
+	 void Clear( ) ;                                                       /* Removes all gestures. */
+	 bool Save( const char* fName ) const ;                                /* Writes the gestures to a compiled gesture file. */
+	 bool Load( const char* fName ) ;                                      /* Replaces the gestures with a compiled gesture file. */
+
+	 /* Key functions */
+	 static bool MakeKey( bool rightHand, const double flex[INDEX_NUM_FLEX], const bool contact[INDEX_NUM_CONTACTS], uint64_t &key ) ;
+	 static bool HandKey( const Hand &hand, bool rightHand, uint64_t &key ) ;
+
+  private:
+
+	 /* The scan tables point into the mapping, so an index can not be copied. */
+	 GestureIndex( const GestureIndex &other ) ;
+	 GestureIndex &operator=( const GestureIndex &other ) ;
+
+	 void Unmap( ) ;
+
+	 bool sorted ;                                   /* True if the entries are sorted by key. */
+	 vector<GestureEntry> entries ;                  /* The known gestures, sorted by key and then by text. */
+	 vector<uint8_t> flexTable ;                     /* Quantized flex values of every gesture, FLEX_VECTOR_LEN bytes each. */
+	 vector<uint64_t> sigTable ;                     /* Contact signatures of every pair of gestures, the first in the low 32 bits. */
+	 vector<uint8_t> handTable ;                     /* The hands used by every gesture. */
+	 const uint8_t* flexScan ;                       /* The flex table scanned by Nearest(), in flexTable or the mapping. */
+	 const uint64_t* sigScan ;                       /* The signature table scanned by Nearest(). */
+	 const uint8_t* handScan ;                       /* The hand table scanned by Nearest(). */
+	 size_t scanLen ;                                /* Number of gestures in the scan tables, including padding. */
+	 void* mapping ;                                 /* The mapped compiled gesture file, or NULL. */
+	 size_t mappingLen ;                             /* Size of the mapping. */
+
+} ;
+
+#endif
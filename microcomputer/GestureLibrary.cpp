@@ -0,0 +1,344 @@
+/***********GestureLibrary.cpp******************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The GestureSet Build() and Load() functions, and the GestureLibrary
+            Enter(), Leave(), Publish(), Start(), Reload(), and Stop() functions and
+            the library thread are defined in this module.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <sys/stat.h>
+#include <chrono>
+#include "GestureLibrary.h"
+
+/*----------GestureSet::GestureSet( )------------------------------------------------
+
+  PURPOSE:  Create a set with no gestures that has not been published.
+
+-----------------------------------------------------------------------------------*/
+
+GestureSet::GestureSet( ) : generation(0) {
+
+}
+
+/*----------GestureSet::Build( )-----------------------------------------------------
+
+  PURPOSE:  Build the motion templates from the keyframes of the gesture index, once
+            every gesture has been added to it.
+
+  INPUT  PARAMETERS:  from -- where the gestures were read from.
+
+-----------------------------------------------------------------------------------*/
+
+void GestureSet::Build( const string &from ){
+
+    motion.Build( index ) ;
+    source = from ;
+
+    return ;
+
+}
+
+/*----------GestureSet::Load( )------------------------------------------------------
+
+  PURPOSE:  Map a compiled gesture file written by tools/gesture_compile and build the
+            motion templates from it.
+
+  INPUT  PARAMETERS:  fName -- the compiled gesture file.
+
+  RETURN VALUE:  true if the file was loaded
+                 false if it is missing, corrupt, or of a different layout.
+
+-----------------------------------------------------------------------------------*/
+
+bool GestureSet::Load( const char* fName ){
+
+    if( !index.Load(fName) ){
+        return false ;
+    }
+    Build( fName ) ;
+
+    return true ;
+
+}
+
+/*----------GestureLibrary::GestureLibrary( )----------------------------------------
+
+  PURPOSE:  Create a library with no set published and no reader.
+
+-----------------------------------------------------------------------------------*/
+
+GestureLibrary::GestureLibrary( ) : current(NULL), seen(GESTURE_OFFLINE), online(false), running(false),
+                                    stopping(false), reloadRequested(false), fileIno(0), fileSize(0),
+                                    fileTime(0), published(0), gestures(0), failures(0) {
+
+}
+
+/*----------GestureLibrary::~GestureLibrary( )---------------------------------------
+
+  PURPOSE:  Stop the library thread and free every set, once the classify stage has
+            stopped.
+
+-----------------------------------------------------------------------------------*/
+
+GestureLibrary::~GestureLibrary( ){
+
+    size_t i ;  /* An iterator. */
+
+    Stop() ;
+    for( i = 0 ; i < retired.size() ; i++ ){
+        delete retired[i].set ;
+    }
+    delete current.load() ;
+
+}
+
+/*----------GestureLibrary::Enter( )-------------------------------------------------
+
+  PURPOSE:  Return the current set to the classify stage. Called before each frame; the
+            set returned may be used until the next call to Enter() or Leave(), and
+            any set returned before may not. Never waits or allocates.
+
+  RETURN VALUE:  The current set, or an empty set if none has been published.
+
+-----------------------------------------------------------------------------------*/
+
+const GestureSet &GestureLibrary::Enter( ){
+
+    GestureSet* set ;  /* The current set. */
+
+    if( !online ){
+        /* Hold every set until the current one has been read below. This store and the
+           load that follows are ordered against the swap and check in Publish(), so
+           either the new set is read here or the old one is not freed. */
+        seen.store( 0 ) ;
+        online = true ;
+    }
+    set = current.load() ;
+    if( set == NULL ){
+        return empty ;
+    }
+    seen.store( set->generation, memory_order_release ) ;
+
+    return *set ;
+
+}
+
+/*----------GestureLibrary::Leave( )-------------------------------------------------
+
+  PURPOSE:  Tell the library that the classify stage uses no set until it next calls
+            Enter(), so replaced sets can be freed while the stage is stopped.
+
+-----------------------------------------------------------------------------------*/
+
+void GestureLibrary::Leave( ){
+
+    seen.store( GESTURE_OFFLINE, memory_order_release ) ;
+    online = false ;
+
+    return ;
+
+}
+
+/*----------GestureLibrary::Publish( )-----------------------------------------------
+
+  PURPOSE:  Make a set current. The set must be completely built; the library owns it
+            from now on and frees it once it has been replaced and is no longer used.
+
+  INPUT  PARAMETERS:  set -- the new set.
+
+-----------------------------------------------------------------------------------*/
+
+void GestureLibrary::Publish( GestureSet* set ){
+
+    GestureSet* old ;  /* The set replaced. */
+    RetiredSet r ;     /* The set replaced, until it is freed. */
+
+    lock_guard<mutex> guard( lock ) ;
+    set->generation = published + 1 ;
+    gestures = set->index.Size() ;
+    old = current.exchange( set ) ;
+    published = set->generation ;
+    if( old != NULL ){
+        r.set = old ;
+        r.replacedBy = set->generation ;
+        retired.push_back( r ) ;
+    }
+    Reclaim() ;
+
+    return ;
+
+}
+
+/*----------GestureLibrary::Reclaim( )-----------------------------------------------
+
+  PURPOSE:  Free the retired sets the classify stage can no longer be using: those
+            replaced by the set it last entered or an earlier one, or all of them if
+            it has left. Called with the lock held.
+
+-----------------------------------------------------------------------------------*/
+
+void GestureLibrary::Reclaim( ){
+
+    unsigned long s = seen.load() ;  /* Generation the reader last entered. */
+    size_t kept = 0 ;                /* Number of retired sets still in use. */
+    size_t i ;                       /* An iterator. */
+
+    for( i = 0 ; i < retired.size() ; i++ ){
+        if( (s != 0) && (s >= retired[i].replacedBy) )
+            delete retired[i].set ;
+        else
+            retired[kept++] = retired[i] ;
+    }
+    retired.resize( kept ) ;
+
+    return ;
+
+}
+
+/*----------GestureLibrary::Start( )-------------------------------------------------
+
+  PURPOSE:  Start the library thread, watching a compiled gesture file. The file as it
+            is now is taken to be the one already published, if any.
+
+  INPUT  PARAMETERS:  fName -- the compiled gesture file.
+
+  RETURN VALUE:  true if the thread was started
+                 false if it was already running.
+
+-----------------------------------------------------------------------------------*/
+
+bool GestureLibrary::Start( const char* fName ){
+
+    if( running ){
+        return false ;
+    }
+    this->fName = fName ;
+    fileIno = 0 ;
+    Changed() ;
+    stopping = false ;
+    reloadRequested = false ;
+    running = true ;
+    watcher = thread( &GestureLibrary::Run, this ) ;
+
+    return true ;
+
+}
+
+/*----------GestureLibrary::Reload( )------------------------------------------------
+
+  PURPOSE:  Ask the library thread to load the compiled gesture file now, whether or
+            not it has changed. Returns at once.
+
+-----------------------------------------------------------------------------------*/
+
+void GestureLibrary::Reload( ){
+
+    {
+        lock_guard<mutex> guard( lock ) ;
+        reloadRequested = true ;
+    }
+    wake.notify_one() ;
+
+    return ;
+
+}
+
+/*----------GestureLibrary::Stop( )--------------------------------------------------
+
+  PURPOSE:  Stop the library thread. A load in progress is finished first.
+
+-----------------------------------------------------------------------------------*/
+
+void GestureLibrary::Stop( ){
+
+    if( watcher.joinable() ){
+        {
+            lock_guard<mutex> guard( lock ) ;
+            stopping = true ;
+        }
+        wake.notify_one() ;
+        watcher.join() ;
+    }
+
+    return ;
+
+}
+
+/*----------GestureLibrary::Changed( )-----------------------------------------------
+
+  PURPOSE:  Check whether the compiled gesture file has been replaced or rewritten
+            since it was last checked. Called by the library thread only.
+
+  RETURN VALUE:  true if the file is there and has changed
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool GestureLibrary::Changed( ){
+
+    struct stat st ;  /* The file as it is now. */
+
+    if( stat(fName.c_str(), &st) != 0 ){
+        return false ;
+    }
+    if( (st.st_ino == fileIno) && (st.st_size == fileSize) && (st.st_mtime == fileTime) ){
+        return false ;
+    }
+    fileIno = st.st_ino ;
+    fileSize = st.st_size ;
+    fileTime = st.st_mtime ;
+
+    return true ;
+
+}
+
+/*----------GestureLibrary::Run( )---------------------------------------------------
+
+  PURPOSE:  The library thread. Every GESTURE_POLL_MS, or as soon as Reload() is
+            called, loads the compiled gesture file into a new set if it has changed
+            or was asked for, publishes it, and frees the sets no longer used. The
+            classify stage keeps using the current set throughout.
+
+-----------------------------------------------------------------------------------*/
+
+void GestureLibrary::Run( ){
+
+    GestureSet* set ;  /* The set being loaded. */
+    bool stop ;        /* True once Stop() has been called. */
+    bool reload ;      /* True if Reload() was called. */
+
+    do{
+        {
+            unique_lock<mutex> guard( lock ) ;
+            if( !stopping && !reloadRequested ){
+                wake.wait_for( guard, chrono::milliseconds(GESTURE_POLL_MS) ) ;
+            }
+            stop = stopping ;
+            reload = reloadRequested ;
+            reloadRequested = false ;
+            Reclaim() ;
+        }
+        if( !stop && (Changed() || reload) ){
+            set = new GestureSet ;
+            if( set->Load(fName.c_str()) ){
+                Publish( set ) ;
+            }
+            else{
+                delete set ;
+                failures++ ;
+            }
+        }
+    } while( !stop ) ;
+    running = false ;
+
+    return ;
+
+}
@@ -0,0 +1,155 @@
+/***********GestureLibrary.h*********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the class "GestureSet", the gestures the classify
+            stage recognizes, and the class "GestureLibrary", which publishes them
+            and replaces them while sign2speech runs. Variables.h and
+            GestureLibrary.cpp include this file.
+
+            A set is built completely, the gesture index and the motion templates,
+            before it is published, and is never changed afterwards. Publishing
+            swaps a single atomic pointer, so the classify stage reads the current
+            set with one load and never waits on a reload, as in read-copy-update:
+
+              Enter()  called by the classify stage before each frame. Returns the
+                       current set, and tells the library that the stage is done
+                       with any set it used before.
+              Leave()  called when the classify stage stops, so sets it no longer
+                       uses are not kept for it.
+
+            A replaced set is retired rather than freed, and freed by the library
+            thread once the classify stage has entered a later set or left. Only
+            one thread may read the sets this way.
+
+            Once started, the library thread checks the compiled gesture file every
+            GESTURE_POLL_MS, and loads and publishes it whenever tools/gesture_compile
+            has replaced it, or when Reload() is called, as the /reload command of
+            the status page does. A file that does not load leaves the current set
+            in place.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef GESTURELIBRARY_H
+#define GESTURELIBRARY_H
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <limits.h>
+#include <sys/types.h>
+#include "GestureIndex.h"
+#include "MotionRecognizer.h"
+
+using namespace std ;
+
+#define GESTURE_POLL_MS  500        /* Time between checks of the compiled gesture file for a new version. */
+#define GESTURE_OFFLINE  ULONG_MAX  /* Generation seen by a reader that uses no set. */
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "GestureSet" represents the gestures recognized at one time: the gesture index and
+   the motion templates built from it. Only Gestures() and Build() change a set, and only
+   before it is published. */
+
+class GestureSet {
+
+  public:
+
+	 /* Default constructor function */
+	 GestureSet( ) ;
+
+	 /* Accessor functions */
+	 inline const GestureIndex &Index( ) const { return index ; }            /* Access the gesture index. */
+	 inline const MotionRecognizer &Motion( ) const { return motion ; }      /* Access the motion templates, with no motion in progress. */
+	 inline unsigned long Generation( ) const { return generation ; }        /* Access number of sets published up to this one, 0 if not published. */
+	 inline const string &Source( ) const { return source ; }               /* Access where the gestures were read from. */
+
+	 /* Mutator functions */
+	 inline GestureIndex &Gestures( ) { return index ; }                     /* Access the gesture index, to fill it before Build(). */
+	 void Build( const string &from ) ;              /* Builds the motion templates once the index is filled. */
+	 bool Load( const char* fName ) ;                /* Maps a compiled gesture file and builds the motion templates. */
+
+  private:
+
+	 friend class GestureLibrary ;
+
+	 GestureIndex index ;                            /* The known gestures. */
+	 MotionRecognizer motion ;                       /* The templates of the letters that involve motion. */
+	 unsigned long generation ;                      /* Number of sets published up to this one. */
+	 string source ;                                 /* The file or database the gestures were read from. */
+
+} ;
+
+/* Type "RetiredSet" represents a set that has been replaced but may still be in use. */
+
+struct RetiredSet {
+	 GestureSet* set ;                               /* The replaced set. */
+	 unsigned long replacedBy ;                      /* Generation of the set that replaced it. */
+} ;
+
+/* Type "GestureLibrary" publishes the current gesture set and reloads it from its own
+   thread. Enter() and Leave() never wait or allocate; Publish(), Reload(), and the
+   accessors may be called from any thread. */
+
+class GestureLibrary {
+
+  public:
+
+	 /* Default constructor and destructor functions */
+	 GestureLibrary( ) ;
+	 ~GestureLibrary( ) ;
+
+	 /* Accessor functions */
+	 inline bool Running( ) const { return running ; }                       /* True while the library thread runs. */
+	 inline unsigned long Generation( ) const { return published ; }        /* Access generation of the current set. */
+	 inline size_t Size( ) const { return gestures ; }                       /* Access number of gestures in the current set. */
+	 inline unsigned long Failures( ) const { return failures ; }           /* Access number of reloads that did not load. */
+
+	 /* Reader functions, for the classify stage only */
+	 const GestureSet &Enter( ) ;                    /* Returns the current set; earlier sets are no longer used. */
+	 void Leave( ) ;                                 /* No set is used until the next Enter(). */
+
+	 /* Mutator functions */
+	 void Publish( GestureSet* set ) ;               /* Makes a built set current, taking ownership of it. */
+	 bool Start( const char* fName ) ;               /* Starts the library thread, watching a compiled gesture file. */
+	 void Reload( ) ;                                /* Asks the library thread to load the file now. */
+	 void Stop( ) ;                                  /* Stops the library thread. */
+
+  private:
+
+	 void Run( ) ;
+	 bool Changed( ) ;
+	 void Reclaim( ) ;
+
+	 atomic<GestureSet*> current ;                   /* The published set. */
+	 atomic<unsigned long> seen ;                    /* Generation the reader last entered, 0 while entering, GESTURE_OFFLINE if none. */
+	 bool online ;                                   /* True between Enter() and Leave(), used by the reader only. */
+	 GestureSet empty ;                              /* Returned by Enter() before any set is published. */
+	 thread watcher ;                                /* The library thread. */
+	 mutex lock ;                                    /* Guards publishing, the retired sets, and the flags. */
+	 condition_variable wake ;                       /* Wakes the library thread. */
+	 atomic<bool> running ;                          /* True while the library thread runs. */
+	 bool stopping ;                                 /* True once Stop() has been called. */
+	 bool reloadRequested ;                          /* True once Reload() has been called, until the file is loaded. */
+	 string fName ;                                  /* The compiled gesture file watched. */
+	 ino_t fileIno ;                                 /* Inode of the file last loaded or tried, 0 if none. */
+	 off_t fileSize ;                                /* Its size. */
+	 time_t fileTime ;                               /* Its modification time. */
+	 vector<RetiredSet> retired ;                    /* Replaced sets not yet freed. */
+	 atomic<unsigned long> published ;               /* Generation of the current set. */
+	 atomic<size_t> gestures ;                       /* Number of gestures in the current set. */
+	 atomic<unsigned long> failures ;                /* Number of reloads that did not load. */
+
+} ;
+
+#endif
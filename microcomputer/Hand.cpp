@@ -13,76 +13,86 @@
 ************************************************************************************/
 
 #include <climits>
-#include <assert.h>
+#include <math.h>
 #include "Hand.h"
 
-/*----------Hand::~Hand( )-----------------------------------------------------------
+/*----------Hand::ContactSignature( )------------------------------------------------
 
-  PURPOSE:  Destructor function for a "Hand". 
-            Note that if a destructor is created for the Hand class, then a 
-            destructor must also be created for the Lsm303 and Lsm9dof classes.
+  PURPOSE:  Pack the contact sensor values into a 16 bit mask. Bits are assigned in
+            the same order as the gesture database columns: th_con_t, in_con_t,
+            in_con_m, mi_con_t, mi_con_m, ri_con_t, ri_con_m, pi_con_t, pi_con_m,
+            ti_con_t, im_con_t, mr_con_t, rp_con_t.
 
-Hand::~Hand( ){
-
-    if( lsm303 != NULL ){
-        delete[] lsm303 ;
-    }
-    if( lsm9dof != NULL ){
-        delete[] lsm9dof ;
-    }
-
-    return ;
-}
+  RETURN VALUE:  The packed contact sensor values.
 
 -----------------------------------------------------------------------------------*/
 
-/*----------Hand::Lsm303Vals( )------------------------------------------------------
+uint16_t Hand::ContactSignature( ) const {
 
-  PURPOSE:  Given an index, return the corresponding LSM303 accelerometer values.
+    uint16_t sig = 0 ;  /* The packed contact sensor values. */
 
-  INPUT  PARAMETERS:  i     -- the index value.
-
------------------------------------------------------------------------------------*/
+    sig |= (uint16_t)thumb.ContactTip()   << 0 ;
+    sig |= (uint16_t)index.ContactTip()   << 1 ;
+    sig |= (uint16_t)index.ContactMid()   << 2 ;
+    sig |= (uint16_t)middle.ContactTip()  << 3 ;
+    sig |= (uint16_t)middle.ContactMid()  << 4 ;
+    sig |= (uint16_t)ring.ContactTip()    << 5 ;
+    sig |= (uint16_t)ring.ContactMid()    << 6 ;
+    sig |= (uint16_t)pinky.ContactTip()   << 7 ;
+    sig |= (uint16_t)pinky.ContactMid()   << 8 ;
+    sig |= (uint16_t)tiFold.ContactTip()  << 9 ;
+    sig |= (uint16_t)imFold.ContactTip()  << 10 ;
+    sig |= (uint16_t)mrFold.ContactTip()  << 11 ;
+    sig |= (uint16_t)rpFold.ContactTip()  << 12 ;
 
-Lsm303 Hand::Lsm303Vals( unsigned int i ){
-
-    /* Ensure that values have been read in and that the index is in range. */
-    assert( lsm303 != NULL ) ;
-    assert( i < NUM_LSM303 ) ;
-
-    return lsm303[i] ;
+    return sig ;
 
 }
 
-/*----------Hand::Lsm9dofVals( )------------------------------------------------------
+/*----------Hand::QuantizeFlex( )----------------------------------------------------
 
-  PURPOSE:  Given an index, return the corresponding LSM9DOF accelerometer values.
+  PURPOSE:  Quantize a flex sensor value into steps of FLEX_STEP.
 
-  INPUT  PARAMETERS:  i     -- the index value.
+  INPUT  PARAMETERS:  flex -- the flex sensor value.
+
+  RETURN VALUE:  The quantized flex sensor value, limited to the range 0-255.
 
 -----------------------------------------------------------------------------------*/
 
-Lsm9dof Hand::Lsm9dofVals( unsigned int i ){
+uint8_t Hand::QuantizeFlex( double flex ){
+
+    double bin = floor( (flex / FLEX_STEP) + 0.5 ) ;  /* The quantized value. */
 
-    /* Ensure that values have been read in and that the index is in range. */
-    assert( lsm9dof != NULL ) ;
-    assert( i < NUM_LSM9DOF ) ;
+    if( bin < 0.0 )
+        bin = 0.0 ;
+    if( bin > UCHAR_MAX )
+        bin = UCHAR_MAX ;
 
-    return lsm9dof[i] ;
+    return (uint8_t)bin ;
 
 }
 
-/*----------Hand::LsmInit( )---------------------------------------------------------
+/*----------Hand::FlexVector( )------------------------------------------------------
 
-  PURPOSE:  Function to initialize the arrays for the LSM303 and LSM9DOF
-            accelerometer values.
+  PURPOSE:  Quantize the index, middle, ring, and pinky flex sensor values. The thumb
+            does not have a flex sensor, and the remaining entries are padded with
+            zeros.
+
+  OUTPUT PARAMETERS:  vec -- the quantized flex sensor values.
 
 -----------------------------------------------------------------------------------*/
 
-void Hand::LsmInit( ){
+void Hand::FlexVector( uint8_t vec[FLEX_VECTOR_LEN] ) const {
+
+    unsigned int i ;  /* An iterator. */
 
-    lsm303 = new Lsm303 [ NUM_LSM9DOF ] ;
-    lsm9dof = new Lsm9dof [ NUM_LSM9DOF ] ;
+    vec[0] = QuantizeFlex( index.Flex() ) ;
+    vec[1] = QuantizeFlex( middle.Flex() ) ;
+    vec[2] = QuantizeFlex( ring.Flex() ) ;
+    vec[3] = QuantizeFlex( pinky.Flex() ) ;
+    for( i = 4 ; i < FLEX_VECTOR_LEN ; i++ ){
+        vec[i] = 0 ;
+    }
 
     return ;
 
@@ -108,8 +118,9 @@ void Hand::LsmInit( ){
 
 -----------------------------------------------------------------------------------*/
 
-void Hand::Set( Finger th, Finger in, Finger mi, Finger ri, Finger pi, Fold ti, Fold im, Fold mr, Fold rp, 
-                Lsm303 l3030, Lsm303 l3031, Lsm9dof l9dof0, Lsm9dof l9dof1 ){
+void Hand::Set( const Finger &th, const Finger &in, const Finger &mi, const Finger &ri, const Finger &pi,
+                const Fold &ti, const Fold &im, const Fold &mr, const Fold &rp, 
+                const Lsm303 &l3030, const Lsm303 &l3031, const Lsm9dof &l9dof0, const Lsm9dof &l9dof1 ){
 
 	thumb  = th ;
 	index  = in ;
@@ -124,6 +135,8 @@ void Hand::Set( Finger th, Finger in, Finger mi, Finger ri, Finger pi, Fold ti,
 	lsm303[1] = l3031 ;
 	lsm9dof[0] = l9dof0 ;
 	lsm9dof[1] = l9dof1 ;
+	/* The orientation is fused from the values once they are set. */
+	orientation.defined = false ;
 	defined = true ;
 	
 	return ;
@@ -18,49 +18,61 @@
 #define HAND_H
 
 #include <iostream>
+#include <assert.h>
+#include <stdint.h>
 #include "Finger.h"
 #include "Fold.h"
 #include "Lsm303.h"
 #include "Lsm9dof.h"
+#include "ImuFusion.h"
 using namespace std ;
 
 #define NUM_LSM303 2
 #define NUM_LSM9DOF 2
+#define NUM_CONTACT_BITS 13   /* Number of contact sensors packed into a contact signature. */
+#define FLEX_VECTOR_LEN 8     /* Width of the quantized flex vector. Only the first 4 entries are used. */
+#define FLEX_STEP 5.0         /* Flex sensor values are quantized by i2c_transfer in steps of 5. */
 
 /*----------Type Definitions-------------------------------------------------------*/
 
-/* Type "Hand" represents a left or hand.       */
+/* Type "Hand" represents a left or hand. The accelerometers are stored inline, so a
+   "Hand" can be copied from one pipeline stage to the next without touching the heap. */
 
 class Hand { 
 
   public:  
 	
 	 /* Default and explicit constructor functions */
-         inline Hand( ) : defined(false), lsm303(NULL), lsm9dof(NULL) { }          
-         inline Hand( Finger th, Finger in, Finger mi, Finger ri, Finger pi, Fold ti, Fold im, Fold mr, Fold rp ) : 
-	   defined(true), thumb(th), index(in), middle(mi), ring(ri), pinky(pi), tiFold(ti), imFold(im), mrFold(mr), rpFold(rp) { }
-	 /* Destructor function. ~Hand( ) ; */
+         inline Hand( ) : defined(false) { orientation.defined = false ; }          
+         inline Hand( const Finger &th, const Finger &in, const Finger &mi, const Finger &ri, const Finger &pi,
+                      const Fold &ti, const Fold &im, const Fold &mr, const Fold &rp ) : 
+	   defined(true), thumb(th), index(in), middle(mi), ring(ri), pinky(pi), tiFold(ti), imFold(im), mrFold(mr), rpFold(rp) { orientation.defined = false ; }
 
 	 /* Accessor functions */
-   	 inline Finger  Thumb( )       const { return thumb       ; }  /* Access thumb.  */
-	 inline Finger  Index( )       const { return index       ; }  /* Access index finger.  */
-	 inline Finger  Middle( )      const { return middle      ; }  /* Access middle finger.  */
-	 inline Finger  Ring( )        const { return ring        ; }  /* Access ring finger.  */
-	 inline Finger  Pinky( )       const { return pinky       ; }  /* Access pinky finger.  */
-	 inline Fold    TiFold( )      const { return tiFold      ; }  /* Access thumb-index interdigital fold. */
-	 inline Fold    ImFold( )      const { return imFold      ; }  /* Access index-middle interdigital fold. */
-	 inline Fold    MrFold( )      const { return mrFold      ; }  /* Access middler-ring interdigital fold. */
-	 inline Fold    RpFold( )      const { return rpFold      ; }  /* Access ring-pinky interdigital fold. */
+   	 inline const Finger &Thumb( )  const { return thumb       ; }  /* Access thumb.  */
+	 inline const Finger &Index( )  const { return index       ; }  /* Access index finger.  */
+	 inline const Finger &Middle( ) const { return middle      ; }  /* Access middle finger.  */
+	 inline const Finger &Ring( )   const { return ring        ; }  /* Access ring finger.  */
+	 inline const Finger &Pinky( )  const { return pinky       ; }  /* Access pinky finger.  */
+	 inline const Fold   &TiFold( ) const { return tiFold      ; }  /* Access thumb-index interdigital fold. */
+	 inline const Fold   &ImFold( ) const { return imFold      ; }  /* Access index-middle interdigital fold. */
+	 inline const Fold   &MrFold( ) const { return mrFold      ; }  /* Access middler-ring interdigital fold. */
+	 inline const Fold   &RpFold( ) const { return rpFold      ; }  /* Access ring-pinky interdigital fold. */
 	 inline bool    Defined( )     const { return defined ; }      /* Access defined value. */         
-	 Lsm303  Lsm303Vals( unsigned int i )  ;                       /* Access LSM303 accelerometer. */
-	 Lsm9dof Lsm9dofVals( unsigned int i ) ;                       /* Access LSM9DOF accelerometer. */
+	 inline const Lsm303  &Lsm303Vals( unsigned int i )  const { assert( i < NUM_LSM303 ) ; return lsm303[i] ; }    /* Access LSM303 accelerometer. */
+	 inline const Lsm9dof &Lsm9dofVals( unsigned int i ) const { assert( i < NUM_LSM9DOF ) ; return lsm9dof[i] ; }  /* Access LSM9DOF accelerometer. */
+	 inline const HandOrientation &Orientation( ) const { return orientation ; }   /* Access fused orientation, if defined. */
+	 uint16_t ContactSignature( ) const ;                          /* Access contact sensors as a bit mask. */
+	 void    FlexVector( uint8_t vec[FLEX_VECTOR_LEN] ) const ;    /* Access quantized flex sensor values. */
+	 static uint8_t QuantizeFlex( double flex ) ;                  /* Quantize a single flex sensor value. */
 	 
 	 /* Mutator function */
          /* Set fingers, interdigital folds, accelerometer values. */
-	 void Set( Finger th, Finger in, Finger mi, Finger ri, Finger pi, 
-                   Fold tiFold, Fold imFold, Fold mrFold, Fold rpFold, Lsm303 l3030, Lsm303 l3031, Lsm9dof l9dof0, Lsm9dof l9dof1 ) ;  
-	 /* Initializers for accelerometers. */
-	 void LsmInit( ) ;
+	 void Set( const Finger &th, const Finger &in, const Finger &mi, const Finger &ri, const Finger &pi, 
+                   const Fold &tiFold, const Fold &imFold, const Fold &mrFold, const Fold &rpFold,
+                   const Lsm303 &l3030, const Lsm303 &l3031, const Lsm9dof &l9dof0, const Lsm9dof &l9dof1 ) ;  
+	 /* Set the orientation fused by ImuFusion. */
+	 inline void SetOrientation( const HandOrientation &o ) { orientation = o ; }
 			  
 	 /* Input/Output functions */
 	 void Show( ostream &os = cout ) const ;
@@ -77,8 +89,9 @@ class Hand {
          Fold   imFold ;                                 /* Index-middle interdigital fold. */
          Fold   mrFold ;                                 /* Middle-ring interdigital fold. */
          Fold   rpFold ;                                 /* Ring-pinky interdigital fold. */
-	 Lsm303* lsm303 ;                                /* The LSM303 accelerometer values. There are 2 accelerometers attached. */
-	 Lsm9dof* lsm9dof ;                              /* The LSM9DOF accelerometer values. There are 2 accelerometers attached.*/
+	 Lsm303 lsm303[NUM_LSM303] ;                     /* The LSM303 accelerometer values. There are 2 accelerometers attached. */
+	 Lsm9dof lsm9dof[NUM_LSM9DOF] ;                  /* The LSM9DOF accelerometer values. There are 2 accelerometers attached.*/
+	 HandOrientation orientation ;                   /* The orientation of each accelerometer, fused over the previous frames. */
 	 				
 } ;
 
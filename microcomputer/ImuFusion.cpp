@@ -0,0 +1,288 @@
+/***********ImuFusion.cpp***********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The Reset(), Start(), and Update() functions of the "ImuFusion" class are
+            defined in this module.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <math.h>
+#include "ImuFusion.h"
+#include "Hand.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#define FUSION_EPSILON 1e-12f  /* Added to a squared length so that a zero vector stays zero when normalized. */
+
+/* Fails to compile if the accelerometers of a hand do not fill the lanes of the filter. */
+typedef char fusion_imus_check[((NUM_LSM303 + NUM_LSM9DOF) == FUSION_IMUS) ? 1 : -1] ;
+
+/*----------inv_length( )------------------------------------------------------------
+
+  PURPOSE:  Compute 1 / sqrt(n) for the squared length of each accelerometer's vector,
+            four at a time.
+
+  INPUT  PARAMETERS:  n   -- the squared lengths.
+
+  OUTPUT PARAMETERS:  inv -- the inverse lengths.
+
+-----------------------------------------------------------------------------------*/
+
+static inline void inv_length( const float n[FUSION_IMUS], float inv[FUSION_IMUS] ){
+
+#if defined(__SSE2__)
+    __m128 v = _mm_add_ps( _mm_loadu_ps(n), _mm_set1_ps(FUSION_EPSILON) ) ;
+    _mm_storeu_ps( inv, _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(v)) ) ;
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    float32x4_t v = vaddq_f32( vld1q_f32(n), vdupq_n_f32(FUSION_EPSILON) ) ;
+    float32x4_t r = vrsqrteq_f32( v ) ;
+    /* Two Newton steps bring the estimate to full single precision. */
+    r = vmulq_f32( r, vrsqrtsq_f32(vmulq_f32(v, r), r) ) ;
+    r = vmulq_f32( r, vrsqrtsq_f32(vmulq_f32(v, r), r) ) ;
+    vst1q_f32( inv, r ) ;
+#else
+    unsigned int i ;
+    for( i = 0 ; i < FUSION_IMUS ; i++ ){
+        inv[i] = 1.0f / sqrtf( n[i] + FUSION_EPSILON ) ;
+    }
+#endif
+
+    return ;
+
+}
+
+/*----------ImuFusion::ImuFusion( )--------------------------------------------------
+
+  PURPOSE:  Create a filter that starts from the first frame.
+
+-----------------------------------------------------------------------------------*/
+
+ImuFusion::ImuFusion( ){
+
+    Reset() ;
+
+}
+
+/*----------ImuFusion::Reset( )------------------------------------------------------
+
+  PURPOSE:  Forget the orientation, so that the next frame starts the filter over.
+            Used when the hand is taken off, which may be to put on another glove, so
+            the gyrometer offset is learned again.
+
+-----------------------------------------------------------------------------------*/
+
+void ImuFusion::Reset( ){
+
+    unsigned int i ;  /* An iterator. */
+
+    started = false ;
+    lastNs = 0 ;
+    for( i = 0 ; i < FUSION_IMUS ; i++ ){
+        q[0][i] = 1.0f ;
+        q[1][i] = q[2][i] = q[3][i] = 0.0f ;
+        bias[0][i] = bias[1][i] = bias[2][i] = 0.0f ;
+        stillTime[i] = 0.0f ;
+    }
+
+    return ;
+
+}
+
+/*----------ImuFusion::Start( )------------------------------------------------------
+
+  PURPOSE:  Start the filter from a single frame: each orientation is the smallest
+            turn that brings gravity to the measured direction. The gyrometer offset
+            learned so far is kept, as the hand may be moving.
+
+  INPUT  PARAMETERS:  a -- the accelerometer readings, in g.
+
+-----------------------------------------------------------------------------------*/
+
+void ImuFusion::Start( const float a[3][FUSION_IMUS] ){
+
+    float n[FUSION_IMUS] ;    /* Squared length of each reading. */
+    float inv[FUSION_IMUS] ;  /* Inverse length of each reading. */
+    float r[FUSION_IMUS] ;    /* Inverse length of each quaternion. */
+    unsigned int i ;          /* An iterator. */
+    unsigned int k ;          /* An iterator. */
+
+    for( i = 0 ; i < FUSION_IMUS ; i++ ){
+        n[i] = (a[0][i] * a[0][i]) + (a[1][i] * a[1][i]) + (a[2][i] * a[2][i]) ;
+    }
+    inv_length( n, inv ) ;
+    for( i = 0 ; i < FUSION_IMUS ; i++ ){
+        float ax = a[0][i] * inv[i] ;
+        float ay = a[1][i] * inv[i] ;
+        float az = a[2][i] * inv[i] ;
+        if( n[i] == 0.0f ){
+            /* No reading, such as a glove without this accelerometer. */
+            q[0][i] = 1.0f ; q[1][i] = 0.0f ; q[2][i] = 0.0f ; q[3][i] = 0.0f ;
+        }
+        else if( az < -0.999f ){
+            /* Upside down, where any turn about a horizontal axis will do. */
+            q[0][i] = 0.0f ; q[1][i] = 1.0f ; q[2][i] = 0.0f ; q[3][i] = 0.0f ;
+        }
+        else{
+            q[0][i] = 1.0f + az ; q[1][i] = ay ; q[2][i] = -ax ; q[3][i] = 0.0f ;
+        }
+        n[i] = (q[0][i] * q[0][i]) + (q[1][i] * q[1][i]) + (q[2][i] * q[2][i]) + (q[3][i] * q[3][i]) ;
+    }
+    inv_length( n, r ) ;
+    for( k = 0 ; k < 4 ; k++ ){
+        for( i = 0 ; i < FUSION_IMUS ; i++ ){
+            q[k][i] *= r[i] ;
+        }
+    }
+    started = true ;
+
+    return ;
+
+}
+
+/*----------ImuFusion::Update( )-----------------------------------------------------
+
+  PURPOSE:  Add the next frame of a hand to the filter: the gyrometer rate, less its
+            offset averaged while the hand is still, turns each orientation, and the
+            gradient of the gravity error pulls it towards the measured direction at
+            FUSION_BETA, or FUSION_FAST_BETA while the gyrometer is at full scale.
+            The orientation, the direction of gravity, and the acceleration left
+            over are stored in the hand. A hand that is not worn resets the filter.
+
+  INPUT  PARAMETERS:  hand -- the next frame, given its orientation.
+                      ns   -- the time the frame was read, 0 if unknown, in which
+                              case frames are taken to be FUSION_PERIOD_NS apart.
+
+-----------------------------------------------------------------------------------*/
+
+void ImuFusion::Update( Hand &hand, uint64_t ns ){
+
+    HandOrientation o ;           /* The orientation found. */
+    float a[3][FUSION_IMUS] ;     /* Accelerometer readings, in g. */
+    float w[3][FUSION_IMUS] ;     /* Gyrometer readings, in counts. */
+    float n[FUSION_IMUS] ;        /* Squared lengths. */
+    float inv[FUSION_IMUS] ;      /* Inverse lengths. */
+    float valid[FUSION_IMUS] ;    /* 1 for an accelerometer with a reading, 0 otherwise. */
+    float dt = FUSION_PERIOD_NS / 1e9f ;  /* Time since the last frame, in seconds. */
+    unsigned int i ;              /* An iterator. */
+    unsigned int k ;              /* An iterator. */
+
+    if( !hand.Defined() ){
+        Reset() ;
+        return ;
+    }
+    for( i = 0 ; i < NUM_LSM303 ; i++ ){
+        const Lsm303 &lsm = hand.Lsm303Vals( i ) ;
+        const Lsm9dof &gyro = hand.Lsm9dofVals( i ) ;  /* The LSM9DOF on the same side. */
+        a[0][i] = (float)lsm.AccelX() / FUSION_LSM303_G ;
+        a[1][i] = (float)lsm.AccelY() / FUSION_LSM303_G ;
+        a[2][i] = (float)lsm.AccelZ() / FUSION_LSM303_G ;
+        w[0][i] = (float)gyro.GyroX() ;
+        w[1][i] = (float)gyro.GyroY() ;
+        w[2][i] = (float)gyro.GyroZ() ;
+    }
+    for( i = 0 ; i < NUM_LSM9DOF ; i++ ){
+        const Lsm9dof &lsm = hand.Lsm9dofVals( i ) ;
+        a[0][NUM_LSM303 + i] = (float)lsm.AccelX() / FUSION_LSM9DOF_G ;
+        a[1][NUM_LSM303 + i] = (float)lsm.AccelY() / FUSION_LSM9DOF_G ;
+        a[2][NUM_LSM303 + i] = (float)lsm.AccelZ() / FUSION_LSM9DOF_G ;
+        w[0][NUM_LSM303 + i] = (float)lsm.GyroX() ;
+        w[1][NUM_LSM303 + i] = (float)lsm.GyroY() ;
+        w[2][NUM_LSM303 + i] = (float)lsm.GyroZ() ;
+    }
+    if( (ns != 0) && (lastNs != 0) )
+        dt = (ns > lastNs) ? (ns - lastNs) / 1e9f : 0.0f ;
+    lastNs = ns ;
+    for( i = 0 ; i < FUSION_IMUS ; i++ ){
+        n[i] = (a[0][i] * a[0][i]) + (a[1][i] * a[1][i]) + (a[2][i] * a[2][i]) ;
+        valid[i] = (n[i] > 0.0f) ? 1.0f : 0.0f ;
+    }
+    if( !started || (dt > FUSION_MAX_DT) ){
+        Start( a ) ;
+    }
+    else{
+        float s[4][FUSION_IMUS] ;  /* Gradient of the gravity error. */
+        float g[3][FUSION_IMUS] ;  /* Gyrometer rates, in radians per second. */
+        float full[FUSION_IMUS] ;  /* 1 while a gyrometer axis is at full scale, 0 otherwise. */
+        float beta[FUSION_IMUS] ;  /* Correction towards the measured gravity. */
+        float alpha[FUSION_IMUS] ; /* Weight of this frame in the gyrometer offset, 0 unless the hand is still. */
+        for( i = 0 ; i < FUSION_IMUS ; i++ ){
+            float r0 = w[0][i] - bias[0][i], r1 = w[1][i] - bias[1][i], r2 = w[2][i] - bias[2][i] ;
+            full[i] = ((fabsf(w[0][i]) >= FUSION_GYRO_FULL) || (fabsf(w[1][i]) >= FUSION_GYRO_FULL) ||
+                       (fabsf(w[2][i]) >= FUSION_GYRO_FULL)) ? 1.0f : 0.0f ;
+            beta[i] = FUSION_BETA + (full[i] * (FUSION_FAST_BETA - FUSION_BETA)) ;
+            /* The hand is still when it hardly turns and feels nothing but gravity; any other
+               reading holds a turn of the sign, which is not the offset. */
+            alpha[i] = 0.0f ;
+            if( (((r0 * r0) + (r1 * r1) + (r2 * r2)) < (FUSION_STILL_RATE * FUSION_STILL_RATE)) &&
+                (n[i] > ((1.0f - FUSION_STILL_ACCEL) * (1.0f - FUSION_STILL_ACCEL))) &&
+                (n[i] < ((1.0f + FUSION_STILL_ACCEL) * (1.0f + FUSION_STILL_ACCEL))) && (dt > 0.0f) ){
+                /* The mean of the still readings, until it spans FUSION_BIAS_TAU. */
+                stillTime[i] = fminf( stillTime[i] + dt, FUSION_BIAS_TAU ) ;
+                alpha[i] = dt / stillTime[i] ;
+            }
+        }
+        for( k = 0 ; k < 3 ; k++ ){
+            for( i = 0 ; i < FUSION_IMUS ; i++ ){
+                bias[k][i] += alpha[i] * (w[k][i] - bias[k][i]) ;
+                g[k][i] = (w[k][i] - bias[k][i]) * FUSION_GYRO_SCALE ;
+            }
+        }
+        inv_length( n, inv ) ;
+        for( i = 0 ; i < FUSION_IMUS ; i++ ){
+            float q0 = q[0][i], q1 = q[1][i], q2 = q[2][i], q3 = q[3][i] ;
+            /* The error between gravity as the orientation predicts it and as measured. */
+            float f0 = 2.0f * ((q1 * q3) - (q0 * q2)) - (a[0][i] * inv[i]) ;
+            float f1 = 2.0f * ((q0 * q1) + (q2 * q3)) - (a[1][i] * inv[i]) ;
+            float f2 = 1.0f - 2.0f * ((q1 * q1) + (q2 * q2)) - (a[2][i] * inv[i]) ;
+            s[0][i] = (-2.0f * q2 * f0) + (2.0f * q1 * f1) ;
+            s[1][i] = (2.0f * q3 * f0) + (2.0f * q0 * f1) - (4.0f * q1 * f2) ;
+            s[2][i] = (-2.0f * q0 * f0) + (2.0f * q3 * f1) - (4.0f * q2 * f2) ;
+            s[3][i] = (2.0f * q1 * f0) + (2.0f * q2 * f1) ;
+            n[i] = (s[0][i] * s[0][i]) + (s[1][i] * s[1][i]) + (s[2][i] * s[2][i]) + (s[3][i] * s[3][i]) ;
+        }
+        inv_length( n, inv ) ;
+        for( i = 0 ; i < FUSION_IMUS ; i++ ){
+            float q0 = q[0][i], q1 = q[1][i], q2 = q[2][i], q3 = q[3][i] ;
+            float step = beta[i] * inv[i] * valid[i] ;
+            q[0][i] += dt * ((0.5f * ((-q1 * g[0][i]) - (q2 * g[1][i]) - (q3 * g[2][i]))) - (step * s[0][i])) ;
+            q[1][i] += dt * ((0.5f * ((q0 * g[0][i]) + (q2 * g[2][i]) - (q3 * g[1][i]))) - (step * s[1][i])) ;
+            q[2][i] += dt * ((0.5f * ((q0 * g[1][i]) - (q1 * g[2][i]) + (q3 * g[0][i]))) - (step * s[2][i])) ;
+            q[3][i] += dt * ((0.5f * ((q0 * g[2][i]) + (q1 * g[1][i]) - (q2 * g[0][i]))) - (step * s[3][i])) ;
+            n[i] = (q[0][i] * q[0][i]) + (q[1][i] * q[1][i]) + (q[2][i] * q[2][i]) + (q[3][i] * q[3][i]) ;
+        }
+        inv_length( n, inv ) ;
+        for( k = 0 ; k < 4 ; k++ ){
+            for( i = 0 ; i < FUSION_IMUS ; i++ ){
+                q[k][i] *= inv[i] ;
+            }
+        }
+    }
+    o.defined = true ;
+    for( i = 0 ; i < FUSION_IMUS ; i++ ){
+        o.quat[0][i] = q[0][i] ;
+        o.quat[1][i] = q[1][i] ;
+        o.quat[2][i] = q[2][i] ;
+        o.quat[3][i] = q[3][i] ;
+        /* An accelerometer without a reading has no direction of gravity, as in MotionFeatures. */
+        o.gravity[0][i] = 2.0f * ((q[1][i] * q[3][i]) - (q[0][i] * q[2][i])) * valid[i] ;
+        o.gravity[1][i] = 2.0f * ((q[0][i] * q[1][i]) + (q[2][i] * q[3][i])) * valid[i] ;
+        o.gravity[2][i] = ((q[0][i] * q[0][i]) - (q[1][i] * q[1][i]) - (q[2][i] * q[2][i]) + (q[3][i] * q[3][i])) * valid[i] ;
+        o.linear[0][i] = a[0][i] - o.gravity[0][i] ;
+        o.linear[1][i] = a[1][i] - o.gravity[1][i] ;
+        o.linear[2][i] = a[2][i] - o.gravity[2][i] ;
+    }
+    hand.SetOrientation( o ) ;
+
+    return ;
+
+}
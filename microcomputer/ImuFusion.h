@@ -0,0 +1,100 @@
+/***********ImuFusion.h*************************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the type "HandOrientation", the orientation of
+            each accelerometer of a hand, and the class "ImuFusion", which estimates
+            it from every frame with a Madgwick filter. Hand.h and ImuFusion.cpp
+            include this file.
+
+            The filter integrates the gyrometer and pulls the estimate towards the
+            measured direction of gravity at FUSION_BETA, so the orientation follows
+            fast turns without the noise of a single accelerometer reading, and the
+            acceleration of the hand is left over once gravity is taken out. A flick
+            of the wrist can turn faster than the gyrometer reads, so while it is at
+            full scale the estimate follows gravity at FUSION_FAST_BETA instead. The
+            offset of the gyrometer is only learned while the hand is still, so that
+            the turns of a sign are not taken for it: the mean of the still readings
+            at first, then an average over FUSION_BIAS_TAU of stillness. Only
+            the LSM9DOF has a gyrometer, so each LSM303 uses the rate of the LSM9DOF
+            on the same side of the hand. The magnetometers are not used: they are
+            not calibrated, and the heading of the hand carries no meaning in a
+            sign, so the orientation is only known up to a turn about gravity.
+
+            The four accelerometers are filtered together. Each value is kept as an
+            array of FUSION_IMUS floats, one per accelerometer, in the order of the
+            MotionFeatures orientation vector: top and bottom LSM303, then top and
+            bottom LSM9DOF. Every step is a loop over the four, which the compiler
+            turns into single vector instructions.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef IMUFUSION_H
+#define IMUFUSION_H
+
+#include <stdint.h>
+
+#define FUSION_IMUS         4           /* Number of accelerometers on a hand, filtered together. */
+#define FUSION_BETA         0.5f        /* Largest correction towards the measured gravity, in radians per second. */
+#define FUSION_FAST_BETA    5.0f        /* Correction while a gyrometer axis is at full scale and reads short of the rate. */
+#define FUSION_BIAS_TAU     5.0f        /* Time still over which the gyrometer offset is averaged, in seconds. */
+#define FUSION_STILL_RATE   1150.0f     /* Largest rate, less the offset, of a still hand, in counts (10 dps). */
+#define FUSION_STILL_ACCEL  0.05f       /* Largest difference from 1 g of the acceleration of a still hand, in g. */
+#define FUSION_PERIOD_NS    10000000ULL /* Time between frames that carry no timestamp, in nanoseconds. */
+#define FUSION_MAX_DT       0.1f        /* Longest time integrated in one step, in seconds. Longer gaps restart the filter. */
+#define FUSION_LSM303_G     1000.0f     /* LSM303 accelerometer reading of 1 g (1 mg per count). */
+#define FUSION_LSM9DOF_G    16393.0f    /* LSM9DOF accelerometer reading of 1 g (0.061 mg per count). */
+#define FUSION_GYRO_SCALE   1.527e-4f   /* LSM9DOF gyrometer rate per count, in radians per second (8.75 mdps). */
+#define FUSION_GYRO_FULL    32000.0f    /* LSM9DOF gyrometer reading, in counts, taken as full scale (245 dps). */
+
+class Hand ;
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "HandOrientation" represents the fused orientation of each accelerometer of a hand.
+   Each array holds one value per accelerometer. */
+
+struct HandOrientation {
+	 bool defined ;                                  /* True once the filter has estimated the orientation. */
+	 float quat[4][FUSION_IMUS] ;                    /* Unit quaternion w, x, y, z of the sensor relative to the earth. */
+	 float gravity[3][FUSION_IMUS] ;                 /* Unit direction of gravity, in sensor axes. */
+	 float linear[3][FUSION_IMUS] ;                  /* Acceleration less gravity, in g, in sensor axes. */
+} ;
+
+/* Type "ImuFusion" tracks the orientation of the accelerometers of one hand from frame
+   to frame. It holds no pointers and never allocates, so it can live on the stack of
+   the decode stage. */
+
+class ImuFusion {
+
+  public:
+
+	 /* Default constructor function */
+	 ImuFusion( ) ;
+
+	 /* Accessor functions */
+	 inline bool Started( ) const { return started ; }              /* Access whether the filter has been started. */
+
+	 /* Mutator functions */
+	 void Reset( ) ;                                                /* Restarts from the next frame. */
+	 void Update( Hand &hand, uint64_t ns ) ;                       /* Adds the next frame, storing the orientation in the hand. */
+
+  private:
+
+	 void Start( const float a[3][FUSION_IMUS] ) ;
+
+	 bool started ;                                  /* True once the filter has been started. */
+	 uint64_t lastNs ;                               /* Time of the last frame, 0 if unknown. */
+	 float q[4][FUSION_IMUS] ;                       /* The orientation of each accelerometer. */
+	 float bias[3][FUSION_IMUS] ;                    /* The gyrometer offset, in counts. */
+	 float stillTime[FUSION_IMUS] ;                  /* Time the hand was still while the offset was learned, up to FUSION_BIAS_TAU. */
+
+} ;
+
+#endif
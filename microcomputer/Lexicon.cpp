@@ -0,0 +1,545 @@
+/***********Lexicon.cpp*************************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The Add(), AddPair(), Build(), Clear(), Save(), Load(), Child(), and
+            PairCost() functions of the "Lexicon" class are defined in this module.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <algorithm>
+#include <map>
+#include <math.h>
+#include <string.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "Lexicon.h"
+#include "../microcontroller/sensor_frame.h"
+
+/* Type "TrieBuilder" is a node of the trie while it is being built, before its children
+   are laid out next to each other. */
+
+struct TrieBuilder {
+    map<char, uint32_t> children ;   /* The nodes extending this prefix, by letter. */
+    uint32_t word ;                  /* The word spelled by this prefix, or LEXICON_NONE. */
+    uint32_t best ;                  /* The most likely word starting with this prefix. */
+    char letter ;                    /* The last letter of the prefix. */
+} ;
+
+/*----------count_more( )------------------------------------------------------------
+
+  PURPOSE:  Order words by count, most common first, and then alphabetically, so that
+            the words kept by Build() do not depend on the order they were added.
+
+-----------------------------------------------------------------------------------*/
+
+static bool count_more( const pair<string, double> &a, const pair<string, double> &b ){
+
+    if( a.second != b.second )
+        return a.second > b.second ;
+
+    return a.first < b.first ;
+
+}
+
+/*----------bigram_less( )-----------------------------------------------------------
+
+  PURPOSE:  Order word pairs by their first word and then by the word following it,
+            so that PairCost() can binary search them.
+
+-----------------------------------------------------------------------------------*/
+
+static bool bigram_less( const LexiconBigram &a, const LexiconBigram &b ){
+
+    if( a.prev != b.prev )
+        return a.prev < b.prev ;
+
+    return a.next < b.next ;
+
+}
+
+/*----------file_align( )------------------------------------------------------------
+
+  PURPOSE:  Round an offset within a compiled lexicon file up to the next section.
+
+-----------------------------------------------------------------------------------*/
+
+static inline uint32_t file_align( size_t offset ){
+
+    return (uint32_t)(((offset + LEXICON_FILE_ALIGN - 1) / LEXICON_FILE_ALIGN) * LEXICON_FILE_ALIGN) ;
+
+}
+
+/*----------valid_header( )----------------------------------------------------------
+
+  PURPOSE:  Check that a compiled lexicon file was written with the same layout as
+            this program uses, and that every section lies within the file, in order.
+
+  INPUT  PARAMETERS:  header -- the header of the file.
+                      size   -- the size of the file.
+
+  RETURN VALUE:  true if the header can be trusted
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+static bool valid_header( const LexiconFileHeader &header, size_t size ){
+
+    return (header.magic == LEXICON_FILE_MAGIC) && (header.version == LEXICON_FILE_VERSION) &&
+           (header.headerSize == sizeof(LexiconFileHeader)) && (header.fileSize == size) && (header.nodeCount > 0) &&
+           ((header.nodeOffset % LEXICON_FILE_ALIGN) == 0) && ((header.wordOffset % LEXICON_FILE_ALIGN) == 0) &&
+           ((header.bigramOffset % LEXICON_FILE_ALIGN) == 0) &&
+           (header.nodeOffset >= sizeof(LexiconFileHeader)) &&
+           ((header.nodeOffset + ((uint64_t)header.nodeCount * sizeof(LexiconNode))) <= header.wordOffset) &&
+           ((header.wordOffset + ((uint64_t)header.wordCount * sizeof(LexiconWord))) <= header.bigramOffset) &&
+           ((header.bigramOffset + ((uint64_t)header.bigramCount * sizeof(LexiconBigram))) <= header.textOffset) &&
+           (header.textOffset < header.fileSize) ;
+
+}
+
+/*----------Lexicon::Lexicon( )------------------------------------------------------
+
+  PURPOSE:  Create an empty lexicon.
+
+-----------------------------------------------------------------------------------*/
+
+Lexicon::Lexicon( ) : nodes(NULL), words(NULL), bigrams(NULL), text(NULL), nodeCount(0), wordCount(0), bigramCount(0),
+                      mapping(NULL), mappingLen(0) {
+
+}
+
+/*----------Lexicon::~Lexicon( )-----------------------------------------------------
+
+  PURPOSE:  Release the compiled lexicon file, if one is mapped.
+
+-----------------------------------------------------------------------------------*/
+
+Lexicon::~Lexicon( ){
+
+    Unmap() ;
+
+}
+
+/*----------Lexicon::Add( )----------------------------------------------------------
+
+  PURPOSE:  Add to the number of times a word was seen. Build() must be called before
+            the word can be found.
+
+  INPUT  PARAMETERS:  word  -- the word, in upper case.
+                      count -- the number of times it was seen.
+
+-----------------------------------------------------------------------------------*/
+
+void Lexicon::Add( const string &word, double count ){
+
+    if( !word.empty() && (count > 0.0) )
+        counts.push_back( make_pair(word, count) ) ;
+
+    return ;
+
+}
+
+/*----------Lexicon::AddPair( )------------------------------------------------------
+
+  PURPOSE:  Add to the number of times a word was seen following another word. Pairs
+            whose words are not kept by Build() are dropped.
+
+  INPUT  PARAMETERS:  prev  -- the first word, in upper case.
+                      next  -- the word following it.
+                      count -- the number of times the pair was seen.
+
+-----------------------------------------------------------------------------------*/
+
+void Lexicon::AddPair( const string &prev, const string &next, double count ){
+
+    if( !prev.empty() && !next.empty() && (count > 0.0) )
+        pairCounts.push_back( make_pair(make_pair(prev, next), count) ) ;
+
+    return ;
+
+}
+
+/*----------Lexicon::Build( )--------------------------------------------------------
+
+  PURPOSE:  Build the trie from the most common words added. Each word costs
+            -log P(word) among the words kept. A word pair costs the negative log of
+            an even mix of P(next | prev), as counted, and P(next), so that a pair
+            never seen costs the word's own cost plus LEXICON_BACKOFF_COST.
+
+            The nodes are laid out breadth first, so that the children of a node are
+            next to each other and Child() reads a single run of the table.
+
+  INPUT  PARAMETERS:  maxWords -- the most words to keep, or 0 to keep every word.
+
+-----------------------------------------------------------------------------------*/
+
+void Lexicon::Build( unsigned int maxWords ){
+
+    map<string, double> merged ;                 /* The count of each word. */
+    map<pair<string, string>, double> pairMerged ;  /* The count of each word pair. */
+    vector<pair<string, double> > kept ;         /* The words kept, most common first. */
+    map<string, uint32_t> ids ;                  /* The position of each kept word. */
+    map<uint32_t, double> prevTotal ;            /* The pairs counted for each first word. */
+    vector<TrieBuilder> trie ;                   /* The trie, before its layout. */
+    vector<uint32_t> order ;                     /* The trie nodes in breadth first order. */
+    vector<uint32_t> position ;                  /* The position of each trie node in that order. */
+    TrieBuilder node ;                           /* A new trie node. */
+    double total = 0.0 ;                         /* The count of every kept word. */
+    uint32_t at ;                                /* The node of the prefix read so far. */
+    size_t i ;                                   /* An iterator. */
+    size_t j ;                                   /* An iterator. */
+
+    for( i = 0 ; i < counts.size() ; i++ ){
+        merged[counts[i].first] += counts[i].second ;
+    }
+    for( i = 0 ; i < pairCounts.size() ; i++ ){
+        pairMerged[pairCounts[i].first] += pairCounts[i].second ;
+    }
+    kept.assign( merged.begin(), merged.end() ) ;
+    sort( kept.begin(), kept.end(), count_more ) ;
+    if( (maxWords > 0) && (kept.size() > maxWords) )
+        kept.resize( maxWords ) ;
+    sort( kept.begin(), kept.end() ) ;
+    Clear() ;
+    for( i = 0 ; i < kept.size() ; i++ ){
+        total += kept[i].second ;
+    }
+    /* The words are numbered in alphabetical order. */
+    wordTable.resize( kept.size() ) ;
+    for( i = 0 ; i < kept.size() ; i++ ){
+        ids[kept[i].first] = (uint32_t)i ;
+        wordTable[i].text = (uint32_t)textTable.size() ;
+        wordTable[i].cost = (float)-log( kept[i].second / total ) ;
+        textTable += kept[i].first ;
+        textTable += '\0' ;
+    }
+    node.word = LEXICON_NONE ;
+    node.best = LEXICON_NONE ;
+    node.letter = '\0' ;
+    trie.push_back( node ) ;
+    for( i = 0 ; i < kept.size() ; i++ ){
+        at = LEXICON_ROOT ;
+        for( j = 0 ; j < kept[i].first.size() ; j++ ){
+            map<char, uint32_t>::iterator child = trie[at].children.find( kept[i].first[j] ) ;
+            if( child == trie[at].children.end() ){
+                node.letter = kept[i].first[j] ;
+                trie.push_back( node ) ;
+                trie[at].children[kept[i].first[j]] = (uint32_t)(trie.size() - 1) ;
+                at = (uint32_t)(trie.size() - 1) ;
+            }
+            else
+                at = child->second ;
+        }
+        trie[at].word = (uint32_t)i ;
+    }
+    /* Children are always created after their parent, so walking backwards visits every
+       child before its parent. */
+    for( i = trie.size() ; i-- > 0 ; ){
+        trie[i].best = trie[i].word ;
+        for( map<char, uint32_t>::iterator child = trie[i].children.begin() ; child != trie[i].children.end() ; ++child ){
+            uint32_t best = trie[child->second].best ;
+            if( (trie[i].best == LEXICON_NONE) || (wordTable[best].cost < wordTable[trie[i].best].cost) )
+                trie[i].best = best ;
+        }
+    }
+    order.push_back( LEXICON_ROOT ) ;
+    for( i = 0 ; i < order.size() ; i++ ){
+        for( map<char, uint32_t>::iterator child = trie[order[i]].children.begin() ; child != trie[order[i]].children.end() ; ++child ){
+            order.push_back( child->second ) ;
+        }
+    }
+    position.resize( trie.size() ) ;
+    for( i = 0 ; i < order.size() ; i++ ){
+        position[order[i]] = (uint32_t)i ;
+    }
+    nodeTable.resize( order.size() ) ;
+    for( i = 0 ; i < order.size() ; i++ ){
+        const TrieBuilder &from = trie[order[i]] ;
+        LexiconNode &to = nodeTable[i] ;
+        memset( &to, 0, sizeof(to) ) ;
+        to.firstChild = from.children.empty() ? LEXICON_NONE : position[from.children.begin()->second] ;
+        to.word = from.word ;
+        to.best = from.best ;
+        to.numChildren = (uint8_t)from.children.size() ;
+        to.letter = from.letter ;
+    }
+    /* Word pairs, mixed evenly with the cost of the following word. */
+    for( map<pair<string, string>, double>::iterator p = pairMerged.begin() ; p != pairMerged.end() ; ++p ){
+        if( (ids.count(p->first.first) != 0) && (ids.count(p->first.second) != 0) )
+            prevTotal[ids[p->first.first]] += p->second ;
+    }
+    for( map<pair<string, string>, double>::iterator p = pairMerged.begin() ; p != pairMerged.end() ; ++p ){
+        LexiconBigram bigram ;
+        if( (ids.count(p->first.first) == 0) || (ids.count(p->first.second) == 0) )
+            continue ;
+        bigram.prev = ids[p->first.first] ;
+        bigram.next = ids[p->first.second] ;
+        bigram.cost = (float)-log( (0.5 * (p->second / prevTotal[bigram.prev])) + (0.5 * exp(-wordTable[bigram.next].cost)) ) ;
+        bigramTable.push_back( bigram ) ;
+    }
+    sort( bigramTable.begin(), bigramTable.end(), bigram_less ) ;
+    nodes = &nodeTable[0] ;
+    words = wordTable.empty() ? NULL : &wordTable[0] ;
+    bigrams = bigramTable.empty() ? NULL : &bigramTable[0] ;
+    text = textTable.c_str() ;
+    nodeCount = nodeTable.size() ;
+    wordCount = wordTable.size() ;
+    bigramCount = bigramTable.size() ;
+
+    return ;
+
+}
+
+/*----------Lexicon::Clear( )--------------------------------------------------------
+
+  PURPOSE:  Remove every word, and release the compiled lexicon file if one is mapped.
+            The counts added since the last Build() are kept.
+
+-----------------------------------------------------------------------------------*/
+
+void Lexicon::Clear( ){
+
+    Unmap() ;
+    nodeTable.clear() ;
+    wordTable.clear() ;
+    bigramTable.clear() ;
+    textTable.clear() ;
+    nodes = NULL ;
+    words = NULL ;
+    bigrams = NULL ;
+    text = NULL ;
+    nodeCount = 0 ;
+    wordCount = 0 ;
+    bigramCount = 0 ;
+
+    return ;
+
+}
+
+/*----------Lexicon::Child( )--------------------------------------------------------
+
+  PURPOSE:  Extend a prefix by a letter.
+
+  INPUT  PARAMETERS:  node   -- the prefix.
+                      letter -- the next letter, in upper case.
+
+  RETURN VALUE:  The node of the longer prefix
+                 LEXICON_NONE if no word starts with it.
+
+-----------------------------------------------------------------------------------*/
+
+uint32_t Lexicon::Child( uint32_t node, char letter ) const {
+
+    const LexiconNode* child ;  /* The next child of the prefix. */
+    unsigned int i ;            /* An iterator. */
+
+    if( (node >= nodeCount) || (nodes[node].firstChild == LEXICON_NONE) )
+        return LEXICON_NONE ;
+    child = nodes + nodes[node].firstChild ;
+    for( i = 0 ; i < nodes[node].numChildren ; i++ ){
+        if( child[i].letter == letter )
+            return nodes[node].firstChild + i ;
+        if( child[i].letter > letter )
+            break ;
+    }
+
+    return LEXICON_NONE ;
+
+}
+
+/*----------Lexicon::PairCost( )-----------------------------------------------------
+
+  PURPOSE:  Find the cost of a word following another word. At the start of the text,
+            or if the lexicon holds no word pairs, this is the word's own cost.
+
+  INPUT  PARAMETERS:  prev -- the previous word, or LEXICON_NONE.
+                      next -- the word.
+
+  RETURN VALUE:  -log P(next | prev).
+
+-----------------------------------------------------------------------------------*/
+
+float Lexicon::PairCost( uint32_t prev, uint32_t next ) const {
+
+    LexiconBigram key ;                   /* The pair to find. */
+    const LexiconBigram* found ;          /* The first pair not ordered before it. */
+
+    if( (prev == LEXICON_NONE) || (bigramCount == 0) )
+        return words[next].cost ;
+    key.prev = prev ;
+    key.next = next ;
+    found = lower_bound( bigrams, bigrams + bigramCount, key, bigram_less ) ;
+    if( (found != (bigrams + bigramCount)) && (found->prev == prev) && (found->next == next) )
+        return found->cost ;
+
+    return words[next].cost + LEXICON_BACKOFF_COST ;
+
+}
+
+/*----------Lexicon::Save( )---------------------------------------------------------
+
+  PURPOSE:  Write the lexicon to a compiled lexicon file, in the layout described in
+            Lexicon.h. The file is written next to its final name and renamed into
+            place, so a running program never maps a partly written file.
+
+  INPUT  PARAMETERS:  fName -- the compiled lexicon file.
+
+  RETURN VALUE:  true if the file was written
+                 false if the lexicon has not been built or the file could not be written.
+
+-----------------------------------------------------------------------------------*/
+
+bool Lexicon::Save( const char* fName ) const {
+
+    LexiconFileHeader header ;                   /* The file header. */
+    vector<uint8_t> file ;                       /* The whole file. */
+    string tmpName = string(fName) + ".tmp" ;    /* The file being written. */
+    FILE* output ;                               /* The file being written. */
+    size_t textLen = 0 ;                         /* Size of the text section. */
+    bool written ;                               /* True if the file was written in full. */
+
+    if( nodeCount == 0 ){
+        return false ;
+    }
+    if( wordCount > 0 ){
+        /* The text section ends with the NUL of the last word. */
+        textLen = words[wordCount - 1].text + strlen( WordText((uint32_t)(wordCount - 1)) ) + 1 ;
+    }
+    memset( &header, 0, sizeof(header) ) ;
+    header.magic = LEXICON_FILE_MAGIC ;
+    header.version = LEXICON_FILE_VERSION ;
+    header.headerSize = sizeof(LexiconFileHeader) ;
+    header.nodeCount = (uint32_t)nodeCount ;
+    header.wordCount = (uint32_t)wordCount ;
+    header.bigramCount = (uint32_t)bigramCount ;
+    header.nodeOffset = file_align( sizeof(LexiconFileHeader) ) ;
+    header.wordOffset = file_align( header.nodeOffset + (nodeCount * sizeof(LexiconNode)) ) ;
+    header.bigramOffset = file_align( header.wordOffset + (wordCount * sizeof(LexiconWord)) ) ;
+    header.textOffset = file_align( header.bigramOffset + (bigramCount * sizeof(LexiconBigram)) ) ;
+    header.fileSize = (uint32_t)(header.textOffset + textLen + 1) ;
+    file.assign( header.fileSize, 0 ) ;
+    memcpy( &file[header.nodeOffset], nodes, nodeCount * sizeof(LexiconNode) ) ;
+    if( wordCount > 0 ){
+        memcpy( &file[header.wordOffset], words, wordCount * sizeof(LexiconWord) ) ;
+        memcpy( &file[header.textOffset], text, textLen ) ;
+    }
+    if( bigramCount > 0 ){
+        memcpy( &file[header.bigramOffset], bigrams, bigramCount * sizeof(LexiconBigram) ) ;
+    }
+    header.crc = frame_crc32( &file[sizeof(LexiconFileHeader)], file.size() - sizeof(LexiconFileHeader) ) ;
+    memcpy( &file[0], &header, sizeof(header) ) ;
+    output = fopen( tmpName.c_str(), "wb" ) ;
+    if( output == NULL ){
+        return false ;
+    }
+    written = (fwrite( &file[0], 1, file.size(), output ) == file.size()) ;
+    written = (fclose( output ) == 0) && written ;
+    if( !written || (rename( tmpName.c_str(), fName ) != 0) ){
+        remove( tmpName.c_str() ) ;
+        return false ;
+    }
+
+    return true ;
+
+}
+
+/*----------Lexicon::Load( )---------------------------------------------------------
+
+  PURPOSE:  Replace the words with those of a compiled lexicon file. The file is mapped
+            read only, checked against its CRC, and read in place. The lexicon is
+            left unchanged if the file is missing, corrupt, or was compiled with a
+            different layout.
+
+  INPUT  PARAMETERS:  fName -- the compiled lexicon file.
+
+  RETURN VALUE:  true if the file was loaded
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool Lexicon::Load( const char* fName ){
+
+    int fd = open( fName, O_RDONLY | O_CLOEXEC ) ;   /* The compiled lexicon file. */
+    struct stat st ;                                  /* The size of the file. */
+    void* map ;                                       /* The mapped file. */
+    const uint8_t* base ;                             /* The start of the mapped file. */
+    LexiconFileHeader header ;                        /* The file header. */
+    size_t i ;                                        /* An iterator. */
+    bool valid ;                                      /* True if every node and word lies within the file. */
+
+    if( fd < 0 ){
+        return false ;
+    }
+    if( (fstat(fd, &st) != 0) || (st.st_size < (off_t)sizeof(LexiconFileHeader)) ){
+        close( fd ) ;
+        return false ;
+    }
+    map = mmap( NULL, st.st_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0 ) ;
+    close( fd ) ;
+    if( map == MAP_FAILED ){
+        return false ;
+    }
+    base = (const uint8_t*)map ;
+    memcpy( &header, base, sizeof(header) ) ;
+    valid = valid_header( header, st.st_size ) &&
+            (header.crc == frame_crc32( base + sizeof(LexiconFileHeader), header.fileSize - sizeof(LexiconFileHeader) )) &&
+            (base[header.fileSize - 1] == '\0') ;
+    /* The decoder follows the links without checking them, so they are checked once here. */
+    for( i = 0 ; valid && (i < header.nodeCount) ; i++ ){
+        const LexiconNode &node = ((const LexiconNode*)(base + header.nodeOffset))[i] ;
+        valid = ((node.firstChild == LEXICON_NONE) || ((node.firstChild + (uint64_t)node.numChildren) <= header.nodeCount)) &&
+                ((node.word == LEXICON_NONE) || (node.word < header.wordCount)) &&
+                ((node.best == LEXICON_NONE) || (node.best < header.wordCount)) ;
+    }
+    for( i = 0 ; valid && (i < header.wordCount) ; i++ ){
+        valid = (((const LexiconWord*)(base + header.wordOffset))[i].text < (header.fileSize - header.textOffset)) ;
+    }
+    for( i = 0 ; valid && (i < header.bigramCount) ; i++ ){
+        const LexiconBigram &bigram = ((const LexiconBigram*)(base + header.bigramOffset))[i] ;
+        valid = (bigram.prev < header.wordCount) && (bigram.next < header.wordCount) ;
+    }
+    if( !valid ){
+        munmap( map, st.st_size ) ;
+        return false ;
+    }
+    Clear() ;
+    mapping = map ;
+    mappingLen = st.st_size ;
+    nodes = (const LexiconNode*)(base + header.nodeOffset) ;
+    words = (const LexiconWord*)(base + header.wordOffset) ;
+    bigrams = (const LexiconBigram*)(base + header.bigramOffset) ;
+    text = (const char*)(base + header.textOffset) ;
+    nodeCount = header.nodeCount ;
+    wordCount = header.wordCount ;
+    bigramCount = header.bigramCount ;
+
+    return true ;
+
+}
+
+/*----------Lexicon::Unmap( )--------------------------------------------------------
+
+  PURPOSE:  Release the compiled lexicon file, if one is mapped.
+
+-----------------------------------------------------------------------------------*/
+
+void Lexicon::Unmap( ){
+
+    if( mapping != NULL ){
+        munmap( mapping, mappingLen ) ;
+        mapping = NULL ;
+        mappingLen = 0 ;
+    }
+
+    return ;
+
+}
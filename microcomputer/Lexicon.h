@@ -0,0 +1,152 @@
+/***********Lexicon.h***************************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the class "Lexicon", the words the word decoder
+            may spell, stored as a letter trie with the cost of each word, and an
+            optional table of word pairs. Variables.h, WordDecoder.h, Lexicon.cpp and
+            tools/lexicon_compile.cpp include this file.
+
+            Costs are negative natural logs of probabilities, so that the costs of a
+            word's letters and of the word itself can simply be added. Every node of
+            the trie also records the most likely word below it, so that a prefix
+            can be completed without searching.
+
+            The lexicon is compiled by tools/lexicon_compile and loaded with a single
+            mmap(), as the compiled gesture file is. The file is laid out as below,
+            every section starting on a cache line, in host byte order:
+
+              LexiconFileHeader  magic, version, layout, section offsets, CRC
+              nodes              LexiconNode per node, the root first, each node's
+                                 children next to each other in letter order
+              words              LexiconWord per word
+              bigrams            LexiconBigram per word pair, sorted by prev, next
+              text               the words, NUL terminated
+
+            Every section is read in place; nothing is copied when the file is loaded.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef LEXICON_H
+#define LEXICON_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+using namespace std ;
+
+#define LEXICON_NONE         0xFFFFFFFFU  /* No node or word. */
+#define LEXICON_ROOT         0            /* The node of the empty prefix. */
+#define LEXICON_BACKOFF_COST 0.6931f      /* Added to a word's cost when the pair was never seen, -log(1/2). */
+#define LEXICON_FILE_MAGIC   0x584C5332   /* Marks a compiled lexicon file ("2SLX"). */
+#define LEXICON_FILE_VERSION 1            /* The compiled lexicon file layout. Increment whenever the layout changes. */
+#define LEXICON_FILE_ALIGN   64           /* Alignment of each section of the file, in bytes. */
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "LexiconNode" represents a prefix in the trie. */
+
+struct LexiconNode {
+	 uint32_t firstChild ;                           /* The first node extending this prefix by a letter. */
+	 uint32_t word ;                                 /* The word spelled by this prefix, or LEXICON_NONE. */
+	 uint32_t best ;                                 /* The most likely word starting with this prefix. */
+	 uint8_t numChildren ;                           /* Number of letters that extend this prefix. */
+	 char letter ;                                   /* The last letter of the prefix. */
+	 uint8_t reserved[2] ;                           /* Always zero. */
+} ;
+
+/* Type "LexiconWord" represents a word. */
+
+struct LexiconWord {
+	 uint32_t text ;                                 /* Offset of the word within the text section. */
+	 float cost ;                                    /* -log P(word). */
+} ;
+
+/* Type "LexiconBigram" represents a word that was seen following another word. */
+
+struct LexiconBigram {
+	 uint32_t prev ;                                 /* The first word. */
+	 uint32_t next ;                                 /* The word following it. */
+	 float cost ;                                    /* -log P(next | prev). */
+} ;
+
+/* Type "LexiconFileHeader" starts a compiled lexicon file. Offsets are from the start of
+   the file. */
+
+struct LexiconFileHeader {
+	 uint32_t magic ;                                /* LEXICON_FILE_MAGIC. */
+	 uint32_t version ;                              /* LEXICON_FILE_VERSION. */
+	 uint32_t headerSize ;                           /* sizeof(LexiconFileHeader). */
+	 uint32_t nodeCount ;                            /* Number of nodes. */
+	 uint32_t wordCount ;                            /* Number of words. */
+	 uint32_t bigramCount ;                          /* Number of word pairs. */
+	 uint32_t nodeOffset ;                           /* Start of the nodes. */
+	 uint32_t wordOffset ;                           /* Start of the words. */
+	 uint32_t bigramOffset ;                         /* Start of the word pairs. */
+	 uint32_t textOffset ;                           /* Start of the text. */
+	 uint32_t fileSize ;                             /* Size of the whole file. */
+	 uint32_t crc ;                                  /* CRC-32 of everything after the header. */
+} ;
+
+/* Type "Lexicon" represents the set of known words. Words are added with their counts,
+   and the trie is built once all have been added; it is then read only, so any
+   number of threads may search it. */
+
+class Lexicon {
+
+  public:
+
+	 /* Default constructor and destructor functions */
+	 Lexicon( ) ;
+	 ~Lexicon( ) ;
+
+	 /* Accessor functions */
+	 inline size_t Size( ) const { return wordCount ; }                                    /* Access number of words. */
+	 inline const LexiconNode &Node( uint32_t node ) const { return nodes[node] ; }        /* Access a prefix. */
+	 inline float WordCost( uint32_t word ) const { return words[word].cost ; }            /* Access -log P(word). */
+	 inline const char* WordText( uint32_t word ) const { return text + words[word].text ; }  /* Access a word. */
+	 uint32_t Child( uint32_t node, char letter ) const ;                                  /* Extends a prefix by a letter. */
+	 float PairCost( uint32_t prev, uint32_t next ) const ;                                /* Access -log P(next | prev). */
+
+	 /* Mutator functions */
+	 void Add( const string &word, double count ) ;                                        /* Adds to a word's count. */
+	 void AddPair( const string &prev, const string &next, double count ) ;                /* Adds to a word pair's count. */
+	 void Build( unsigned int maxWords ) ;                                                 /* Builds the trie from the most common words. */
+	 void Clear( ) ;                                                                       /* Removes all words. */
+	 bool Save( const char* fName ) const ;                                                /* Writes a compiled lexicon file. */
+	 bool Load( const char* fName ) ;                                                      /* Replaces the words with a compiled lexicon file. */
+
+  private:
+
+	 /* The tables point into the mapping, so a lexicon can not be copied. */
+	 Lexicon( const Lexicon &other ) ;
+	 Lexicon &operator=( const Lexicon &other ) ;
+
+	 void Unmap( ) ;
+
+	 vector<pair<string, double> > counts ;          /* The words added, with their counts. */
+	 vector<pair<pair<string, string>, double> > pairCounts ;  /* The word pairs added, with their counts. */
+	 vector<LexiconNode> nodeTable ;                 /* The trie, when built in memory. */
+	 vector<LexiconWord> wordTable ;                 /* The words, when built in memory. */
+	 vector<LexiconBigram> bigramTable ;             /* The word pairs, when built in memory. */
+	 string textTable ;                              /* The text of the words, when built in memory. */
+	 const LexiconNode* nodes ;                      /* The trie, in nodeTable or the mapping. */
+	 const LexiconWord* words ;                      /* The words. */
+	 const LexiconBigram* bigrams ;                  /* The word pairs. */
+	 const char* text ;                              /* The text of the words. */
+	 size_t nodeCount ;                              /* Number of nodes. */
+	 size_t wordCount ;                              /* Number of words. */
+	 size_t bigramCount ;                            /* Number of word pairs. */
+	 void* mapping ;                                 /* The mapped compiled lexicon file, or NULL. */
+	 size_t mappingLen ;                             /* Size of the mapping. */
+
+} ;
+
+#endif
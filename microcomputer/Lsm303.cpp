@@ -28,7 +28,7 @@
 
 -----------------------------------------------------------------------------------*/
 
-void Lsm303::SetAccel( double accelxVal, double accelyVal, double accelzVal, double magxVal, double magyVal, double magzVal, string sideVal ) {
+void Lsm303::SetAccel( double accelxVal, double accelyVal, double accelzVal, double magxVal, double magyVal, double magzVal, LsmSide sideVal ) {
 
     accelx = accelxVal ;
     accely = accelyVal ;
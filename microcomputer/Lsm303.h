@@ -15,9 +15,7 @@
 #ifndef LSM303_H
 #define LSM303_H
 
-#include <string>
-
-using namespace std ;
+#include "LsmSide.h"
 
 /*----------Type Definitions-------------------------------------------------------*/
 
@@ -28,9 +26,9 @@ class Lsm303 {
   public:  
 	
 	 /* Default and explicit constructor functions */
-	 inline Lsm303( ) : defined(false) { }          
+	 inline Lsm303( ) : defined(false), accelx(0.0), accely(0.0), accelz(0.0), magx(0.0), magy(0.0), magz(0.0), side(LSM_TOP) { }          
          inline Lsm303( double accelxVal, double accelyVal, double accelzVal,
-                        double magxVal, double magyVal, double magzVal, string sideVal ) : 
+                        double magxVal, double magyVal, double magzVal, LsmSide sideVal ) : 
          defined(true), accelx(accelxVal), accely(accelyVal), accelz(accelzVal), magx(magxVal), magy(magyVal), magz(magzVal), side(sideVal) { }
 
 	 /* Accessor functions */
@@ -40,12 +38,13 @@ class Lsm303 {
    	 inline double MagX( )       const { return magx ; }  /* Access x axis magnetometer value.  */
    	 inline double MagY( )       const { return magy ; }  /* Access y axis magnetometer value.  */
    	 inline double MagZ( )       const { return magz ; }  /* Access z axis magnetometer value.  */
-   	 inline string Side( )       const { return side ; }  /* Access location of LSM303.  */
+   	 inline LsmSide Side( )      const { return side ; }  /* Access location of LSM303.  */
+   	 inline const char* SideName( ) const { return lsm_side_name( side ) ; }  /* Access name of location. */
 	 inline bool   Defined( ) const { return defined ; }  /* Access defined value. */
 	 
 	 /* Mutator functions */
 	 void SetAccel( double accelxVal, double accelyVal, double accelzVal, 
-                        double magxVal, double magyVal, double magzVal, string side ) ;  /* Sets LSM303 values. */
+                        double magxVal, double magyVal, double magzVal, LsmSide side ) ;  /* Sets LSM303 values. */
 			  
   private:
 	
@@ -56,7 +55,7 @@ class Lsm303 {
          double magx ;                              /* The x axis magnetometer value. */
          double magy ;                              /* The y axis magnetometer value. */
          double magz ;                              /* The z axis magnetometer value. */
-	 string side ;                              /* The location of the LSM303. */
+	 LsmSide side ;                             /* The location of the LSM303. */
  				
 } ;
 
@@ -32,7 +32,7 @@
 -----------------------------------------------------------------------------------*/
 
 void Lsm9dof::SetAccel( double accelxVal, double accelyVal, double accelzVal, double magxVal, double magyVal, double magzVal, 
-                        double gyroxVal, double gyroyVal, double gyrozVal, string sideVal ) {
+                        double gyroxVal, double gyroyVal, double gyrozVal, LsmSide sideVal ) {
 
     accelx = accelxVal ;
     accely = accelyVal ;
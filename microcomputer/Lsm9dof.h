@@ -15,9 +15,7 @@
 #ifndef LSM9DOF_H
 #define LSM9DOF_H
 
-#include <string>
-
-using namespace std ;
+#include "LsmSide.h"
 
 /*----------Type Definitions-------------------------------------------------------*/
 
@@ -28,10 +26,11 @@ class Lsm9dof {
   public:  
 	
 	 /* Default and explicit constructor functions */
-	 inline Lsm9dof( ) : defined(false) { }          
+	 inline Lsm9dof( ) : defined(false), accelx(0.0), accely(0.0), accelz(0.0), magx(0.0), magy(0.0), magz(0.0),
+                            gyrox(0.0), gyroy(0.0), gyroz(0.0), side(LSM_TOP) { }          
          inline Lsm9dof( double accelxVal, double accelyVal, double accelzVal,
                          double magxVal, double magyVal, double magzVal, 
-                         double gyroxVal, double gyroyVal, double gyrozVal, string sideVal ) : 
+                         double gyroxVal, double gyroyVal, double gyrozVal, LsmSide sideVal ) : 
          defined(true), accelx(accelxVal), accely(accelyVal), accelz(accelzVal), magx(magxVal), magy(magyVal), magz(magzVal), 
          gyrox(gyroxVal), gyroy(gyroyVal), gyroz(gyrozVal), side(sideVal) { }
 
@@ -45,13 +44,14 @@ class Lsm9dof {
    	 inline double GyroX( )     const { return gyrox ; }  /* Access x axis gyrometer value.  */
    	 inline double GyroY( )     const { return gyroy ; }  /* Access y axis gyrometer value.  */
    	 inline double GyroZ( )     const { return gyroz ; }  /* Access z axis gyrometer value.  */
-   	 inline string Side( )       const { return side ; }  /* Access location of LSM9DOF.  */
+   	 inline LsmSide Side( )      const { return side ; }  /* Access location of LSM9DOF.  */
+   	 inline const char* SideName( ) const { return lsm_side_name( side ) ; }  /* Access name of location. */
 	 inline bool   Defined( ) const { return defined ; }  /* Access defined value. */
 	 
 	 /* Mutator functions */
 	 void SetAccel( double accelxVal, double accelyVal, double accelzVal, 
                         double magxVal, double magyVal, double magzVal, 
-                        double gyroxVal, double gyroyVal, double gyrozVal, string side ) ;  /* Sets LSM9DOF values. */
+                        double gyroxVal, double gyroyVal, double gyrozVal, LsmSide side ) ;  /* Sets LSM9DOF values. */
 			  
   private:
 	
@@ -65,7 +65,7 @@ class Lsm9dof {
          double gyrox ;                             /* The x axis gyrometer value. */
          double gyroy ;                             /* The y axis gyrometer value. */
          double gyroz ;                             /* The z axis gyrometer value. */
-	 string side ;                              /* The location of the LSM9DOF. */
+	 LsmSide side ;                             /* The location of the LSM9DOF. */
  				
 } ;
 
@@ -0,0 +1,64 @@
+/***********LsmSide.h***************************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the type "LsmSide", the location of an
+            accelerometer on the hand, and the functions that convert it to and from
+            the "side" attribute of the XML file. Lsm303.h and Lsm9dof.h include this
+            file.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef LSMSIDE_H
+#define LSMSIDE_H
+
+#include <string.h>
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "LsmSide" represents the location of an accelerometer. Accelerometer 0 of each
+   type is on top of the hand and accelerometer 1 is underneath. */
+
+enum LsmSide { LSM_TOP, LSM_BOTTOM } ;
+
+/*----------lsm_side_name( )---------------------------------------------------------
+
+  PURPOSE:  Return the name of a location, as written to the XML file.
+
+-----------------------------------------------------------------------------------*/
+
+inline const char* lsm_side_name( LsmSide side ){
+
+    return (side == LSM_BOTTOM) ? "bottom" : "top" ;
+
+}
+
+/*----------lsm_side( )--------------------------------------------------------------
+
+  PURPOSE:  Convert the name of a location to a "LsmSide".
+
+  INPUT  PARAMETERS:  name     -- the name, or NULL if unknown.
+                      fallback -- the location to use if the name is not recognized.
+
+-----------------------------------------------------------------------------------*/
+
+inline LsmSide lsm_side( const char* name, LsmSide fallback ){
+
+    if( name == NULL )
+        return fallback ;
+    if( strcmp(name, "top") == 0 )
+        return LSM_TOP ;
+    if( strcmp(name, "bottom") == 0 )
+        return LSM_BOTTOM ;
+
+    return fallback ;
+
+}
+
+#endif
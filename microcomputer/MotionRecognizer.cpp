@@ -0,0 +1,492 @@
+/***********MotionRecognizer.cpp*****************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The Build(), Reset(), Update(), IsKeyframe(), HandFeatures(),
+            EntryFeatures(), Distance(), and Moved() functions are defined in this
+            module.
+
+            Letters that involve motion are stored in the gesture database as a
+            numbered sequence of keyframes, such as J1, J2, J3. Each frame is
+            reduced to the direction of gravity at every accelerometer plus the
+            shape of the hand, and compared against the keyframes using
+            subsequence dynamic time warping: a motion may start on any frame, may
+            dwell on a keyframe for several frames, and may pass through a keyframe
+            between two frames. A motion is completed once a path reaches the last
+            keyframe with a small enough mean distance, and the hand has actually
+            turned by a fair share of the angle spanned by the keyframes. It is
+            reported once no overlapping partial path can still complete with a
+            smaller mean distance, so one motion is only reported once.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <map>
+#include <math.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MotionRecognizer.h"
+
+#define MOTION_INF 1e30f  /* Cost of a keyframe that no path reaches. */
+
+/*----------keyframe_name( )---------------------------------------------------------
+
+  PURPOSE:  Split the text of a gesture such as "Z3" into its letter and keyframe
+            number.
+
+  RETURN VALUE:  true if the gesture is a letter followed by a keyframe number
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+static bool keyframe_name( const string &gest, string &letter, unsigned int &number ){
+
+    size_t i ;  /* An iterator. */
+
+    if( (gest.size() < 2) || !isalpha((unsigned char)gest[0]) ){
+        return false ;
+    }
+    for( i = 1 ; i < gest.size() ; i++ ){
+        if( !isdigit((unsigned char)gest[i]) )
+            return false ;
+    }
+    letter = gest.substr( 0, 1 ) ;
+    number = (unsigned int)atoi( gest.c_str() + 1 ) ;
+
+    return true ;
+
+}
+
+/*----------set_direction( )---------------------------------------------------------
+
+  PURPOSE:  Store an accelerometer reading as a unit vector. A reading of zero is
+            stored as zero.
+
+-----------------------------------------------------------------------------------*/
+
+static void set_direction( float* v, double x, double y, double z ){
+
+    double n = sqrt( (x * x) + (y * y) + (z * z) ) ;  /* Length of the reading. */
+
+    if( n == 0.0 ){
+        v[0] = v[1] = v[2] = 0.0f ;
+        return ;
+    }
+    v[0] = (float)(x / n) ;
+    v[1] = (float)(y / n) ;
+    v[2] = (float)(z / n) ;
+
+    return ;
+
+}
+
+/*----------orient_distance( )-------------------------------------------------------
+
+  PURPOSE:  Find the squared distance between two orientations, summed over the
+            gravity direction of each accelerometer.
+
+  INPUT  PARAMETERS:  a -- an orientation.
+                      b -- the other orientation.
+
+  RETURN VALUE:  The squared distance, from 0 up to 4 for each accelerometer.
+
+-----------------------------------------------------------------------------------*/
+
+static float orient_distance(const float a[MOTION_DIMS], const float b[MOTION_DIMS] ){
+
+    float d = 0.0f ;  /* The squared distance. */
+    unsigned int i ;  /* An iterator. */
+
+    for( i = 0 ; i < MOTION_DIMS ; i++ ){
+        d += (a[i] - b[i]) * (a[i] - b[i]) ;
+    }
+
+    return d ;
+
+}
+
+/*----------MotionRecognizer::MotionRecognizer( )------------------------------------
+
+  PURPOSE:  Create a recognizer with no motions.
+
+-----------------------------------------------------------------------------------*/
+
+MotionRecognizer::MotionRecognizer( ) : frames(0) {
+
+    Reset() ;
+
+}
+
+/*----------MotionRecognizer::HandFeatures( )----------------------------------------
+
+  PURPOSE:  Reduce a hand to the values compared against the keyframes. The
+            direction of gravity is taken from the fused orientation when the decode
+            stage has found it, as it is free of the noise and of the acceleration
+            of the hand that a single reading holds.
+
+-----------------------------------------------------------------------------------*/
+
+void MotionRecognizer::HandFeatures( const Hand &hand, MotionFeatures &f ){
+
+    const HandOrientation &o = hand.Orientation() ;  /* The fused orientation. */
+    unsigned int i ;                                 /* An iterator. */
+
+    if( o.defined ){
+        for( i = 0 ; i < FUSION_IMUS ; i++ ){
+            f.orient[3 * i]     = o.gravity[0][i] ;
+            f.orient[3 * i + 1] = o.gravity[1][i] ;
+            f.orient[3 * i + 2] = o.gravity[2][i] ;
+        }
+        hand.FlexVector( f.flex ) ;
+        f.signature = hand.ContactSignature() ;
+        return ;
+    }
+    for( i = 0 ; i < NUM_LSM303 ; i++ ){
+        const Lsm303 &lsm = hand.Lsm303Vals( i ) ;
+        set_direction( &f.orient[3 * i], lsm.AccelX(), lsm.AccelY(), lsm.AccelZ() ) ;
+    }
+    for( i = 0 ; i < NUM_LSM9DOF ; i++ ){
+        const Lsm9dof &lsm = hand.Lsm9dofVals( i ) ;
+        set_direction( &f.orient[3 * (NUM_LSM303 + i)], lsm.AccelX(), lsm.AccelY(), lsm.AccelZ() ) ;
+    }
+    hand.FlexVector( f.flex ) ;
+    f.signature = hand.ContactSignature() ;
+
+    return ;
+
+}
+
+/*----------MotionRecognizer::EntryFeatures( )---------------------------------------
+
+  PURPOSE:  Reduce the right hand of a gesture to the values compared against
+            each frame.
+
+-----------------------------------------------------------------------------------*/
+
+void MotionRecognizer::EntryFeatures( const GestureEntry &entry, MotionFeatures &f ){
+
+    const double (*lsm303)[INDEX_LSM303_VALS] = entry.lsm303[INDEX_RIGHT] ;     /* The right hand's LSM303 values. */
+    const double (*lsm9dof)[INDEX_LSM9DOF_VALS] = entry.lsm9dof[INDEX_RIGHT] ;  /* The right hand's LSM9DOF values. */
+    unsigned int i ;                                                            /* An iterator. */
+
+    for( i = 0 ; i < INDEX_NUM_LSM303 ; i++ ){
+        set_direction( &f.orient[3 * i], lsm303[i][0], lsm303[i][1], lsm303[i][2] ) ;
+    }
+    for( i = 0 ; i < INDEX_NUM_LSM9DOF ; i++ ){
+        set_direction( &f.orient[3 * (INDEX_NUM_LSM303 + i)], lsm9dof[i][0], lsm9dof[i][1], lsm9dof[i][2] ) ;
+    }
+    /* The index keeps both hands in one vector; the features hold a single hand, as Hand::FlexVector() does. */
+    memset( f.flex, 0, FLEX_VECTOR_LEN ) ;
+    memcpy( f.flex, &entry.flex[INDEX_RIGHT * INDEX_NUM_FLEX], INDEX_NUM_FLEX ) ;
+    f.signature = (uint16_t)(entry.signature >> (INDEX_RIGHT * INDEX_SIG_SHIFT)) ;
+
+    return ;
+
+}
+
+/*----------MotionRecognizer::Distance( )--------------------------------------------
+
+  PURPOSE:  Compute the distance between a frame and a keyframe: the squared
+            distance between the gravity directions plus HANDSHAPE_WEIGHT for each
+            flex step and CONTACT_WEIGHT steps for each contact sensor that differs.
+            The hand shape is compared first, then one accelerometer at a time, and
+            the comparison stops as soon as the distance exceeds the limit.
+
+  INPUT  PARAMETERS:  a, b  -- the frame and the keyframe.
+                      limit -- the distance beyond which the exact value is not needed.
+
+  RETURN VALUE:  The distance, or a value greater than the limit.
+
+-----------------------------------------------------------------------------------*/
+
+float MotionRecognizer::Distance( const MotionFeatures &a, const MotionFeatures &b, float limit ) const {
+
+    unsigned int steps = 0 ;  /* Number of flex steps that differ. */
+    float d ;                 /* The distance so far. */
+    unsigned int i ;          /* An iterator. */
+    unsigned int j ;          /* An iterator. */
+
+    for( i = 0 ; i < FLEX_VECTOR_LEN ; i++ ){
+        steps += (unsigned int)abs( (int)a.flex[i] - (int)b.flex[i] ) ;
+    }
+    steps += CONTACT_WEIGHT * (unsigned int)__builtin_popcount( (unsigned int)(a.signature ^ b.signature) ) ;
+    d = HANDSHAPE_WEIGHT * (float)steps ;
+    for( i = 0 ; (i < MOTION_NUM_IMUS) && (d <= limit) ; i++ ){
+        for( j = 3 * i ; j < (3 * i) + 3 ; j++ ){
+            d += (a.orient[j] - b.orient[j]) * (a.orient[j] - b.orient[j]) ;
+        }
+    }
+
+    return d ;
+
+}
+
+/*----------MotionRecognizer::Build( )-----------------------------------------------
+
+  PURPOSE:  Create a template for every letter whose keyframes, numbered from 1,
+            are all present in the gesture database. Only one-handed right hand
+            gestures are used, as letters are signed with the right hand.
+
+  INPUT  PARAMETERS:  index -- the in-memory copy of the gesture database.
+
+-----------------------------------------------------------------------------------*/
+
+void MotionRecognizer::Build( const GestureIndex &index ){
+
+    map< string, map<unsigned int, MotionFeatures> > found ;   /* Keyframes of each letter, by number. */
+    map< string, map<unsigned int, MotionFeatures> >::iterator it ;
+    string letter ;        /* Letter of the next keyframe. */
+    unsigned int number ;  /* Number of the next keyframe. */
+    size_t i ;             /* An iterator. */
+
+    templates.clear() ;
+    for( i = 0 ; i < index.Size() ; i++ ){
+        const GestureEntry &entry = index.Entry( (unsigned int)i ) ;
+        if( (entry.hands == INDEX_USES_RIGHT) && keyframe_name(entry.gest, letter, number) ){
+            EntryFeatures( entry, found[letter][number] ) ;
+        }
+    }
+    for( it = found.begin() ; it != found.end() ; it++ ){
+        MotionTemplate motion ;
+        motion.letter = it->first ;
+        motion.span = 0.0f ;
+        for( number = 1 ; it->second.count(number) != 0 ; number++ ){
+            motion.keys.push_back( it->second[number] ) ;
+            float d = sqrt( orient_distance(motion.keys[0].orient, motion.keys[number - 1].orient) ) ;
+            if( d > motion.span )
+                motion.span = d ;
+        }
+        if( (motion.keys.size() < 2) || (motion.keys.size() != it->second.size()) ){
+            /* A single keyframe, or a gap in the numbering, is not a motion. */
+            continue ;
+        }
+        templates.push_back( motion ) ;
+    }
+    Reset() ;
+
+    return ;
+
+}
+
+/*----------MotionRecognizer::Reset( )-----------------------------------------------
+
+  PURPOSE:  Forget any partially completed motions.
+
+-----------------------------------------------------------------------------------*/
+
+void MotionRecognizer::Reset( ){
+
+    size_t i ;  /* An iterator. */
+
+    for( i = 0 ; i < templates.size() ; i++ ){
+        templates[i].cost.assign( templates[i].keys.size(), MOTION_INF ) ;
+        templates[i].len.assign( templates[i].keys.size(), 0 ) ;
+        templates[i].start.assign( templates[i].keys.size(), 0 ) ;
+    }
+    frames = 0 ;
+    candidate = -1 ;
+    candidateCost = MOTION_INF ;
+    candidateEnd = 0 ;
+    nextStart = 0 ;
+    memset( recent, 0, sizeof(recent) ) ;
+
+    return ;
+
+}
+
+/*----------MotionRecognizer::IsKeyframe( )------------------------------------------
+
+  PURPOSE:  Determine if a gesture is one of the keyframes of a motion, in which case
+            it should not be converted to text on its own.
+
+-----------------------------------------------------------------------------------*/
+
+bool MotionRecognizer::IsKeyframe( const string &gest ) const {
+
+    string letter ;        /* Letter of the keyframe. */
+    unsigned int number ;  /* Number of the keyframe. */
+    size_t i ;             /* An iterator. */
+
+    if( !keyframe_name(gest, letter, number) ){
+        return false ;
+    }
+    for( i = 0 ; i < templates.size() ; i++ ){
+        if( templates[i].letter == letter )
+            return true ;
+    }
+
+    return false ;
+
+}
+
+/*----------MotionRecognizer::Moved( )-----------------------------------------------
+
+  PURPOSE:  Find how far the hand has turned since a recent frame. Orientations are
+            averaged over MOTION_AVERAGE frames so that sensor noise is not counted
+            as motion, and only frames from the start frame on are used so that
+            motion before the start is not counted either.
+
+  INPUT  PARAMETERS:  start -- the frame to measure from, up to and including the
+                               current frame. Must be one of the last MOTION_WINDOW
+                               frames.
+
+  RETURN VALUE:  The largest distance from the average orientation at the start to
+                 the average orientation at any later point.
+
+-----------------------------------------------------------------------------------*/
+
+float MotionRecognizer::Moved( uint64_t start ) const {
+
+    float from[MOTION_DIMS] ;    /* Average orientation at the start. */
+    float sum[MOTION_DIMS] ;     /* Sum of the orientations in the current average. */
+    float moved = 0.0f ;         /* The largest squared distance. */
+    uint64_t i ;                 /* An iterator. */
+    unsigned int j ;             /* An iterator. */
+
+    if( (frames - start + 1) < (2 * MOTION_AVERAGE) ){
+        /* Too few frames to tell motion from noise. */
+        return 0.0f ;
+    }
+    memset( sum, 0, sizeof(sum) ) ;
+    for( i = start ; i < (start + MOTION_AVERAGE) ; i++ ){
+        for( j = 0 ; j < MOTION_DIMS ; j++ ){
+            sum[j] += recent[i & (MOTION_WINDOW - 1)][j] ;
+        }
+    }
+    for( j = 0 ; j < MOTION_DIMS ; j++ ){
+        from[j] = sum[j] / MOTION_AVERAGE ;
+    }
+    for( ; i <= frames ; i++ ){
+        float d = 0.0f ;
+        for( j = 0 ; j < MOTION_DIMS ; j++ ){
+            sum[j] += recent[i & (MOTION_WINDOW - 1)][j] - recent[(i - MOTION_AVERAGE) & (MOTION_WINDOW - 1)][j] ;
+            d += ((sum[j] / MOTION_AVERAGE) - from[j]) * ((sum[j] / MOTION_AVERAGE) - from[j]) ;
+        }
+        if( d > moved )
+            moved = d ;
+    }
+
+    return sqrt( moved ) ;
+
+}
+
+/*----------MotionRecognizer::Update( )----------------------------------------------
+
+  PURPOSE:  Add the next frame to every template. For each keyframe, the best path
+            ending there either stays on the keyframe, advances from the previous
+            keyframe, or passes through the previous keyframe within this frame.
+            A path on the first keyframe always starts afresh, unless a motion
+            was recognized within MOTION_REFRACTORY frames. Paths longer than
+            MOTION_WINDOW frames, or with a frame further than MOTION_CELL_MAX from
+            its keyframe, are dropped. Keyframes that no path can reach are not
+            compared at all.
+
+  INPUT  PARAMETERS:  hand   -- the next frame.
+
+  OUTPUT PARAMETERS:  letter -- the recognized motion.
+
+  RETURN VALUE:  true if a motion was recognized on this frame
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool MotionRecognizer::Update( const Hand &hand, string &letter ){
+
+    MotionFeatures f ;               /* The frame. */
+    bool pending = false ;           /* True if a partial path could still improve on the candidate. */
+    size_t t ;                       /* An iterator. */
+    size_t j ;                       /* An iterator. */
+
+    if( templates.empty() || !hand.Defined() ){
+        return false ;
+    }
+    HandFeatures( hand, f ) ;
+    memcpy( recent[frames & (MOTION_WINDOW - 1)], f.orient, sizeof(f.orient) ) ;
+    for( t = 0 ; t < templates.size() ; t++ ){
+        MotionTemplate &motion = templates[t] ;
+        float diagCost = MOTION_INF ;  /* Cost of the previous keyframe on the previous frame. */
+        uint16_t diagLen = 0 ;
+        uint64_t diagStart = 0 ;
+        for( j = 0 ; j < motion.keys.size() ; j++ ){
+            float pc = 0.0f ;                      /* Cost of the best predecessor. */
+            uint16_t pl = 0 ;                      /* Length of the best predecessor. */
+            uint64_t ps = frames ;                 /* Start of the best predecessor. */
+            float stayCost = motion.cost[j] ;
+            uint16_t stayLen = motion.len[j] ;
+            uint64_t stayStart = motion.start[j] ;
+            if( j > 0 ){
+                /* Paths are compared by their mean distance, as a sum would favor the shortest path. */
+                pc = diagCost ; pl = diagLen ; ps = diagStart ;
+                if( (stayCost < MOTION_INF) && ((pc >= MOTION_INF) || ((stayCost * pl) < (pc * stayLen))) ){
+                    pc = stayCost ; pl = stayLen ; ps = stayStart ;
+                }
+                if( (motion.cost[j - 1] < MOTION_INF) && ((pc >= MOTION_INF) || ((motion.cost[j - 1] * pl) < (pc * motion.len[j - 1]))) ){
+                    pc = motion.cost[j - 1] ; pl = motion.len[j - 1] ; ps = motion.start[j - 1] ;
+                }
+            }
+            diagCost = stayCost ;
+            diagLen = stayLen ;
+            diagStart = stayStart ;
+            motion.cost[j] = MOTION_INF ;
+            if( (pc >= MOTION_INF) || ((frames - ps) >= MOTION_WINDOW) || (ps < nextStart) ){
+                continue ;
+            }
+            float d = Distance( f, motion.keys[j], MOTION_CELL_MAX ) ;
+            if( d > MOTION_CELL_MAX ){
+                continue ;
+            }
+            motion.cost[j] = pc + d ;
+            motion.len[j] = (uint16_t)(pl + 1) ;
+            motion.start[j] = ps ;
+        }
+        j = motion.keys.size() - 1 ;
+        if( motion.cost[j] < MOTION_INF ){
+            float mean = motion.cost[j] / (float)motion.len[j] ;
+            /* A later path only replaces the candidate if it overlaps it and is closer. */
+            if( (mean <= MOTION_MAX_COST) && (mean < candidateCost) &&
+                ((candidate < 0) || (motion.start[j] <= candidateEnd)) &&
+                (Moved(motion.start[j]) >= (MOTION_MIN_SPAN * motion.span)) ){
+                if( (candidate != (int)t) || (candidateCost >= MOTION_INF) )
+                    candidateEnd = frames ;
+                candidate = (int)t ;
+                candidateCost = mean ;
+            }
+        }
+    }
+    frames++ ;
+    if( candidate < 0 ){
+        return false ;
+    }
+    for( t = 0 ; (t < templates.size()) && !pending ; t++ ){
+        for( j = 0 ; (j + 1) < templates[t].keys.size() ; j++ ){
+            if( (templates[t].cost[j] < MOTION_INF) && (templates[t].start[j] <= candidateEnd) &&
+                ((templates[t].cost[j] / (float)templates[t].len[j]) < candidateCost) ){
+                pending = true ;
+                break ;
+            }
+        }
+    }
+    if( pending ){
+        return false ;
+    }
+    letter = templates[candidate].letter ;
+    /* Drop every path that overlaps the reported motion so it is not reported again. */
+    for( t = 0 ; t < templates.size() ; t++ ){
+        for( j = 0 ; j < templates[t].keys.size() ; j++ ){
+            if( templates[t].start[j] <= candidateEnd )
+                templates[t].cost[j] = MOTION_INF ;
+        }
+    }
+    candidate = -1 ;
+    candidateCost = MOTION_INF ;
+    nextStart = frames + MOTION_REFRACTORY ;
+
+    return true ;
+
+}
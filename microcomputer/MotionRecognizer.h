@@ -0,0 +1,100 @@
+/***********MotionRecognizer.h*******************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the class "MotionRecognizer", which recognizes
+            letters that involve motion, such as J and Z, from the stream of hands
+            read from the sensors. Parser.h and MotionRecognizer.cpp include this file.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef MOTIONRECOGNIZER_H
+#define MOTIONRECOGNIZER_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include "Hand.h"
+#include "GestureIndex.h"
+
+using namespace std ;
+
+#define MOTION_NUM_IMUS    4      /* Number of accelerometers used to track the orientation of the hand. */
+#define MOTION_DIMS       (3 * MOTION_NUM_IMUS)  /* Length of an orientation vector. */
+#define MOTION_WINDOW    128      /* Longest motion, in frames. Must be a power of two. */
+#define MOTION_CELL_MAX  1.5f     /* Largest distance between a frame and a keyframe that can be part of a motion. */
+#define MOTION_MAX_COST  0.5f     /* Largest mean distance per frame for a motion to be recognized. */
+#define HANDSHAPE_WEIGHT 0.05f    /* Distance added per flex step, scaled by CONTACT_WEIGHT for contact sensors. */
+#define MOTION_AVERAGE     4      /* Number of frames averaged when measuring how far the hand has turned. */
+#define MOTION_REFRACTORY 32      /* Number of frames after a motion is recognized before the next one may start. */
+#define MOTION_MIN_SPAN  0.5f     /* Fraction of the keyframe orientation span a motion must cover. */
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "MotionFeatures" represents a hand reduced to the values compared by the recognizer:
+   the direction of gravity at each accelerometer and the shape of the hand. */
+
+struct MotionFeatures {
+	 float orient[MOTION_DIMS] ;                      /* Unit gravity vector of the top and bottom LSM303 and LSM9DOF. */
+	 uint8_t flex[FLEX_VECTOR_LEN] ;                  /* Quantized flex sensor values. */
+	 uint16_t signature ;                             /* Packed contact sensor values. */
+} ;
+
+/* Type "MotionTemplate" represents a letter made up of a sequence of keyframes, such as J1, J2, J3,
+   together with the state of the streaming match against it. */
+
+struct MotionTemplate {
+	 string letter ;                                  /* The text that corresponds to the motion. */
+	 vector<MotionFeatures> keys ;                    /* The keyframes, in order. */
+	 float span ;                                     /* Largest orientation change from the first keyframe. */
+	 vector<float> cost ;                             /* Cumulative distance of the best path ending at each keyframe. */
+	 vector<uint16_t> len ;                           /* Number of cells on that path. */
+	 vector<uint64_t> start ;                         /* Frame the path started on. */
+} ;
+
+/* Type "MotionRecognizer" matches the stream of hands against every motion template at once
+   using subsequence dynamic time warping. Each frame updates one column per template, so
+   the cost per frame is bounded by the total number of keyframes. */
+
+class MotionRecognizer {
+
+  public:
+
+	 /* Default constructor function */
+	 MotionRecognizer( ) ;
+
+	 /* Accessor functions */
+	 inline size_t Size( ) const { return templates.size() ; }              /* Access number of motions. */
+	 bool IsKeyframe( const string &gest ) const ;                           /* True if the gesture is part of a motion. */
+
+	 /* Mutator functions */
+	 void Build( const GestureIndex &index ) ;       /* Creates a template for every sequence of keyframes in the index. */
+	 void Reset( ) ;                                 /* Forgets any partial motions. */
+	 bool Update( const Hand &hand, string &letter ) ;  /* Adds the next frame, returning true once a motion completes. */
+
+	 /* Feature functions */
+	 static void HandFeatures( const Hand &hand, MotionFeatures &f ) ;
+	 static void EntryFeatures( const GestureEntry &entry, MotionFeatures &f ) ;
+
+  private:
+
+	 float Distance( const MotionFeatures &a, const MotionFeatures &b, float limit ) const ;
+	 float Moved( uint64_t start ) const ;
+
+	 vector<MotionTemplate> templates ;              /* The known motions. */
+	 uint64_t frames ;                               /* Number of frames seen. */
+	 float recent[MOTION_WINDOW][MOTION_DIMS] ;      /* Ring of the orientation of each recent frame. */
+	 int candidate ;                                 /* Template of the best completed motion not yet reported, -1 if none. */
+	 float candidateCost ;                           /* Mean distance of that motion. */
+	 uint64_t candidateEnd ;                         /* Frame that motion was completed on. */
+	 uint64_t nextStart ;                            /* First frame a new motion may start on. */
+
+} ;
+
+#endif
@@ -0,0 +1,281 @@
+/***********Pipeline.cpp*************************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The StageStats::Record(), StageStats::TakeMaxNs(),
+            PipelineStats::Report(), LatencyHistogram::Record(),
+            LatencyHistogram::Percentile(), and pipeline_now_ns() functions are
+            defined in this module.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "Pipeline.h"
+
+/*----------StageStats::Record( )----------------------------------------------------
+
+  PURPOSE:  Count a sample. Only the stage's own thread may call this function, so the
+            counters are updated with plain atomic stores; only the largest latency
+            needs a compare and swap, since the reporting thread clears it.
+
+  INPUT  PARAMETERS:  startNs -- the time the sample was queued for the stage, or 0
+                                 if unknown.
+                      endNs   -- the time the stage finished with the sample.
+
+-----------------------------------------------------------------------------------*/
+
+void StageStats::Record( uint64_t startNs, uint64_t endNs ){
+
+    uint64_t latency ;  /* Time taken by the sample. */
+    uint64_t prev ;     /* The largest latency so far. */
+
+    __atomic_store_n( &items, items + 1, __ATOMIC_RELAXED ) ;
+    if( (startNs == 0) || (endNs < startNs) ){
+        return ;
+    }
+    latency = endNs - startNs ;
+    __atomic_store_n( &timed, timed + 1, __ATOMIC_RELAXED ) ;
+    __atomic_store_n( &totalNs, totalNs + latency, __ATOMIC_RELAXED ) ;
+    prev = __atomic_load_n( &maxNs, __ATOMIC_RELAXED ) ;
+    while( (latency > prev) &&
+           !__atomic_compare_exchange_n(&maxNs, &prev, latency, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED) ){
+    }
+
+    return ;
+
+}
+
+/*----------StageStats::TakeMaxNs( )-------------------------------------------------
+
+  PURPOSE:  Return the largest latency recorded since the last call, and start over.
+
+-----------------------------------------------------------------------------------*/
+
+uint64_t StageStats::TakeMaxNs( ){
+
+    return __atomic_exchange_n( &maxNs, 0, __ATOMIC_RELAXED ) ;
+
+}
+
+/*----------PipelineStats::PipelineStats( )------------------------------------------
+
+  PURPOSE:  Create a set of statistics with nothing counted.
+
+-----------------------------------------------------------------------------------*/
+
+PipelineStats::PipelineStats( ) : lastReportNs(0) {
+
+    memset( lastItems, 0, sizeof(lastItems) ) ;
+    memset( lastTimed, 0, sizeof(lastTimed) ) ;
+    memset( lastTotalNs, 0, sizeof(lastTotalNs) ) ;
+
+}
+
+/*----------PipelineStats::Line( )---------------------------------------------------
+
+  PURPOSE:  Format the rate and the mean and largest latency of one stage since the
+            last report, and remember the counters for the next one.
+
+-----------------------------------------------------------------------------------*/
+
+string PipelineStats::Line( const char* name, StageStats &stats, unsigned int stage, double seconds ){
+
+    char buffer[128] ;                                /* The formatted line. */
+    uint64_t items = stats.Items() ;                  /* Samples counted so far. */
+    uint64_t timed = stats.Timed() ;                  /* Timed samples counted so far. */
+    uint64_t totalNs = stats.TotalNs() ;              /* Summed latency so far. */
+    uint64_t count = timed - lastTimed[stage] ;       /* Timed samples since the last report. */
+    double rate = (seconds > 0.0) ? ((items - lastItems[stage]) / seconds) : 0.0 ;  /* Samples per second. */
+    double meanUs = (count > 0) ? ((totalNs - lastTotalNs[stage]) / (count * 1000.0)) : 0.0 ;
+    double maxUs = stats.TakeMaxNs() / 1000.0 ;
+
+    snprintf( buffer, sizeof(buffer), "%-9s%6.1f/s %9.1f %9.1f us", name, rate, meanUs, maxUs ) ;
+    lastItems[stage] = items ;
+    lastTimed[stage] = timed ;
+    lastTotalNs[stage] = totalNs ;
+
+    return string( buffer ) ;
+
+}
+
+/*----------PipelineStats::Report( )-------------------------------------------------
+
+  PURPOSE:  Format the statistics of every stage since the last report, one line per
+            stage, followed by the end to end latency and the word to speech latency.
+
+  INPUT  PARAMETERS:  depth    -- the number of samples waiting for each stage.
+                      capacity -- the size of the queue in front of each stage.
+                      nowNs    -- the current time.
+
+  RETURN VALUE:  The report.
+
+-----------------------------------------------------------------------------------*/
+
+string PipelineStats::Report( const unsigned int depth[NUM_STAGES], const unsigned int capacity[NUM_STAGES], uint64_t nowNs ){
+
+    const char* names[NUM_STAGES] = {"ingest", "decode", "classify", "text", "speech"} ;  /* Stage names. */
+    char queue[32] ;                                                                      /* The formatted queue depth. */
+    double seconds = (lastReportNs == 0) ? 0.0 : ((nowNs - lastReportNs) / 1e9) ;        /* Time since the last report. */
+    string report = "Pipeline:\tstage       rate   mean us    max us  queue\n" ;          /* The report. */
+    unsigned int i ;                                                                      /* An iterator. */
+
+    for( i = 0 ; i < NUM_STAGES ; i++ ){
+        snprintf( queue, sizeof(queue), "  %u/%u\n", depth[i], capacity[i] ) ;
+        report += "\t\t" + Line( names[i], stages[i], i, seconds ) + queue ;
+    }
+    report += "\t\t" + Line( "total", total, NUM_STAGES, seconds ) + "\n" ;
+    report += "\t\t" + Line( "spoken", spoken, NUM_STAGES + 1, seconds ) + "\n" ;
+    lastReportNs = nowNs ;
+
+    return report ;
+
+}
+
+/*----------LatencyHistogram::LatencyHistogram( )------------------------------------
+
+  PURPOSE:  Create a histogram with nothing counted.
+
+-----------------------------------------------------------------------------------*/
+
+LatencyHistogram::LatencyHistogram( ){
+
+    Reset() ;
+
+}
+
+/*----------LatencyHistogram::Reset( )-----------------------------------------------
+
+  PURPOSE:  Forget every latency.
+
+-----------------------------------------------------------------------------------*/
+
+void LatencyHistogram::Reset( ){
+
+    memset( counts, 0, sizeof(counts) ) ;
+    count = 0 ;
+    totalNs = 0 ;
+    maxNs = 0 ;
+
+    return ;
+
+}
+
+/*----------LatencyHistogram::Bucket( )----------------------------------------------
+
+  PURPOSE:  Find the bucket holding a latency. Latencies below 2^LATENCY_SUB_BITS have
+            a bucket each. Above that, each power of two is split into
+            2^LATENCY_SUB_BITS buckets of equal width, chosen by the bits that follow
+            the highest set bit.
+
+-----------------------------------------------------------------------------------*/
+
+unsigned int LatencyHistogram::Bucket( uint64_t ns ){
+
+    unsigned int top ;    /* Position of the highest set bit. */
+    unsigned int shift ;  /* Number of low bits dropped. */
+
+    if( ns < (1ULL << LATENCY_SUB_BITS) )
+        return (unsigned int)ns ;
+    top = 63 - __builtin_clzll( ns ) ;
+    shift = top - LATENCY_SUB_BITS ;
+
+    return ((shift + 1) << LATENCY_SUB_BITS) + (unsigned int)((ns >> shift) & ((1ULL << LATENCY_SUB_BITS) - 1)) ;
+
+}
+
+/*----------LatencyHistogram::BucketEnd( )-------------------------------------------
+
+  PURPOSE:  Return the largest latency that falls in a bucket.
+
+-----------------------------------------------------------------------------------*/
+
+uint64_t LatencyHistogram::BucketEnd( unsigned int bucket ){
+
+    unsigned int shift ;  /* Number of low bits dropped. */
+    uint64_t start ;      /* The smallest latency in the bucket. */
+
+    if( bucket < (1U << LATENCY_SUB_BITS) )
+        return bucket ;
+    shift = (bucket >> LATENCY_SUB_BITS) - 1 ;
+    start = ((uint64_t)((bucket & ((1U << LATENCY_SUB_BITS) - 1)) | (1U << LATENCY_SUB_BITS))) << shift ;
+
+    return start + ((1ULL << shift) - 1) ;
+
+}
+
+/*----------LatencyHistogram::Record( )----------------------------------------------
+
+  PURPOSE:  Count a latency.
+
+  INPUT  PARAMETERS:  ns -- the latency, in nanoseconds.
+
+-----------------------------------------------------------------------------------*/
+
+void LatencyHistogram::Record( uint64_t ns ){
+
+    counts[Bucket(ns)]++ ;
+    count++ ;
+    totalNs += ns ;
+    if( ns > maxNs )
+        maxNs = ns ;
+
+    return ;
+
+}
+
+/*----------LatencyHistogram::Percentile( )------------------------------------------
+
+  PURPOSE:  Find the latency that the given percentage of latencies do not exceed.
+
+  INPUT  PARAMETERS:  percent -- the percentile, from 0 to 100.
+
+  RETURN VALUE:  The end of the bucket holding the percentile, but no more than the
+                 largest latency. 0 if nothing has been counted.
+
+-----------------------------------------------------------------------------------*/
+
+uint64_t LatencyHistogram::Percentile( double percent ) const {
+
+    uint64_t rank = (uint64_t)ceil( (percent / 100.0) * count ) ;  /* Number of latencies at or below the percentile. */
+    uint64_t seen = 0 ;                                             /* Number of latencies in the buckets so far. */
+    unsigned int i ;                                                /* An iterator. */
+
+    if( count == 0 )
+        return 0 ;
+    if( rank == 0 )
+        rank = 1 ;
+    for( i = 0 ; i < LATENCY_BUCKETS ; i++ ){
+        seen += counts[i] ;
+        if( seen >= rank )
+            return (BucketEnd(i) < maxNs) ? BucketEnd(i) : maxNs ;
+    }
+
+    return maxNs ;
+
+}
+
+/*----------pipeline_now_ns( )-------------------------------------------------------
+
+  PURPOSE:  Read the monotonic clock, in nanoseconds. This is the same clock
+            i2c_transfer uses for frame timestamps.
+
+-----------------------------------------------------------------------------------*/
+
+uint64_t pipeline_now_ns( ){
+
+    struct timespec t ; /* The current time. */
+
+    clock_gettime( CLOCK_MONOTONIC, &t ) ;
+
+    return ((uint64_t)t.tv_sec * 1000000000ULL) + (uint64_t)t.tv_nsec ;
+
+}
@@ -0,0 +1,197 @@
+/***********Pipeline.h***************************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the samples passed between the stages of the
+            sign to speech pipeline, and the classes "StageStats" and
+            "PipelineStats", which count the samples each stage handles and how long
+            they took, and "LatencyHistogram", which finds latency percentiles.
+            Variables.h and Pipeline.cpp include this file.
+
+            The stages run on separate threads, connected by SpscQueue:
+
+              ingest -> decode -> classify -> text -> speech
+
+            ingest   -- copies frames out of the shared memory ring, or reads the
+                        XML file when the ring is unavailable.
+            decode   -- converts each frame or XML document into a pair of hands.
+            classify -- segments holds, recognizes motions, and matches gestures.
+            text     -- decodes the recognized letters into words, appends them,
+                        hands the text to the window, and updates the display and
+                        output XML file.
+            speech   -- converts text to speech.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <string>
+#include <stdint.h>
+#include "Gesture.h"
+#include "SpscQueue.h"
+#include "Tracer.h"
+#include "WordDecoder.h"
+#include "../microcontroller/sensor_frame.h"
+
+using namespace std ;
+
+#define PIPELINE_RAW_SLOTS     64     /* Number of samples queued between ingest and decode. */
+#define PIPELINE_SAMPLE_SLOTS  64     /* Number of samples queued between decode, classify, and text. */
+#define PIPELINE_SPEECH_SLOTS   8     /* Number of utterances queued for speech. */
+#define PIPELINE_SEGMENTS       2     /* Most poses recognized from one sample: a held pose and a completed motion. */
+#define PIPELINE_REPORT_NS 1000000000ULL  /* Time between updates of the pipeline statistics, in nanoseconds. */
+#define LATENCY_SUB_BITS       3     /* Each power of two is split into 2^3 buckets, so latencies are kept to within 12.5%. */
+#define LATENCY_BUCKETS ((64 - LATENCY_SUB_BITS + 1) << LATENCY_SUB_BITS)  /* Enough buckets for any 64 bit latency. */
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "PipelineStage" names the stages, in order. */
+
+enum PipelineStage { STAGE_INGEST, STAGE_DECODE, STAGE_CLASSIFY, STAGE_TEXT, STAGE_SPEECH, NUM_STAGES } ;
+
+/* Type "RawSample" represents a sample as read by the ingest stage. */
+
+struct RawSample {
+	 struct sensor_frame frame ;                      /* The frame copied out of the shared memory ring. */
+	 string xml ;                                     /* The contents of the XML file, if read from one. */
+	 bool fromFile ;                                  /* True if the sample was read from the XML file. */
+	 uint32_t seq ;                                   /* The frame's sequence number, used to follow it through the trace. */
+	 uint64_t ingested ;                              /* Time the sample was read, in nanoseconds. */
+	 uint64_t queued ;                                /* Time the sample was queued for the next stage. */
+} ;
+
+/* Type "GestureSample" represents a decoded sample, together with the text the classify
+   stage recognized from it. */
+
+struct GestureSample {
+	 Gesture gesture ;                                /* The pair of hands. */
+	 string sensorStatus ;                            /* An indicator of the sensor status. */
+	 string xmlVersion ;                              /* The XML version. */
+	 string convert ;                                 /* Used to track whether gesture conversion should be performed. */
+	 string letters ;                                 /* Text recognized from this sample. */
+	 LetterSegment segments[PIPELINE_SEGMENTS] ;      /* The letters each pose recognized from this sample may have been. */
+	 unsigned int numSegments ;                       /* Number of poses recognized from this sample. */
+	 const char* source ;                             /* Where the sample was read from. */
+	 bool valid ;                                     /* False if the sample could not be decoded. */
+	 bool convertFailed ;                             /* True if the gesture could not be converted to text. */
+	 uint32_t seq ;                                   /* The frame's sequence number, used to follow it through the trace. */
+	 uint64_t acquired ;                              /* Time the sensors were read, 0 if unknown. */
+	 uint64_t ingested ;                              /* Time the sample was read. */
+	 uint64_t queued ;                                /* Time the sample was queued for the next stage. */
+} ;
+
+/* Type "SpeechRequest" represents text waiting to be converted to speech. */
+
+struct SpeechRequest {
+	 string text ;                                    /* The text to speak. */
+	 uint64_t queued ;                                /* Time the text was queued. */
+	 uint64_t origin ;                                /* Time the frame that completed the text was read, 0 if
+	                                                     the text was requested with the Output button. */
+	 uint32_t seq ;                                   /* Sequence number of that frame, TRACE_NO_FRAME if none. */
+} ;
+
+/* Type "StageStats" counts the samples handled by one stage and the time from each
+   sample being queued for the stage to the stage finishing with it. Only the stage's
+   own thread records; any thread may read. */
+
+class StageStats {
+
+  public:
+
+	 /* Default constructor function */
+	 inline StageStats( ) : items(0), timed(0), totalNs(0), maxNs(0) { }
+
+	 /* Accessor functions */
+	 inline uint64_t Items( ) const { return __atomic_load_n( &items, __ATOMIC_RELAXED ) ; }      /* Access number of samples. */
+	 inline uint64_t Timed( ) const { return __atomic_load_n( &timed, __ATOMIC_RELAXED ) ; }      /* Access number of timed samples. */
+	 inline uint64_t TotalNs( ) const { return __atomic_load_n( &totalNs, __ATOMIC_RELAXED ) ; }  /* Access summed latency. */
+
+	 /* Mutator functions */
+	 void Record( uint64_t startNs, uint64_t endNs ) ;  /* Counts a sample, timed from startNs unless it is 0. */
+	 uint64_t TakeMaxNs( ) ;                         /* Returns the largest latency since the last call. */
+
+  private:
+
+	 uint64_t items ;                                /* Number of samples handled. */
+	 uint64_t timed ;                                /* Number of samples with a known start time. */
+	 uint64_t totalNs ;                              /* Summed latency of the timed samples. */
+	 uint64_t maxNs ;                                /* Largest latency since TakeMaxNs() was last called. */
+
+} ;
+
+/* Type "PipelineStats" holds the statistics of every stage, of each sample from the
+   time the sensors were read until its text reached the window, and of each streamed
+   word from the time the frame that completed it was read until it was spoken. */
+
+class PipelineStats {
+
+  public:
+
+	 /* Default constructor function */
+	 PipelineStats( ) ;
+
+	 /* Accessor functions */
+	 inline StageStats &Stage( PipelineStage stage ) { return stages[stage] ; }  /* Access the statistics of a stage. */
+	 inline StageStats &Total( ) { return total ; }                              /* Access the end to end statistics. */
+	 inline StageStats &Spoken( ) { return spoken ; }                            /* Access the word to speech statistics. */
+
+	 /* Formats the rate, queue depth, and mean and largest latency of each stage since the last report. */
+	 string Report( const unsigned int depth[NUM_STAGES], const unsigned int capacity[NUM_STAGES], uint64_t nowNs ) ;
+
+  private:
+
+	 string Line( const char* name, StageStats &stats, unsigned int stage, double seconds ) ;
+
+	 StageStats stages[NUM_STAGES] ;                 /* The statistics of each stage. */
+	 StageStats total ;                              /* The end to end statistics. */
+	 StageStats spoken ;                             /* Time from the frame that completed a word to it being spoken. */
+	 uint64_t lastItems[NUM_STAGES + 2] ;            /* Samples counted at the last report. */
+	 uint64_t lastTimed[NUM_STAGES + 2] ;            /* Timed samples counted at the last report. */
+	 uint64_t lastTotalNs[NUM_STAGES + 2] ;          /* Summed latency at the last report. */
+	 uint64_t lastReportNs ;                         /* Time of the last report. */
+
+} ;
+
+/* Type "LatencyHistogram" counts latencies in logarithmic buckets, so percentiles can be
+   found without keeping every sample or allocating memory. Only one thread may record,
+   and the percentiles should only be read once it has finished. */
+
+class LatencyHistogram {
+
+  public:
+
+	 /* Default constructor function */
+	 LatencyHistogram( ) ;
+
+	 /* Accessor functions */
+	 inline uint64_t Count( ) const { return count ; }                      /* Access number of latencies. */
+	 inline uint64_t MaxNs( ) const { return maxNs ; }                      /* Access largest latency. */
+	 inline double MeanNs( ) const { return count ? ((double)totalNs / count) : 0.0 ; }  /* Access mean latency. */
+	 uint64_t Percentile( double percent ) const ;    /* Access a percentile, rounded up to the end of its bucket. */
+
+	 /* Mutator functions */
+	 void Record( uint64_t ns ) ;                    /* Counts a latency. */
+	 void Reset( ) ;                                 /* Forgets every latency. */
+
+  private:
+
+	 static unsigned int Bucket( uint64_t ns ) ;
+	 static uint64_t BucketEnd( unsigned int bucket ) ;
+
+	 uint64_t counts[LATENCY_BUCKETS] ;              /* Number of latencies in each bucket. */
+	 uint64_t count ;                                /* Number of latencies. */
+	 uint64_t totalNs ;                              /* Summed latency. */
+	 uint64_t maxNs ;                                /* Largest latency. */
+
+} ;
+
+uint64_t pipeline_now_ns( ) ;
+
+#endif
@@ -0,0 +1,254 @@
+/***********PoseSegmenter.cpp********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The Defaults(), ParseConfig(), Configure(), Reset(), and Update()
+            functions are defined in this module.
+
+            A frame is stable when the summed variance of the quantized flex
+            values and of the accelerometer gravity directions over the last
+            "window" frames are under the hold thresholds, and the contact
+            sensors have not changed for "holdFrames" frames. A hold starts after
+            "holdFrames" stable frames in a row, and ends after "releaseFrames"
+            frames in a row over the release thresholds or with different contact
+            sensors. Using larger release thresholds than hold thresholds keeps
+            sensor noise from splitting one hold into several.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <string.h>
+#include "PoseSegmenter.h"
+
+/*----------PoseSegmenter::PoseSegmenter( )------------------------------------------
+
+  PURPOSE:  Create a segmenter with the default settings. Configure() changes them.
+
+-----------------------------------------------------------------------------------*/
+
+PoseSegmenter::PoseSegmenter( ) : config(Defaults()), holds(0) {
+
+    Reset() ;
+
+}
+
+/*----------PoseSegmenter::Defaults( )-----------------------------------------------
+
+  PURPOSE:  Return the default settings.
+
+-----------------------------------------------------------------------------------*/
+
+SegmentConfig PoseSegmenter::Defaults( ){
+
+    SegmentConfig defaults ;  /* The default settings. */
+
+    defaults.window = SEGMENT_WINDOW ;
+    defaults.holdFrames = SEGMENT_HOLD_FRAMES ;
+    defaults.releaseFrames = SEGMENT_RELEASE_FRAMES ;
+    defaults.holdFlex = SEGMENT_HOLD_FLEX ;
+    defaults.releaseFlex = SEGMENT_RELEASE_FLEX ;
+    defaults.holdOrient = SEGMENT_HOLD_ORIENT ;
+    defaults.releaseOrient = SEGMENT_RELEASE_ORIENT ;
+
+    return defaults ;
+
+}
+
+/*----------PoseSegmenter::ParseConfig( )--------------------------------------------
+
+  PURPOSE:  Read settings given as comma separated name=value pairs, such as
+            "window=8,hold-flex=3", as SIGN2SPEECH_SEGMENT and replay -g give
+            them. The names are window, hold, release, hold-flex, release-flex,
+            hold-orient, and release-orient. Settings not named are left as they
+            are.
+
+  INPUT  PARAMETERS:  spec -- the settings.
+
+  OUTPUT PARAMETERS:  config -- the settings, changed by those named.
+
+  RETURN VALUE:  False if a name is unknown or a value is not a number that is
+                 zero or more, in which case config may be partly changed.
+
+-----------------------------------------------------------------------------------*/
+
+bool PoseSegmenter::ParseConfig( const char* spec, SegmentConfig &config ){
+
+    char name[32] ;   /* The name of the next setting. */
+    double value ;    /* The value of the next setting. */
+    int used ;        /* Number of characters read for the next setting. */
+
+    while( *spec != '\0' ){
+        if( (sscanf(spec, "%31[^=,]=%lf%n", name, &value, &used) != 2) || (value < 0.0) )
+            return false ;
+        if( strcmp(name, "window") == 0 )
+            config.window = (unsigned int)value ;
+        else if( strcmp(name, "hold") == 0 )
+            config.holdFrames = (unsigned int)value ;
+        else if( strcmp(name, "release") == 0 )
+            config.releaseFrames = (unsigned int)value ;
+        else if( strcmp(name, "hold-flex") == 0 )
+            config.holdFlex = (float)value ;
+        else if( strcmp(name, "release-flex") == 0 )
+            config.releaseFlex = (float)value ;
+        else if( strcmp(name, "hold-orient") == 0 )
+            config.holdOrient = (float)value ;
+        else if( strcmp(name, "release-orient") == 0 )
+            config.releaseOrient = (float)value ;
+        else
+            return false ;
+        spec += used ;
+        if( *spec == ',' )
+            spec++ ;
+        else if( *spec != '\0' )
+            return false ;
+    }
+
+    return true ;
+
+}
+
+/*----------PoseSegmenter::Configure( )----------------------------------------------
+
+  PURPOSE:  Change the settings. The window is limited to 2-SEGMENT_MAX_WINDOW frames,
+            the frame counts to at least 1, and the release thresholds to at least
+            the hold thresholds.
+
+  INPUT  PARAMETERS:  newConfig -- the new settings.
+
+-----------------------------------------------------------------------------------*/
+
+void PoseSegmenter::Configure( const SegmentConfig &newConfig ){
+
+    config = newConfig ;
+    if( config.window < 2 )
+        config.window = 2 ;
+    if( config.window > SEGMENT_MAX_WINDOW )
+        config.window = SEGMENT_MAX_WINDOW ;
+    if( config.holdFrames < 1 )
+        config.holdFrames = 1 ;
+    if( config.releaseFrames < 1 )
+        config.releaseFrames = 1 ;
+    if( config.releaseFlex < config.holdFlex )
+        config.releaseFlex = config.holdFlex ;
+    if( config.releaseOrient < config.holdOrient )
+        config.releaseOrient = config.holdOrient ;
+    Reset() ;
+
+    return ;
+
+}
+
+/*----------PoseSegmenter::Reset( )--------------------------------------------------
+
+  PURPOSE:  Forget any hold and the frames in the window.
+
+-----------------------------------------------------------------------------------*/
+
+void PoseSegmenter::Reset( ){
+
+    memset( flexSum, 0, sizeof(flexSum) ) ;
+    memset( flexSq, 0, sizeof(flexSq) ) ;
+    memset( orientSum, 0, sizeof(orientSum) ) ;
+    memset( orientSq, 0, sizeof(orientSq) ) ;
+    count = 0 ;
+    next = 0 ;
+    signature = 0 ;
+    sigRun = 0 ;
+    stableRun = 0 ;
+    unstableRun = 0 ;
+    holding = false ;
+    flexVar = 0.0f ;
+    orientVar = 0.0f ;
+
+    return ;
+
+}
+
+/*----------PoseSegmenter::Update( )-------------------------------------------------
+
+  PURPOSE:  Add the next frame to the window and update the hold state. The sums of
+            the values and their squares are kept up to date as frames enter and
+            leave the window, so each frame costs the same regardless of the
+            window size.
+
+  INPUT  PARAMETERS:  hand -- the next frame.
+
+  RETURN VALUE:  true if a hold started on this frame, in which case the hand should
+                 be converted to text
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool PoseSegmenter::Update( const Hand &hand ){
+
+    MotionFeatures f ;        /* The frame. */
+    double var = 0.0 ;        /* The variance so far. */
+    bool stable ;             /* True if the frame is stable enough to start a hold. */
+    bool unstable ;           /* True if the frame is unstable enough to end a hold. */
+    unsigned int j ;          /* An iterator. */
+
+    if( !hand.Defined() ){
+        return false ;
+    }
+    MotionRecognizer::HandFeatures( hand, f ) ;
+    if( count == config.window ){
+        /* Remove the oldest frame from the sums. */
+        for( j = 0 ; j < FLEX_VECTOR_LEN ; j++ ){
+            flexSum[j] -= flex[next][j] ;
+            flexSq[j] -= flex[next][j] * flex[next][j] ;
+        }
+        for( j = 0 ; j < MOTION_DIMS ; j++ ){
+            orientSum[j] -= orient[next][j] ;
+            orientSq[j] -= orient[next][j] * orient[next][j] ;
+        }
+    }
+    else{
+        count++ ;
+    }
+    for( j = 0 ; j < FLEX_VECTOR_LEN ; j++ ){
+        flex[next][j] = (float)f.flex[j] ;
+        flexSum[j] += flex[next][j] ;
+        flexSq[j] += flex[next][j] * flex[next][j] ;
+        var += (flexSq[j] / count) - ((flexSum[j] / count) * (flexSum[j] / count)) ;
+    }
+    flexVar = (var > 0.0) ? (float)var : 0.0f ;
+    var = 0.0 ;
+    for( j = 0 ; j < MOTION_DIMS ; j++ ){
+        orient[next][j] = f.orient[j] ;
+        orientSum[j] += orient[next][j] ;
+        orientSq[j] += orient[next][j] * orient[next][j] ;
+        var += (orientSq[j] / count) - ((orientSum[j] / count) * (orientSum[j] / count)) ;
+    }
+    orientVar = (var > 0.0) ? (float)var : 0.0f ;
+    next = (next + 1) % config.window ;
+    if( holding ){
+        /* The contacts are compared against the hold, so a single frame of contact noise does not end it. */
+        unstable = (f.signature != signature) || (flexVar > config.releaseFlex) || (orientVar > config.releaseOrient) ;
+        unstableRun = unstable ? (unstableRun + 1) : 0 ;
+        if( unstableRun >= config.releaseFrames ){
+            holding = false ;
+            stableRun = 0 ;
+            sigRun = 0 ;
+        }
+        return false ;
+    }
+    sigRun = (f.signature == signature) ? (sigRun + 1) : 1 ;
+    signature = f.signature ;
+    stable = (count == config.window) && (sigRun >= config.holdFrames) &&
+             (flexVar <= config.holdFlex) && (orientVar <= config.holdOrient) ;
+    stableRun = stable ? (stableRun + 1) : 0 ;
+    if( stableRun >= config.holdFrames ){
+        holding = true ;
+        unstableRun = 0 ;
+        holds++ ;
+        return true ;
+    }
+
+    return false ;
+
+}
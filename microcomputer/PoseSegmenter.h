@@ -0,0 +1,99 @@
+/***********PoseSegmenter.h**********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the class "PoseSegmenter", which splits the
+            stream of hands read from the sensors into holds, so that each static
+            gesture is converted to text once. Parser.h and PoseSegmenter.cpp
+            include this file.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef POSESEGMENTER_H
+#define POSESEGMENTER_H
+
+#include <stdint.h>
+#include "Hand.h"
+#include "MotionRecognizer.h"
+
+using namespace std ;
+
+#define SEGMENT_MAX_WINDOW     32     /* Largest number of frames the variance can be measured over. */
+#define SEGMENT_WINDOW          6     /* Default number of frames the variance is measured over. */
+#define SEGMENT_HOLD_FRAMES     3     /* Default number of stable frames before a hold starts. */
+#define SEGMENT_RELEASE_FRAMES  2     /* Default number of unstable frames before a hold ends. */
+#define SEGMENT_HOLD_FLEX     2.0f    /* Default flex variance a hold must stay under, in flex steps squared. */
+#define SEGMENT_RELEASE_FLEX  6.0f    /* Default flex variance that ends a hold. */
+#define SEGMENT_HOLD_ORIENT   0.03f   /* Default orientation variance a hold must stay under. */
+#define SEGMENT_RELEASE_ORIENT 0.08f  /* Default orientation variance that ends a hold. */
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "SegmentConfig" holds the settings of a "PoseSegmenter". The release thresholds
+   should be larger than the hold thresholds so that a hold does not flicker on and off. */
+
+struct SegmentConfig {
+	 unsigned int window ;                           /* Number of frames the variance is measured over. */
+	 unsigned int holdFrames ;                       /* Number of stable frames before a hold starts. */
+	 unsigned int releaseFrames ;                    /* Number of unstable frames before a hold ends. */
+	 float holdFlex ;                                /* Summed flex variance a hold must stay under. */
+	 float releaseFlex ;                             /* Summed flex variance that ends a hold. */
+	 float holdOrient ;                              /* Summed orientation variance a hold must stay under. */
+	 float releaseOrient ;                           /* Summed orientation variance that ends a hold. */
+} ;
+
+/* Type "PoseSegmenter" tracks the variance of the flex sensors and accelerometers over
+   a sliding window of frames, and reports when the hand settles into a pose. */
+
+class PoseSegmenter {
+
+  public:
+
+	 /* Default constructor function */
+	 PoseSegmenter( ) ;
+
+	 /* Accessor functions */
+	 inline bool Holding( ) const { return holding ; }                      /* True while the hand is held still. */
+	 inline unsigned long Holds( ) const { return holds ; }                 /* Access number of holds found. */
+	 inline const SegmentConfig &Config( ) const { return config ; }        /* Access the settings. */
+	 inline float FlexVariance( ) const { return flexVar ; }                /* Access the latest flex variance. */
+	 inline float OrientVariance( ) const { return orientVar ; }            /* Access the latest orientation variance. */
+
+	 /* Mutator functions */
+	 void Configure( const SegmentConfig &newConfig ) ;  /* Changes the settings and forgets any hold. */
+	 void Reset( ) ;                                 /* Forgets any hold and the frames in the window. */
+	 bool Update( const Hand &hand ) ;               /* Adds the next frame, returning true when a hold starts. */
+
+	 /* Default settings, and settings given as text */
+	 static SegmentConfig Defaults( ) ;
+	 static bool ParseConfig( const char* spec, SegmentConfig &config ) ;
+
+  private:
+
+	 SegmentConfig config ;                          /* The settings. */
+	 float flex[SEGMENT_MAX_WINDOW][FLEX_VECTOR_LEN] ;  /* Ring of the quantized flex values of each recent frame. */
+	 float orient[SEGMENT_MAX_WINDOW][MOTION_DIMS] ;    /* Ring of the orientation of each recent frame. */
+	 double flexSum[FLEX_VECTOR_LEN] ;               /* Sum of the flex values in the window. */
+	 double flexSq[FLEX_VECTOR_LEN] ;                /* Sum of the squared flex values in the window. */
+	 double orientSum[MOTION_DIMS] ;                 /* Sum of the orientations in the window. */
+	 double orientSq[MOTION_DIMS] ;                  /* Sum of the squared orientations in the window. */
+	 unsigned int count ;                            /* Number of frames in the window. */
+	 unsigned int next ;                             /* Position of the next frame in the ring. */
+	 uint16_t signature ;                            /* Contact sensors of the previous frame, or of the hold. */
+	 unsigned int sigRun ;                           /* Number of frames the contact sensors have been unchanged. */
+	 unsigned int stableRun ;                        /* Number of consecutive stable frames. */
+	 unsigned int unstableRun ;                      /* Number of consecutive unstable frames during a hold. */
+	 bool holding ;                                  /* True while the hand is held still. */
+	 unsigned long holds ;                           /* Number of holds found. */
+	 float flexVar ;                                 /* Flex variance over the window. */
+	 float orientVar ;                               /* Orientation variance over the window. */
+
+} ;
+
+#endif
@@ -0,0 +1,605 @@
+/***********SessionJournal.cpp******************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The Open(), Start(), Frame(), Text(), Snapshot(), Flush(), and Stop()
+            functions of the "SessionJournal" class, and the journal thread that
+            writes the session log and the snapshot file, are defined in this module.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <chrono>
+#include "SessionJournal.h"
+
+/*----------append_xml( )------------------------------------------------------------
+
+  PURPOSE:  Append an element holding a number, written as the old gesture_data.xml
+            wrote it.
+
+  INPUT  PARAMETERS:  xml   -- the snapshot.
+                      name  -- the element name.
+                      value -- the value.
+
+-----------------------------------------------------------------------------------*/
+
+static void append_xml( string &xml, const char* name, double value ){
+
+    char text[32] ;   /* The value, as text. */
+
+    snprintf( text, sizeof(text), "%g", value ) ;
+    xml += '<' ; xml += name ; xml += '>' ;
+    xml += text ;
+    xml += "</" ; xml += name ; xml += '>' ;
+
+}
+
+/*----------append_xml( )------------------------------------------------------------
+
+  PURPOSE:  Append an element holding a contact sensor, as true or false.
+
+  INPUT  PARAMETERS:  xml   -- the snapshot.
+                      name  -- the element name.
+                      value -- the contact sensor.
+
+-----------------------------------------------------------------------------------*/
+
+static void append_xml( string &xml, const char* name, bool value ){
+
+    xml += '<' ; xml += name ; xml += '>' ;
+    xml += value ? "true" : "false" ;
+    xml += "</" ; xml += name ; xml += '>' ;
+
+}
+
+/*----------append_xml( )------------------------------------------------------------
+
+  PURPOSE:  Append an element holding text, with the characters XML reserves
+            written as entities.
+
+  INPUT  PARAMETERS:  xml   -- the snapshot.
+                      name  -- the element name.
+                      value -- the text.
+
+-----------------------------------------------------------------------------------*/
+
+static void append_xml( string &xml, const char* name, const string &value ){
+
+    size_t i ;   /* An iterator. */
+
+    xml += '<' ; xml += name ; xml += '>' ;
+    for( i = 0 ; i < value.size() ; i++ ){
+        switch( value[i] ){
+            case '&': xml += "&amp;" ; break ;
+            case '<': xml += "&lt;" ; break ;
+            case '>': xml += "&gt;" ; break ;
+            case '"': xml += "&quot;" ; break ;
+            default: xml += value[i] ; break ;
+        }
+    }
+    xml += "</" ; xml += name ; xml += '>' ;
+
+}
+
+/*----------render_snapshot( )-------------------------------------------------------
+
+  PURPOSE:  Write a sample as the XML document gesture_data.xsl reads, with the
+            elements of the old gesture_data.xml but without the indentation. The
+            fingers, folds, and accelerometers are visited through tables rather
+            than by comparing their names.
+
+  INPUT  PARAMETERS:  text         -- the recognized text.
+                      gesture      -- the hands.
+                      sensorStatus -- the sensor status.
+                      version      -- the sensor data version.
+
+  OUTPUT PARAMETERS:  xml -- the snapshot.
+
+-----------------------------------------------------------------------------------*/
+
+static void render_snapshot( string &xml, const string &text, const Gesture &gesture, const string &sensorStatus,
+                             const string &version ){
+
+    static const char* const handNames[] = {"left", "right"} ;
+    static const char* const fingerNames[] = {"thumb", "index", "middle", "ring", "pinky"} ;
+    static const char* const foldNames[] = {"thumb-index", "index-middle", "middle-ring", "ring-pinky"} ;
+    static const char* const accelNames[] = {"accel-x", "accel-y", "accel-z", "mag-x", "mag-y", "mag-z",
+                                             "gyro-x", "gyro-y", "gyro-z"} ;
+    unsigned int i ;   /* An iterator. */
+    unsigned int j ;   /* An iterator. */
+    unsigned int k ;   /* An iterator. */
+
+    xml = "<?xml version=\"1.0\" encoding=\"utf-8\" standalone=\"no\"?>\n"
+          "<?xml-stylesheet type=\"text/xsl\" href=\"gesture_data.xsl\"?>\n"
+          "<!DOCTYPE gestures SYSTEM \"gesture_data.dtd\">\n"
+          "<gestures><gesture>" ;
+    if( !gesture.Defined() ){
+        /* No gesture data. Simply close out the document. */
+        xml += "</gesture></gestures>\n" ;
+        return ;
+    }
+    for( i = 0 ; i < 2 ; i++ ){
+        const Hand &hand = (i == 0) ? gesture.Left() : gesture.Right() ;
+        xml += "<hand side=\"" ; xml += handNames[i] ; xml += "\">" ;
+        if( !hand.Defined() ){
+            xml += "</hand>" ;
+            continue ;
+        }
+        const Finger* fingers[] = {&hand.Thumb(), &hand.Index(), &hand.Middle(), &hand.Ring(), &hand.Pinky()} ;
+        const Fold* folds[] = {&hand.TiFold(), &hand.ImFold(), &hand.MrFold(), &hand.RpFold()} ;
+        for( j = 0 ; j < 5 ; j++ ){
+            xml += '<' ; xml += fingerNames[j] ; xml += '>' ;
+            if( fingers[j]->Defined() ){
+                append_xml( xml, "flex", fingers[j]->Flex() ) ;
+                append_xml( xml, "contact-tip", fingers[j]->ContactTip() ) ;
+                /* Currently the thumb only has a tip contact sensor. */
+                if( j > 0 ){
+                    append_xml( xml, "contact-mid", fingers[j]->ContactMid() ) ;
+                }
+            }
+            xml += "</" ; xml += fingerNames[j] ; xml += '>' ;
+        }
+        for( j = 0 ; j < 4 ; j++ ){
+            xml += '<' ; xml += foldNames[j] ; xml += '>' ;
+            if( folds[j]->Defined() ){
+                append_xml( xml, "contact-tip", folds[j]->ContactTip() ) ;
+            }
+            xml += "</" ; xml += foldNames[j] ; xml += '>' ;
+        }
+        for( j = 0 ; j < NUM_LSM303 ; j++ ){
+            const Lsm303 &lsm = hand.Lsm303Vals( j ) ;
+            const double values[] = {lsm.AccelX(), lsm.AccelY(), lsm.AccelZ(), lsm.MagX(), lsm.MagY(), lsm.MagZ()} ;
+            xml += "<lsm303 side=\"" ; xml += lsm.SideName() ; xml += "\">" ;
+            for( k = 0 ; lsm.Defined() && (k < 6) ; k++ ){
+                append_xml( xml, accelNames[k], values[k] ) ;
+            }
+            xml += "</lsm303>" ;
+        }
+        for( j = 0 ; j < NUM_LSM9DOF ; j++ ){
+            const Lsm9dof &lsm = hand.Lsm9dofVals( j ) ;
+            const double values[] = {lsm.AccelX(), lsm.AccelY(), lsm.AccelZ(), lsm.MagX(), lsm.MagY(), lsm.MagZ(),
+                                     lsm.GyroX(), lsm.GyroY(), lsm.GyroZ()} ;
+            xml += "<lsm9dof side=\"" ; xml += lsm.SideName() ; xml += "\">" ;
+            for( k = 0 ; lsm.Defined() && (k < 9) ; k++ ){
+                append_xml( xml, accelNames[k], values[k] ) ;
+            }
+            xml += "</lsm9dof>" ;
+        }
+        xml += "</hand>" ;
+    }
+    xml += "</gesture>" ;
+    append_xml( xml, "converted-text", text ) ;
+    append_xml( xml, "status", sensorStatus ) ;
+    append_xml( xml, "convert", false ) ;
+    append_xml( xml, "version", version ) ;
+    xml += "</gestures>\n" ;
+
+}
+
+/*----------SessionJournal::SessionJournal( )----------------------------------------
+
+  PURPOSE:  Create a journal that is not logging and has not been started.
+
+-----------------------------------------------------------------------------------*/
+
+SessionJournal::SessionJournal( ) : running(false), stopping(false), logFd(-1), used(0), flushRequests(0),
+                                    flushesDone(0), frames(0), dropped(0), snapshotDirty(false) {
+
+}
+
+/*----------SessionJournal::~SessionJournal( )---------------------------------------
+
+  PURPOSE:  Write the records left, stop the journal thread, and close the log.
+
+-----------------------------------------------------------------------------------*/
+
+SessionJournal::~SessionJournal( ){
+
+    Stop() ;
+
+}
+
+/*----------SessionJournal::Open( )--------------------------------------------------
+
+  PURPOSE:  Start appending records to a session log, creating it if needed. The log
+            is only written once Start() has been called.
+
+  INPUT  PARAMETERS:  fName -- the session log.
+
+  RETURN VALUE:  true if the log was opened
+                 false otherwise, or if the journal thread is already running.
+
+-----------------------------------------------------------------------------------*/
+
+bool SessionJournal::Open( const char* fName ){
+
+    int fd ;   /* The session log. */
+
+    if( running || (logFd >= 0) ){
+        return false ;
+    }
+    fd = open( fName, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644 ) ;
+    if( fd < 0 ){
+        return false ;
+    }
+    filling.assign( JOURNAL_BUFFER_BYTES, 0 ) ;
+    writing.assign( JOURNAL_BUFFER_BYTES, 0 ) ;
+    used = 0 ;
+    frames = 0 ;
+    dropped = 0 ;
+    logFd = fd ;
+
+    return true ;
+
+}
+
+/*----------SessionJournal::Start( )-------------------------------------------------
+
+  PURPOSE:  Start the journal thread.
+
+  INPUT  PARAMETERS:  fName -- the snapshot file, NULL to write no snapshot.
+
+  RETURN VALUE:  true if the thread was started
+                 false if it was already running.
+
+-----------------------------------------------------------------------------------*/
+
+bool SessionJournal::Start( const char* fName ){
+
+    if( running ){
+        return false ;
+    }
+    snapshotFName = (fName != NULL) ? fName : "" ;
+    stopping = false ;
+    running = true ;
+    writer = thread( &SessionJournal::Run, this ) ;
+
+    return true ;
+
+}
+
+/*----------SessionJournal::Append( )------------------------------------------------
+
+  PURPOSE:  Copy a record into the buffer, waking the journal thread once the buffer is
+            half full. The record is dropped if it does not fit, rather than waiting
+            for the disk.
+
+  INPUT  PARAMETERS:  type    -- the record type.
+                      head    -- the first part of the payload.
+                      headLen -- its length.
+                      body    -- the rest of the payload, NULL if none.
+                      bodyLen -- its length.
+
+  RETURN VALUE:  true if the record was queued
+                 false if not logging or the buffer is full.
+
+-----------------------------------------------------------------------------------*/
+
+bool SessionJournal::Append( uint8_t type, const void* head, size_t headLen, const void* body, size_t bodyLen ){
+
+    struct journal_record record ;   /* The record header. */
+    size_t half ;                    /* Bytes queued at which the journal thread is woken. */
+    bool notify ;                    /* True if this record filled the buffer past half. */
+
+    record.length = headLen + bodyLen ;
+    record.type = type ;
+    memset( record.reserved, 0, sizeof(record.reserved) ) ;
+    {
+        lock_guard<mutex> guard( lock ) ;
+        if( logFd < 0 ){
+            return false ;
+        }
+        if( (used + sizeof(record) + record.length) > filling.size() ){
+            dropped++ ;
+            return false ;
+        }
+        half = filling.size() / 2 ;
+        memcpy( &filling[used], &record, sizeof(record) ) ;
+        memcpy( &filling[used + sizeof(record)], head, headLen ) ;
+        if( bodyLen > 0 ){
+            memcpy( &filling[used + sizeof(record) + headLen], body, bodyLen ) ;
+        }
+        notify = (used < half) && ((used + sizeof(record) + record.length) >= half) ;
+        used += sizeof(record) + record.length ;
+    }
+    if( notify ){
+        wake.notify_one() ;
+    }
+
+    return true ;
+
+}
+
+/*----------SessionJournal::Frame( )-------------------------------------------------
+
+  PURPOSE:  Queue a frame for the session log.
+
+  INPUT  PARAMETERS:  frame -- the frame, as read from the shared memory ring.
+
+  RETURN VALUE:  true if the frame was queued
+                 false if not logging or the buffer is full.
+
+-----------------------------------------------------------------------------------*/
+
+bool SessionJournal::Frame( const struct sensor_frame &frame ){
+
+    if( !Append(JOURNAL_FRAME, &frame, sizeof(frame), NULL, 0) ){
+        return false ;
+    }
+    frames++ ;
+
+    return true ;
+
+}
+
+/*----------SessionJournal::Text( )--------------------------------------------------
+
+  PURPOSE:  Queue the recognized text for the session log. Called each time it changes,
+            including when it is cleared, so the log holds the text as it was shown.
+
+  INPUT  PARAMETERS:  text -- the whole text.
+                      ns   -- the time it changed, in CLOCK_MONOTONIC nanoseconds.
+
+  RETURN VALUE:  true if the text was queued
+                 false if not logging or the buffer is full.
+
+-----------------------------------------------------------------------------------*/
+
+bool SessionJournal::Text( const string &text, uint64_t ns ){
+
+    return Append( JOURNAL_TEXT, &ns, sizeof(ns), text.data(), text.size() ) ;
+
+}
+
+/*----------SessionJournal::Snapshot( )----------------------------------------------
+
+  PURPOSE:  Queue the latest sample for the snapshot file. Only the values last queued
+            are written, so this may be called for every sample.
+
+  INPUT  PARAMETERS:  text         -- the recognized text.
+                      gesture      -- the hands.
+                      sensorStatus -- the sensor status.
+                      version      -- the sensor data version.
+
+-----------------------------------------------------------------------------------*/
+
+void SessionJournal::Snapshot( const string &text, const Gesture &gesture, const string &sensorStatus,
+                               const string &version ){
+
+    lock_guard<mutex> guard( lock ) ;
+
+    this->text = text ;
+    this->gesture = gesture ;
+    this->sensorStatus = sensorStatus ;
+    this->version = version ;
+    snapshotDirty = true ;
+
+}
+
+/*----------SessionJournal::SnapshotXml( )-------------------------------------------
+
+  PURPOSE:  Access the latest snapshot, as it was written to the snapshot file.
+
+  OUTPUT PARAMETERS:  xml -- the snapshot.
+
+  RETURN VALUE:  true if a snapshot has been written
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool SessionJournal::SnapshotXml( string &xml ) const {
+
+    lock_guard<mutex> guard( lock ) ;
+
+    xml = this->xml ;
+
+    return !xml.empty() ;
+
+}
+
+/*----------SessionJournal::Flush( )-------------------------------------------------
+
+  PURPOSE:  Wait until every record queued so far has been written and synced to the
+            disk. Returns at once if the journal thread is not running.
+
+-----------------------------------------------------------------------------------*/
+
+void SessionJournal::Flush( ){
+
+    unique_lock<mutex> guard( lock ) ;
+    unsigned long request ;   /* The flush waited for. */
+
+    if( !running ){
+        return ;
+    }
+    request = ++flushRequests ;
+    wake.notify_one() ;
+    while( running && (flushesDone < request) ){
+        flushed.wait( guard ) ;
+    }
+
+}
+
+/*----------SessionJournal::Stop( )--------------------------------------------------
+
+  PURPOSE:  Write the records and the snapshot left, stop the journal thread, and close
+            the log.
+
+-----------------------------------------------------------------------------------*/
+
+void SessionJournal::Stop( ){
+
+    if( writer.joinable() ){
+        {
+            lock_guard<mutex> guard( lock ) ;
+            stopping = true ;
+        }
+        wake.notify_one() ;
+        writer.join() ;
+    }
+    if( logFd >= 0 ){
+        close( logFd ) ;
+        logFd = -1 ;
+    }
+
+}
+
+/*----------SessionJournal::WriteLog( )----------------------------------------------
+
+  PURPOSE:  Write the records queued to the session log in one call, then sync it if
+            asked. The stages keep queueing into the other buffer meanwhile. If the
+            write fails, for example because the disk is full, logging is stopped
+            rather than left with a partial record at the end.
+
+  INPUT  PARAMETERS:  sync -- true to sync the log to the disk.
+
+-----------------------------------------------------------------------------------*/
+
+void SessionJournal::WriteLog( bool sync ){
+
+    size_t count ;     /* Number of bytes to write. */
+    size_t done ;      /* Number of bytes written. */
+    ssize_t written ;  /* Number of bytes written by one call. */
+    int fd ;           /* The session log. */
+
+    {
+        lock_guard<mutex> guard( lock ) ;
+        fd = logFd ;
+        filling.swap( writing ) ;
+        count = used ;
+        used = 0 ;
+    }
+    if( fd < 0 ){
+        return ;
+    }
+    for( done = 0 ; done < count ; done += written ){
+        written = write( fd, &writing[done], count - done ) ;
+        if( written < 0 ){
+            if( errno == EINTR ){
+                written = 0 ;
+                continue ;
+            }
+            /* A partial record at the end is skipped by tools/replay, as a damaged frame is. */
+            lock_guard<mutex> guard( lock ) ;
+            close( fd ) ;
+            logFd = -1 ;
+            return ;
+        }
+    }
+    if( sync && (count > 0) ){
+        fdatasync( fd ) ;
+    }
+
+}
+
+/*----------SessionJournal::WriteSnapshot( )-----------------------------------------
+
+  PURPOSE:  Render the sample last queued, if it has not been written, and replace the
+            snapshot file with it by renaming a temporary file over it.
+
+-----------------------------------------------------------------------------------*/
+
+void SessionJournal::WriteSnapshot( ){
+
+    string rendered ;           /* The snapshot. */
+    string tempFName ;          /* The file the snapshot is written to before it is renamed. */
+    string latestText ;         /* The text, as last posted. */
+    Gesture latestGesture ;     /* The hands, as last posted. */
+    string latestStatus ;       /* The sensor status, as last posted. */
+    string latestVersion ;      /* The sensor data version, as last posted. */
+    FILE* file ;                /* The temporary file. */
+    bool written ;              /* True if the snapshot was written in full. */
+
+    if( snapshotFName.empty() ){
+        return ;
+    }
+    {
+        /* Copy the sample out, so the stages are not held up while it is rendered. */
+        lock_guard<mutex> guard( lock ) ;
+        if( !snapshotDirty ){
+            return ;
+        }
+        latestText = text ;
+        latestGesture = gesture ;
+        latestStatus = sensorStatus ;
+        latestVersion = version ;
+        snapshotDirty = false ;
+    }
+    render_snapshot( rendered, latestText, latestGesture, latestStatus, latestVersion ) ;
+    tempFName = snapshotFName + ".tmp" ;
+    file = fopen( tempFName.c_str(), "wb" ) ;
+    if( file != NULL ){
+        written = fwrite( rendered.data(), 1, rendered.size(), file ) == rendered.size() ;
+        written = (fclose( file ) == 0) && written ;
+        if( !written || (rename(tempFName.c_str(), snapshotFName.c_str()) != 0) ){
+            unlink( tempFName.c_str() ) ;
+        }
+    }
+    lock_guard<mutex> guard( lock ) ;
+    xml.swap( rendered ) ;
+
+}
+
+/*----------SessionJournal::Run( )---------------------------------------------------
+
+  PURPOSE:  Thread function. Wakes JOURNAL_SNAPSHOT_HZ times a second, or when the
+            buffer is half full or a flush is waited for, to write the log and the
+            snapshot, until Stop() is called.
+
+-----------------------------------------------------------------------------------*/
+
+void SessionJournal::Run( ){
+
+    chrono::steady_clock::time_point now ;        /* The time of this pass. */
+    chrono::steady_clock::time_point lastWrite ;  /* The time the log was last written. */
+    chrono::steady_clock::time_point lastSync ;   /* The time the log was last synced. */
+    unsigned long request ;                       /* The latest flush waited for. */
+    bool stop ;                                   /* True once Stop() has been called. */
+    bool full ;                                   /* True once the buffer is half full. */
+    bool sync ;                                   /* True to sync the log on this pass. */
+
+    lastWrite = lastSync = chrono::steady_clock::now() ;
+    do{
+        {
+            unique_lock<mutex> guard( lock ) ;
+            if( !stopping && (flushRequests == flushesDone) && (used < (filling.size() / 2)) ){
+                wake.wait_for( guard, chrono::milliseconds(1000 / JOURNAL_SNAPSHOT_HZ) ) ;
+            }
+            stop = stopping ;
+            request = flushRequests ;
+            full = (used > 0) && (used >= (filling.size() / 2)) ;
+            sync = stop || (request != flushesDone) ;
+        }
+        now = chrono::steady_clock::now() ;
+        if( sync || full || ((now - lastWrite) >= chrono::milliseconds(JOURNAL_WRITE_MS)) ){
+            sync = sync || ((now - lastSync) >= chrono::milliseconds(JOURNAL_SYNC_MS)) ;
+            WriteLog( sync ) ;
+            lastWrite = now ;
+            if( sync ){
+                lastSync = now ;
+            }
+        }
+        WriteSnapshot() ;
+        {
+            lock_guard<mutex> guard( lock ) ;
+            flushesDone = request ;
+        }
+        flushed.notify_all() ;
+    } while( !stop ) ;
+    {
+        lock_guard<mutex> guard( lock ) ;
+        running = false ;
+    }
+    flushed.notify_all() ;
+
+}
@@ -0,0 +1,128 @@
+/***********SessionJournal.h*********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the class "SessionJournal", which keeps every
+            write to the disk off the pipeline: the session log of sensor frames and
+            recognized text, and the XML snapshot of the latest sample that used to
+            be rewritten by output_xml() on the pipeline after every frame.
+            Variables.h and SessionJournal.cpp include this file.
+
+            The log is append-only. Each record is a journal_record header, giving
+            the length and type of the payload that follows it:
+
+              JOURNAL_FRAME  a sensor frame exactly as i2c_transfer wrote it.
+              JOURNAL_TEXT   the time the text changed, in CLOCK_MONOTONIC
+                             nanoseconds, as a uint64_t, then the whole text.
+
+            Each frame carries its own magic number and CRC, so tools/replay reads a
+            log as it does a session file, skipping the text records, and logs may
+            simply be concatenated.
+
+            The stages only copy records into a buffer. The journal thread writes the
+            buffer out every JOURNAL_WRITE_MS, or sooner once it is half full, and
+            syncs the log every JOURNAL_SYNC_MS. It also renders the latest sample as
+            a compact XML snapshot at most JOURNAL_SNAPSHOT_HZ times a second and
+            replaces the snapshot file with it, so a reader never sees a partial file.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef SESSIONJOURNAL_H
+#define SESSIONJOURNAL_H
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <stdint.h>
+#include "Gesture.h"
+#include "../microcontroller/sensor_frame.h"
+
+using namespace std ;
+
+#define JOURNAL_FRAME         1        /* Record type of a sensor frame. */
+#define JOURNAL_TEXT          2        /* Record type of the recognized text. */
+#define JOURNAL_BUFFER_BYTES  262144   /* Bytes buffered for the log, about 15 seconds of frames. Records that do not fit are dropped. */
+#define JOURNAL_WRITE_MS      250      /* Longest time records wait in the buffer before they are written. */
+#define JOURNAL_SYNC_MS       1000     /* Longest time written records wait before they are synced to the disk. */
+#define JOURNAL_SNAPSHOT_HZ   10       /* The most times a second the snapshot file is replaced. */
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "journal_record" is the header written before each record of the log. */
+
+struct journal_record {
+	 uint32_t length ;                               /* Number of payload bytes that follow the header. */
+	 uint8_t type ;                                  /* JOURNAL_FRAME or JOURNAL_TEXT. */
+	 uint8_t reserved[3] ;                           /* Always zero. */
+} ;
+
+/* Type "SessionJournal" writes the session log and the snapshot file from its own thread.
+   Frame(), Text(), and Snapshot() may be called from any thread; they only copy the
+   values and never wait on the disk. */
+
+class SessionJournal {
+
+  public:
+
+	 /* Default constructor and destructor functions */
+	 SessionJournal( ) ;
+	 ~SessionJournal( ) ;
+
+	 /* Accessor functions */
+	 inline bool IsOpen( ) const { return logFd >= 0 ; }                    /* True while logging. */
+	 inline bool Running( ) const { return running ; }                     /* True while the journal thread runs. */
+	 inline unsigned long Frames( ) const { return frames ; }              /* Access number of frames logged. */
+	 inline unsigned long Dropped( ) const { return dropped ; }            /* Access number of records dropped while the buffer was full. */
+	 bool SnapshotXml( string &xml ) const ;                               /* Access the latest snapshot, as written to the file. */
+
+	 /* Mutator functions */
+	 bool Open( const char* fName ) ;                /* Starts appending to a session log. Called before Start(). */
+	 bool Start( const char* snapshotFName ) ;       /* Starts the journal thread. */
+	 bool Frame( const struct sensor_frame &frame ) ;  /* Queues a frame for the log. */
+	 bool Text( const string &text, uint64_t ns ) ;  /* Queues the text for the log, as it changes. */
+	 void Snapshot( const string &text, const Gesture &gesture, const string &sensorStatus,
+	                const string &version ) ;       /* Queues the latest sample for the snapshot file. */
+	 void Flush( ) ;                                 /* Waits until every queued record is on the disk. */
+	 void Stop( ) ;                                  /* Writes the records left and stops the thread. */
+
+  private:
+
+	 void Run( ) ;
+	 bool Append( uint8_t type, const void* head, size_t headLen, const void* body, size_t bodyLen ) ;
+	 void WriteLog( bool sync ) ;
+	 void WriteSnapshot( ) ;
+
+	 thread writer ;                                 /* The journal thread. */
+	 mutable mutex lock ;                            /* Guards the buffer, the posted sample, and the flags. */
+	 condition_variable wake ;                       /* Wakes the journal thread. */
+	 condition_variable flushed ;                    /* Signalled each time the journal thread has synced the log. */
+	 atomic<bool> running ;                          /* True while the journal thread runs. */
+	 bool stopping ;                                 /* True once Stop() has been called. */
+	 atomic<int> logFd ;                             /* The session log, -1 if not logging. */
+	 string snapshotFName ;                          /* The snapshot file, empty if none is written. */
+	 vector<char> filling ;                          /* Records queued by the stages. */
+	 vector<char> writing ;                          /* Records being written by the journal thread. */
+	 size_t used ;                                   /* Number of bytes queued in filling. */
+	 unsigned long flushRequests ;                   /* Number of calls to Flush(). */
+	 unsigned long flushesDone ;                     /* Number of those the journal thread has synced. */
+	 atomic<unsigned long> frames ;                  /* Number of frames logged. */
+	 atomic<unsigned long> dropped ;                 /* Number of records dropped. */
+	 string text ;                                   /* The text, as last posted. */
+	 Gesture gesture ;                               /* The hands, as last posted. */
+	 string sensorStatus ;                           /* The sensor status, as last posted. */
+	 string version ;                                /* The sensor data version, as last posted. */
+	 bool snapshotDirty ;                            /* True if a sample was posted since the snapshot was written. */
+	 string xml ;                                    /* The latest snapshot, guarded by lock. */
+
+} ;
+
+#endif
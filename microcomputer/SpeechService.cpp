@@ -0,0 +1,341 @@
+/***********SpeechService.cpp********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The Start(), Speak(), and Stop() functions of the "SpeechService" class
+            are defined in this module.
+
+            Each utterance is sent to the Festival server as a (SayText "...")
+            command. The server is put in asynchronous audio mode when connecting, so
+            it queues the audio for playback and replies as soon as the utterance is
+            synthesized. The reply is zero or more data blocks, each starting with
+            "LP\n" or "WV\n" and ending with SPEECH_REPLY_END, followed by "OK\n", or
+            "ER\n" if the command failed.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+#include "SpeechService.h"
+
+/*----------SpeechService::SpeechService( )------------------------------------------
+
+  PURPOSE:  Create a service that is not yet connected to a server.
+
+-----------------------------------------------------------------------------------*/
+
+SpeechService::SpeechService( ) : command("festival"), server(-1), sock(-1), started(false), utterances(0) {
+
+}
+
+/*----------SpeechService::~SpeechService( )-----------------------------------------
+
+  PURPOSE:  Disconnect, and stop the server if it was started by this service.
+
+-----------------------------------------------------------------------------------*/
+
+SpeechService::~SpeechService( ){
+
+    Stop() ;
+
+}
+
+/*----------SpeechService::Start( )--------------------------------------------------
+
+  PURPOSE:  Connect to a Festival server that is already listening, or start one.
+            Does not wait for a new server to load its voices.
+
+  INPUT  PARAMETERS:  newCommand -- the Festival executable.
+
+  RETURN VALUE:  true if a server is running or was started
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool SpeechService::Start( const string &newCommand ){
+
+    command = newCommand ;
+    started = true ;
+    if( Connect(0) ){
+        return true ;
+    }
+
+    return Spawn() ;
+
+}
+
+/*----------SpeechService::Speak( )--------------------------------------------------
+
+  PURPOSE:  Speak the text, connecting to the server first if needed. A server that
+            has died is started again.
+
+  INPUT  PARAMETERS:  text -- the text to speak.
+
+  RETURN VALUE:  true if the text was spoken
+                 false if no server could be reached or the server reported an error.
+
+-----------------------------------------------------------------------------------*/
+
+bool SpeechService::Speak( const string &text ){
+
+    if( text.size() == 0 ){
+        /* No text to convert, simply return. */
+        return true ;
+    }
+    if( !started ){
+        return false ;
+    }
+    if( (sock < 0) && !Connect(0) ){
+        if( (server == -1) && !Spawn() ){
+            return false ;
+        }
+        if( !Connect(SPEECH_CONNECT_MS) ){
+            return false ;
+        }
+    }
+    if( !SendAll("(SayText " + Quote(text) + ")\n") || !ReadReply() ){
+        Disconnect() ;
+        return false ;
+    }
+    utterances++ ;
+
+    return true ;
+
+}
+
+/*----------SpeechService::Stop( )---------------------------------------------------
+
+  PURPOSE:  Disconnect, and stop the server if it was started by this service.
+
+-----------------------------------------------------------------------------------*/
+
+void SpeechService::Stop( ){
+
+    Disconnect() ;
+    if( server != -1 ){
+        kill( server, SIGTERM ) ;
+        waitpid( server, NULL, 0 ) ;
+        server = -1 ;
+    }
+    started = false ;
+
+    return ;
+
+}
+
+/*----------SpeechService::Connect( )------------------------------------------------
+
+  PURPOSE:  Connect to the server on the local host, retrying while a server started
+            by this service is still loading.
+
+  INPUT  PARAMETERS:  timeout_ms -- the longest time to keep retrying, 0 to try once.
+
+  RETURN VALUE:  true if connected
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool SpeechService::Connect( unsigned int timeout_ms ){
+
+    struct sockaddr_in addr ;                                     /* The address of the server. */
+    struct timeval replyTime = { SPEECH_REPLY_MS / 1000, 0 } ;    /* Longest wait for a reply. */
+    struct timespec retry = { 0, SPEECH_RETRY_MS * 1000000L } ;   /* Time between attempts. */
+    unsigned int waited = 0 ;                                     /* Time spent retrying, in milliseconds. */
+
+    if( sock >= 0 ){
+        return true ;
+    }
+    memset( &addr, 0, sizeof(addr) ) ;
+    addr.sin_family = AF_INET ;
+    addr.sin_port = htons( SPEECH_PORT ) ;
+    addr.sin_addr.s_addr = htonl( INADDR_LOOPBACK ) ;
+    while( true ){
+        sock = socket( AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0 ) ;
+        if( sock < 0 ){
+            return false ;
+        }
+        if( connect(sock, (struct sockaddr*)&addr, sizeof(addr)) == 0 ){
+            setsockopt( sock, SOL_SOCKET, SO_RCVTIMEO, &replyTime, sizeof(replyTime) ) ;
+            /* Hand the audio to Festival's spooler, so the next utterance is synthesized
+               while this one plays. */
+            if( !SendAll("(audio_mode 'async)\n") || !ReadReply() ){
+                Disconnect() ;
+                return false ;
+            }
+            return true ;
+        }
+        Disconnect() ;
+        /* Stop waiting if the server has exited, for example because Festival is not installed. */
+        if( (server != -1) && (waitpid(server, NULL, WNOHANG) == server) ){
+            server = -1 ;
+        }
+        if( (server == -1) || (waited >= timeout_ms) ){
+            return false ;
+        }
+        nanosleep( &retry, NULL ) ;
+        waited += SPEECH_RETRY_MS ;
+    }
+
+}
+
+/*----------SpeechService::Spawn( )--------------------------------------------------
+
+  PURPOSE:  Start "festival --server" as a child process, with its output discarded.
+
+  RETURN VALUE:  true if the process was started
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool SpeechService::Spawn( ){
+
+    pid_t pid ;  /* The process ID of the child. */
+    int null ;   /* /dev/null, for the child's standard streams. */
+
+    pid = fork() ;
+    if( pid < 0 ){
+        return false ;
+    }
+    if( pid == 0 ){
+        /* Only async-signal-safe calls are allowed between fork() and exec(). */
+        null = open( "/dev/null", O_RDWR ) ;
+        if( null >= 0 ){
+            dup2( null, STDIN_FILENO ) ;
+            dup2( null, STDOUT_FILENO ) ;
+            dup2( null, STDERR_FILENO ) ;
+        }
+        execlp( command.c_str(), command.c_str(), "--server", (char*)NULL ) ;
+        _exit( 127 ) ;
+    }
+    server = pid ;
+
+    return true ;
+
+}
+
+/*----------SpeechService::SendAll( )------------------------------------------------
+
+  PURPOSE:  Write all of the data to the server.
+
+-----------------------------------------------------------------------------------*/
+
+bool SpeechService::SendAll( const string &data ){
+
+    size_t sent = 0 ;  /* Number of bytes written so far. */
+    ssize_t n ;        /* Number of bytes written by the last call. */
+
+    while( sent < data.size() ){
+        /* MSG_NOSIGNAL keeps a server that has gone away from raising SIGPIPE. */
+        n = send( sock, data.data() + sent, data.size() - sent, MSG_NOSIGNAL ) ;
+        if( n < 0 ){
+            if( errno == EINTR )
+                continue ;
+            return false ;
+        }
+        sent += n ;
+    }
+
+    return true ;
+
+}
+
+/*----------SpeechService::ReadReply( )----------------------------------------------
+
+  PURPOSE:  Read the server's reply to a command, skipping any data blocks.
+
+  RETURN VALUE:  true if the server replied "OK"
+                 false if it replied "ER", the reply was not understood, or the
+                 connection failed or timed out.
+
+-----------------------------------------------------------------------------------*/
+
+bool SpeechService::ReadReply( ){
+
+    string reply ;          /* Received data not yet consumed. */
+    string tag ;            /* The type of the next part of the reply. */
+    char buffer[512] ;      /* The data from the last read. */
+    size_t end ;            /* Position of the end of a data block. */
+    ssize_t n ;             /* Number of bytes read by the last call. */
+
+    while( true ){
+        while( reply.size() >= 3 ){
+            tag = reply.substr( 0, 3 ) ;
+            if( tag == "OK\n" ){
+                return true ;
+            }
+            if( (tag != "LP\n") && (tag != "WV\n") ){
+                return false ;
+            }
+            end = reply.find( SPEECH_REPLY_END, 3 ) ;
+            if( end == string::npos ){
+                break ;
+            }
+            reply.erase( 0, end + strlen(SPEECH_REPLY_END) ) ;
+        }
+        n = recv( sock, buffer, sizeof(buffer), 0 ) ;
+        if( n < 0 ){
+            if( errno == EINTR )
+                continue ;
+            return false ;
+        }
+        if( n == 0 ){
+            return false ;
+        }
+        reply.append( buffer, n ) ;
+    }
+
+}
+
+/*----------SpeechService::Disconnect( )---------------------------------------------
+
+  PURPOSE:  Close the connection to the server, if any.
+
+-----------------------------------------------------------------------------------*/
+
+void SpeechService::Disconnect( ){
+
+    if( sock >= 0 ){
+        close( sock ) ;
+        sock = -1 ;
+    }
+
+    return ;
+
+}
+
+/*----------SpeechService::Quote( )--------------------------------------------------
+
+  PURPOSE:  Return the text as a Scheme string literal.
+
+-----------------------------------------------------------------------------------*/
+
+string SpeechService::Quote( const string &text ){
+
+    string quoted = "\"" ;  /* The string literal. */
+    size_t i ;              /* An iterator. */
+
+    for( i = 0 ; i < text.size() ; i++ ){
+        if( (text[i] == '"') || (text[i] == '\\') ){
+            quoted += '\\' ;
+        }
+        quoted += text[i] ;
+    }
+    quoted += "\"" ;
+
+    return quoted ;
+
+}
@@ -0,0 +1,75 @@
+/***********SpeechService.h**********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the class "SpeechService", which keeps a
+            Festival server running for the life of the program, so that voices
+            and lexicons are loaded once instead of on every utterance. Variables.h
+            and SpeechService.cpp include this file.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef SPEECHSERVICE_H
+#define SPEECHSERVICE_H
+
+#include <string>
+#include <stdint.h>
+#include <sys/types.h>
+
+using namespace std ;
+
+#define SPEECH_PORT          1314     /* Port the Festival server listens on. This is Festival's default. */
+#define SPEECH_CONNECT_MS   30000     /* Longest wait for a newly started server to load its voices. */
+#define SPEECH_RETRY_MS       100     /* Time between connection attempts while the server starts. */
+#define SPEECH_REPLY_MS     60000     /* Longest wait for the server to finish an utterance. */
+#define SPEECH_REPLY_END "ft_StUfF_key"  /* Marks the end of each data block in a server reply. */
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "SpeechService" starts "festival --server" as a child process, unless a server
+   is already listening, and speaks text through it over a local socket. Start() returns
+   at once; the first call to Speak() waits for the server to finish loading. Speak()
+   blocks until the utterance has been synthesized and queued for playback, so it should
+   only be called from the speech stage. */
+
+class SpeechService {
+
+  public:
+
+	 /* Default constructor and destructor functions */
+	 SpeechService( ) ;
+	 ~SpeechService( ) ;
+
+	 /* Accessor functions */
+	 inline bool Connected( ) const { return sock >= 0 ; }                  /* True while connected to the server. */
+	 inline unsigned long Utterances( ) const { return utterances ; }       /* Access number of utterances spoken. */
+
+	 /* Mutator functions */
+	 bool Start( const string &command ) ;          /* Starts the server if none is listening. */
+	 bool Speak( const string &text ) ;              /* Speaks the text, returning false if the server failed. */
+	 void Stop( ) ;                                  /* Disconnects, and stops the server if it was started here. */
+
+  private:
+
+	 bool Connect( unsigned int timeout_ms ) ;
+	 bool Spawn( ) ;
+	 bool SendAll( const string &data ) ;
+	 bool ReadReply( ) ;
+	 void Disconnect( ) ;
+	 static string Quote( const string &text ) ;
+
+	 string command ;                                /* The Festival executable. */
+	 pid_t server ;                                  /* The server started by this service, -1 if none. */
+	 int sock ;                                      /* The connection to the server, -1 if none. */
+	 bool started ;                                  /* True once Start() has been called. */
+	 unsigned long utterances ;                      /* Number of utterances spoken. */
+
+} ;
+
+#endif
@@ -0,0 +1,270 @@
+/***********SpscQueue.h**************************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the class template "SpscQueue", a bounded queue
+            between exactly one producer thread and one consumer thread. Pushing and
+            popping use atomic loads and stores only; a thread that finds the queue
+            full or empty sleeps on a futex, in the same way as the shared memory
+            ring in ../microcontroller/sample_ring.h. Pipeline.h includes this file.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#define SPSC_CACHE_LINE 64  /* Size of a cache line, in bytes. */
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "SpscQueue" holds up to N values of type T, where N is a power of two. Only one
+   thread may call TryPush() and WaitForSpace(), and only one other thread may call
+   Front(), Pop(), TryPop() and WaitForData(). */
+
+template <typename T, unsigned int N>
+class SpscQueue {
+
+  public:
+
+	 /* Default constructor function */
+	 SpscQueue( ) : head(0), dataWakeup(0), dataWaiting(0), tail(0), spaceWakeup(0), spaceWaiting(0), maxDepth(0) { }
+
+	 /* Accessor functions */
+	 inline unsigned int Capacity( ) const { return N ; }                   /* Access number of slots. */
+	 inline unsigned int Depth( ) const {                                   /* Access number of queued values. */
+	     return (unsigned int)(__atomic_load_n(&head, __ATOMIC_ACQUIRE) - __atomic_load_n(&tail, __ATOMIC_ACQUIRE)) ; }
+	 inline unsigned int MaxDepth( ) const { return __atomic_load_n( &maxDepth, __ATOMIC_RELAXED ) ; }  /* Access largest depth seen. */
+
+	 /* Producer functions */
+	 bool TryPush( const T &value ) ;                /* Copies a value in, returning false if the queue is full. */
+	 bool WaitForSpace( unsigned int timeout_ms ) ;  /* Sleeps until a slot is free, returning false on timeout. */
+
+	 /* Consumer functions */
+	 T *Front( ) ;                                   /* Access the oldest value in place, NULL if the queue is empty. */
+	 void Pop( ) ;                                   /* Frees the slot returned by Front(). */
+	 bool TryPop( T &value ) ;                       /* Copies the oldest value out, returning false if the queue is empty. */
+	 bool WaitForData( unsigned int timeout_ms ) ;   /* Sleeps until a value is queued, returning false on timeout. */
+
+  private:
+
+	 static void Wake( uint32_t *wakeup, uint32_t *waiting ) ;
+	 static void Sleep( uint32_t *wakeup, uint32_t *waiting, uint32_t seen, unsigned int timeout_ms ) ;
+
+	 /* Written by the producer. Padding rather than alignment keeps the groups on separate
+	    cache lines, since operator new need not honour over-aligned members. */
+	 char producerPad[SPSC_CACHE_LINE] ;
+	 uint64_t head ;                                 /* Number of values pushed. */
+	 uint32_t dataWakeup ;                           /* Futex the consumer sleeps on while the queue is empty. */
+	 uint32_t dataWaiting ;                          /* Non-zero while the consumer is asleep. */
+	 /* Written by the consumer. */
+	 char consumerPad[SPSC_CACHE_LINE] ;
+	 uint64_t tail ;                                 /* Number of values popped. */
+	 uint32_t spaceWakeup ;                          /* Futex the producer sleeps on while the queue is full. */
+	 uint32_t spaceWaiting ;                         /* Non-zero while the producer is asleep. */
+	 uint32_t maxDepth ;                             /* Largest number of queued values seen by the consumer. */
+	 char slotPad[SPSC_CACHE_LINE] ;
+	 T slots[N] ;                                    /* The values. */
+
+	 static_assert( (N != 0) && ((N & (N - 1)) == 0), "SpscQueue size must be a power of two" ) ;
+
+} ;
+
+/*----------SpscQueue::Wake( )-------------------------------------------------------
+
+  PURPOSE:  Wake the other thread if it is asleep on the given futex.
+
+-----------------------------------------------------------------------------------*/
+
+template <typename T, unsigned int N>
+void SpscQueue<T, N>::Wake( uint32_t *wakeup, uint32_t *waiting ){
+
+    __atomic_add_fetch( wakeup, 1, __ATOMIC_SEQ_CST ) ;
+    if( __atomic_load_n(waiting, __ATOMIC_SEQ_CST) != 0 )
+        syscall( SYS_futex, wakeup, FUTEX_WAKE, INT_MAX, NULL, NULL, 0 ) ;
+
+    return ;
+
+}
+
+/*----------SpscQueue::Sleep( )------------------------------------------------------
+
+  PURPOSE:  Sleep on the given futex until woken or the timeout expires. Returns at
+            once if the futex has changed since "seen" was read.
+
+-----------------------------------------------------------------------------------*/
+
+template <typename T, unsigned int N>
+void SpscQueue<T, N>::Sleep( uint32_t *wakeup, uint32_t *waiting, uint32_t seen, unsigned int timeout_ms ){
+
+    struct timespec t ;  /* The amount of time to wait. */
+
+    t.tv_sec = timeout_ms / 1000 ;
+    t.tv_nsec = (long)(timeout_ms % 1000) * 1000000 ;
+    __atomic_add_fetch( waiting, 1, __ATOMIC_SEQ_CST ) ;
+    syscall( SYS_futex, wakeup, FUTEX_WAIT, seen, &t, NULL, 0 ) ;
+    __atomic_sub_fetch( waiting, 1, __ATOMIC_SEQ_CST ) ;
+
+    return ;
+
+}
+
+/*----------SpscQueue::TryPush( )----------------------------------------------------
+
+  PURPOSE:  Copy a value into the next free slot and wake the consumer.
+
+  INPUT  PARAMETERS:  value -- the value to queue.
+
+  RETURN VALUE:  true if the value was queued
+                 false if the queue is full.
+
+-----------------------------------------------------------------------------------*/
+
+template <typename T, unsigned int N>
+bool SpscQueue<T, N>::TryPush( const T &value ){
+
+    uint64_t h = __atomic_load_n( &head, __ATOMIC_RELAXED ) ;  /* The slot to fill. */
+
+    if( (h - __atomic_load_n(&tail, __ATOMIC_ACQUIRE)) >= N ){
+        return false ;
+    }
+    slots[h & (N - 1)] = value ;
+    __atomic_store_n( &head, h + 1, __ATOMIC_RELEASE ) ;
+    Wake( &dataWakeup, &dataWaiting ) ;
+
+    return true ;
+
+}
+
+/*----------SpscQueue::WaitForSpace( )-----------------------------------------------
+
+  PURPOSE:  Sleep until the consumer frees a slot.
+
+  INPUT  PARAMETERS:  timeout_ms -- the longest time to wait, in milliseconds.
+
+  RETURN VALUE:  true if a slot is free
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+template <typename T, unsigned int N>
+bool SpscQueue<T, N>::WaitForSpace( unsigned int timeout_ms ){
+
+    uint32_t seen = __atomic_load_n( &spaceWakeup, __ATOMIC_SEQ_CST ) ;  /* The futex value before checking the queue. */
+
+    if( Depth() < N ){
+        return true ;
+    }
+    Sleep( &spaceWakeup, &spaceWaiting, seen, timeout_ms ) ;
+
+    return Depth() < N ;
+
+}
+
+/*----------SpscQueue::Front( )------------------------------------------------------
+
+  PURPOSE:  Access the oldest value without copying it. The slot stays owned by the
+            consumer until Pop() is called.
+
+  RETURN VALUE:  The oldest value, or NULL if the queue is empty.
+
+-----------------------------------------------------------------------------------*/
+
+template <typename T, unsigned int N>
+T *SpscQueue<T, N>::Front( ){
+
+    uint64_t t = __atomic_load_n( &tail, __ATOMIC_RELAXED ) ;  /* The oldest slot. */
+    uint32_t depth = (uint32_t)(__atomic_load_n(&head, __ATOMIC_ACQUIRE) - t) ;  /* Number of queued values. */
+
+    if( depth == 0 ){
+        return NULL ;
+    }
+    if( depth > __atomic_load_n(&maxDepth, __ATOMIC_RELAXED) ){
+        __atomic_store_n( &maxDepth, depth, __ATOMIC_RELAXED ) ;
+    }
+
+    return &slots[t & (N - 1)] ;
+
+}
+
+/*----------SpscQueue::Pop( )--------------------------------------------------------
+
+  PURPOSE:  Hand the slot returned by Front() back to the producer and wake it.
+
+-----------------------------------------------------------------------------------*/
+
+template <typename T, unsigned int N>
+void SpscQueue<T, N>::Pop( ){
+
+    __atomic_store_n( &tail, __atomic_load_n(&tail, __ATOMIC_RELAXED) + 1, __ATOMIC_RELEASE ) ;
+    Wake( &spaceWakeup, &spaceWaiting ) ;
+
+    return ;
+
+}
+
+/*----------SpscQueue::TryPop( )-----------------------------------------------------
+
+  PURPOSE:  Copy the oldest value out and free its slot.
+
+  INPUT  PARAMETERS:  value -- set to the oldest value.
+
+  RETURN VALUE:  true if a value was popped
+                 false if the queue is empty.
+
+-----------------------------------------------------------------------------------*/
+
+template <typename T, unsigned int N>
+bool SpscQueue<T, N>::TryPop( T &value ){
+
+    T *front = Front() ;  /* The oldest value. */
+
+    if( front == NULL ){
+        return false ;
+    }
+    value = *front ;
+    Pop() ;
+
+    return true ;
+
+}
+
+/*----------SpscQueue::WaitForData( )------------------------------------------------
+
+  PURPOSE:  Sleep until the producer queues a value.
+
+  INPUT  PARAMETERS:  timeout_ms -- the longest time to wait, in milliseconds.
+
+  RETURN VALUE:  true if a value is queued
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+template <typename T, unsigned int N>
+bool SpscQueue<T, N>::WaitForData( unsigned int timeout_ms ){
+
+    uint32_t seen = __atomic_load_n( &dataWakeup, __ATOMIC_SEQ_CST ) ;  /* The futex value before checking the queue. */
+
+    if( Depth() != 0 ){
+        return true ;
+    }
+    Sleep( &dataWakeup, &dataWaiting, seen, timeout_ms ) ;
+
+    return Depth() != 0 ;
+
+}
+
+#endif
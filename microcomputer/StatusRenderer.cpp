@@ -0,0 +1,232 @@
+/***********StatusRenderer.cpp*******************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The Start(), Post(), and Stop() functions of the "StatusRenderer" class,
+            and the rendering thread they control, are defined in this module.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <chrono>
+#include <ncurses.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include "StatusRenderer.h"
+
+/*----------StatusRenderer::StatusRenderer( )----------------------------------------
+
+  PURPOSE:  Create a renderer whose thread has not been started.
+
+-----------------------------------------------------------------------------------*/
+
+StatusRenderer::StatusRenderer( ) : dirty(false), stopping(false), maxHz(STATUS_MAX_HZ), rows(0), cols(0) {
+
+}
+
+/*----------StatusRenderer::~StatusRenderer( )---------------------------------------
+
+  PURPOSE:  Draw any pending text and stop the rendering thread, so that the last
+            message is shown when the program exits.
+
+-----------------------------------------------------------------------------------*/
+
+StatusRenderer::~StatusRenderer( ){
+
+    Stop() ;
+
+}
+
+/*----------StatusRenderer::Start( )-------------------------------------------------
+
+  PURPOSE:  Start the rendering thread. Text posted before the thread starts is drawn
+            as soon as it does.
+
+  INPUT  PARAMETERS:  maxHz -- the most times a second the screen is redrawn.
+
+-----------------------------------------------------------------------------------*/
+
+void StatusRenderer::Start( unsigned int maxHz ){
+
+    if( renderer.joinable() ){
+        return ;
+    }
+    this->maxHz = (maxHz > 0) ? maxHz : STATUS_MAX_HZ ;
+    stopping = false ;
+    renderer = thread( &StatusRenderer::Run, this ) ;
+
+}
+
+/*----------StatusRenderer::Post( )--------------------------------------------------
+
+  PURPOSE:  Queue text to be drawn, replacing any text that has not been drawn yet.
+            Only copies the text, so it is cheap enough to call on every frame.
+
+  INPUT  PARAMETERS:  scrText -- the collection of text to display on the screen.
+
+-----------------------------------------------------------------------------------*/
+
+void StatusRenderer::Post( const ScreenText &scrText ){
+
+    {
+        lock_guard<mutex> guard( lock ) ;
+        pending = scrText ;
+        dirty = true ;
+    }
+    wakeup.notify_one() ;
+
+}
+
+/*----------StatusRenderer::Stop( )--------------------------------------------------
+
+  PURPOSE:  Stop the rendering thread once it has drawn any pending text.
+
+-----------------------------------------------------------------------------------*/
+
+void StatusRenderer::Stop( ){
+
+    if( !renderer.joinable() ){
+        return ;
+    }
+    {
+        lock_guard<mutex> guard( lock ) ;
+        stopping = true ;
+    }
+    wakeup.notify_one() ;
+    renderer.join() ;
+
+}
+
+/*----------StatusRenderer::Run( )---------------------------------------------------
+
+  PURPOSE:  The rendering thread. Waits for text to be posted, then waits out the
+            rest of the redraw period so that later posts replace it, and draws the
+            latest text. Runs at a lower priority than the stages.
+
+-----------------------------------------------------------------------------------*/
+
+void StatusRenderer::Run( ){
+
+    chrono::steady_clock::time_point next = chrono::steady_clock::now() ;      /* The earliest time of the next redraw. */
+    chrono::nanoseconds period( 1000000000LL / maxHz ) ;                        /* The shortest time between redraws. */
+    ScreenText scrText ;                                                        /* The text to draw. */
+    vector<string> lines ;                                                      /* The text, laid out in rows. */
+    bool last ;                                                                 /* True if this is the final redraw. */
+
+    setpriority( PRIO_PROCESS, (id_t)syscall( SYS_gettid ), STATUS_NICE ) ;
+    while( true ){
+        {
+            unique_lock<mutex> guard( lock ) ;
+            while( !dirty && !stopping ){
+                wakeup.wait( guard ) ;
+            }
+            while( !stopping && (chrono::steady_clock::now() < next) ){
+                wakeup.wait_until( guard, next ) ;
+            }
+            if( !dirty ){
+                break ;
+            }
+            scrText = pending ;
+            dirty = false ;
+            last = stopping ;
+        }
+        Layout( scrText, lines ) ;
+        Draw( lines ) ;
+        next = chrono::steady_clock::now() + period ;
+        if( last ){
+            break ;
+        }
+    }
+
+}
+
+/*----------StatusRenderer::Layout( )------------------------------------------------
+
+  PURPOSE:  Lay out the text in the rows it occupies on the screen. Tabs are expanded
+            and each row is cut short of the last column, so that no row wraps onto
+            the next and each row can be redrawn on its own.
+
+  INPUT  PARAMETERS:  scrText -- the collection of text to display on the screen.
+                      lines   -- receives the rows.
+
+-----------------------------------------------------------------------------------*/
+
+void StatusRenderer::Layout( const ScreenText &scrText, vector<string> &lines ) const {
+
+    string text = "Instructions:\t" + scrText.InstrData() + "Status:\t\t" + scrText.Status() +   /* The text, as it was printed before. */
+                  "Gesture:\t" + scrText.GestureConv() + "Gesture Data:\n\n" + scrText.GestureData() ;
+    int width ;                                                                                /* The longest row to draw. */
+    string::size_type i ;                                                                      /* An iterator. */
+
+    width = getmaxx( stdscr ) - 1 ;
+    width = (width > 1) ? width : 1 ;
+    lines.assign( 1, "" ) ;
+    for( i = 0 ; i < text.size() ; i++ ){
+        if( text[i] == '\n' ){
+            lines.push_back( "" ) ;
+        }
+        else if( text[i] == '\t' ){
+            do{
+                lines.back() += ' ' ;
+            }while( (lines.back().size() % STATUS_TAB_WIDTH) != 0 ) ;
+        }
+        else{
+            lines.back() += text[i] ;
+        }
+        if( (int)lines.back().size() > width ){
+            lines.back().resize( width ) ;
+        }
+    }
+
+}
+
+/*----------StatusRenderer::Draw( )--------------------------------------------------
+
+  PURPOSE:  Rewrite the rows that differ from the last redraw, clear any rows left
+            over from longer text, and refresh the terminal once. If the terminal
+            has been resized, every row is redrawn.
+
+  INPUT  PARAMETERS:  lines -- the rows to show.
+
+-----------------------------------------------------------------------------------*/
+
+void StatusRenderer::Draw( const vector<string> &lines ){
+
+    int newRows ;                     /* The screen height. */
+    int newCols ;                     /* The screen width. */
+    bool changed = false ;            /* True if any row was rewritten. */
+    unsigned int i ;                  /* An iterator. */
+
+    getmaxyx( stdscr, newRows, newCols ) ;
+    if( (newRows != rows) || (newCols != cols) ){
+        rows = newRows ;
+        cols = newCols ;
+        drawn.clear() ;
+        erase() ;
+        changed = true ;
+    }
+    for( i = 0 ; (i < lines.size()) && ((int)i < rows) ; i++ ){
+        if( (i < drawn.size()) && (drawn[i] == lines[i]) ){
+            continue ;
+        }
+        mvaddstr( i, 0, lines[i].c_str() ) ;
+        clrtoeol() ;
+        changed = true ;
+    }
+    if( lines.size() < drawn.size() ){
+        move( lines.size(), 0 ) ;
+        clrtobot() ;
+        changed = true ;
+    }
+    if( changed ){
+        refresh() ;
+    }
+    drawn = lines ;
+
+}
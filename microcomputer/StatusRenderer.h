@@ -0,0 +1,77 @@
+/***********StatusRenderer.h*********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the class "StatusRenderer", which draws the
+            ScreenText on the terminal from its own thread. Parser.cpp and
+            StatusRenderer.cpp include this file.
+
+            The stages only hand over a copy of the text they want shown. The
+            renderer draws the latest text at most STATUS_MAX_HZ times a second,
+            so a burst of updates costs a single redraw, and rewrites only the
+            rows whose text changed instead of clearing the screen.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef STATUSRENDERER_H
+#define STATUSRENDERER_H
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "ScreenText.h"
+
+using namespace std ;
+
+#define STATUS_MAX_HZ    10   /* The most times a second the screen is redrawn. */
+#define STATUS_TAB_WIDTH 8    /* Columns between tab stops, as curses expands them. */
+#define STATUS_NICE      10   /* Niceness of the rendering thread, so the stages win the CPU. */
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "StatusRenderer" owns the curses screen once started. Any thread may post text;
+   posts that arrive while a redraw is pending replace the pending text. Curses must
+   have been initialized before Start() is called, and no other thread may draw on
+   the screen while the renderer runs. */
+
+class StatusRenderer {
+
+  public:
+
+	 /* Default constructor and destructor functions */
+	 StatusRenderer( ) ;
+	 ~StatusRenderer( ) ;
+
+	 /* Mutator functions */
+	 void Start( unsigned int maxHz ) ;              /* Starts the rendering thread. */
+	 void Post( const ScreenText &scrText ) ;        /* Queues text to be drawn. */
+	 void Stop( ) ;                                  /* Draws any pending text and stops the thread. */
+
+  private:
+
+	 void Run( ) ;
+	 void Layout( const ScreenText &scrText, vector<string> &lines ) const ;
+	 void Draw( const vector<string> &lines ) ;
+
+	 thread renderer ;                               /* The rendering thread. */
+	 mutex lock ;                                    /* Guards pending, dirty and stopping. */
+	 condition_variable wakeup ;                     /* Signalled when text is posted or the renderer is stopped. */
+	 ScreenText pending ;                            /* The latest text posted. */
+	 bool dirty ;                                    /* True if pending has not been drawn. */
+	 bool stopping ;                                 /* True once Stop() has been called. */
+	 unsigned int maxHz ;                            /* The most redraws per second. */
+	 vector<string> drawn ;                          /* The rows on the screen, as last drawn. */
+	 int rows ;                                      /* The screen height when last drawn. */
+	 int cols ;                                      /* The screen width when last drawn. */
+
+} ;
+
+#endif
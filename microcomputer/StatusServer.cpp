@@ -0,0 +1,785 @@
+/***********StatusServer.cpp*********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The Start(), Post(), PostText(), and Stop() functions of the
+            "StatusServer" class, and the server thread they control, are defined
+            in this module. The status page is served from memory, so the server
+            reads no files.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <poll.h>
+#include <algorithm>
+#include <chrono>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include "StatusServer.h"
+
+/* The status page. It opens /events, and redraws the text and sensors from each event. */
+
+static const char STATUS_PAGE[] =
+    "<!DOCTYPE html>\n"
+    "<html>\n"
+    "<head>\n"
+    "<meta charset=\"utf-8\">\n"
+    "<title>Gesture Data</title>\n"
+    "<style>\n"
+    "body { font-family: sans-serif; text-align: center; }\n"
+    "#text { font-size: 28px; font-weight: bold; min-height: 1.5em; }\n"
+    "#status.connected { color: green; } #status.disconnected { color: red; }\n"
+    "table { margin: auto; } meter { width: 120px; }\n"
+    "</style>\n"
+    "</head>\n"
+    "<body>\n"
+    "<p>Converted Text:</p>\n"
+    "<p id=\"text\"></p>\n"
+    "<p><button onclick=\"command('speak')\">Speak</button> <button onclick=\"command('reset')\">Reset</button> "
+    "<button onclick=\"command('reload')\">Reload Gestures</button></p>\n"
+    "<noscript><form action=\"/\" method=\"post\"><input type=\"hidden\" name=\"setting\" value=\"convert\">"
+    "<input type=\"submit\" value=\"Convert to Speech\"></form></noscript>\n"
+    "<p>Sensor Status: <span id=\"status\">Waiting</span></p>\n"
+    "<table id=\"hands\"></table>\n"
+    "<p>Version: <span id=\"version\"></span></p>\n"
+    "<script>\n"
+    "var fingers = ['Thumb', 'Index', 'Middle', 'Ring', 'Pinky'];\n"
+    "function command(name) { fetch('/' + name, { method: 'POST' }); }\n"
+    "function showText(state) { document.getElementById('text').textContent = state.text; }\n"
+    "function showSensors(state) {\n"
+    "  var status = document.getElementById('status');\n"
+    "  status.textContent = state.status || 'Unknown';\n"
+    "  status.className = state.status;\n"
+    "  document.getElementById('version').textContent = state.version;\n"
+    "  var rows = '';\n"
+    "  ['Left', 'Right'].forEach(function (name, side) {\n"
+    "    var hand = state.hands[side];\n"
+    "    if (!hand) return;\n"
+    "    rows += '<tr><th colspan=\"2\">' + name + ' hand, contacts ' + hand.contacts.toString(16) + '</th></tr>';\n"
+    "    hand.flex.forEach(function (value, i) {\n"
+    "      rows += '<tr><td>' + fingers[i] + '</td><td><meter min=\"0\" max=\"100\" value=\"' + value + '\"></meter></td></tr>';\n"
+    "    });\n"
+    "  });\n"
+    "  document.getElementById('hands').innerHTML = rows;\n"
+    "}\n"
+    "var events = new EventSource('/events');\n"
+    "events.addEventListener('text', function (e) { showText(JSON.parse(e.data)); });\n"
+    "events.addEventListener('sensors', function (e) { showSensors(JSON.parse(e.data)); });\n"
+    "events.onerror = function () { document.getElementById('status').textContent = 'Not running'; };\n"
+    "</script>\n"
+    "</body>\n"
+    "</html>\n" ;
+
+/*----------now_ms( )----------------------------------------------------------------
+
+  PURPOSE:  Read the monotonic clock.
+
+  RETURN VALUE:  The time, in milliseconds.
+
+-----------------------------------------------------------------------------------*/
+
+static int64_t now_ms( ){
+
+    return chrono::duration_cast<chrono::milliseconds>( chrono::steady_clock::now().time_since_epoch() ).count() ;
+
+}
+
+/*----------json_string( )-----------------------------------------------------------
+
+  PURPOSE:  Quote a string for JSON.
+
+  INPUT  PARAMETERS:  value -- the string.
+
+  RETURN VALUE:  The string, in double quotes, with quotes, backslashes and control
+                 characters escaped.
+
+-----------------------------------------------------------------------------------*/
+
+static string json_string( const string &value ){
+
+    string quoted = "\"" ;   /* The quoted string. */
+    char escape[8] ;         /* The escape of a control character. */
+    size_t i ;               /* An iterator. */
+
+    for( i = 0 ; i < value.size() ; i++ ){
+        unsigned char c = (unsigned char)value[i] ;
+        if( (c == '"') || (c == '\\') ){
+            quoted += '\\' ;
+            quoted += (char)c ;
+        }
+        else if( c == '\n' ){
+            quoted += "\\n" ;
+        }
+        else if( c < 0x20 ){
+            snprintf( escape, sizeof(escape), "\\u%04x", c ) ;
+            quoted += escape ;
+        }
+        else{
+            quoted += (char)c ;
+        }
+    }
+    quoted += '"' ;
+
+    return quoted ;
+
+}
+
+/*----------event( )-----------------------------------------------------------------
+
+  PURPOSE:  Format a server-sent event.
+
+  INPUT  PARAMETERS:  name -- the event type.
+                      data -- the event data, on a single line.
+
+  RETURN VALUE:  The event, as sent on the stream.
+
+-----------------------------------------------------------------------------------*/
+
+static string event( const char* name, const string &data ){
+
+    return string( "event: " ) + name + "\ndata: " + data + "\n\n" ;
+
+}
+
+/*----------StatusServer::StatusServer( )--------------------------------------------
+
+  PURPOSE:  Create a server that is not listening.
+
+-----------------------------------------------------------------------------------*/
+
+StatusServer::StatusServer( ) : running(false), stopping(false), listener(-1), port(0), textDirty(false),
+                                sensorsDirty(false) {
+
+    wake[0] = wake[1] = -1 ;
+
+}
+
+/*----------StatusServer::~StatusServer( )-------------------------------------------
+
+  PURPOSE:  Close every connection and stop the server thread.
+
+-----------------------------------------------------------------------------------*/
+
+StatusServer::~StatusServer( ){
+
+    Stop() ;
+
+}
+
+/*----------StatusServer::Start( )---------------------------------------------------
+
+  PURPOSE:  Listen for browsers on every interface, as server.py did, and start the
+            server thread.
+
+  INPUT  PARAMETERS:  port    -- the TCP port, or 0 to let the system pick one.
+                      command -- called on the server thread with each command.
+
+  RETURN VALUE:  true if the server is listening
+                 false if the port could not be opened.
+
+-----------------------------------------------------------------------------------*/
+
+bool StatusServer::Start( unsigned short port, const function<void(StatusCommand)> &command ){
+
+    struct sockaddr_in addr ;       /* The address listened on. */
+    socklen_t addrLen = sizeof(addr) ;  /* Length of the address. */
+    int reuse = 1 ;                 /* Allows a restarted server to bind while old connections close. */
+
+    if( server.joinable() ){
+        return true ;
+    }
+    listener = socket( AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0 ) ;
+    if( listener < 0 ){
+        return false ;
+    }
+    setsockopt( listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse) ) ;
+    memset( &addr, 0, sizeof(addr) ) ;
+    addr.sin_family = AF_INET ;
+    addr.sin_addr.s_addr = htonl( INADDR_ANY ) ;
+    addr.sin_port = htons( port ) ;
+    if( (bind(listener, (struct sockaddr*)&addr, sizeof(addr)) != 0) || (listen(listener, STATUS_MAX_CLIENTS) != 0) ||
+        (getsockname(listener, (struct sockaddr*)&addr, &addrLen) != 0) || (pipe2(wake, O_NONBLOCK | O_CLOEXEC) != 0) ){
+        close( listener ) ;
+        listener = -1 ;
+        return false ;
+    }
+    this->port = ntohs( addr.sin_port ) ;
+    this->command = command ;
+    stopping = false ;
+    running = true ;
+    server = thread( &StatusServer::Run, this ) ;
+
+    return true ;
+
+}
+
+/*----------StatusServer::Post( )----------------------------------------------------
+
+  PURPOSE:  Queue the latest values to be pushed, replacing any that have not been
+            pushed yet. Only copies them, so it is cheap enough to call on every
+            frame; the JSON is written on the server thread.
+
+  INPUT  PARAMETERS:  text         -- the recognized text.
+                      gesture      -- the latest hands.
+                      sensorStatus -- the sensor status, connected or disconnected.
+                      version      -- the version of the sensor data.
+
+-----------------------------------------------------------------------------------*/
+
+void StatusServer::Post( const string &text, const Gesture &gesture, const string &sensorStatus, const string &version ){
+
+    bool pending ;   /* True if the server thread has already been woken. */
+
+    if( !running ){
+        return ;
+    }
+    {
+        lock_guard<mutex> guard( lock ) ;
+        pending = textDirty || sensorsDirty ;
+        if( text != this->text ){
+            this->text = text ;
+            textDirty = true ;
+        }
+        this->gesture = gesture ;
+        this->sensorStatus = sensorStatus ;
+        this->version = version ;
+        sensorsDirty = true ;
+    }
+    if( !pending ){
+        Wake() ;
+    }
+
+}
+
+/*----------StatusServer::PostText( )------------------------------------------------
+
+  PURPOSE:  Queue the text to be pushed, leaving the hands as last posted. Used when
+            the text changes without a new frame, as when it is cleared.
+
+  INPUT  PARAMETERS:  text -- the recognized text.
+
+-----------------------------------------------------------------------------------*/
+
+void StatusServer::PostText( const string &text ){
+
+    bool pending ;   /* True if the server thread has already been woken. */
+
+    if( !running ){
+        return ;
+    }
+    {
+        lock_guard<mutex> guard( lock ) ;
+        if( text == this->text ){
+            return ;
+        }
+        pending = textDirty || sensorsDirty ;
+        this->text = text ;
+        textDirty = true ;
+    }
+    if( !pending ){
+        Wake() ;
+    }
+
+}
+
+/*----------StatusServer::Stop( )----------------------------------------------------
+
+  PURPOSE:  Stop the server thread, closing the connections, and stop listening.
+
+-----------------------------------------------------------------------------------*/
+
+void StatusServer::Stop( ){
+
+    if( !server.joinable() ){
+        return ;
+    }
+    stopping = true ;
+    Wake() ;
+    server.join() ;
+    close( listener ) ;
+    close( wake[0] ) ;
+    close( wake[1] ) ;
+    listener = wake[0] = wake[1] = -1 ;
+    running = false ;
+
+}
+
+/*----------StatusServer::Wake( )----------------------------------------------------
+
+  PURPOSE:  Wake the server thread from poll(). If the pipe is full, the thread has
+            yet to drain it, so it is awake already.
+
+-----------------------------------------------------------------------------------*/
+
+void StatusServer::Wake( ){
+
+    char c = 0 ;   /* The byte written. */
+
+    if( write(wake[1], &c, 1) < 0 ){
+        /* Already awake. */
+    }
+
+}
+
+/*----------StatusServer::Run( )-----------------------------------------------------
+
+  PURPOSE:  The server thread. Waits on the listening socket, the connections, and
+            the wake pipe, and pushes posted values at most STATUS_PUSH_HZ times a
+            second. A quiet event stream is sent a comment every STATUS_KEEPALIVE_MS.
+
+-----------------------------------------------------------------------------------*/
+
+void StatusServer::Run( ){
+
+    vector<struct pollfd> fds ;                          /* The descriptors waited on. */
+    const int64_t period = 1000 / STATUS_PUSH_HZ ;       /* The shortest time between pushes. */
+    int64_t nextPush = 0 ;                               /* The earliest time of the next push. */
+    int64_t lastSent = now_ms() ;                        /* Time the event streams were last sent anything. */
+    int64_t now ;                                        /* The current time. */
+    bool pushText ;                                      /* True if the text is waiting to be pushed. */
+    bool pushSensors ;                                   /* True if the hands are waiting to be pushed. */
+    int timeout ;                                        /* Longest wait in poll(). */
+    char drain[64] ;                                     /* Bytes read from the wake pipe. */
+    size_t i ;                                           /* An iterator. */
+
+    while( !stopping ){
+        {
+            lock_guard<mutex> guard( lock ) ;
+            pushText = textDirty ;
+            pushSensors = sensorsDirty ;
+        }
+        now = now_ms() ;
+        if( pushText || pushSensors ){
+            timeout = (nextPush > now) ? (int)(nextPush - now) : 0 ;
+        }
+        else{
+            timeout = (int)max( (int64_t)0, (lastSent + STATUS_KEEPALIVE_MS) - now ) ;
+        }
+        fds.resize( 2 + clients.size() ) ;
+        fds[0].fd = wake[0] ;
+        fds[0].events = POLLIN ;
+        fds[1].fd = listener ;
+        fds[1].events = POLLIN ;
+        for( i = 0 ; i < clients.size() ; i++ ){
+            fds[2 + i].fd = clients[i].fd ;
+            fds[2 + i].events = POLLIN | (clients[i].out.empty() ? 0 : POLLOUT) ;
+        }
+        for( i = 0 ; i < fds.size() ; i++ ){
+            fds[i].revents = 0 ;
+        }
+        if( (poll(&fds[0], fds.size(), timeout) < 0) && (errno != EINTR) ){
+            break ;
+        }
+        if( fds[0].revents & POLLIN ){
+            while( read(wake[0], drain, sizeof(drain)) > 0 ){
+            }
+        }
+        /* Serve the connections that were waited on, before any new one is added. */
+        for( i = 0 ; i < clients.size() ; i++ ){
+            short revents = fds[2 + i].revents ;
+            bool open = !(revents & (POLLERR | POLLNVAL)) ;
+            if( open && (revents & (POLLIN | POLLHUP)) ){
+                open = Read( clients[i] ) ;
+            }
+            if( open && !clients[i].out.empty() ){
+                open = Send( clients[i] ) ;
+            }
+            if( !open ){
+                close( clients[i].fd ) ;
+                clients[i].fd = -1 ;
+            }
+        }
+        for( i = clients.size() ; i > 0 ; i-- ){
+            if( clients[i - 1].fd < 0 ){
+                clients.erase( clients.begin() + (i - 1) ) ;
+            }
+        }
+        if( fds[1].revents & POLLIN ){
+            Accept() ;
+        }
+        now = now_ms() ;
+        if( (pushText || pushSensors) && (now >= nextPush) ){
+            Push( pushText, pushSensors ) ;
+            nextPush = now + period ;
+            lastSent = now ;
+        }
+        else if( (now - lastSent) >= STATUS_KEEPALIVE_MS ){
+            Push( false, false ) ;
+            lastSent = now ;
+        }
+    }
+    for( i = 0 ; i < clients.size() ; i++ ){
+        close( clients[i].fd ) ;
+    }
+    clients.clear() ;
+
+}
+
+/*----------StatusServer::Accept( )--------------------------------------------------
+
+  PURPOSE:  Accept the connections waiting on the listening socket. Once
+            STATUS_MAX_CLIENTS are open, further connections are closed at once.
+
+-----------------------------------------------------------------------------------*/
+
+void StatusServer::Accept( ){
+
+    StatusClient client ;   /* The new connection. */
+    int fd ;                /* The accepted socket. */
+
+    while( (fd = accept4(listener, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0 ){
+        if( clients.size() >= STATUS_MAX_CLIENTS ){
+            close( fd ) ;
+            continue ;
+        }
+        client.fd = fd ;
+        client.streaming = false ;
+        client.closing = false ;
+        clients.push_back( client ) ;
+    }
+
+}
+
+/*----------StatusServer::Read( )----------------------------------------------------
+
+  PURPOSE:  Read what the browser has sent, and handle the request once its headers
+            and body have arrived. Anything sent on an event stream is discarded.
+
+  INPUT  PARAMETERS:  client -- the connection.
+
+  RETURN VALUE:  true to keep the connection open
+                 false if the browser closed it or sent too long a request.
+
+-----------------------------------------------------------------------------------*/
+
+bool StatusServer::Read( StatusClient &client ){
+
+    char buffer[1024] ;     /* The bytes read. */
+    ssize_t count ;         /* Number of bytes read. */
+    size_t headerEnd ;      /* Position of the blank line after the headers. */
+    size_t length = 0 ;     /* The length of the body. */
+    const char* value ;     /* The Content-Length value. */
+    char* end ;             /* The end of the Content-Length number. */
+    unsigned long parsed ;  /* The Content-Length number. */
+    size_t pos ;            /* Position within the request. */
+    string method ;         /* The request method. */
+    string path ;           /* The requested path, without any query. */
+
+    while( (count = recv(client.fd, buffer, sizeof(buffer), 0)) > 0 ){
+        if( !client.streaming && !client.closing ){
+            client.in.append( buffer, count ) ;
+        }
+    }
+    if( (count == 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)) ){
+        return false ;
+    }
+    if( client.streaming || client.closing ){
+        return true ;
+    }
+    if( client.in.size() > STATUS_MAX_REQUEST ){
+        Respond( client, "413 Payload Too Large", "text/plain", "Request too long\n" ) ;
+        return true ;
+    }
+    headerEnd = client.in.find( "\r\n\r\n" ) ;
+    if( headerEnd == string::npos ){
+        return true ;
+    }
+    pos = 0 ;
+    while( (pos = client.in.find("\r\n", pos)) < headerEnd ){
+        pos += 2 ;
+        if( strncasecmp(&client.in[pos], "Content-Length:", 15) == 0 ){
+            /* The length is checked before it is added to anything, so a huge one cannot wrap. */
+            value = &client.in[pos + 15] ;
+            value += strspn( value, " \t" ) ;
+            if( !isdigit((unsigned char)*value) ){
+                Respond( client, "400 Bad Request", "text/plain", "Bad Content-Length\n" ) ;
+                return true ;
+            }
+            parsed = strtoul( value, &end, 10 ) ;
+            end += strspn( end, " \t" ) ;
+            if( *end != '\r' ){
+                Respond( client, "400 Bad Request", "text/plain", "Bad Content-Length\n" ) ;
+                return true ;
+            }
+            if( parsed > STATUS_MAX_REQUEST ){
+                Respond( client, "413 Payload Too Large", "text/plain", "Request too long\n" ) ;
+                return true ;
+            }
+            length = (size_t)parsed ;
+        }
+    }
+    if( (headerEnd + 4 + length) > STATUS_MAX_REQUEST ){
+        Respond( client, "413 Payload Too Large", "text/plain", "Request too long\n" ) ;
+        return true ;
+    }
+    if( client.in.size() < (headerEnd + 4 + length) ){
+        return true ;
+    }
+    pos = client.in.find( ' ' ) ;
+    method = client.in.substr( 0, pos ) ;
+    path = (pos < headerEnd) ? client.in.substr( pos + 1, client.in.find_first_of(" ?\r", pos + 1) - pos - 1 ) : "" ;
+    Handle( client, method, path, client.in.substr(headerEnd + 4, length) ) ;
+    client.in.clear() ;
+
+    return true ;
+
+}
+
+/*----------StatusServer::Handle( )--------------------------------------------------
+
+  PURPOSE:  Answer a request, as listed in StatusServer.h.
+
+  INPUT  PARAMETERS:  client -- the connection.
+                      method -- the request method.
+                      path   -- the requested path.
+                      body   -- the request body.
+
+-----------------------------------------------------------------------------------*/
+
+void StatusServer::Handle( StatusClient &client, const string &method, const string &path, const string &body ){
+
+    bool get = (method == "GET") || (method == "HEAD") ;   /* True for a request that only reads. */
+    bool post = (method == "POST") ;                       /* True for a command. */
+
+    if( get && (path == "/") ){
+        Respond( client, "200 OK", "text/html; charset=utf-8", (method == "HEAD") ? "" : STATUS_PAGE ) ;
+    }
+    else if( get && ((path == "/status") || ((method == "GET") && (path == "/events"))) ){
+        string text ;           /* The text, as last posted. */
+        Gesture gesture ;       /* The hands, as last posted. */
+        string sensorStatus ;   /* The sensor status, as last posted. */
+        string version ;        /* The sensor data version, as last posted. */
+        {
+            lock_guard<mutex> guard( lock ) ;
+            text = this->text ;
+            gesture = this->gesture ;
+            sensorStatus = this->sensorStatus ;
+            version = this->version ;
+        }
+        if( path == "/status" ){
+            string status = TextJson( text ) ;
+            status.erase( status.size() - 1 ) ;
+            Respond( client, "200 OK", "application/json",
+                     status + ",\"sensors\":" + SensorJson( gesture, sensorStatus, version ) + "}\n" ) ;
+        }
+        else{
+            client.streaming = true ;
+            client.out += "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\n"
+                          "Connection: keep-alive\r\n\r\nretry: 1000\n\n" ;
+            client.out += event( "text", TextJson(text) ) ;
+            client.out += event( "sensors", SensorJson(gesture, sensorStatus, version) ) ;
+        }
+    }
+    else if( post && ((path == "/speak") || (path == "/reset") || (path == "/reload")) ){
+        if( command ){
+            command( (path == "/speak") ? STATUS_SPEAK : ((path == "/reset") ? STATUS_RESET : STATUS_RELOAD) ) ;
+        }
+        Respond( client, "204 No Content", "text/plain", "" ) ;
+    }
+    else if( post && (path == "/") ){
+        /* The form of the old page, which only asked for the text to be spoken. */
+        if( command && (body.find("setting=convert") != string::npos) ){
+            command( STATUS_SPEAK ) ;
+        }
+        client.out += "HTTP/1.1 303 See Other\r\nLocation: /\r\nContent-Length: 0\r\nConnection: close\r\n\r\n" ;
+        client.closing = true ;
+    }
+    else if( (path == "/") || (path == "/status") || (path == "/events") || (path == "/speak") || (path == "/reset") ||
+             (path == "/reload") ){
+        Respond( client, "405 Method Not Allowed", "text/plain", "Method not allowed\n" ) ;
+    }
+    else{
+        Respond( client, "404 Not Found", "text/plain", "Not found\n" ) ;
+    }
+
+}
+
+/*----------StatusServer::Respond( )-------------------------------------------------
+
+  PURPOSE:  Queue a complete response, after which the connection is closed.
+
+  INPUT  PARAMETERS:  client -- the connection.
+                      status -- the status code and reason.
+                      type   -- the content type.
+                      body   -- the response body.
+
+-----------------------------------------------------------------------------------*/
+
+void StatusServer::Respond( StatusClient &client, const char* status, const char* type, const string &body ){
+
+    char length[32] ;   /* The body length, as text. */
+
+    snprintf( length, sizeof(length), "%u", (unsigned int)body.size() ) ;
+    client.out += string( "HTTP/1.1 " ) + status + "\r\nContent-Type: " + type + "\r\nContent-Length: " + length +
+                  "\r\nCache-Control: no-cache\r\nConnection: close\r\n\r\n" + body ;
+    client.closing = true ;
+
+}
+
+/*----------StatusServer::Send( )----------------------------------------------------
+
+  PURPOSE:  Send as much of the queued bytes as the socket takes without blocking.
+
+  INPUT  PARAMETERS:  client -- the connection.
+
+  RETURN VALUE:  true to keep the connection open
+                 false if it failed, or a response has been sent in full.
+
+-----------------------------------------------------------------------------------*/
+
+bool StatusServer::Send( StatusClient &client ){
+
+    ssize_t count ;   /* Number of bytes sent. */
+
+    while( !client.out.empty() ){
+        count = send( client.fd, client.out.data(), client.out.size(), MSG_NOSIGNAL ) ;
+        if( count < 0 ){
+            if( errno == EINTR ){
+                continue ;
+            }
+            return (errno == EAGAIN) || (errno == EWOULDBLOCK) ;
+        }
+        client.out.erase( 0, count ) ;
+    }
+
+    return !client.closing ;
+
+}
+
+/*----------StatusServer::Push( )----------------------------------------------------
+
+  PURPOSE:  Send the posted values to every event stream, or a comment if there are
+            none. The values are copied and marked pushed together, so a value
+            posted meanwhile is pushed next time rather than lost. A browser that
+            has stopped reading is dropped once STATUS_MAX_BACKLOG bytes are
+            waiting for it.
+
+  INPUT  PARAMETERS:  pushText    -- true to send the text.
+                      pushSensors -- true to send the hands.
+
+-----------------------------------------------------------------------------------*/
+
+void StatusServer::Push( bool pushText, bool pushSensors ){
+
+    string events ;         /* The events sent. */
+    string text ;           /* The text pushed. */
+    Gesture gesture ;       /* The hands pushed. */
+    string sensorStatus ;   /* The sensor status pushed. */
+    string version ;        /* The sensor data version pushed. */
+    size_t i ;              /* An iterator. */
+
+    {
+        lock_guard<mutex> guard( lock ) ;
+        if( pushText ){
+            text = this->text ;
+            textDirty = false ;
+        }
+        if( pushSensors ){
+            gesture = this->gesture ;
+            sensorStatus = this->sensorStatus ;
+            version = this->version ;
+            sensorsDirty = false ;
+        }
+    }
+    if( pushText ){
+        events += event( "text", TextJson(text) ) ;
+    }
+    if( pushSensors ){
+        events += event( "sensors", SensorJson(gesture, sensorStatus, version) ) ;
+    }
+    if( events.empty() ){
+        events = ":\n\n" ;
+    }
+    for( i = clients.size() ; i > 0 ; i-- ){
+        StatusClient &client = clients[i - 1] ;
+        if( !client.streaming ){
+            continue ;
+        }
+        client.out += events ;
+        if( (client.out.size() > STATUS_MAX_BACKLOG) || !Send(client) ){
+            close( client.fd ) ;
+            clients.erase( clients.begin() + (i - 1) ) ;
+        }
+    }
+
+}
+
+/*----------StatusServer::TextJson( )------------------------------------------------
+
+  PURPOSE:  Write the text as JSON.
+
+  INPUT  PARAMETERS:  text -- the recognized text.
+
+  RETURN VALUE:  {"text": the text}.
+
+-----------------------------------------------------------------------------------*/
+
+string StatusServer::TextJson( const string &text ){
+
+    return "{\"text\":" + json_string( text ) + "}" ;
+
+}
+
+/*----------StatusServer::SensorJson( )----------------------------------------------
+
+  PURPOSE:  Write the hands as JSON. Each hand that is worn lists its flex
+            sensors from the thumb to the pinky, its contact sensors as the bits of
+            its contact signature, and the direction of gravity at the top LSM9DOF
+            once it has been fused, or null for a hand that is not worn.
+
+  INPUT  PARAMETERS:  gesture      -- the hands.
+                      sensorStatus -- the sensor status, connected or disconnected.
+                      version      -- the version of the sensor data.
+
+  RETURN VALUE:  {"status": ..., "version": ..., "hands": [left, right]}.
+
+-----------------------------------------------------------------------------------*/
+
+string StatusServer::SensorJson( const Gesture &gesture, const string &sensorStatus, const string &version ){
+
+    string json ;                /* The JSON written. */
+    char value[96] ;             /* A value, as text. */
+    unsigned int side ;          /* An iterator over the hands. */
+
+    json = "{\"status\":" + json_string( sensorStatus ) + ",\"version\":" + json_string( version ) + ",\"hands\":[" ;
+    for( side = 0 ; side < 2 ; side++ ){
+        const Hand &hand = (side == 0) ? gesture.Left() : gesture.Right() ;
+        if( side > 0 ){
+            json += "," ;
+        }
+        if( !gesture.Defined() || !hand.Defined() ){
+            json += "null" ;
+            continue ;
+        }
+        snprintf( value, sizeof(value), "{\"flex\":[%.0f,%.0f,%.0f,%.0f,%.0f],\"contacts\":%u,\"gravity\":",
+                  hand.Thumb().Flex(), hand.Index().Flex(), hand.Middle().Flex(), hand.Ring().Flex(),
+                  hand.Pinky().Flex(), (unsigned int)hand.ContactSignature() ) ;
+        json += value ;
+        if( hand.Orientation().defined ){
+            const HandOrientation &o = hand.Orientation() ;
+            snprintf( value, sizeof(value), "[%.3f,%.3f,%.3f]}", o.gravity[0][NUM_LSM303], o.gravity[1][NUM_LSM303],
+                      o.gravity[2][NUM_LSM303] ) ;
+            json += value ;
+        }
+        else{
+            json += "null}" ;
+        }
+    }
+    json += "]}" ;
+
+    return json ;
+
+}
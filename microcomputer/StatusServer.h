@@ -0,0 +1,131 @@
+/***********StatusServer.h***********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the class "StatusServer", which serves the
+            status page of sign2speech over HTTP from its own thread, in place of
+            gesture_data/server.py. Variables.h and StatusServer.cpp include this
+            file.
+
+            The text stage posts the recognized text and the latest hands. Browsers
+            that open /events are sent them as server-sent events when they change,
+            the hands at most STATUS_PUSH_HZ times a second, so nothing is read back
+            from a file or transformed per request. Commands are posted to /speak,
+            /reset, and /reload and handed to the callback given to Start(). The
+            requests are:
+
+              GET  /         the status page.
+              GET  /status   the text and hands, as JSON.
+              GET  /events   the text and hands, as a stream of "text" and "sensors"
+                             events with the same JSON.
+              POST /speak    speak the text, then clear it, as the Output button does.
+              POST /reset    clear the text, as the Reset button does.
+              POST /reload   load the compiled gesture file again.
+              POST /         setting=convert speaks the text, as the form of the old
+                             page did.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef STATUSSERVER_H
+#define STATUSSERVER_H
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <stdint.h>
+#include "Gesture.h"
+
+using namespace std ;
+
+#define STATUS_PORT          8080     /* Port the status page is served on, as it was by server.py. */
+#define STATUS_PUSH_HZ       10       /* The most times a second the hands are pushed to the browsers. */
+#define STATUS_MAX_CLIENTS   16       /* The most connections kept open. Further connections are refused. */
+#define STATUS_MAX_REQUEST   8192     /* Longest request, headers and body, that is read. */
+#define STATUS_MAX_BACKLOG   262144   /* Most bytes queued for a browser that is not reading before it is dropped. */
+#define STATUS_KEEPALIVE_MS  15000    /* Time between comments sent on a quiet event stream, so it is not timed out. */
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "StatusCommand" names a command posted by a browser. */
+
+enum StatusCommand {
+	 STATUS_SPEAK,                                   /* Speak the text, then clear it. */
+	 STATUS_RESET,                                   /* Clear the text. */
+	 STATUS_RELOAD                                   /* Load the compiled gesture file again. */
+} ;
+
+/* Type "StatusClient" represents a connection to a browser. */
+
+struct StatusClient {
+	 int fd ;                                        /* The connected socket. */
+	 bool streaming ;                                /* True once the browser has opened /events. */
+	 bool closing ;                                  /* True to close the connection once out has been sent. */
+	 string in ;                                     /* The request, as read so far. */
+	 string out ;                                    /* The bytes waiting to be sent. */
+} ;
+
+/* Type "StatusServer" listens on a TCP port once started. Post() may be called from any
+   thread; it only copies the values and wakes the server thread when they have not
+   been sent yet. The command callback is called on the server thread, so it should
+   only hand the command over. */
+
+class StatusServer {
+
+  public:
+
+	 /* Default constructor and destructor functions */
+	 StatusServer( ) ;
+	 ~StatusServer( ) ;
+
+	 /* Accessor functions */
+	 inline bool Running( ) const { return running ; }                     /* True while the server is listening. */
+	 inline unsigned short Port( ) const { return port ; }                 /* Access the port listened on. */
+
+	 /* Mutator functions */
+	 bool Start( unsigned short port, const function<void(StatusCommand)> &command ) ;   /* Starts listening. */
+	 void Post( const string &text, const Gesture &gesture, const string &sensorStatus,
+	            const string &version ) ;           /* Queues the values to be pushed. */
+	 void PostText( const string &text ) ;          /* Queues the text alone, as when it is cleared. */
+	 void Stop( ) ;                                  /* Closes every connection and stops the thread. */
+
+  private:
+
+	 void Run( ) ;
+	 void Accept( ) ;
+	 bool Read( StatusClient &client ) ;
+	 void Handle( StatusClient &client, const string &method, const string &path, const string &body ) ;
+	 bool Send( StatusClient &client ) ;
+	 void Push( bool pushText, bool pushSensors ) ;
+	 void Wake( ) ;
+	 static string TextJson( const string &text ) ;
+	 static string SensorJson( const Gesture &gesture, const string &sensorStatus, const string &version ) ;
+	 static void Respond( StatusClient &client, const char* status, const char* type, const string &body ) ;
+
+	 thread server ;                                 /* The server thread. */
+	 mutable mutex lock ;                            /* Guards the posted values and their flags. */
+	 atomic<bool> running ;                          /* True while the server thread runs. */
+	 atomic<bool> stopping ;                         /* True once Stop() has been called. */
+	 int listener ;                                  /* The listening socket, or -1. */
+	 int wake[2] ;                                   /* Pipe that wakes the server thread, or -1. */
+	 unsigned short port ;                           /* The port listened on. */
+	 function<void(StatusCommand)> command ;         /* Called with each command posted. */
+	 vector<StatusClient> clients ;                  /* The open connections, used by the server thread only. */
+	 string text ;                                   /* The text, as last posted. */
+	 Gesture gesture ;                               /* The hands, as last posted. */
+	 string sensorStatus ;                           /* The sensor status, as last posted. */
+	 string version ;                                /* The sensor data version, as last posted. */
+	 bool textDirty ;                                /* True if the text changed since it was pushed. */
+	 bool sensorsDirty ;                             /* True if the hands were posted since they were pushed. */
+
+} ;
+
+#endif
@@ -0,0 +1,207 @@
+/***********Tracer.cpp***************************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The Open(), Name(), Span(), and Write() functions of the "Tracer" class
+            are defined in this module.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "Tracer.h"
+
+thread_local TraceBuffer* Tracer::local = NULL ;
+thread_local const char* Tracer::localName = NULL ;
+
+/*----------TraceBuffer::TraceBuffer( )----------------------------------------------
+
+  PURPOSE:  Create an empty buffer for a thread.
+
+  INPUT  PARAMETERS:  thread -- the name of the thread, shown in the trace.
+                      tid    -- the kernel id of the thread.
+
+-----------------------------------------------------------------------------------*/
+
+TraceBuffer::TraceBuffer( const char* thread, unsigned long tid ) : next(NULL), thread(thread), tid(tid), count(0) {
+
+}
+
+/*----------Tracer::Tracer( )--------------------------------------------------------
+
+  PURPOSE:  Create a tracer that drops every span until it is opened.
+
+-----------------------------------------------------------------------------------*/
+
+Tracer::Tracer( ) : buffers(NULL), enabled(false) {
+
+}
+
+/*----------Tracer::Open( )----------------------------------------------------------
+
+  PURPOSE:  Start recording spans. Nothing is written until Write() is called, so the
+            file is only checked here.
+
+  INPUT  PARAMETERS:  fName -- the file to write the trace to.
+
+  RETURN VALUE:  true if the file can be written
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool Tracer::Open( const char* fName ){
+
+    FILE* file = fopen( fName, "w" ) ;  /* The trace file. */
+
+    if( file == NULL ){
+        return false ;
+    }
+    fclose( file ) ;
+    this->fName = fName ;
+    __atomic_store_n( &enabled, true, __ATOMIC_RELEASE ) ;
+
+    return true ;
+
+}
+
+/*----------Tracer::Name( )----------------------------------------------------------
+
+  PURPOSE:  Name the calling thread in the trace. Must be called before the thread
+            records its first span.
+
+  INPUT  PARAMETERS:  thread -- the name. Must be a string literal.
+
+-----------------------------------------------------------------------------------*/
+
+void Tracer::Name( const char* thread ){
+
+    localName = thread ;
+
+}
+
+/*----------Tracer::Span( )----------------------------------------------------------
+
+  PURPOSE:  Record a span on the calling thread, if tracing. Never waits or takes a
+            lock; the first span a thread records allocates its buffer.
+
+  INPUT  PARAMETERS:  name    -- the stage. Must be a string literal.
+                      frame   -- the frame's sequence number, or TRACE_NO_FRAME.
+                      startNs -- start of the span, in CLOCK_MONOTONIC nanoseconds.
+                      endNs   -- end of the span.
+
+-----------------------------------------------------------------------------------*/
+
+void Tracer::Span( const char* name, uint32_t frame, uint64_t startNs, uint64_t endNs ){
+
+    if( !Enabled() ){
+        return ;
+    }
+    Local()->Add( name, frame, startNs, endNs ) ;
+
+}
+
+/*----------Tracer::Write( )---------------------------------------------------------
+
+  PURPOSE:  Write every span still held by the buffers to the trace file, as Chrome
+            trace JSON. Threads may keep recording while the trace is written; a span
+            that is overwritten while being copied is left out.
+
+  RETURN VALUE:  true if the trace was written
+                 false if not tracing or the file could not be written.
+
+-----------------------------------------------------------------------------------*/
+
+bool Tracer::Write( ){
+
+    FILE* file ;                                                  /* The trace file. */
+    TraceBuffer* buffer ;                                         /* The next buffer to write. */
+    TraceEvent event ;                                            /* A copy of the next span. */
+    uint64_t count ;                                              /* Number of spans added to the buffer. */
+    uint64_t i ;                                                  /* An iterator. */
+    unsigned long pid = (unsigned long)getpid() ;                 /* The process id. */
+    const char* sep = "" ;                                        /* Separates the events. */
+
+    if( !Enabled() ){
+        return false ;
+    }
+    file = fopen( fName.c_str(), "w" ) ;
+    if( file == NULL ){
+        return false ;
+    }
+    fprintf( file, "{\"traceEvents\":[\n" ) ;
+    fprintf( file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%lu,\"args\":{\"name\":\"sign2speech\"}}", pid ) ;
+    sep = ",\n" ;
+    for( buffer = __atomic_load_n( &buffers, __ATOMIC_ACQUIRE ) ; buffer != NULL ; buffer = buffer->next ){
+        fprintf( file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%lu,\"tid\":%lu,\"args\":{\"name\":\"%s\"}}",
+                 sep, pid, buffer->Tid(), buffer->Thread() ) ;
+        count = buffer->Count() ;
+        for( i = (count > TRACE_EVENTS) ? count - TRACE_EVENTS : 0 ; i < count ; i++ ){
+            event = buffer->Event( i ) ;
+            /* Skip the span if the thread has since wrapped around onto it. */
+            if( (buffer->Count() - i) > TRACE_EVENTS ){
+                continue ;
+            }
+            fprintf( file, "%s{\"name\":\"%s\",\"cat\":\"sign2speech\",\"ph\":\"X\",\"pid\":%lu,\"tid\":%lu,"
+                           "\"ts\":%llu.%03llu,\"dur\":%llu.%03llu",
+                     sep, event.name, pid, buffer->Tid(),
+                     (unsigned long long)(event.startNs / 1000), (unsigned long long)(event.startNs % 1000),
+                     (unsigned long long)((event.endNs - event.startNs) / 1000),
+                     (unsigned long long)((event.endNs - event.startNs) % 1000) ) ;
+            if( event.frame != TRACE_NO_FRAME ){
+                fprintf( file, ",\"args\":{\"frame\":%u}", event.frame ) ;
+            }
+            fprintf( file, "}" ) ;
+        }
+    }
+    fprintf( file, "\n],\"displayTimeUnit\":\"ns\"}\n" ) ;
+
+    return (fclose( file ) == 0) ;
+
+}
+
+/*----------Tracer::Local( )---------------------------------------------------------
+
+  PURPOSE:  Find the calling thread's buffer on its first span. A named thread takes
+            over the buffer of an earlier thread with the same name, so the stages
+            started each time the worker runs reuse the buffers of the ones before
+            them, keeping their spans. Otherwise a new buffer is pushed onto the list
+            with a compare and swap, so threads never wait for each other.
+
+  RETURN VALUE:  The calling thread's buffer.
+
+-----------------------------------------------------------------------------------*/
+
+TraceBuffer* Tracer::Local( ){
+
+    TraceBuffer* buffer ;  /* The new buffer. */
+    unsigned long tid ;    /* The calling thread's id. */
+
+    if( local != NULL ){
+        return local ;
+    }
+    tid = (unsigned long)syscall( SYS_gettid ) ;
+    if( localName != NULL ){
+        for( buffer = __atomic_load_n( &buffers, __ATOMIC_ACQUIRE ) ; buffer != NULL ; buffer = buffer->next ){
+            if( strcmp( buffer->Thread(), localName ) == 0 ){
+                buffer->SetTid( tid ) ;
+                local = buffer ;
+                return local ;
+            }
+        }
+    }
+    buffer = new TraceBuffer( (localName != NULL) ? localName : "thread", tid ) ;
+    buffer->next = __atomic_load_n( &buffers, __ATOMIC_RELAXED ) ;
+    while( !__atomic_compare_exchange_n( &buffers, &buffer->next, buffer, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED ) ) ;
+    local = buffer ;
+
+    return local ;
+
+}
@@ -0,0 +1,120 @@
+/***********Tracer.h*****************************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the classes "TraceBuffer" and "Tracer", which
+            record how long each pipeline stage spent on each frame, so that the time
+            from a hand pose to the spoken letter can be broken down stage by stage.
+            Variables.h and Tracer.cpp include this file.
+
+            Each span is tagged with the frame's sequence number, as assigned by
+            i2c_transfer, and timed on CLOCK_MONOTONIC, so the trace written here
+            lines up with the one written by i2c_transfer --trace. The traces are
+            Chrome trace JSON (chrome://tracing or ui.perfetto.dev), and
+            tools/trace_report.py merges them and summarizes the stage latencies.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <string>
+#include <stdint.h>
+
+using namespace std ;
+
+#define TRACE_EVENTS      65536       /* Spans kept per thread, the oldest being overwritten. Must be a power of two. */
+#define TRACE_NO_FRAME    0xFFFFFFFF  /* Frame number of spans that do not belong to a frame. */
+#define TRACE_LOCAL_FRAME 0x80000000  /* Set in the frame numbers given to samples read from the XML file. */
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "TraceEvent" represents a span of time a stage spent on a frame. */
+
+struct TraceEvent {
+	 const char* name ;                               /* The stage. Must be a string literal. */
+	 uint32_t frame ;                                 /* The frame's sequence number, or TRACE_NO_FRAME. */
+	 uint64_t startNs ;                               /* Start of the span, in CLOCK_MONOTONIC nanoseconds. */
+	 uint64_t endNs ;                                 /* End of the span. */
+} ;
+
+/* Type "TraceBuffer" holds the latest spans recorded by one thread at a time. Only that
+   thread adds spans, and it never waits: each span is stored before the count is published,
+   so a reader sees every span up to the count it loads. */
+
+class TraceBuffer {
+
+  public:
+
+	 /* Constructor function */
+	 TraceBuffer( const char* thread, unsigned long tid ) ;
+
+	 /* Accessor functions */
+	 inline const char* Thread( ) const { return thread ; }                   /* Access the thread name. */
+	 inline unsigned long Tid( ) const { return __atomic_load_n( &tid, __ATOMIC_RELAXED ) ; }  /* Access the thread id. */
+	 inline uint64_t Count( ) const { return __atomic_load_n( &count, __ATOMIC_ACQUIRE ) ; }  /* Access number of spans added. */
+	 inline const TraceEvent &Event( uint64_t i ) const { return events[i & (TRACE_EVENTS - 1)] ; }  /* Access span i. */
+
+	 /* Mutator functions */
+	 inline void SetTid( unsigned long newTid ) { __atomic_store_n( &tid, newTid, __ATOMIC_RELAXED ) ; }  /* Hands the buffer to another thread. */
+	 inline void Add( const char* name, uint32_t frame, uint64_t startNs, uint64_t endNs ){  /* Adds a span. */
+	   TraceEvent &event = events[count & (TRACE_EVENTS - 1)] ;
+	   event.name = name ;
+	   event.frame = frame ;
+	   event.startNs = startNs ;
+	   event.endNs = endNs ;
+	   __atomic_store_n( &count, count + 1, __ATOMIC_RELEASE ) ;
+	 }
+
+	 TraceBuffer* next ;                             /* The buffer of the previously registered thread. */
+
+  private:
+
+	 const char* thread ;                            /* Name of the thread. */
+	 unsigned long tid ;                             /* Kernel id of the thread. */
+	 uint64_t count ;                                /* Number of spans added. */
+	 TraceEvent events[TRACE_EVENTS] ;               /* The latest spans. */
+
+} ;
+
+/* Type "Tracer" gives each thread that records a span its own TraceBuffer, and writes
+   every buffer out as Chrome trace JSON. Spans are dropped until Open() is called, so
+   the trace points cost a branch when tracing is off. Buffers are never freed, since
+   the stages may still be recording while the program exits. There should be only one
+   Tracer, since each thread's buffer is found through a thread_local pointer. */
+
+class Tracer {
+
+  public:
+
+	 /* Default constructor function */
+	 Tracer( ) ;
+
+	 /* Accessor functions */
+	 inline bool Enabled( ) const { return __atomic_load_n( &enabled, __ATOMIC_RELAXED ) ; }  /* True while tracing. */
+
+	 /* Mutator functions */
+	 bool Open( const char* fName ) ;                /* Starts tracing, to be written to fName. */
+	 void Name( const char* thread ) ;               /* Names the calling thread in the trace. */
+	 void Span( const char* name, uint32_t frame, uint64_t startNs, uint64_t endNs ) ;  /* Records a span on the calling thread. */
+	 bool Write( ) ;                                 /* Writes every span recorded so far. */
+
+  private:
+
+	 TraceBuffer* Local( ) ;
+
+	 static thread_local TraceBuffer* local ;        /* The calling thread's buffer, NULL until it records. */
+	 static thread_local const char* localName ;     /* The calling thread's name. */
+	 TraceBuffer* buffers ;                          /* Every thread's buffer, most recently registered first. */
+	 string fName ;                                  /* The trace file. */
+	 bool enabled ;                                  /* True once Open() has been called. */
+
+} ;
+
+#endif
@@ -0,0 +1,365 @@
+/***********WordDecoder.cpp*********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The Push(), Flush(), Pending(), Reset(), and WordsPerMinute() functions of
+            the "WordDecoder" class are defined in this module.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <algorithm>
+#include <string.h>
+#include "WordDecoder.h"
+
+/*----------hypothesis_less( )-------------------------------------------------------
+
+  PURPOSE:  Order spellings by cost, cheapest first.
+
+-----------------------------------------------------------------------------------*/
+
+static bool hypothesis_less( const DecoderHypothesis &a, const DecoderHypothesis &b ){
+
+    return a.cost < b.cost ;
+
+}
+
+/*----------WordDecoder::WordDecoder( )----------------------------------------------
+
+  PURPOSE:  Create a decoder without a lexicon.
+
+-----------------------------------------------------------------------------------*/
+
+WordDecoder::WordDecoder( ) : lexicon(NULL) {
+
+    Reset() ;
+
+}
+
+/*----------WordDecoder::SetLexicon( )-----------------------------------------------
+
+  PURPOSE:  Choose the words to decode, and start over.
+
+  INPUT  PARAMETERS:  lexicon -- the words, or NULL to stop decoding. It must outlive
+                                 the decoder.
+
+-----------------------------------------------------------------------------------*/
+
+void WordDecoder::SetLexicon( const Lexicon* lexicon ){
+
+    this->lexicon = lexicon ;
+    Reset() ;
+
+    return ;
+
+}
+
+/*----------WordDecoder::Reset( )----------------------------------------------------
+
+  PURPOSE:  Forget the word being signed and the previous word, and start counting the
+            signing rate over.
+
+-----------------------------------------------------------------------------------*/
+
+void WordDecoder::Reset( ){
+
+    beam[0].node = LEXICON_ROOT ;
+    beam[0].cost = 0.0f ;
+    beam[0].len = 0 ;
+    beamSize = 1 ;
+    prevWord = LEXICON_NONE ;
+    words = 0 ;
+    letters = 0 ;
+    firstNs = 0 ;
+    lastWordNs = 0 ;
+
+    return ;
+
+}
+
+/*----------WordDecoder::Push( )-----------------------------------------------------
+
+  PURPOSE:  Decode the next segment. A letter extends the spellings of the word being
+            signed. A space appends the most likely word, followed by the space; a
+            space with no word before it is appended as it is. A segment that is
+            most likely a space, but costs DECODER_SPACE_COST or more, is taken as
+            the letters it may otherwise have been.
+
+  INPUT  PARAMETERS:  segment -- the letters the pose may have been.
+                      text    -- the decoded text, appended to.
+
+  RETURN VALUE:  true if a word was appended
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool WordDecoder::Push( const LetterSegment &segment, string &text ){
+
+    bool added ;  /* True if a word was appended. */
+
+    if( !Active() || (segment.count == 0) ){
+        return false ;
+    }
+    if( (firstNs == 0) && (segment.acquired != 0) ){
+        firstNs = segment.acquired ;
+    }
+    /* A space that is not clearly one is more likely the hand passing between letters. */
+    if( (segment.hyps[0].letter != ' ') || (segment.hyps[0].cost >= DECODER_SPACE_COST) ){
+        Extend( segment ) ;
+        return false ;
+    }
+    added = Flush( text ) ;
+    text += ' ' ;
+    if( added ){
+        lastWordNs = segment.acquired ;
+    }
+
+    return added ;
+
+}
+
+/*----------WordDecoder::Flush( )----------------------------------------------------
+
+  PURPOSE:  Append the most likely word for the letters signed so far, without a
+            space, and start on the next word.
+
+  INPUT  PARAMETERS:  text -- the decoded text, appended to.
+
+  RETURN VALUE:  true if a word was appended
+                 false if no letters have been signed since the last word.
+
+-----------------------------------------------------------------------------------*/
+
+bool WordDecoder::Flush( string &text ){
+
+    unsigned int hyp ;  /* The spelling chosen. */
+    uint32_t word ;     /* The word chosen, or LEXICON_NONE to keep the spelling. */
+
+    if( !Active() || !Choose(hyp, word) ){
+        return false ;
+    }
+    if( word != LEXICON_NONE )
+        text += lexicon->WordText( word ) ;
+    else
+        text.append( beam[hyp].letters, beam[hyp].len ) ;
+    prevWord = word ;
+    words++ ;
+    letters += beam[hyp].len ;
+    beam[0].node = LEXICON_ROOT ;
+    beam[0].cost = 0.0f ;
+    beam[0].len = 0 ;
+    beamSize = 1 ;
+
+    return true ;
+
+}
+
+/*----------WordDecoder::Pending( )--------------------------------------------------
+
+  PURPOSE:  Show the word that a space would complete: the letters of the spelling it
+            would be decoded from, followed by the rest of the word in brackets if
+            the word would be completed.
+
+  INPUT  PARAMETERS:  shown -- receives the word, empty if no letters have been signed.
+
+-----------------------------------------------------------------------------------*/
+
+void WordDecoder::Pending( string &shown ) const {
+
+    unsigned int hyp ;  /* The spelling chosen. */
+    uint32_t word ;     /* The word chosen, or LEXICON_NONE to keep the spelling. */
+    const char* full ;  /* The text of the word chosen. */
+
+    shown.clear() ;
+    if( !Active() || !Choose(hyp, word) ){
+        return ;
+    }
+    shown.assign( beam[hyp].letters, beam[hyp].len ) ;
+    if( word != LEXICON_NONE ){
+        full = lexicon->WordText( word ) ;
+        if( strlen(full) > beam[hyp].len ){
+            shown += '[' ;
+            shown += full + beam[hyp].len ;
+            shown += ']' ;
+        }
+    }
+
+    return ;
+
+}
+
+/*----------WordDecoder::WordsPerMinute( )-------------------------------------------
+
+  PURPOSE:  Find the signing rate, from the first segment to the space that completed
+            the last word, using the times the poses were read.
+
+  RETURN VALUE:  The words per minute, 0 if no word has been completed by a space.
+
+-----------------------------------------------------------------------------------*/
+
+double WordDecoder::WordsPerMinute( ) const {
+
+    if( (words == 0) || (firstNs == 0) || (lastWordNs <= firstNs) )
+        return 0.0 ;
+
+    return words / ((lastWordNs - firstNs) / 60e9) ;
+
+}
+
+/*----------WordDecoder::Extend( )---------------------------------------------------
+
+  PURPOSE:  Extend every spelling kept by each letter of a segment, and keep the
+            cheapest DECODER_BEAM. A spelling within the lexicon follows the trie; any
+            spelling may also leave the lexicon at DECODER_OOV_COST a letter. Since the
+            pose may have been the hand passing between two letters, every spelling
+            may also skip the segment, at DECODER_SKIP_COST less the cost of its
+            closest letter. Spellings that reach the same prefix, or the same letters
+            outside the lexicon, are merged.
+
+  INPUT  PARAMETERS:  segment -- the letters the pose may have been.
+
+-----------------------------------------------------------------------------------*/
+
+void WordDecoder::Extend( const LetterSegment &segment ){
+
+    float skip = DECODER_SKIP_COST - segment.hyps[0].cost ;  /* Cost of skipping the segment. */
+    unsigned int count = 0 ;  /* Number of extended spellings. */
+    unsigned int i ;          /* An iterator over the spellings kept. */
+    unsigned int j ;          /* An iterator over the letters. */
+
+    if( skip < DECODER_MIN_SKIP_COST )
+        skip = DECODER_MIN_SKIP_COST ;
+    for( i = 0 ; i < beamSize ; i++ ){
+        const DecoderHypothesis &from = beam[i] ;
+        Merge( count, from, from.node, 0, from.cost + skip ) ;
+        if( from.len >= DECODER_MAX_WORD ){
+            /* The word is too long to be one, so the letter is dropped. */
+            continue ;
+        }
+        for( j = 0 ; j < segment.count ; j++ ){
+            char letter = segment.hyps[j].letter ;
+            float cost = from.cost + segment.hyps[j].cost ;
+            if( letter == ' ' )
+                continue ;
+            if( from.node != LEXICON_NONE ){
+                uint32_t child = lexicon->Child( from.node, letter ) ;
+                if( child != LEXICON_NONE )
+                    Merge( count, from, child, letter, cost ) ;
+            }
+            Merge( count, from, LEXICON_NONE, letter, cost + DECODER_OOV_COST ) ;
+        }
+    }
+    beamSize = (count < DECODER_BEAM) ? count : DECODER_BEAM ;
+    partial_sort( next, next + beamSize, next + count, hypothesis_less ) ;
+    memcpy( beam, next, beamSize * sizeof(DecoderHypothesis) ) ;
+
+    return ;
+
+}
+
+/*----------WordDecoder::Merge( )----------------------------------------------------
+
+  PURPOSE:  Add a spelling extended by a segment, or lower the cost of the same
+            spelling if it was already reached another way.
+
+  INPUT  PARAMETERS:  count  -- number of extended spellings, incremented if added.
+                      from   -- the spelling extended.
+                      node   -- the prefix reached, or LEXICON_NONE outside the lexicon.
+                      letter -- the letter added, or 0 if the segment was skipped.
+                      cost   -- the cost of the extended spelling.
+
+-----------------------------------------------------------------------------------*/
+
+void WordDecoder::Merge( unsigned int &count, const DecoderHypothesis &from, uint32_t node, char letter, float cost ){
+
+    unsigned int len = from.len + ((letter != 0) ? 1 : 0) ;  /* Number of letters of the extended spelling. */
+    unsigned int k ;                                         /* An iterator over the extended spellings. */
+
+    for( k = 0 ; k < count ; k++ ){
+        if( (next[k].node != node) || (next[k].len != len) )
+            continue ;
+        /* A prefix within the lexicon has a single spelling; outside it, the letters must match. */
+        if( (node == LEXICON_NONE) && ((memcmp(next[k].letters, from.letters, from.len) != 0) ||
+                                       ((letter != 0) && (next[k].letters[from.len] != letter))) )
+            continue ;
+        if( cost < next[k].cost )
+            next[k].cost = cost ;
+        return ;
+    }
+    DecoderHypothesis &to = next[count++] ;
+    memcpy( to.letters, from.letters, from.len ) ;
+    if( letter != 0 )
+        to.letters[from.len] = letter ;
+    to.len = len ;
+    to.node = node ;
+    to.cost = cost ;
+
+    return ;
+
+}
+
+/*----------WordDecoder::Choose( )---------------------------------------------------
+
+  PURPOSE:  Find the most likely word for the letters signed so far. Each spelling
+            within the lexicon may end in the word it spells, or after
+            DECODER_COMPLETE_AFTER letters, in the most likely word it starts, at
+            DECODER_COMPLETE_COST more; either costs the word following the previous
+            word. A spelling outside the lexicon costs DECODER_OOV_WORD_COST more.
+
+  INPUT  PARAMETERS:  hyp  -- receives the spelling chosen.
+                      word -- receives the word, or LEXICON_NONE to keep the spelling.
+
+  RETURN VALUE:  true if a word was found
+                 false if no letters have been signed since the last word.
+
+-----------------------------------------------------------------------------------*/
+
+bool WordDecoder::Choose( unsigned int &hyp, uint32_t &word ) const {
+
+    float best = 0.0f ;     /* The cost of the word chosen. */
+    bool found = false ;    /* True once a word has been found. */
+    float cost ;            /* The cost of the next word. */
+    unsigned int i ;        /* An iterator. */
+
+    for( i = 0 ; i < beamSize ; i++ ){
+        if( beam[i].len == 0 )
+            continue ;
+        if( beam[i].node == LEXICON_NONE ){
+            cost = beam[i].cost + DECODER_OOV_WORD_COST ;
+            if( !found || (cost < best) ){
+                best = cost ;
+                hyp = i ;
+                word = LEXICON_NONE ;
+                found = true ;
+            }
+            continue ;
+        }
+        const LexiconNode &node = lexicon->Node( beam[i].node ) ;
+        if( node.word != LEXICON_NONE ){
+            cost = beam[i].cost + lexicon->PairCost( prevWord, node.word ) ;
+            if( !found || (cost < best) ){
+                best = cost ;
+                hyp = i ;
+                word = node.word ;
+                found = true ;
+            }
+        }
+        if( (beam[i].len >= DECODER_COMPLETE_AFTER) && (node.best != LEXICON_NONE) && (node.best != node.word) ){
+            cost = beam[i].cost + lexicon->PairCost( prevWord, node.best ) + DECODER_COMPLETE_COST ;
+            if( !found || (cost < best) ){
+                best = cost ;
+                hyp = i ;
+                word = node.best ;
+                found = true ;
+            }
+        }
+    }
+
+    return found ;
+
+}
@@ -0,0 +1,124 @@
+/***********WordDecoder.h***********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the types "LetterSegment", the letters a held
+            pose may have been, and "WordDecoder", which turns the segments of a
+            word into the word most likely meant. Pipeline.h and WordDecoder.cpp
+            include this file.
+
+            The classify stage keeps the DECODER_TOP_K closest letters of each pose,
+            with a cost that grows with their distance. The decoder runs a beam
+            search over the lexicon trie as each segment arrives, so that a misread
+            letter is corrected by the word it belongs to, and once the signer makes
+            a space, adds the cost of the word itself, following the previous word.
+            After DECODER_COMPLETE_AFTER letters, a space may also complete the
+            word; the completion is shown while the word is signed, so the signer
+            can stop as soon as it is right.
+
+            Letters that lead outside the lexicon, such as names and numbers, are
+            kept as spelled, at DECODER_OOV_COST for each letter, so they are only
+            chosen when no word fits. A pose may also be skipped, as the segmenter
+            sometimes catches the hand passing between two letters; the further
+            the pose is from every letter, the less skipping it costs.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef WORDDECODER_H
+#define WORDDECODER_H
+
+#include <string>
+#include <stdint.h>
+#include "Lexicon.h"
+
+using namespace std ;
+
+#define DECODER_TOP_K          4      /* Number of letters kept for each pose. */
+#define DECODER_BEAM          16      /* Number of spellings kept while a word is signed. */
+#define DECODER_MAX_WORD      24      /* Longest word, in letters. Further letters are dropped. */
+#define DECODER_COMPLETE_AFTER 3      /* Number of letters signed before a word may be completed. */
+#define DECODER_DISTANCE_SCALE 4.0f   /* Distance between a pose and a letter, in flex steps, that costs 1. */
+#define DECODER_MAX_DISTANCE  40      /* Largest distance to the closest letter for a pose to count as a letter. */
+#define DECODER_ORIENT_WEIGHT  4.0f   /* Distance, in flex steps, added per unit of squared error in the direction of gravity. */
+#define DECODER_OOV_COST       2.0f   /* Cost of each letter outside the lexicon. */
+#define DECODER_OOV_WORD_COST 12.0f   /* Cost of a word outside the lexicon. */
+#define DECODER_COMPLETE_COST  2.0f   /* Cost of completing a word instead of spelling it out. */
+#define DECODER_SKIP_COST      6.0f   /* Cost of taking a pose that matched a letter exactly as the hand passing between letters. */
+#define DECODER_MIN_SKIP_COST  0.5f   /* Least cost of taking a pose as the hand passing between letters. */
+#define DECODER_SPACE_COST     2.0f   /* Largest cost of a space for the pose to end the word. */
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "LetterHypothesis" represents a letter a pose may have been. */
+
+struct LetterHypothesis {
+	 char letter ;                                   /* The letter, or ' ' for a space. */
+	 float cost ;                                    /* -log of the letter's likelihood, up to a constant. */
+} ;
+
+/* Type "LetterSegment" represents a pose, as the letters it may have been, closest first. */
+
+struct LetterSegment {
+	 LetterHypothesis hyps[DECODER_TOP_K] ;          /* The letters, cheapest first. */
+	 unsigned int count ;                            /* Number of letters. */
+	 uint64_t acquired ;                             /* Time the pose was read, 0 if unknown. */
+} ;
+
+/* Type "DecoderHypothesis" represents a spelling of the word being signed. */
+
+struct DecoderHypothesis {
+	 uint32_t node ;                                 /* The prefix in the lexicon, or LEXICON_NONE if outside it. */
+	 float cost ;                                    /* Summed cost of the letters. */
+	 unsigned int len ;                              /* Number of letters. */
+	 char letters[DECODER_MAX_WORD] ;                /* The letters, not NUL terminated. */
+} ;
+
+/* Type "WordDecoder" decodes the words of one stream of segments. Only one thread may use
+   it. Without a lexicon, it is not active, and the letters should be used as
+   recognized. */
+
+class WordDecoder {
+
+  public:
+
+	 /* Default constructor function */
+	 WordDecoder( ) ;
+
+	 /* Accessor functions */
+	 inline bool Active( ) const { return (lexicon != NULL) && (lexicon->Size() > 0) ; }  /* Access whether words are decoded. */
+	 inline unsigned int Words( ) const { return words ; }            /* Access number of words decoded. */
+	 inline unsigned int Letters( ) const { return letters ; }        /* Access number of letters signed for them, not counting spaces or skipped poses. */
+	 double WordsPerMinute( ) const ;                                 /* Access the signing rate. */
+	 void Pending( string &shown ) const ;                            /* Access the word being signed, with its completion. */
+
+	 /* Mutator functions */
+	 void SetLexicon( const Lexicon* lexicon ) ;                      /* Chooses the words to decode. */
+	 bool Push( const LetterSegment &segment, string &text ) ;        /* Decodes a segment, appending any completed word. */
+	 bool Flush( string &text ) ;                                     /* Appends the word being signed. */
+	 void Reset( ) ;                                                  /* Starts over, as at the start of the text. */
+
+  private:
+
+	 bool Choose( unsigned int &hyp, uint32_t &word ) const ;
+	 void Extend( const LetterSegment &segment ) ;
+	 void Merge( unsigned int &count, const DecoderHypothesis &from, uint32_t node, char letter, float cost ) ;
+
+	 const Lexicon* lexicon ;                                         /* The words, or NULL. */
+	 DecoderHypothesis beam[DECODER_BEAM] ;                           /* The spellings kept, cheapest first. */
+	 DecoderHypothesis next[DECODER_BEAM * (DECODER_TOP_K * 2 + 1)] ; /* The spellings extended by a segment, within and outside the lexicon, or skipping it. */
+	 unsigned int beamSize ;                                          /* Number of spellings kept. */
+	 uint32_t prevWord ;                                              /* The last word decoded, or LEXICON_NONE. */
+	 unsigned int words ;                                             /* Number of words decoded. */
+	 unsigned int letters ;                                           /* Number of letters the words decoded were spelled from. */
+	 uint64_t firstNs ;                                               /* Time of the first segment, 0 if none. */
+	 uint64_t lastWordNs ;                                            /* Time of the segment that completed the last word. */
+
+} ;
+
+#endif
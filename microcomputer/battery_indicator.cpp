@@ -1,34 +1,326 @@
+/***********battery_indicator.cpp****************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The Start() function of the "BatteryMonitor" class, and the handlers it
+            connects to the main loop, are defined in this module.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
 #include "battery_indicator.h"
 
-int getBatteryState() {
+/*----------read_attribute( )--------------------------------------------------------
+
+  PURPOSE:  Read a sysfs attribute from the start, without reopening it. Sysfs
+            regenerates the value on each read at offset 0.
+
+  INPUT  PARAMETERS:  fd     -- the open attribute.
+                      buffer -- receives the value, without the trailing newline.
+                      size   -- size of the buffer.
+
+  RETURN VALUE:  true if the attribute was read
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+static bool read_attribute( int fd, char* buffer, size_t size ){
+
+    ssize_t len = pread( fd, buffer, size - 1, 0 ) ;  /* Number of bytes read. */
+
+    if( len <= 0 ){
+        return false ;
+    }
+    buffer[len] = '\0' ;
+    buffer[strcspn( buffer, "\n" )] = '\0' ;
+
+    return true ;
+
+}
+
+/*----------BatteryMonitor::BatteryMonitor( )----------------------------------------
+
+  PURPOSE:  Create a monitor that is not yet watching the battery.
+
+-----------------------------------------------------------------------------------*/
+
+BatteryMonitor::BatteryMonitor( ) : capacityFd(-1), ueventFd(-1), level(BATTERY_UNKNOWN) {
+
+}
+
+/*----------BatteryMonitor::~BatteryMonitor( )---------------------------------------
+
+  PURPOSE:  Stop watching the battery.
+
+-----------------------------------------------------------------------------------*/
+
+BatteryMonitor::~BatteryMonitor( ){
+
+    ueventWatch.disconnect() ;
+    pollTimeout.disconnect() ;
+    if( ueventFd >= 0 ){
+        close( ueventFd ) ;
+    }
+    if( capacityFd >= 0 ){
+        close( capacityFd ) ;
+    }
+
+}
+
+/*----------BatteryMonitor::Start( )-------------------------------------------------
+
+  PURPOSE:  Start watching the battery through UPower, or through sysfs if UPower is
+            not running. Must be called from the GUI thread, whose main loop runs the
+            handlers. The current level is reported before returning.
+
+  INPUT  PARAMETERS:  changed -- called with the charge level, in percent, whenever
+                                 it changes.
+
+  RETURN VALUE:  true if a battery was found
+                 false otherwise, in which case the level stays BATTERY_UNKNOWN.
+
+-----------------------------------------------------------------------------------*/
+
+bool BatteryMonitor::Start( const sigc::slot<void, int> &changed ){
+
+    this->changed = changed ;
+    this->changed( level ) ;
+
+    return WatchUPower() || WatchSysfs() ;
+
+}
+
+/*----------BatteryMonitor::WatchUPower( )-------------------------------------------
+
+  PURPOSE:  Subscribe to UPower's property changes for the battery. UPower caches
+            the device's properties in the proxy and updates them before the signal
+            is emitted, so reading the level never waits on the bus.
+
+  RETURN VALUE:  true if UPower reports the battery
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool BatteryMonitor::WatchUPower( ){
+
+    Glib::VariantBase percentage ;    /* UPower's cached charge level. */
+
+    try{
+        upower = Gio::DBus::Proxy::create_for_bus_sync( Gio::DBus::BUS_TYPE_SYSTEM, "org.freedesktop.UPower",
+                                                        BATTERY_UPOWER_DEVICE, "org.freedesktop.UPower.Device" ) ;
+    }
+    catch( const Glib::Error &e ){
+        upower.reset() ;
+        return false ;
+    }
+    /* The proxy is created even when UPower is not running, but then has no properties. */
+    upower->get_cached_property( percentage, "Percentage" ) ;
+    if( percentage.gobj() == NULL ){
+        upower.reset() ;
+        return false ;
+    }
+    upower->signal_properties_changed().connect( sigc::mem_fun( *this, &BatteryMonitor::OnPropertiesChanged ) ) ;
+    ReadUPower() ;
+
+    return true ;
+
+}
+
+/*----------BatteryMonitor::WatchSysfs( )--------------------------------------------
+
+  PURPOSE:  Find the first battery under BATTERY_SYSFS_DIR and keep its capacity
+            attribute open. The kernel sends a power_supply uevent when the charge
+            changes, so the attribute is read again on each one; since some drivers
+            only send them when the status changes, it is also read every
+            BATTERY_POLL_SECONDS.
+
+  RETURN VALUE:  true if a battery was found
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool BatteryMonitor::WatchSysfs( ){
+
+    DIR* dir = opendir( BATTERY_SYSFS_DIR ) ;  /* The power supplies. */
+    struct dirent* entry ;                      /* The next power supply. */
+    struct sockaddr_nl addr ;                   /* The uevent multicast group. */
+    char type[32] ;                             /* The power supply's type. */
+    int fd ;                                    /* The power supply's type attribute. */
+
+    if( dir == NULL ){
+        return false ;
+    }
+    while( (capacityFd < 0) && ((entry = readdir( dir )) != NULL) ){
+        if( entry->d_name[0] == '.' ){
+            continue ;
+        }
+        fd = open( (std::string(BATTERY_SYSFS_DIR "/") + entry->d_name + "/type").c_str(), O_RDONLY | O_CLOEXEC ) ;
+        if( fd < 0 ){
+            continue ;
+        }
+        if( read_attribute( fd, type, sizeof(type) ) && (strcmp( type, "Battery" ) == 0) ){
+            capacityFd = open( (std::string(BATTERY_SYSFS_DIR "/") + entry->d_name + "/capacity").c_str(), O_RDONLY | O_CLOEXEC ) ;
+        }
+        close( fd ) ;
+    }
+    closedir( dir ) ;
+    if( capacityFd < 0 ){
+        return false ;
+    }
+    /* Without the uevent socket, the periodic read alone keeps the level current. */
+    ueventFd = socket( AF_NETLINK, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT ) ;
+    if( ueventFd >= 0 ){
+        memset( &addr, 0, sizeof(addr) ) ;
+        addr.nl_family = AF_NETLINK ;
+        addr.nl_groups = 1 ;
+        if( bind( ueventFd, (struct sockaddr*)&addr, sizeof(addr) ) == 0 ){
+            ueventWatch = Glib::signal_io().connect( sigc::mem_fun( *this, &BatteryMonitor::OnUevent ), ueventFd, Glib::IO_IN ) ;
+        }
+        else{
+            close( ueventFd ) ;
+            ueventFd = -1 ;
+        }
+    }
+    pollTimeout = Glib::signal_timeout().connect_seconds( sigc::mem_fun( *this, &BatteryMonitor::OnPoll ), BATTERY_POLL_SECONDS ) ;
+    ReadSysfs() ;
+
+    return true ;
+
+}
+
+/*----------BatteryMonitor::ReadUPower( )--------------------------------------------
 
-  system("upower -i /org/freedesktop/UPower/devices/battery_BAT0 |grep 'percentage:' |awk '{print $2}' > percentage.txt");
+  PURPOSE:  Take the level from UPower's cached Percentage property.
 
-  char * buffer = 0;
-  long length; 
-  FILE * f = fopen ("percentage.txt", "rb");
+-----------------------------------------------------------------------------------*/
+
+void BatteryMonitor::ReadUPower( ){
+
+    Glib::VariantBase percentage ;    /* UPower's cached charge level. */
+
+    upower->get_cached_property( percentage, "Percentage" ) ;
+    if( percentage.gobj() == NULL ){
+        return ;
+    }
+    try{
+        Update( (int)(Glib::VariantBase::cast_dynamic< Glib::Variant<double> >( percentage ).get() + 0.5) ) ;
+    }
+    catch( const std::bad_cast &e ){
+    }
+
+}
 
-  if (f)
-  {
-    fseek (f, 0, SEEK_END);
-    length = ftell (f);
-    fseek (f, 0, SEEK_SET);
-    buffer = (char *) malloc (length);
-    if (buffer)
-    {
-      fread (buffer, 1, length, f);
+/*----------BatteryMonitor::ReadSysfs( )---------------------------------------------
+
+  PURPOSE:  Take the level from the battery's capacity attribute.
+
+-----------------------------------------------------------------------------------*/
+
+void BatteryMonitor::ReadSysfs( ){
+
+    char capacity[16] ;    /* The charge level, in percent. */
+
+    if( read_attribute( capacityFd, capacity, sizeof(capacity) ) ){
+        Update( atoi( capacity ) ) ;
+    }
+
+}
+
+/*----------BatteryMonitor::Update( )------------------------------------------------
+
+  PURPOSE:  Record a new level, calling back only if it changed.
+
+  INPUT  PARAMETERS:  newLevel -- the charge level, in percent.
+
+-----------------------------------------------------------------------------------*/
+
+void BatteryMonitor::Update( int newLevel ){
+
+    if( newLevel < 0 ){
+        newLevel = 0 ;
+    }
+    else if( newLevel > 100 ){
+        newLevel = 100 ;
     }
-    fclose (f);
-  }
+    if( newLevel != level ){
+        level = newLevel ;
+        changed( level ) ;
+    }
+
+}
+
+/*----------BatteryMonitor::OnPropertiesChanged( )-----------------------------------
+
+  PURPOSE:  Handle UPower's PropertiesChanged signal.
+
+  INPUT  PARAMETERS:  changedProperties -- the properties that changed, with their values.
+                      invalidated       -- properties that changed without their values.
+
+-----------------------------------------------------------------------------------*/
+
+void BatteryMonitor::OnPropertiesChanged( const Gio::DBus::Proxy::MapChangedProperties &changedProperties,
+                                          const std::vector<Glib::ustring> &invalidated ){
+
+    if( changedProperties.count( "Percentage" ) != 0 ){
+        ReadUPower() ;
+    }
+
+}
+
+/*----------BatteryMonitor::OnUevent( )----------------------------------------------
+
+  PURPOSE:  Drain the uevent socket, reading the capacity attribute again if any of
+            the uevents came from a power supply.
+
+  INPUT  PARAMETERS:  condition -- the socket's state.
+
+  RETURN VALUE:  true, to keep watching the socket.
+
+-----------------------------------------------------------------------------------*/
+
+bool BatteryMonitor::OnUevent( Glib::IOCondition condition ){
+
+    char buffer[4096] ;     /* A uevent: the action and device path, then NUL separated KEY=value pairs. */
+    ssize_t len ;           /* Length of the uevent. */
+    bool power = false ;    /* True if a power supply changed. */
+
+    while( (len = recv( ueventFd, buffer, sizeof(buffer), MSG_DONTWAIT )) > 0 ){
+        if( memmem( buffer, len, "SUBSYSTEM=power_supply", strlen( "SUBSYSTEM=power_supply" ) ) != NULL ){
+            power = true ;
+        }
+    }
+    if( power ){
+        ReadSysfs() ;
+    }
+
+    return true ;
+
+}
+
+/*----------BatteryMonitor::OnPoll( )------------------------------------------------
+
+  PURPOSE:  Read the capacity attribute in case no uevent was sent.
+
+  RETURN VALUE:  true, to keep polling.
+
+-----------------------------------------------------------------------------------*/
+
+bool BatteryMonitor::OnPoll( ){
 
-  if (buffer)
-  {
-    // start to process your data / extract strings here...
-    std::string str(buffer);
-    str = str.substr(0, str.length() - 1);
-    return stoi(str);
-  }
+    ReadSysfs() ;
 
-  return 100;
+    return true ;
 
 }
@@ -1,6 +1,77 @@
-#include <iostream>
-#include <cstdio>
-#include <cstdlib>
+/***********battery_indicator.h******************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the class "BatteryMonitor", which keeps the
+            charge level shown in the power bar up to date. Variables.h and
+            battery_indicator.cpp include this file.
+
+            The level is pushed to the GUI thread only when it changes. It is
+            taken from UPower's PropertiesChanged signal on the system bus when
+            UPower is running. Otherwise the battery's capacity attribute under
+            /sys/class/power_supply is kept open and read again whenever the kernel
+            announces a power supply uevent, and once a minute in case the driver
+            does not. Neither path starts a process or touches the disk.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef BATTERY_INDICATOR_H
+#define BATTERY_INDICATOR_H
+
+#include <gtkmm.h>
 #include <string>
+#include <vector>
+
+#define BATTERY_UPOWER_DEVICE "/org/freedesktop/UPower/devices/battery_BAT0"  /* The battery watched through UPower. */
+#define BATTERY_SYSFS_DIR     "/sys/class/power_supply"                      /* Where the kernel lists power supplies. */
+#define BATTERY_POLL_SECONDS  60          /* Seconds between reads of the capacity attribute when no uevent arrives. */
+#define BATTERY_UNKNOWN       100         /* Level shown when there is no battery, as when running on AC. */
+
+/*----------Type Definitions-------------------------------------------------------*/
+
+/* Type "BatteryMonitor" watches the battery from the GUI thread's main loop and calls
+   back with the new charge level, in percent, each time it changes. */
+
+class BatteryMonitor {
+
+  public:
+
+	 /* Default constructor and destructor functions */
+	 BatteryMonitor( ) ;
+	 ~BatteryMonitor( ) ;
+
+	 /* Accessor functions */
+	 inline int Level( ) const { return level ; }   /* Access the last known charge level, in percent. */
+
+	 /* Mutator functions */
+	 bool Start( const sigc::slot<void, int> &changed ) ;  /* Starts watching the battery. */
+
+  private:
+
+	 bool WatchUPower( ) ;
+	 bool WatchSysfs( ) ;
+	 void ReadUPower( ) ;
+	 void ReadSysfs( ) ;
+	 void Update( int newLevel ) ;
+	 void OnPropertiesChanged( const Gio::DBus::Proxy::MapChangedProperties &changedProperties,
+	                           const std::vector<Glib::ustring> &invalidated ) ;
+	 bool OnUevent( Glib::IOCondition condition ) ;
+	 bool OnPoll( ) ;
+
+	 Glib::RefPtr<Gio::DBus::Proxy> upower ;         /* UPower's battery device, if UPower is running. */
+	 int capacityFd ;                                /* The battery's open capacity attribute, or -1. */
+	 int ueventFd ;                                  /* Netlink socket receiving kernel uevents, or -1. */
+	 sigc::connection ueventWatch ;                  /* Watches ueventFd. */
+	 sigc::connection pollTimeout ;                  /* Rereads the capacity attribute every BATTERY_POLL_SECONDS. */
+	 sigc::slot<void, int> changed ;                 /* Called with each new level. */
+	 int level ;                                     /* The last known charge level, in percent. */
+
+} ;
 
-int getBatteryState(void);
+#endif
@@ -0,0 +1,118 @@
+/***********frames.cpp**************************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The get_frame() and next_frame() functions are defined in this module.
+            Neither function allocates memory, so they may be used on every frame.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <string.h>
+#include "frames.h"
+
+/*----------get_frame----------------------------------------------------------------
+
+  PURPOSE:  Function to collect sensor data from a binary sensor frame, such as one
+            read in place from the shared memory ring written by i2c_transfer.
+            A hand whose glove is not worn is left undefined, so that it is not
+            matched against the gestures that use it.
+
+  INPUT PARAMETERS: nextHand     -- The next pair of hands to read in.
+                    frame        -- The frame to read.
+                    sensorStatus -- An indicator of the sensor status.
+                    xmlVersion   -- The XML version.
+                    convert      -- Used to track whether gesture conversion should be performed.
+
+  RETURN VALUE:  true if the frame is valid and was read successfully
+                 false otherwise.
+    
+-----------------------------------------------------------------------------------*/
+
+bool get_frame( Hand nextHand[NUM_HANDS], const struct sensor_frame* frame, string &sensorStatus, string &xmlVersion,
+                string &convert ){
+
+    unsigned int i ;                                                          /* An iterator. */
+    unsigned int j ;                                                          /* An iterator. */
+
+    if( (frame == NULL) || !frame_valid(frame) )
+        return false ;
+    for( i = 0 ; i < NUM_HANDS ; i++ ){
+        if( (frame->flags & ((i == FRAME_LEFT) ? FRAME_LEFT_PRESENT : FRAME_RIGHT_PRESENT)) == 0 ){
+            nextHand[i] = Hand() ;
+            continue ;
+        }
+        const struct frame_hand &hand = frame->hands[i] ;   /* The next hand. Left first, then right. */
+        uint16_t c = hand.contact ;                          /* The contact sensors. */
+        Lsm303 nextLsm303[NUM_LSM303] ;                      /* The next set of LSM303 accelerometer values. */
+	Lsm9dof nextLsm9dof[NUM_LSM9DOF] ;                   /* The next set of LSM9DOF accelerometer values. */
+        for( j = 0 ; j < NUM_LSM303 ; j++ ){
+            const int16_t* v = hand.lsm303[j] ;
+            nextLsm303[j] = Lsm303( v[0], v[1], v[2], v[3], v[4], v[5], (LsmSide)j ) ;
+        }
+        for( j = 0 ; j < NUM_LSM9DOF ; j++ ){
+            const int16_t* v = hand.lsm9dof[j] ;
+            nextLsm9dof[j] = Lsm9dof( v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[8], (LsmSide)j ) ;
+        }
+        /* Store the next hand set of data. */
+        nextHand[i].Set( Finger(hand.flex[0], (c >> FRAME_TH_CON_T) & 1, false), 
+                         Finger(hand.flex[1], (c >> FRAME_IN_CON_T) & 1, (c >> FRAME_IN_CON_M) & 1),
+                         Finger(hand.flex[2], (c >> FRAME_MI_CON_T) & 1, (c >> FRAME_MI_CON_M) & 1),
+                         Finger(hand.flex[3], (c >> FRAME_RI_CON_T) & 1, (c >> FRAME_RI_CON_M) & 1),
+                         Finger(hand.flex[4], (c >> FRAME_PI_CON_T) & 1, (c >> FRAME_PI_CON_M) & 1),
+                         Fold((c >> FRAME_TI_CON_T) & 1), Fold((c >> FRAME_IM_CON_T) & 1), 
+                         Fold((c >> FRAME_MR_CON_T) & 1), Fold((c >> FRAME_RP_CON_T) & 1),
+                         nextLsm303[0], nextLsm303[1], nextLsm9dof[0], nextLsm9dof[1] ) ;         
+    }
+    sensorStatus = (frame->flags & FRAME_CONNECTED) ? "connected" : "disconnected" ;
+    /* Frames never request a conversion. */
+    convert = "false" ;
+    xmlVersion = "1.0" ;
+
+    return true ;
+
+}
+
+/*----------next_frame---------------------------------------------------------------
+
+  PURPOSE:  Function to find the next valid sensor frame within a stream of bytes,
+            such as a frame capture file. Damaged or partial frames are skipped by
+            searching for the next frame header.
+
+  INPUT PARAMETERS: buffer -- The bytes read so far.
+                    len    -- The number of bytes in the buffer.
+                    pos    -- The position to start searching from. Updated to the
+                              byte following the frame, or to the start of an
+                              incomplete frame at the end of the buffer.
+                    frame  -- The frame that was found.
+
+  RETURN VALUE:  true if a valid frame was found
+                 false if more bytes are needed.
+    
+-----------------------------------------------------------------------------------*/
+
+bool next_frame( const char* buffer, size_t len, size_t &pos, struct sensor_frame &frame ){
+
+    uint32_t magic ;  /* The next four bytes, compared against the frame header. */
+
+    while( (pos + sizeof(struct sensor_frame)) <= len ){
+        memcpy( &magic, buffer + pos, sizeof(magic) ) ;
+        if( magic == FRAME_MAGIC ){
+            /* Copy the frame out, since the buffer may not be aligned. */
+            memcpy( &frame, buffer + pos, sizeof(struct sensor_frame) ) ;
+            if( frame_valid(&frame) ){
+                pos += sizeof(struct sensor_frame) ;
+                return true ;
+            }
+        }
+        pos++ ;
+    }
+
+    return false ;
+
+}
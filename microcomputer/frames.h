@@ -0,0 +1,33 @@
+/***********frames.h****************************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file supplies the function prototypes for the functions
+            exported from the module frames.cpp, which convert the binary sensor
+            frames written by i2c_transfer into hands. Parser.h includes this file.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef FRAMES_H
+#define FRAMES_H
+
+#include <string>
+#include <stddef.h>
+#include "Hand.h"
+#include "../microcontroller/sensor_frame.h"
+
+#define NUM_HANDS        2  /* Number of hands. */
+
+using namespace std ;
+
+bool get_frame( Hand nextHand[NUM_HANDS], const struct sensor_frame* frame, string &sensorStatus, string &xmlVersion,
+                string &convert ) ;
+bool next_frame( const char* buffer, size_t len, size_t &pos, struct sensor_frame &frame ) ;
+
+#endif
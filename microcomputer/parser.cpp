@@ -15,6 +15,7 @@
 #include "parser.h"
 
 volatile sig_atomic_t kbFlag = 0 ; // Keyboard interrupt flag.
+static StatusRenderer statusRenderer ; // Draws the screen text from its own thread.
 
 /*----------main---------------------------------------------------------------------
 
@@ -74,6 +75,8 @@ bool init( ScreenText &scrText ){
 	noecho() ;
         /* Set any attempt to read from standard input to be non-blocking. */
         nodelay( stdscr, true ) ;
+        /* From here on only the status renderer draws on the screen. */
+        statusRenderer.Start( STATUS_MAX_HZ ) ;
         /* Initialize the text to display on the screen. */
 	scrText.SetStatus( "\n" ) ;
 	scrText.SetGestureData( "\n" ) ;
@@ -88,7 +91,8 @@ bool init( ScreenText &scrText ){
 
 /*----------load_gesture_database-----------------------------------------------------
 
-  PURPOSE:  Function to connect to the sign language gesture database.
+  PURPOSE:  Function to connect to the sign language gesture database and load the
+            gestures into memory so that the database is not queried for every frame.
 
   INPUT PARAMETERS: driver -- The name of the database to connect to.
                     db     -- The connection to the database.
@@ -96,6 +100,7 @@ bool init( ScreenText &scrText ){
                     un     -- The database username.
                     pw     -- The database password.
                     dbName -- The database name to use.
+                    index  -- The in-memory copy of the gesture database.
 
   RETURN VALUE:  true if a connection was successfully established to the database
                  false otherwise.
@@ -103,7 +108,27 @@ bool init( ScreenText &scrText ){
 -----------------------------------------------------------------------------------*/
 
 bool load_gesture_database( Driver* driver, Connection* &db, const char* dbURL, const char* un, const char* pw, const char* dbName, 
-                            ScreenText &scrText ){
+                            GestureIndex &index, ScreenText &scrText ){
+
+    const char* flexCols[INDEX_NUM_FLEX] = { "in_flex", "mi_flex", "ri_flex", "pi_flex" } ;       /* Flex sensor columns. */
+    const char* contactCols[INDEX_NUM_CONTACTS] = { "th_con_t", "in_con_t", "in_con_m",            /* Contact sensor columns. */
+                                                    "mi_con_t", "mi_con_m", "ri_con_t", "ri_con_m",
+                                                    "pi_con_t", "pi_con_m", "ti_con_t", "im_con_t",
+                                                    "mr_con_t", "rp_con_t" } ;
+    const char* lsm303Cols[INDEX_LSM303_VALS] = { "accel_303_%u_x", "accel_303_%u_y", "accel_303_%u_z", /* LSM303 columns. */
+                                                  "mag_303_%u_x", "mag_303_%u_y", "mag_303_%u_z" } ;
+    const char* lsm9dofCols[INDEX_LSM9DOF_VALS] = { "accel_9dof_%u_x", "accel_9dof_%u_y", "accel_9dof_%u_z", /* LSM9DOF columns. */
+                                                    "mag_9dof_%u_x", "mag_9dof_%u_y", "mag_9dof_%u_z",
+                                                    "gyro_9dof_%u_x", "gyro_9dof_%u_y", "gyro_9dof_%u_z" } ;
+    double flex[INDEX_NUM_FLEX] ;                                   /* The next set of flex sensor values. */
+    bool contact[INDEX_NUM_CONTACTS] ;                              /* The next set of contact sensor values. */
+    double lsm303[INDEX_NUM_LSM303][INDEX_LSM303_VALS] ;            /* The next set of LSM303 values. */
+    double lsm9dof[INDEX_NUM_LSM9DOF][INDEX_LSM9DOF_VALS] ;         /* The next set of LSM9DOF values. */
+    char col[MAX_COL_NAME] ;                                        /* The name of the next column. */
+    unsigned int i ;                                                /* An iterator. */
+    unsigned int j ;                                                /* An iterator. */
+    Statement* st = NULL ;                                          /* SQL statement. */
+    ResultSet* rSet = NULL ;                                        /* The result set returned by the SQL query. */
 
     try{
         /* Connect to the SQL database and supply credentials. Turn off autocommit. */
@@ -112,154 +137,38 @@ bool load_gesture_database( Driver* driver, Connection* &db, const char* dbURL,
         db->setAutoCommit( 0 ) ;
         /* Choose the database to use. */
         db->setSchema( dbName ) ;
+        /* Read in every gesture once. */
+        index.Clear() ;
+        st = db->createStatement() ;
+        rSet = st->executeQuery( "SELECT * FROM gesture_tbl ORDER BY gest ASC;" ) ;
+        while( rSet->next() ){
+            for( i = 0 ; i < INDEX_NUM_FLEX ; i++ ){
+                flex[i] = (double)rSet->getDouble( flexCols[i] ) ;
+            }
+            for( i = 0 ; i < INDEX_NUM_CONTACTS ; i++ ){
+                contact[i] = rSet->getBoolean( contactCols[i] ) ;
+            }
+            for( i = 0 ; i < INDEX_NUM_LSM303 ; i++ ){
+                for( j = 0 ; j < INDEX_LSM303_VALS ; j++ ){
+                    snprintf( col, MAX_COL_NAME, lsm303Cols[j], i ) ;
+                    lsm303[i][j] = (double)rSet->getDouble( col ) ;
+                }
+            }
+            for( i = 0 ; i < INDEX_NUM_LSM9DOF ; i++ ){
+                for( j = 0 ; j < INDEX_LSM9DOF_VALS ; j++ ){
+                    snprintf( col, MAX_COL_NAME, lsm9dofCols[j], i ) ;
+                    lsm9dof[i][j] = (double)rSet->getDouble( col ) ;
+                }
+            }
+            index.Add( string(rSet->getString("hand")) == "right", flex, contact, lsm303, lsm9dof, string(rSet->getString("gest")) ) ;
+        }
+        index.Build() ;
     } catch( SQLException &e ){
         /* Database connection error. */
         print_error( e, scrText ) ;
-	output_to_display( scrText, true ) ;
-	return false ;
-    }
-    return true ;
-
-}
-
-/*----------gesture_to_text----------------------------------------------------------
-
-  PURPOSE:  Function to attempt to match the current gesture to the gesture database.
-            If a match is found, the gesture is converted into text.
-            Special cases: 2/V  -- Try differentiating with V angled forward and
-                                   2 angled straight up. Thus, different
-                                   accelerometer values should be present for these.
-                           6/W  -- Try differentiating based on context. Some people
-                                   tap the pinky and thumb together a few times to
-                                   distinguish 6 from W. Thus multiple W's in 
-                                   succession could be an indication of a 6.
-                           9/F  -- Try differentiating based on context. Some people
-                                   tap the index and thumb together a few times to
-                                   distinguish 9 from F. Thus multiple F's in 
-                                   succession could be an indication of a 9.
-
-  INPUT PARAMETERS: nextGesture -- The next set of gesture data to read in.
-                                   An instance of class Gesture.
-                    db          -- The connection to the database.
-                    text        -- The gesture converted to text
-                    scrText     -- The collection of text to display on the screen.
-
-  RETURN VALUE:  true if the gesture was successfully converted to text
-                 false otherwise.
-
------------------------------------------------------------------------------------*/
-
-bool gesture_to_text( Gesture &nextGesture, Connection* db, string &text, ScreenText &scrText, bool motion, bool &added_text ){
-
-    ResultSet* rSet ;                       /* The result set returned by the SQL query. */
-    Statement* st   ;                       /* SQL statement. */
-    string query ;                          /* SQL query. */
-    ostringstream buffer ;                  /* Buffer used to convert numerical values to strings. */
-
-    added_text = false ;
-    try{
-        /* Query database for closest matching gesture */
-        st = db->createStatement() ; 
-        /* Construct the query. Assume only that the right hand is used for now. */
-        buffer << "SELECT gest FROM gesture_tbl WHERE hand = \"right\"" ;
-        add_to_query( query, buffer, " AND in_flex = " ) ;
-        buffer << nextGesture.Right().Index().Flex() ;
-        add_to_query( query, buffer, " AND mi_flex = " ) ;
-        buffer << nextGesture.Right().Middle().Flex() ;
-        add_to_query( query, buffer, " AND ri_flex = " ) ;
-        buffer << nextGesture.Right().Ring().Flex() ;
-        add_to_query( query, buffer, " AND pi_flex = " ) ;
-        buffer << nextGesture.Right().Pinky().Flex() ;
-        add_to_query( query, buffer, " AND th_con_t = " ) ;
-        buffer << nextGesture.Right().Thumb().ContactTip() ;
-        add_to_query( query, buffer, " AND in_con_t = " ) ;
-        buffer << nextGesture.Right().Index().ContactTip() ;
-        add_to_query( query, buffer, " AND mi_con_t = " ) ;
-        buffer << nextGesture.Right().Middle().ContactTip() ;
-        add_to_query( query, buffer, " AND ri_con_t = " ) ;
-        buffer << nextGesture.Right().Ring().ContactTip() ;
-        add_to_query( query, buffer, " AND pi_con_t = " ) ;
-        buffer << nextGesture.Right().Pinky().ContactTip() ;
-        add_to_query( query, buffer, " AND ti_con_t = " ) ;
-        buffer << nextGesture.Right().TiFold().ContactTip() ;
-        add_to_query( query, buffer, " AND im_con_t = " ) ;
-        buffer << nextGesture.Right().ImFold().ContactTip() ;
-        add_to_query( query, buffer, " AND mr_con_t = " ) ;
-        buffer << nextGesture.Right().MrFold().ContactTip() ;
-        add_to_query( query, buffer, " AND rp_con_t = " ) ;
-        buffer << nextGesture.Right().RpFold().ContactTip() ;
-	add_to_query( query, buffer, " AND in_con_m = " ) ;
-        buffer << nextGesture.Right().Index().ContactMid() ;
-        add_to_query( query, buffer, " AND mi_con_m = " ) ;
-        buffer << nextGesture.Right().Middle().ContactMid() ;
-        add_to_query( query, buffer, " AND ri_con_m = " ) ;
-        buffer << nextGesture.Right().Ring().ContactMid() ;
-        add_to_query( query, buffer, " AND pi_con_m = " ) ;
-        buffer << nextGesture.Right().Pinky().ContactMid() ;
-	add_to_query( query, buffer, "" ) ;
-	if( motion ){
-	   /* Gesture involves motion, include accelerometer values in query. */
-  	   unsigned int i ; /* An iterator. */
-           ostringstream accel_num ;
-           for( i = 0 ; i < NUM_LSM303 ; i ++ ) {
-	       accel_num.str( "" ) ;              
-               accel_num.clear() ;
-	       accel_num << i ;
-               add_to_query( query, buffer, " AND ABS(accel_303_" + accel_num.str() + "_x - " ) ;
-               buffer << nextGesture.Right().Lsm303Vals(i).AccelX() << ") <= " << LSM303_TOL ;
-               add_to_query( query, buffer, " AND ABS(accel_303_" + accel_num.str() + "_y - " ) ;
-               buffer << nextGesture.Right().Lsm303Vals(i).AccelY() << ") <= " << LSM303_TOL ;
-               add_to_query( query, buffer, " AND ABS(accel_303_" + accel_num.str() + "_z - " ) ;
-               buffer << nextGesture.Right().Lsm303Vals(i).AccelZ() << ") <= " << LSM303_TOL ;
-               add_to_query( query, buffer, " AND ABS(mag_303_" + accel_num.str() + "_x - " ) ;
-               buffer << nextGesture.Right().Lsm303Vals(i).MagX() << ") <= " << LSM303_TOL ;
-               add_to_query( query, buffer, " AND ABS(mag_303_" + accel_num.str() + "_y - " ) ;
-               buffer << nextGesture.Right().Lsm303Vals(i).MagY() << ") <= " << LSM303_TOL ;
-               add_to_query( query, buffer, " AND ABS(mag_303_" + accel_num.str() + "_z - " ) ;
-               buffer << nextGesture.Right().Lsm303Vals(i).MagZ() << ") <= " << LSM303_TOL ;
-		add_to_query( query, buffer, "" ) ;
-            
-           }
-           for( i = 0 ; i < NUM_LSM9DOF ; i ++ ) {
-		accel_num.str( "" ) ;
-               accel_num.clear() ;
-	       accel_num << i ;
-               add_to_query( query, buffer, " AND ABS(accel_9dof_" + accel_num.str() + "_x - " ) ;
-               buffer << nextGesture.Right().Lsm9dofVals(i).AccelX() << ") <= " << LSM9DOF_TOL ;
-               add_to_query( query, buffer, " AND ABS(accel_9dof_" + accel_num.str() + "_y - " ) ; 
-               buffer << nextGesture.Right().Lsm9dofVals(i).AccelY() << ") <= " << LSM9DOF_TOL ;
-               add_to_query( query, buffer, " AND ABS(accel_9dof_" + accel_num.str() + "_z - " ) ;
-               buffer << nextGesture.Right().Lsm9dofVals(i).AccelZ() << ") <= " << LSM9DOF_TOL ;
-               add_to_query( query, buffer, " AND ABS(mag_9dof_" + accel_num.str() + "_x - " ) ;
-               buffer << nextGesture.Right().Lsm9dofVals(i).MagX() << ") <= " << LSM9DOF_TOL ;
-               add_to_query( query, buffer, " AND ABS(mag_9dof_" + accel_num.str() + "_y - " ) ;
-               buffer << nextGesture.Right().Lsm9dofVals(i).MagY() << ") <= " << LSM9DOF_TOL ;
-               add_to_query( query, buffer, " AND ABS(mag_9dof_" + accel_num.str() + "_z - " ) ;
-               buffer << nextGesture.Right().Lsm9dofVals(i).MagZ() << ") <= " << LSM9DOF_TOL ;
-               add_to_query( query, buffer, " AND ABS(gyro_9dof_" + accel_num.str() + "_x - " ) ;
-               buffer << nextGesture.Right().Lsm9dofVals(i).GyroX() << ") <= " << LSM9DOF_TOL ;
-               add_to_query( query, buffer, " AND ABS(gyro_9dof_" + accel_num.str() + "_y - " ) ;
-               buffer << nextGesture.Right().Lsm9dofVals(i).GyroY() << ") <= " << LSM9DOF_TOL ;
-               add_to_query( query, buffer, " AND ABS(gyro_9dof_" + accel_num.str() + "_z - " ) ;
-               buffer << nextGesture.Right().Lsm9dofVals(i).GyroZ() << ") <= " << LSM9DOF_TOL ;
-		add_to_query( query, buffer, "" ) ;                      
-           } 
-	 }
-        query += " ORDER BY gest ASC;" ;
-	/* Perform the query. */
-        rSet = st->executeQuery( query ) ;
-        if( rSet->rowsCount() > 0 ){
-            /* Assume for now that the first element is correct.
-               However, we should be refining the query in a do while loop 
-               if there are multiple matches until there is a single match. */
-   	    rSet->next() ;
-    	    text += rSet->getString( "gest" ) ;
-            added_text = true ;
-	}
-    } catch( SQLException &e ){
-        /* Database connection error. */
-        print_error( e, scrText ) ;
-        output_to_display( scrText, true ) ;
+	output_to_display( scrText ) ;
+        delete rSet ;
+        delete st ;
 	return false ;
     }
     /* Clean up results. */ 
@@ -317,29 +226,17 @@ bool text_to_speech( string text, string ttsScript, const char* tfName ){
 
 /*----------output_to_display---------------------------------------------------------
 
-  PURPOSE:  Function to output text to the display.
+  PURPOSE:  Function to output text to the display. The text is handed to the status
+            renderer, which redraws the rows that changed on its own thread at most
+            STATUS_MAX_HZ times a second, so this returns without drawing.
 
   INPUT PARAMETERS: scrText  -- The collection of text to be printed to the screen.
-                    eraseScr -- If true, erase the screen before printing.
 
 -----------------------------------------------------------------------------------*/
 
-void output_to_display( ScreenText scrText, bool eraseScr ){
-
-    string buffer = "" ; /* The buffer of screen text to display. */
+void output_to_display( const ScreenText &scrText ){
 
-    if( eraseScr ) {
-        wclear( stdscr ) ;
-    }
-    buffer = "Instructions:\t" + scrText.InstrData() ;
-    printw( buffer.c_str() ) ;
-    buffer = "Status:\t\t" + scrText.Status() ;
-    printw( buffer.c_str() ) ;
-    buffer = "Gesture:\t" + scrText.GestureConv() ;
-    printw( buffer.c_str() ) ;
-    buffer = "Gesture Data:\n\n" + scrText.GestureData() ;
-    printw( buffer.c_str() ) ;
-    refresh() ;
+    statusRenderer.Post( scrText ) ;
 
     return ;
 
@@ -359,6 +256,7 @@ void output_to_display( ScreenText scrText, bool eraseScr ){
 bool clean_up( Connection* db ){
 
     delete db ;
+    statusRenderer.Stop() ;
     delwin( stdscr ) ;
     endwin() ;
 
@@ -407,25 +305,25 @@ bool file_exists( const char* fName ){
 
 }
 
-/*----------get_gesture--------------------------------------------------------------
+/*----------parse_gesture------------------------------------------------------------
 
-  PURPOSE:  Function to collect sensor data from an XML file.
+  PURPOSE:  Function to collect sensor data from the contents of an XML file. The
+            text is parsed in place, so it must be writable and null terminated.
 
-  INPUT PARAMETERS: nextGesture  -- The next set of gesture data to read in.
-                                    An instance of class Gesture.
-                    fName        -- The name of the file to read gesture data from.
-                    scrText      -- The collection of text to display on the screen.
+  INPUT PARAMETERS: nextHand     -- The next pair of hands to read in.
+                    text         -- The contents of the XML file.
+                    doc          -- The XML document to parse into.
                     sensorStatus -- An indicator of the sensor status.
                     xmlVersion   -- The XML version.
                     convert      -- Used to track whether gesture conversion should be performed.
 
-  RETURN VALUE:  true if the file was read successfully
+  RETURN VALUE:  true if the text was read successfully
                  false otherwise.
     
 -----------------------------------------------------------------------------------*/
 
-bool get_gesture( Hand nextHand[NUM_HANDS], const char* fName, ScreenText &scrText, xml_document<> &doc,
-                  string &sensorStatus, string &xmlVersion, string &convert ){
+bool parse_gesture( Hand nextHand[NUM_HANDS], char* text, xml_document<> &doc, string &sensorStatus, string &xmlVersion,
+                    string &convert ){
 
     unsigned int i ;                                                                                     /* An iterator. */
     unsigned int j ;                                                                                     /* An iterator. */
@@ -438,9 +336,8 @@ bool get_gesture( Hand nextHand[NUM_HANDS], const char* fName, ScreenText &scrTe
                                              "gyro-x", "gyro-y", "gyro-z"} ; 
     double lsm9dofAccelVals[NUM_LSM9DOF_VALS] ;                                                          /* The next set of accelerometer values. */
 
-    /* Parse the XML file. */
-    file<> xmlFile( fName ) ;
-    doc.parse<0>( xmlFile.data() ) ;
+    /* Parse the XML text. */
+    doc.parse<0>( text ) ;
     /* Collect sensor values. Start with the gestures node. */   
     xml_node<>* gestures = doc.first_node("gestures") ;      
     if( gestures == NULL ) {
@@ -460,15 +357,11 @@ bool get_gesture( Hand nextHand[NUM_HANDS], const char* fName, ScreenText &scrTe
             return false ;
         }
         /* Initialize the hand, fingers, and inter-digital folds. */
-        nextHand[i].LsmInit() ;
         Finger nextFinger[NUM_FINGERS] ;    /* The next set of fingers to be read in. */
         Fold nextFold[NUM_FOLDS] ;          /* The next set of interdigital folds to be read in. */
 	Lsm303 nextLsm303[NUM_LSM303] ;     /* The next set of LSM303 accelerometer values to be read in. */
 	Lsm9dof nextLsm9dof[NUM_LSM9DOF] ;  /* The next set of LSM9DOF accelerometer values to be read in. */
         /* Read the next hand node. */
-        xml_attribute<> *handSide = hand->first_attribute("side") ;
-        scrText.SetStatus( "Reading " + string(handSide->value()) + " hand\n" ) ;
-	output_to_display( scrText, true ) ;
         for( j = 0 ; j < NUM_FINGERS ; j++ ){
 	    /* Get the finger node. */ 
             xml_node<>* nextNode = hand->first_node( fingerName[j].c_str() ) ;  
@@ -527,7 +420,7 @@ bool get_gesture( Hand nextHand[NUM_HANDS], const char* fName, ScreenText &scrTe
                 lsm303AccelVals[k] = (double)atof( nextNode->value() ) ;
 	    }
             xml_attribute<>* lsm303Attr = lsm303->first_attribute("side") ;
-  	    string lsm303Side = string( lsm303Attr->value() ) ;
+  	    LsmSide lsm303Side = lsm_side( (lsm303Attr != NULL) ? lsm303Attr->value() : NULL, (LsmSide)j ) ;
   	    nextLsm303[j] = Lsm303( lsm303AccelVals[0], lsm303AccelVals[1], lsm303AccelVals[2],
                                     lsm303AccelVals[3], lsm303AccelVals[4], lsm303AccelVals[5], lsm303Side ) ;
 	}
@@ -547,7 +440,7 @@ bool get_gesture( Hand nextHand[NUM_HANDS], const char* fName, ScreenText &scrTe
                 lsm9dofAccelVals[k] = (double)atof( nextNode->value() ) ;
 	    }
 	    xml_attribute<>* lsm9dofAttr = lsm9dof->first_attribute("side") ;
-            string lsm9dofSide = string( lsm9dofAttr->value() ) ;
+            LsmSide lsm9dofSide = lsm_side( (lsm9dofAttr != NULL) ? lsm9dofAttr->value() : NULL, (LsmSide)j ) ;
             nextLsm9dof[j] = Lsm9dof( lsm9dofAccelVals[0], lsm9dofAccelVals[1], lsm9dofAccelVals[2],
                                       lsm9dofAccelVals[3], lsm9dofAccelVals[4], lsm9dofAccelVals[5],
                                       lsm9dofAccelVals[6], lsm9dofAccelVals[7], lsm9dofAccelVals[8], lsm9dofSide ) ;
@@ -578,295 +471,3 @@ bool get_gesture( Hand nextHand[NUM_HANDS], const char* fName, ScreenText &scrTe
 
 }
 
-/*----------output_xml---------------------------------------------------------------
-
-  PURPOSE:  Function to output updated XML file contents.
-
-  INPUT PARAMETERS: outfName     -- The new name of the XML file.
-                    text         -- The gesture converted to text.
-                    nextGesture  -- The current set of gesture data.
-                    sensorStatus -- An indicator of the sensor status.
-                    xmlVersion   -- The XML version.
-
-  RETURN VALUE:  true if the file was written successfully
-                 false otherwise.
-    
------------------------------------------------------------------------------------*/
-
-bool output_xml( const char* outfName, string &text, Gesture &nextGesture, string &sensorStatus, string &xmlVersion ){
-
-    int i ;                                                                                              /* An iterator. */
-    int j ;                                                                                              /* An iterator. */
-    int k ;                                                                                              /* An iterator. */
-    ofstream outputFile ;                                                                                /* File to write to. */
-    string handName[NUM_HANDS] = {"left", "right"} ;                                                     /* Hand names. */
-    string fingerName[NUM_FINGERS] = {"thumb", "index", "middle", "ring", "pinky"} ;                     /* Finger names. */
-    string foldName[NUM_FOLDS] = {"thumb-index", "index-middle", "middle-ring", "ring-pinky"} ;          /* Interdigital fold names. */
-    string lsm303Names[NUM_LSM303_VALS] = {"accel-x", "accel-y", "accel-z", "mag-x", "mag-y", "mag-z"} ; /* LSM303 value names. */
-    string lsm9dofNames[NUM_LSM9DOF_VALS] = {"accel-x", "accel-y", "accel-z", "mag-x", "mag-y", "mag-z", /* LSM9DOF value names. */
-                                             "gyro-x", "gyro-y", "gyro-z"} ; 
-
-    /* Open the file and output the header information. */
-    outputFile.open( outfName ) ;
-    outputFile << "<?xml version=\"1.0\" encoding=\"utf-8\" standalone=\"no\"?>\n" ;
-    outputFile << "<?xml-stylesheet type=\"text/xsl\" href=\"gesture_data.xsl\"?>\n" ;
-    outputFile << "<!DOCTYPE gestures SYSTEM \"gesture_data.dtd\">\n" ;
-    /* Start with the gestures node. */   
-    outputFile << "<gestures>\n" ;
-    /* Proceed to the gesture node. */
-    outputFile << "\t<gesture>\n" ;
-    if( !nextGesture.Defined() ){
-        /* No gesture data. Simply close out the XML file and return. */
-        outputFile << "\t</gesture>\n" ;
-        outputFile << "</gestures>\n" ;
-	return true ;
-    }
-    for( i = 0 ; i < NUM_HANDS ; i++ ){
-        /* Get the next hand .*/
-        Hand nextHand ;
-        if( handName[i].compare("left") == 0 ){
-            nextHand = nextGesture.Left() ;
-        }
-        else if( handName[i].compare("right") == 0 ){
-            nextHand = nextGesture.Right() ;
-        }
-	else{
-  	    return false ;
-	}
-        outputFile << "\t\t<hand side=\"" << handName[i] << "\">\n" ;
-        if( !nextHand.Defined() ){
-            /* No hand data. Simply close out the hand and proceed. */
-            outputFile << "\t\t</hand>\n" ;
-            continue ;
-        }
-        for( j = 0 ; j < NUM_FINGERS ; j++ ){
-            /* Get the next finger.*/
-            Finger nextFinger ;
-            if( fingerName[j].compare("thumb") == 0 ){
-      	        nextFinger = nextHand.Thumb() ;
-	    }
-	    else if( fingerName[j].compare("index") == 0 ){
-  	        nextFinger = nextHand.Index() ;
-	    }
-	    else if( fingerName[j].compare("middle") == 0 ){
-  	        nextFinger = nextHand.Middle() ;
-	    }
-	    else if( fingerName[j].compare("ring") == 0 ){
-  	        nextFinger = nextHand.Ring() ;
-	    }
-	    else if( fingerName[j].compare("pinky") == 0 ){
-  	        nextFinger = nextHand.Pinky() ;
-	    }
-	    else{
-	        return false ;
-	    }
-            outputFile << "\t\t\t<" << fingerName[j] << ">\n" ;
-            if( !nextFinger.Defined() ){
-                /* No finger data. Simply close out the finger and proceed. */
-                outputFile << "\t\t\t</" << fingerName[j] << ">\n" ;
-		continue ;
-	    }
-	    /* Get the flex sensor node. */ 
-            outputFile << "\t\t\t\t<flex>" << nextFinger.Flex() << "</flex>\n" ;
-	    /* Get the contact sensor node. Convert 0 and 1 to boolean values. */ 
-            outputFile << "\t\t\t\t<contact-tip>" ;
-            if( nextFinger.ContactTip() == 0 ){
-	        outputFile << "false" ;
-	    }
-	    else{
-	        outputFile << "true" ;
-	    } 
-            outputFile << "</contact-tip>\n" ;
-	    if( fingerName[j].compare("thumb") != 0 ){
-                /* Currently the thumb only has a tip contact sensor. Convert 0 and 1 to boolean values. */
-	        outputFile << "\t\t\t\t<contact-mid>" ;
-  	        if( nextFinger.ContactMid() == 0 ){
-  	            outputFile << "false" ;
-	        }
-	        else{
-  	            outputFile << "true" ;
-	        }
-                outputFile << "</contact-mid>\n" ;
-	    }
-            outputFile << "\t\t\t</" << fingerName[j] << ">\n" ;
-        }
-        for( j = 0 ; j < NUM_FOLDS ; j++ ){
-	    /* Get the next interdigital fold node. */
-            Fold nextFold ;
-            if( foldName[j].compare("thumb-index") == 0 ){
-      	        nextFold = nextHand.TiFold() ;
-	    }
-            else if( foldName[j].compare("index-middle") == 0 ){
-      	        nextFold = nextHand.ImFold() ;
-	    }
-            else if( foldName[j].compare("middle-ring") == 0 ){
-      	        nextFold = nextHand.MrFold() ;
-	    }
-            else if( foldName[j].compare("ring-pinky") == 0 ){
-      	        nextFold = nextHand.RpFold() ;
-	    }
-            else {
-  	        return false ;
-	    }
-            outputFile << "\t\t\t<" << foldName[j] << ">\n" ;
-            if( !nextFold.Defined() ){
-                /* No interdigital fold data. Simply close out the fold and proceed. */
-                outputFile << "\t\t\t</" << foldName[j] << ">\n" ;
-  	        continue ;
-	    }
-            /* Get the next contact sensor node. Convert 0 and 1 to boolean values. */
-            outputFile << "\t\t\t\t<contact-tip>" ;
-            if( nextFold.ContactTip() == 0 ){
-  	        outputFile << "false" ;
-	    } 
-	    else{
-  	        outputFile << "true" ;
-	    }
-            outputFile << "</contact-tip>\n" ;
-            outputFile << "\t\t\t</" << foldName[j] << ">\n" ;
-	}        
-	/* Get the LSM303 accelerometer values. */
-        for( j = 0 ; j < NUM_LSM303 ; j++ ){
-            outputFile << "\t\t\t<lsm303 side=\"" << nextHand.Lsm303Vals(j).Side() << "\">\n" ;
-            if( nextHand.Lsm303Vals(j).Defined() ){
-                for( k = 0 ; k < NUM_LSM303_VALS ; k++ ){
-                    outputFile << "\t\t\t\t<" << lsm303Names[k] << ">" ;
-                    if( lsm303Names[k].compare("accel-x") == 0 ){
-                        outputFile << nextHand.Lsm303Vals(j).AccelX() ; 
-		    }
-		    else if( lsm303Names[k].compare("accel-y") == 0 ){
-		        outputFile << nextHand.Lsm303Vals(j).AccelY() ; 
-		    }
-		    else if( lsm303Names[k].compare("accel-z") == 0 ){
-		        outputFile << nextHand.Lsm303Vals(j).AccelZ() ; 
-		    }   
-		    else if( lsm303Names[k].compare("mag-x") == 0 ){
-		        outputFile << nextHand.Lsm303Vals(j).MagX() ; 
-		    } 
-		    else if( lsm303Names[k].compare("mag-y") == 0 ){
-		        outputFile << nextHand.Lsm303Vals(j).MagY() ; 
-		    } 
-		    else if( lsm303Names[k].compare("mag-z") == 0 ){
-		       outputFile << nextHand.Lsm303Vals(j).MagZ() ; 
-		    } 
-		    else{
-		        return false ;
-		    }
-       	            outputFile << "</" << lsm303Names[k] << ">\n" ;
-		}
- 	    }
-            outputFile << "\t\t\t</lsm303>\n" ;
-	}
-	/* Get the LSM9DOF accelerometer values. */
-        for( j = 0 ; j < NUM_LSM9DOF ; j++ ){
-            outputFile << "\t\t\t<lsm9dof side=\"" << nextHand.Lsm9dofVals(j).Side() << "\">\n" ;
-            if( nextHand.Lsm9dofVals(j).Defined() ){
-                for( k = 0 ; k < NUM_LSM9DOF_VALS ; k++ ){
-      	            outputFile << "\t\t\t\t<" << lsm9dofNames[k] << ">" ;
-                    if( lsm9dofNames[k].compare("accel-x") == 0 ){
-  		        outputFile << nextHand.Lsm9dofVals(j).AccelX() ; 
-		    }
-		    else if( lsm9dofNames[k].compare("accel-y") == 0 ){
-		        outputFile << nextHand.Lsm9dofVals(j).AccelY() ; 
-		    }
-		    else if( lsm9dofNames[k].compare("accel-z") == 0 ){
-		        outputFile << nextHand.Lsm9dofVals(j).AccelZ() ; 
-		    } 
-		    else if( lsm9dofNames[k].compare("mag-x") == 0 ){
-		        outputFile << nextHand.Lsm9dofVals(j).MagX() ; 
-		    } 
-		    else if( lsm9dofNames[k].compare("mag-y") == 0 ){
-		        outputFile << nextHand.Lsm9dofVals(j).MagY() ; 
-		    } 
-		    else if( lsm9dofNames[k].compare("mag-z") == 0 ){
-		        outputFile << nextHand.Lsm9dofVals(j).MagZ() ; 
-		    } 
-		    else if( lsm9dofNames[k].compare("gyro-x") == 0 ){
-		        outputFile << nextHand.Lsm9dofVals(j).GyroX() ; 
-		    } 
-		    else if( lsm9dofNames[k].compare("gyro-y") == 0 ){
-		        outputFile << nextHand.Lsm9dofVals(j).GyroY() ; 
-		    } 
-		    else if( lsm9dofNames[k].compare("gyro-z") == 0 ){
-		        outputFile << nextHand.Lsm9dofVals(j).GyroZ() ; 
-		    } 
-		    else{
-		        return false ;
-		    }
-       	            outputFile << "</" << lsm9dofNames[k] << ">\n" ;
-		}
- 	    }
-            outputFile << "\t\t\t</lsm9dof>\n" ;
-	}
-        outputFile << "\t\t</hand>\n" ;
-    }
-    outputFile << "\t</gesture>\n" ;
-    /* Output the converted text. */
-    outputFile << "\t\t<converted-text>" << text << "</converted-text>\n" ;
-    /* Get the sensor status. */
-    outputFile << "\t<status>" << sensorStatus << "</status>\n" ;
-    /* After each read, the conversion status should always be set to false. */
-    outputFile << "\t<convert>false</convert>\n" ;
-    /* Get the XML version. */
-    outputFile << "\t<version>" << xmlVersion << "</version>\n" ;
-    outputFile << "</gestures>\n" ;
-    outputFile.close() ;
-
-    return true ;
-
-}
-
-void add_to_query( string &query, ostringstream &buffer, string stmt ){
-    /* Function to add to query to be sent to SQL database. */
-
-    /* Add in current buffer. */
-    query += buffer.str() ;   
-    /* Prepare next statement. */ 
-    query += stmt ;
-    /* Clear buffer. */
-    buffer.str( "" ) ;
-    buffer.clear() ;
-
-    return ;
-
-}
-
-bool motion_gesture( string &text, const string partial_motion[], const string invalid_motion, 
-                     const string completed_motion, const unsigned int num_motion, const string motion_text ){
-    /* Function to add to replace any completed motions with the appropriate gesture or determine if there is an intermediate gesture
-       was detected, in which case the accelerometers should be used when performing the next match. */
-
-    unsigned int i ;                                                 /* An iterator. */
-    int start ;                                             /* Used to track position of intermediate motions within a gesture, such as J and Z. */
-    bool motion = false ;                                            /* An indicator if the current gesture involves motion. */
-
-    /* Replace any completed motions with the appropriate gesture. */
-    if( text.find(completed_motion) != std::string::npos ){
-        text.resize( text.size() - completed_motion.size() ) ;
-        text += motion_text ;
-    }
-    start = text.find( invalid_motion ) ;
-    if( start != -1 ){
-        /* Invalid motion detected. */
-        text.erase( start, invalid_motion.length() ) ;
-	return motion ;
-    }
-    /* Determine if current gesture involves motion */
-    for( i = 0 ; i < num_motion ; i++ ){
-        start = text.find( partial_motion[i] ) ;
-        if( start != -1 ){
-            /* Check that itermediate motion falls in a valid position and thus was recently detected. */
-            if( (text.length() - start) == (2 * (num_motion - i)) ){
-                motion = true ; 
-		break ;
-	    }
-            else{
-                /* Clear out part of the incomplete motion. */
-  	        text.erase( start, partial_motion[i].length() ) ;
-    	    }
-        }
-    }
-
-    return motion ;
-
-}
@@ -0,0 +1,247 @@
+/***********recognize.cpp***********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The gesture_to_text(), gesture_to_segment(), and classify_sample()
+            functions are defined in this module.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <math.h>
+#include "recognize.h"
+
+static const GestureForest forest ;  /* The decision forest compiled into the program. */
+
+/*----------gesture_to_text----------------------------------------------------------
+
+  PURPOSE:  Function to attempt to match the current gesture to the gesture database.
+            If a match is found, the gesture is converted into text. Both hands are
+            matched together, so two-handed signs are found as well as signs made
+            with either hand; a hand that is not present only matches signs that
+            do not use it. A pose that matches no gesture exactly, as a pose held
+            a step away from its capture does, is classified by the decision
+            forest, and converted if at least FOREST_MIN_CONFIDENCE of its trees
+            agree. A pose more than FOREST_MAX_DISTANCE from every gesture, as
+            the hand passes between letters, is not classified.
+            Special cases: 2/V  -- Try differentiating with V angled forward and
+                                   2 angled straight up. Thus, different
+                                   accelerometer values should be present for these.
+                           6/W  -- Try differentiating based on context. Some people
+                                   tap the pinky and thumb together a few times to
+                                   distinguish 6 from W. Thus multiple W's in 
+                                   succession could be an indication of a 6.
+                           9/F  -- Try differentiating based on context. Some people
+                                   tap the index and thumb together a few times to
+                                   distinguish 9 from F. Thus multiple F's in 
+                                   succession could be an indication of a 9.
+
+  INPUT PARAMETERS: nextGesture -- The next set of gesture data to read in.
+                                   An instance of class Gesture.
+                    index       -- The in-memory copy of the gesture database.
+                    motionRec   -- The motion recognizer. Keyframes of letters that
+                                   involve motion, such as J1, are not converted
+                                   to text, as the recognizer handles them.
+                    text        -- The gesture converted to text
+                    added_text  -- Set to true if text was added.
+
+  RETURN VALUE:  true if the gesture matched a gesture or was classified by the
+                 forest, including a keyframe that adds no text, false if neither
+                 found a label for it.
+
+-----------------------------------------------------------------------------------*/
+
+bool gesture_to_text( const Gesture &nextGesture, const GestureIndex &index, const MotionRecognizer &motionRec, string &text,
+                      bool &added_text ){
+
+    string gest ;                           /* The text of the matching gesture. */
+    GestureMatch near ;                     /* The closest gesture, when no gesture matches. */
+    ForestResult result ;                   /* The class the decision forest found. */
+    bool found = false ;                    /* True if a label was found for the gesture. */
+
+    added_text = false ;
+    /* A two-handed sign is preferred over a sign made with one of its hands. Otherwise, if
+       there are multiple matches, the first one in text order is used, as was the case
+       when querying the database. */
+    if( index.Match(nextGesture, false, LSM303_TOL, LSM9DOF_TOL, gest) ){
+        found = true ;
+    }
+    else if( index.Nearest(nextGesture, near) && (near.distance <= FOREST_MAX_DISTANCE) &&
+             forest.Classify(nextGesture, result) && (result.confidence >= FOREST_MIN_CONFIDENCE) ){
+        gest = forest.Text( result.label ) ;
+        found = true ;
+    }
+    if( found && !motionRec.IsKeyframe(gest) ){
+        text += gest ;
+        added_text = true ;
+    }
+
+    return found ;
+
+}
+
+/*----------orientation_distance-----------------------------------------------------
+
+  PURPOSE:  Function to find how far the fused orientation of the hands is from the
+            orientation a gesture was recorded in. For each accelerometer of each
+            hand the gesture uses, the squared difference between the fused
+            direction of gravity and the recorded accelerometer reading, scaled to
+            1 g, is added. Hands without a fused orientation, and accelerometers
+            that read nothing when recorded, add nothing.
+
+  INPUT PARAMETERS: nextGesture -- The current gesture.
+                    entry       -- The recorded gesture.
+
+  RETURN VALUE:  The distance, from 0 up to 4 for each accelerometer.
+
+-----------------------------------------------------------------------------------*/
+
+static float orientation_distance( const Gesture &nextGesture, const GestureEntry &entry ){
+
+    const double* a ;          /* The recorded accelerometer reading. */
+    float distance = 0.0f ;    /* The summed squared differences. */
+    float diff ;               /* Difference along an axis. */
+    double len ;               /* Length of the recorded reading. */
+    unsigned int side ;        /* An iterator over the hands. */
+    unsigned int k ;           /* An iterator over the accelerometers. */
+    unsigned int d ;           /* An iterator over the axes. */
+
+    for( side = 0 ; side < INDEX_HANDS ; side++ ){
+        const Hand &hand = (side == INDEX_LEFT) ? nextGesture.Left() : nextGesture.Right() ;
+        if( ((entry.hands & (1 << side)) == 0) || !hand.Defined() || !hand.Orientation().defined )
+            continue ;
+        const HandOrientation &o = hand.Orientation() ;
+        for( k = 0 ; k < FUSION_IMUS ; k++ ){
+            a = (k < INDEX_NUM_LSM303) ? entry.lsm303[side][k] : entry.lsm9dof[side][k - INDEX_NUM_LSM303] ;
+            len = sqrt( a[0] * a[0] + a[1] * a[1] + a[2] * a[2] ) ;
+            if( len == 0.0 )
+                continue ;
+            for( d = 0 ; d < 3 ; d++ ){
+                diff = o.gravity[d][k] - (float)(a[d] / len) ;
+                distance += diff * diff ;
+            }
+        }
+    }
+
+    return distance ;
+
+}
+
+/*----------gesture_to_segment-------------------------------------------------------
+
+  PURPOSE:  Function to find the letters the current gesture may have been, for the
+            word decoder. The DECODER_TOP_K closest single letter gestures are kept,
+            each costing its distance over DECODER_DISTANCE_SCALE. Keyframes of
+            letters that involve motion are skipped, as the motion recognizer
+            handles them. A pose that is more than DECODER_MAX_DISTANCE from every
+            letter, such as a hand at rest, is not a letter.
+
+            Letters with the same hand shape, such as K and P or U and N, are told
+            apart by how the hand is held: once the orientation of the hands has
+            been fused, the distance of each letter grows by DECODER_ORIENT_WEIGHT
+            times its orientation_distance(), and the letters are ranked again.
+
+  INPUT PARAMETERS: nextGesture -- The next set of gesture data to read in.
+                    index       -- The in-memory copy of the gesture database.
+                    motionRec   -- The motion recognizer.
+                    segment     -- Receives the letters, closest first.
+
+  RETURN VALUE:  true if the gesture may have been a letter
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool gesture_to_segment( const Gesture &nextGesture, const GestureIndex &index, const MotionRecognizer &motionRec,
+                         LetterSegment &segment ){
+
+    GestureMatch matches[2 * DECODER_TOP_K] ;   /* The closest gestures, with room for keyframes. */
+    unsigned int found ;                        /* Number of gestures found. */
+    unsigned int i ;                            /* An iterator. */
+
+    LetterHypothesis hyp ;                      /* A letter being ranked. */
+    unsigned int j ;                            /* An iterator. */
+
+    segment.count = 0 ;
+    found = index.Nearest( nextGesture, matches, 2 * DECODER_TOP_K ) ;
+    for( i = 0 ; i < found ; i++ ){
+        const string &gest = index.Text( matches[i].entry ) ;
+        if( (gest.size() != 1) || motionRec.IsKeyframe(gest) )
+            continue ;
+        /* Whether the pose is a letter at all is judged by its hand shape alone. */
+        if( (segment.count == 0) && (matches[i].distance > DECODER_MAX_DISTANCE) )
+            return false ;
+        hyp.letter = gest[0] ;
+        hyp.cost = (matches[i].distance +
+                    DECODER_ORIENT_WEIGHT * orientation_distance(nextGesture, index.Entry(matches[i].entry))) /
+                   DECODER_DISTANCE_SCALE ;
+        /* Insert it in order, dropping the most costly letter once DECODER_TOP_K are kept. */
+        for( j = segment.count ; (j > 0) && (segment.hyps[j - 1].cost > hyp.cost) ; j-- ){
+            if( j < DECODER_TOP_K )
+                segment.hyps[j] = segment.hyps[j - 1] ;
+        }
+        if( j < DECODER_TOP_K ){
+            segment.hyps[j] = hyp ;
+            if( segment.count < DECODER_TOP_K )
+                segment.count++ ;
+        }
+    }
+
+    return segment.count > 0 ;
+
+}
+
+/*----------classify_sample----------------------------------------------------------
+
+  PURPOSE:  Function to convert a decoded sample to text. Letters that involve motion
+            are tracked across samples by the motion recognizer. Every other gesture is
+            converted once each time the hands settle into a pose. The text is
+            appended to sample.letters, and sample.convertFailed is set if a pose
+            matched no gesture and the forest could not classify it. The letters
+            each pose may have been are also kept in sample.segments, for the word
+            decoder; a completed motion is a single certain letter.
+
+  INPUT PARAMETERS: sample    -- The decoded sample.
+                    index     -- The in-memory copy of the gesture database.
+                    motionRec -- The motion recognizer.
+                    segmenter -- The pose segmenter.
+
+-----------------------------------------------------------------------------------*/
+
+void classify_sample( GestureSample &sample, const GestureIndex &index, MotionRecognizer &motionRec, PoseSegmenter &segmenter ){
+
+    string motionLetter ;    /* A letter completed by the motion recognizer. */
+    bool motionDone ;        /* True if a motion was completed. */
+    bool added = false ;     /* True if a gesture was converted to text. */
+
+    /* Poses are segmented on the right hand, which signs letters, or on the left hand if it is the only one worn. */
+    const Hand &signing = sample.gesture.Right().Defined() ? sample.gesture.Right() : sample.gesture.Left() ;
+
+    sample.numSegments = 0 ;
+    if( !sample.valid )
+        return ;
+    /* Track letters that involve motion across frames. */
+    motionDone = motionRec.Update( sample.gesture.Right(), motionLetter ) ;
+    /* Convert the gesture to text once each time the signing hand settles into a pose. */
+    if( segmenter.Update(signing) ){
+        if( !gesture_to_text(sample.gesture, index, motionRec, sample.letters, added) )
+            sample.convertFailed = true ;
+        if( gesture_to_segment(sample.gesture, index, motionRec, sample.segments[sample.numSegments]) )
+            sample.segments[sample.numSegments++].acquired = sample.acquired ? sample.acquired : sample.ingested ;
+    }
+    if( motionDone && !motionLetter.empty() ){
+        sample.letters += motionLetter ;
+        LetterSegment &segment = sample.segments[sample.numSegments++] ;
+        segment.hyps[0].letter = motionLetter[0] ;
+        segment.hyps[0].cost = 0.0f ;
+        segment.count = 1 ;
+        segment.acquired = sample.acquired ? sample.acquired : sample.ingested ;
+    }
+
+    return ;
+
+}
@@ -0,0 +1,41 @@
+/***********recognize.h*************************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file supplies the function prototypes for the functions
+            exported from the module recognize.cpp, which convert decoded gestures
+            into text. The module does not depend on the database or the display, so
+            the replay tool runs the same code as the classify stage. Parser.h
+            includes this file.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef RECOGNIZE_H
+#define RECOGNIZE_H
+
+#include <string>
+#include "Gesture.h"
+#include "GestureIndex.h"
+#include "GestureForest.h"
+#include "MotionRecognizer.h"
+#include "PoseSegmenter.h"
+#include "Pipeline.h"
+
+#define LSM303_TOL     100  /* The tolerance to use when matching LSM303 sensor values. */
+#define LSM9DOF_TOL    100  /* The tolerance to use when matching LSM9DOF sensor values. */
+
+using namespace std ;
+
+bool gesture_to_text( const Gesture &nextGesture, const GestureIndex &index, const MotionRecognizer &motionRec, string &text,
+                      bool &added_text ) ;
+bool gesture_to_segment( const Gesture &nextGesture, const GestureIndex &index, const MotionRecognizer &motionRec,
+                         LetterSegment &segment ) ;
+void classify_sample( GestureSample &sample, const GestureIndex &index, MotionRecognizer &motionRec, PoseSegmenter &segmenter ) ;
+
+#endif
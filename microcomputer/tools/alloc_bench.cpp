@@ -0,0 +1,278 @@
+/***********alloc_bench.cpp**********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  Counts the heap allocations made while recorded sensor frames pass through
+            the per-frame path of the pipeline: next_frame(), get_frame(), the copy
+            into the queues between the stages, the pose segmenter, the motion
+            recognizer, the gesture index, and the decision forest. The gesture index
+            is built from the recorded frames, one entry per file, named after the
+            file, and read through a gesture library on every frame, as the classify
+            stage reads it. Every frame matches exactly, so the forest that
+            gesture_to_text() falls back on is run on every frame as well. Each frame
+            is replayed several times in a row so that the segmenter sees it held.
+
+            Usage: alloc_bench [passes] [frame directory ...]
+
+            Exits with a failure status if any allocation was made on the per-frame
+            path, so it can be used to catch regressions.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <dirent.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <new>
+#include "../frames.h"
+#include "../recognize.h"
+#include "../GestureLibrary.h"
+
+#define HOLD_FRAMES  20  /* Number of times each recorded frame is repeated. */
+
+using namespace std ;
+
+static unsigned long allocations = 0 ;  /* Number of calls to operator new. */
+static unsigned long allocBytes = 0 ;   /* Number of bytes requested from operator new. */
+
+/* Every allocation in the program goes through these, including those made by the
+   standard library. */
+
+void* operator new( size_t size ){
+
+    void* p = malloc( size ? size : 1 ) ;
+
+    if( p == NULL )
+        throw bad_alloc() ;
+    allocations++ ;
+    allocBytes += size ;
+
+    return p ;
+
+}
+
+void* operator new[]( size_t size ){
+
+    return operator new( size ) ;
+
+}
+
+/* The deletes free what the new above returned, so they match. They are kept out of line
+   only because GCC 11 and later, once a delete is inlined into a caller that also inlined
+   the standard allocator, sees free() called on a pointer returned by operator new and
+   raises -Wmismatched-new-delete, which does not know that operator new was replaced.
+   The sized deletes of C++14 call these, so they need not be replaced as well. */
+
+__attribute__((noinline)) void operator delete( void* p ) throw() {
+
+    free( p ) ;
+
+}
+
+__attribute__((noinline)) void operator delete[]( void* p ) throw() {
+
+    free( p ) ;
+
+}
+
+bool load_frames( const char* dName, string &frames, GestureIndex &index ) ;
+void add_gesture( const struct sensor_frame &frame, const string &gest, GestureIndex &index ) ;
+
+int main( int argc, char* argv[] ){
+
+    unsigned int passes = (argc > 1) ? atoi( argv[1] ) : 100 ;   /* Number of times to replay the frames. */
+    string frames ;                                              /* The recorded frames, each repeated. */
+    GestureLibrary library ;                                     /* Publishes the gestures, as in sign2speech. */
+    GestureSet* gestures = new GestureSet ;                      /* The gesture index and motion templates, until published. */
+    GestureIndex &index = gestures->Gestures() ;                 /* The gesture index. */
+    MotionRecognizer motionRec ;                                 /* The motion recognizer. */
+    PoseSegmenter segmenter ;                                    /* The pose segmenter. */
+    GestureForest forest ;                                       /* The compiled decision forest. */
+    ForestResult result ;                                        /* The forest's class for the next frame. */
+    unsigned long votes = 0 ;                                    /* Total forest votes, so the forest is not optimized away. */
+    StageStats stats ;                                           /* Per-frame statistics, as kept by each stage. */
+    static SpscQueue<RawSample, PIPELINE_RAW_SLOTS> raws ;            /* The queue between ingest and decode. */
+    static SpscQueue<GestureSample, PIPELINE_SAMPLE_SLOTS> samples ;  /* The queue between decode and classify. */
+    RawSample raw ;                                              /* The next frame, as read by ingest. */
+    GestureSample sample ;                                       /* The next frame, as decoded. */
+    Hand hands[NUM_HANDS] ;                                      /* The hands read from the next frame. */
+    ImuFusion fusion[NUM_HANDS] ;                                /* Tracks the orientation of each hand from frame to frame. */
+    string text ;                                                /* The recognized text. */
+    unsigned long count = 0 ;                                    /* Number of frames replayed. */
+    unsigned long before ;                                       /* Allocations before the replay. */
+    unsigned long beforeBytes ;                                  /* Bytes allocated before the replay. */
+    uint64_t start ;                                             /* Start of the replay, in nanoseconds. */
+    uint64_t elapsed ;                                           /* Length of the replay, in nanoseconds. */
+    size_t pos ;                                                 /* Position of the next frame. */
+    unsigned int i ;                                             /* An iterator. */
+
+    if( argc > 2 ){
+        for( i = 2 ; i < (unsigned int)argc ; i++ ){
+            if( !load_frames(argv[i], frames, index) ){
+                fprintf( stderr, "*** Unable to read frames from %s ***\n", argv[i] ) ;
+                return EXIT_FAILURE ;
+            }
+        }
+    }
+    else if( !load_frames("../gesture_data/alphabet_frames", frames, index) ||
+             !load_frames("../gesture_data/numbers_frames", frames, index) ){
+        fprintf( stderr, "*** Unable to read frames from ../gesture_data ***\n" ) ;
+        return EXIT_FAILURE ;
+    }
+    index.Build() ;
+    gestures->Build( "alloc_bench" ) ;
+    library.Publish( gestures ) ;
+    /* The templates are copied once per set published, as the classify stage does, before the replay. */
+    motionRec = library.Enter().Motion() ;
+    /* The text only grows when a letter is added; reserve it so only the frame path is counted. */
+    text.reserve( 4096 ) ;
+    before = allocations ;
+    beforeBytes = allocBytes ;
+    start = pipeline_now_ns() ;
+    for( i = 0 ; i < passes ; i++ ){
+        pos = 0 ;
+        while( next_frame(frames.data(), frames.size(), pos, raw.frame) ){
+            /* Ingest. */
+            raw.fromFile = false ;
+            raw.ingested = raw.queued = pipeline_now_ns() ;
+            raws.TryPush( raw ) ;
+            /* Decode. */
+            RawSample* in = raws.Front() ;
+            sample.source = "alloc_bench" ;
+            sample.acquired = in->frame.timestamp ;
+            sample.valid = get_frame( hands, &in->frame, sample.sensorStatus, sample.xmlVersion, sample.convert ) ;
+            sample.ingested = in->ingested ;
+            stats.Record( in->queued, pipeline_now_ns() ) ;
+            raws.Pop() ;
+            if( sample.valid ){
+                fusion[0].Update( hands[0], sample.acquired ) ;
+                fusion[1].Update( hands[1], sample.acquired ) ;
+                sample.gesture = Gesture( hands[0], hands[1] ) ;
+            }
+            sample.letters.clear() ;
+            sample.queued = pipeline_now_ns() ;
+            samples.TryPush( sample ) ;
+            /* Classify. */
+            GestureSample* s = samples.Front() ;
+            classify_sample( *s, library.Enter().Index(), motionRec, segmenter ) ;
+            if( forest.Classify(s->gesture, result) )
+                votes += result.votes ;
+            stats.Record( s->queued, pipeline_now_ns() ) ;
+            /* Text. */
+            if( (text.size() + s->letters.size()) < text.capacity() )
+                text += s->letters ;
+            samples.Pop() ;
+            count++ ;
+        }
+    }
+    elapsed = pipeline_now_ns() - start ;
+    library.Leave() ;
+    fprintf( stdout, "Frames:\t\t%lu (%u passes, %u bytes per hand)\n", count, passes, (unsigned int)sizeof(Hand) ) ;
+    fprintf( stdout, "Allocations:\t%lu (%lu bytes)\n", allocations - before, allocBytes - beforeBytes ) ;
+    fprintf( stdout, "Per frame:\t%.3f allocations\t%.1f ns\n", count ? (double)(allocations - before) / count : 0.0,
+             count ? (double)elapsed / count : 0.0 ) ;
+    fprintf( stdout, "Text:\t\t%.60s%s\n", text.c_str(), (text.size() > 60) ? "..." : "" ) ;
+    fprintf( stdout, "Forest votes:\t%.1f per frame\n", count ? (double)votes / count : 0.0 ) ;
+
+    return ((count > 0) && (allocations == before)) ? EXIT_SUCCESS : EXIT_FAILURE ;
+
+}
+
+/*----------load_frames--------------------------------------------------------------
+
+  PURPOSE:  Function to read every .frm file in a directory, adding each frame
+            HOLD_FRAMES times to the replay and once to the gesture index, named
+            after the file.
+
+  RETURN VALUE:  true if at least one frame was read
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool load_frames( const char* dName, string &frames, GestureIndex &index ){
+
+    DIR* dir = opendir( dName ) ;  /* The directory. */
+    struct dirent* entry ;         /* The next file. */
+    struct sensor_frame frame ;    /* The next frame. */
+    vector<string> names ;         /* The frame files, in order. */
+    size_t pos ;                   /* Position of the next frame. */
+    bool found = false ;           /* True once a frame has been read. */
+    unsigned int i ;               /* An iterator. */
+    unsigned int j ;               /* An iterator. */
+
+    if( dir == NULL )
+        return false ;
+    while( (entry = readdir(dir)) != NULL ){
+        string name = entry->d_name ;
+        if( (name.size() > 4) && (name.compare(name.size() - 4, 4, ".frm") == 0) )
+            names.push_back( name ) ;
+    }
+    closedir( dir ) ;
+    sort( names.begin(), names.end() ) ;
+    for( i = 0 ; i < names.size() ; i++ ){
+        ifstream file( (string(dName) + "/" + names[i]).c_str(), ios::binary ) ;
+        stringstream contents ;
+        contents << file.rdbuf() ;
+        string bytes = contents.str() ;
+        pos = 0 ;
+        while( next_frame(bytes.data(), bytes.size(), pos, frame) ){
+            add_gesture( frame, names[i].substr(0, names[i].size() - 4), index ) ;
+            for( j = 0 ; j < HOLD_FRAMES ; j++ ){
+                frames.append( (const char*)&frame, sizeof(frame) ) ;
+            }
+            found = true ;
+        }
+    }
+
+    return found ;
+
+}
+
+/*----------add_gesture--------------------------------------------------------------
+
+  PURPOSE:  Function to add the right hand of a frame to the gesture index.
+
+-----------------------------------------------------------------------------------*/
+
+void add_gesture( const struct sensor_frame &frame, const string &gest, GestureIndex &index ){
+
+    const struct frame_hand &hand = frame.hands[1] ;           /* The right hand. */
+    double flex[INDEX_NUM_FLEX] ;                              /* Flex sensors, without the thumb. */
+    bool contact[INDEX_NUM_CONTACTS] ;                         /* Contact sensors. */
+    double lsm303[INDEX_NUM_LSM303][INDEX_LSM303_VALS] ;       /* LSM303 values. */
+    double lsm9dof[INDEX_NUM_LSM9DOF][INDEX_LSM9DOF_VALS] ;    /* LSM9DOF values. */
+    unsigned int i ;                                           /* An iterator. */
+    unsigned int j ;                                           /* An iterator. */
+
+    for( i = 0 ; i < INDEX_NUM_FLEX ; i++ ){
+        flex[i] = hand.flex[i + 1] ;
+    }
+    for( i = 0 ; i < INDEX_NUM_CONTACTS ; i++ ){
+        contact[i] = (hand.contact >> i) & 1 ;
+    }
+    for( i = 0 ; i < INDEX_NUM_LSM303 ; i++ ){
+        for( j = 0 ; j < INDEX_LSM303_VALS ; j++ ){
+            lsm303[i][j] = hand.lsm303[i][j] ;
+        }
+    }
+    for( i = 0 ; i < INDEX_NUM_LSM9DOF ; i++ ){
+        for( j = 0 ; j < INDEX_LSM9DOF_VALS ; j++ ){
+            lsm9dof[i][j] = hand.lsm9dof[i][j] ;
+        }
+    }
+    index.Add( true, flex, contact, lsm303, lsm9dof, gest ) ;
+
+    return ;
+
+}
@@ -0,0 +1,193 @@
+/***********forest_bench.cpp********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  Benchmark comparing the decision forest compiled into sign2speech with
+            the exact match gesture_to_text() has always made, on the same labelled
+            gestures. The gestures are read by read_labelled(), as tools/forest_train
+            reads them. For each gesture, reports how often and how fast the exact
+            match, the nearest gesture search, the forest alone, and
+            gesture_to_text(), which falls back on the forest when the exact match
+            fails, find the labelled text. Keyframes of letters that involve motion
+            are left to the motion recognizer, so they are not counted.
+
+            Usage: forest_bench [-d gesture_db.sql] [-c copies] [-s seed] [-n passes] file or directory ...
+
+            The files must be held out from the forest's training, such as sessions
+            recorded after it was trained or written by tools/make_session.py: the
+            captures it was trained on, even jittered with another seed, only show
+            how well it remembers them. Each frame is read once, as recorded, unless
+            more copies are asked for.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include "../recognize.h"
+#include "gesture_dump.h"
+#include "forest_data.h"
+
+using namespace std ;
+
+double now_ns( ) ;
+
+int main( int argc, char* argv[] ){
+
+    const char* dbFName = "gesture_db.sql" ;   /* The gesture table. */
+    unsigned int copies = 1 ;                  /* Copies of each captured frame. */
+    unsigned int seed = 2 ;                    /* Seed for the jitter of the captures. */
+    unsigned int passes = 20 ;                 /* Number of times each gesture is looked up. */
+    vector<Labelled> read ;                    /* The labelled gestures. */
+    vector<Labelled> samples ;                 /* The labelled gestures that are not keyframes. */
+    GestureIndex index ;                       /* The gesture index. */
+    MotionRecognizer motionRec ;               /* The motion recognizer. */
+    GestureForest forest ;                     /* The compiled forest. */
+    GestureMatch match ;                       /* The result of a nearest gesture search. */
+    ForestResult result ;                      /* The result of the forest. */
+    string gest ;                              /* The result of an exact match. */
+    string text ;                              /* The result of gesture_to_text(). */
+    bool added ;                               /* True if gesture_to_text() added text. */
+    unsigned int exactHits = 0 ;               /* Number of correct exact matches. */
+    unsigned int nearHits = 0 ;                /* Number of correct nearest gestures. */
+    unsigned int forestHits = 0 ;              /* Number of correct forest classes. */
+    unsigned int forestSure = 0 ;              /* Number of forest classes gesture_to_text() would accept. */
+    unsigned int textHits = 0 ;                /* Number of correct texts. */
+    unsigned int textNone = 0 ;                /* Number of gestures gesture_to_text() added no text for. */
+    unsigned int sink = 0 ;                    /* Keeps the timed results alive. */
+    unsigned int lookups ;                     /* Number of timed lookups. */
+    double start ;                             /* Start time, in nanoseconds. */
+    double exactNs ;                           /* Time spent on exact matches, in nanoseconds. */
+    double nearNs ;                            /* Time spent on nearest searches, in nanoseconds. */
+    double forestNs ;                          /* Time spent on the forest, in nanoseconds. */
+    double textNs ;                            /* Time spent in gesture_to_text(), in nanoseconds. */
+    size_t i ;                                 /* An iterator. */
+    unsigned int p ;                           /* An iterator over the passes. */
+    int opt ;                                  /* The next command line option. */
+
+    while( (opt = getopt(argc, argv, "d:c:s:n:")) != -1 ){
+        switch( opt ){
+            case 'd': dbFName = optarg ; break ;
+            case 'c': copies = atoi( optarg ) ; break ;
+            case 's': seed = atoi( optarg ) ; break ;
+            case 'n': passes = atoi( optarg ) ; break ;
+            default:
+                fprintf( stderr, "Usage: %s [-d gesture_db.sql] [-c copies] [-s seed] [-n passes] file or directory ...\n", argv[0] ) ;
+                return EXIT_FAILURE ;
+        }
+    }
+    if( optind == argc ){
+        fprintf( stderr, "Usage: %s [-d gesture_db.sql] [-c copies] [-s seed] [-n passes] file or directory ...\n", argv[0] ) ;
+        return EXIT_FAILURE ;
+    }
+    if( copies == 0 )
+        copies = 1 ;
+    if( passes == 0 )
+        passes = 1 ;
+    if( !load_dump(dbFName, index) ){
+        fprintf( stderr, "*** Unable to read gestures from %s ***\n", dbFName ) ;
+        return EXIT_FAILURE ;
+    }
+    motionRec.Build( index ) ;
+    srand( seed ) ;
+    for( opt = optind ; opt < argc ; opt++ ){
+        if( !read_labelled_path(argv[opt], index, copies, false, read) )
+            return EXIT_FAILURE ;
+    }
+    for( i = 0 ; i < read.size() ; i++ ){
+        if( !motionRec.IsKeyframe(read[i].label) )
+            samples.push_back( read[i] ) ;
+    }
+    if( samples.empty() ){
+        fprintf( stderr, "*** No labelled gestures were read ***\n" ) ;
+        return EXIT_FAILURE ;
+    }
+    /* Accuracy. */
+    text.reserve( 64 ) ;
+    for( i = 0 ; i < samples.size() ; i++ ){
+        const string &label = samples[i].label ;
+        if( index.Match(samples[i].gesture, false, LSM303_TOL, LSM9DOF_TOL, gest) && (gest == label) )
+            exactHits++ ;
+        if( index.Nearest(samples[i].gesture, match) && (index.Text(match.entry) == label) )
+            nearHits++ ;
+        if( forest.Classify(samples[i].gesture, result) ){
+            if( label == forest.Text(result.label) )
+                forestHits++ ;
+            if( result.confidence >= FOREST_MIN_CONFIDENCE )
+                forestSure++ ;
+        }
+        text.clear() ;
+        gesture_to_text( samples[i].gesture, index, motionRec, text, added ) ;
+        if( !added )
+            textNone++ ;
+        else if( text == label )
+            textHits++ ;
+    }
+    /* Latency. */
+    lookups = passes * samples.size() ;
+    start = now_ns() ;
+    for( p = 0 ; p < passes ; p++ ){
+        for( i = 0 ; i < samples.size() ; i++ ){
+            sink += index.Match( samples[i].gesture, false, LSM303_TOL, LSM9DOF_TOL, gest ) ;
+        }
+    }
+    exactNs = now_ns() - start ;
+    start = now_ns() ;
+    for( p = 0 ; p < passes ; p++ ){
+        for( i = 0 ; i < samples.size() ; i++ ){
+            index.Nearest( samples[i].gesture, match ) ;
+            sink += match.entry ;
+        }
+    }
+    nearNs = now_ns() - start ;
+    start = now_ns() ;
+    for( p = 0 ; p < passes ; p++ ){
+        for( i = 0 ; i < samples.size() ; i++ ){
+            forest.Classify( samples[i].gesture, result ) ;
+            sink += result.label ;
+        }
+    }
+    forestNs = now_ns() - start ;
+    start = now_ns() ;
+    for( p = 0 ; p < passes ; p++ ){
+        for( i = 0 ; i < samples.size() ; i++ ){
+            text.clear() ;
+            gesture_to_text( samples[i].gesture, index, motionRec, text, added ) ;
+            sink += added ;
+        }
+    }
+    textNs = now_ns() - start ;
+    fprintf( stdout, "Gestures:\t%u (%u keyframes not counted), %u in the gesture table, %u in the forest\n",
+             (unsigned int)samples.size(), (unsigned int)(read.size() - samples.size()), (unsigned int)index.Size(),
+             forest.Classes() ) ;
+    fprintf( stdout, "Lookups:\t%u (%u passes)\n", lookups, passes ) ;
+    fprintf( stdout, "Exact match:\t%8.1f ns/lookup\t%5.1f%% correct\n", exactNs / lookups, (100.0 * exactHits) / samples.size() ) ;
+    fprintf( stdout, "Nearest:\t%8.1f ns/lookup\t%5.1f%% correct\n", nearNs / lookups, (100.0 * nearHits) / samples.size() ) ;
+    fprintf( stdout, "Forest:\t\t%8.1f ns/lookup\t%5.1f%% correct, %.1f%% with %.0f%% of the votes\n", forestNs / lookups,
+             (100.0 * forestHits) / samples.size(), (100.0 * forestSure) / samples.size(), 100.0 * FOREST_MIN_CONFIDENCE ) ;
+    fprintf( stdout, "gesture_to_text:%8.1f ns/lookup\t%5.1f%% correct, %.1f%% no text\n", textNs / lookups,
+             (100.0 * textHits) / samples.size(), (100.0 * textNone) / samples.size() ) ;
+
+    return (sink != 0) ? EXIT_SUCCESS : EXIT_FAILURE ;
+
+}
+
+double now_ns( ){
+
+    struct timespec t ;  /* The current time. */
+
+    clock_gettime( CLOCK_MONOTONIC, &t ) ;
+
+    return ((double)t.tv_sec * 1e9) + (double)t.tv_nsec ;
+
+}
@@ -0,0 +1,466 @@
+/***********forest_data.cpp*********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The read_labelled(), read_labelled_row(), and read_labelled_path()
+            functions are defined in this module, along with align_session(), which labels the frames of a
+            session.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+#include <limits.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include "forest_data.h"
+#include "../frames.h"
+
+/*----------session_label------------------------------------------------------------
+
+  PURPOSE:  Function to read the text a session was signed as from the file of the
+            same name with the extension .txt, as tools/replay does.
+
+  RETURN VALUE:  true if the label was read
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+static bool session_label( const string &fName, string &label ){
+
+    string lName = fName ;  /* The name of the label file. */
+    size_t dot = lName.rfind( '.' ) ;
+
+    if( (dot != string::npos) && (lName.find('/', dot) == string::npos) )
+        lName.erase( dot ) ;
+    lName += ".txt" ;
+    ifstream input( lName.c_str() ) ;
+    if( !input.is_open() || !getline(input, label) )
+        return false ;
+    if( !label.empty() && (label[label.size() - 1] == '\r') )
+        label.erase( label.size() - 1 ) ;
+
+    return true ;
+
+}
+
+/*----------jitter_frame-------------------------------------------------------------
+
+  PURPOSE:  Function to disturb the sensor values of a captured frame as a glove would
+            from one sample to the next: flex values move by a step, contact sensors
+            flip, and the accelerometers read a little differently.
+
+-----------------------------------------------------------------------------------*/
+
+static void jitter_frame( struct sensor_frame &frame ){
+
+    unsigned int side ;  /* An iterator over the hands. */
+    unsigned int i ;     /* An iterator. */
+    int value ;          /* The disturbed value. */
+
+    for( side = 0 ; side < FRAME_HANDS ; side++ ){
+        struct frame_hand &hand = frame.hands[side] ;
+        /* The thumb has no flex sensor. */
+        for( i = 1 ; i < FRAME_FINGERS ; i++ ){
+            if( (rand() % 100) >= FOREST_JITTER_FLEX )
+                continue ;
+            value = hand.flex[i] + ((rand() % 2) ? (int)FLEX_STEP : -(int)FLEX_STEP) ;
+            hand.flex[i] = (value < 0) ? 0 : ((value > 95) ? 95 : value) ;
+        }
+        for( i = 0 ; i < FRAME_CONTACTS ; i++ ){
+            if( (rand() % 100) < FOREST_JITTER_CONTACT )
+                hand.contact ^= (uint16_t)(1 << i) ;
+        }
+        for( i = 0 ; i < 3 ; i++ ){
+            hand.lsm303[0][i] += (rand() % (2 * FOREST_JITTER_ACCEL + 1)) - FOREST_JITTER_ACCEL ;
+            hand.lsm303[1][i] += (rand() % (2 * FOREST_JITTER_ACCEL + 1)) - FOREST_JITTER_ACCEL ;
+            hand.lsm9dof[0][i] += (rand() % (2 * FOREST_JITTER_ACCEL + 1)) - FOREST_JITTER_ACCEL ;
+            hand.lsm9dof[1][i] += (rand() % (2 * FOREST_JITTER_ACCEL + 1)) - FOREST_JITTER_ACCEL ;
+        }
+    }
+    frame.crc = frame_crc32( &frame, offsetof(struct sensor_frame, crc) ) ;
+
+    return ;
+
+}
+
+/*----------align_session------------------------------------------------------------
+
+  PURPOSE:  Function to label the frames of a session with the letters it was signed
+            as. Each letter is a gesture of the index, or the keyframes of one that
+            involves motion in order, and the frames are aligned to them in order by
+            dynamic programming: a frame held as a letter costs its distance to the
+            letter's gesture, as Nearest() measures it, and a frame between letters
+            costs FOREST_GAP_DISTANCE. The cheapest alignment labels the frames held
+            as each letter, so a letter signed a little off is still labelled, while
+            the moves between letters are not. The session is rejected if a letter
+            has no gesture, or no frame within FOREST_GAP_DISTANCE of it.
+
+  INPUT PARAMETERS: gestures -- the gestures of the session, one per frame.
+                    index    -- the gesture index.
+                    label    -- the text the session was signed as.
+                    samples  -- receives the labelled gestures.
+                    error    -- set to the reason the session could not be labelled.
+
+  RETURN VALUE:  true if the session was labelled
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+static bool align_session( const vector<Gesture> &gestures, const GestureIndex &index, const string &label,
+                           vector<Labelled> &samples, string &error ){
+
+    map<string, unsigned int> known ;       /* Position of the first gesture of each text. */
+    map<string, unsigned int> textId ;      /* The distinct texts of the letters. */
+    vector<int> entryId ;                   /* The text of each gesture, -1 if not signed. */
+    vector<unsigned int> tokens ;           /* The text of each letter or keyframe. */
+    vector<string> tokenText ;              /* The text of each letter or keyframe. */
+    vector<GestureMatch> matches ;          /* The distance to every gesture. */
+    vector<unsigned int> dist ;             /* The distance of each frame to each text. */
+    vector<unsigned int> nearest ;          /* The distance of a frame to each text. */
+    vector<unsigned long> cost ;            /* The cheapest alignment ending in each state. */
+    vector<unsigned long> next ;            /* The same, a frame later. */
+    vector<unsigned char> back ;            /* The step taken to each state of each frame. */
+    vector<bool> seen ;                     /* True if a frame is close to each letter. */
+    vector<Labelled> held ;                 /* The labelled frames, last first. */
+    unsigned long best ;                    /* The cheapest step to a state. */
+    unsigned int found ;                    /* Number of gestures Nearest() found. */
+    unsigned int states ;                   /* Between and within each letter, then after the last. */
+    unsigned int state ;                    /* The state of a frame. */
+    unsigned int step ;                     /* A step between states. */
+    unsigned int n ;                        /* Number of distinct texts. */
+    unsigned int frames = gestures.size() ; /* Number of frames. */
+    unsigned int f ;                        /* An iterator over the frames. */
+    unsigned int s ;                        /* An iterator over the states. */
+    unsigned int i ;                        /* An iterator. */
+    unsigned int k ;                        /* An iterator over the keyframes. */
+    Labelled sample ;                       /* The next labelled gesture. */
+    const unsigned int unfound = 1000 ;     /* Distance to a gesture Nearest() did not find. */
+
+    for( i = index.Size() ; i > 0 ; i-- ){
+        known[index.Text( i - 1 )] = i - 1 ;
+    }
+    for( i = 0 ; i < label.size() ; i++ ){
+        string letter( 1, label[i] ) ;
+        if( letter == " " )
+            continue ;
+        if( known.count(letter) ){
+            tokenText.push_back( letter ) ;
+            continue ;
+        }
+        for( k = 1 ; known.count(letter + (char)('0' + k)) ; k++ ){
+            tokenText.push_back( letter + (char)('0' + k) ) ;
+        }
+        if( k == 1 ){
+            error = "no gesture was found for the letter \"" + letter + "\"" ;
+            return false ;
+        }
+    }
+    if( tokenText.empty() || (frames < tokenText.size()) ){
+        error = "too few frames for the letters of \"" + label + "\"" ;
+        return false ;
+    }
+    for( i = 0 ; i < tokenText.size() ; i++ ){
+        if( !textId.count(tokenText[i]) )
+            textId.insert( make_pair(tokenText[i], (unsigned int)textId.size()) ) ;
+        tokens.push_back( textId[tokenText[i]] ) ;
+    }
+    n = textId.size() ;
+    entryId.assign( index.Size(), -1 ) ;
+    for( i = 0 ; i < index.Size() ; i++ ){
+        if( textId.count(index.Text(i)) )
+            entryId[i] = textId[index.Text( i )] ;
+    }
+    /* The distance of every frame to every text signed. */
+    matches.resize( index.Size() ) ;
+    dist.resize( (size_t)frames * n ) ;
+    for( f = 0 ; f < frames ; f++ ){
+        nearest.assign( n, unfound ) ;
+        found = index.Nearest( gestures[f], &matches[0], matches.size() ) ;
+        for( i = 0 ; i < found ; i++ ){
+            int id = entryId[matches[i].entry] ;
+            if( (id >= 0) && (matches[i].distance < nearest[id]) )
+                nearest[id] = matches[i].distance ;
+        }
+        copy( nearest.begin(), nearest.end(), dist.begin() + (size_t)f * n ) ;
+    }
+    /* State 2j is the move before letter j, state 2j + 1 is letter j, and state 2t is
+       the rest after the last letter. A frame stays in its state or moves on to the
+       next; a letter may also be followed by the next letter directly. */
+    states = 2 * tokens.size() + 1 ;
+    cost.assign( states, ULONG_MAX ) ;
+    next.assign( states, ULONG_MAX ) ;
+    back.assign( (size_t)frames * states, 0 ) ;
+    cost[0] = FOREST_GAP_DISTANCE ;
+    cost[1] = dist[tokens[0]] ;
+    for( f = 1 ; f < frames ; f++ ){
+        for( s = 0 ; s < states ; s++ ){
+            best = cost[s] ;
+            step = 0 ;
+            if( (s >= 1) && (cost[s - 1] < best) ){
+                best = cost[s - 1] ;
+                step = 1 ;
+            }
+            if( (s >= 3) && (s % 2 == 1) && (cost[s - 2] < best) ){
+                best = cost[s - 2] ;
+                step = 2 ;
+            }
+            back[(size_t)f * states + s] = step ;
+            if( best == ULONG_MAX )
+                next[s] = ULONG_MAX ;
+            else
+                next[s] = best + ((s % 2 == 0) ? FOREST_GAP_DISTANCE : dist[(size_t)f * n + tokens[s / 2]]) ;
+        }
+        cost.swap( next ) ;
+    }
+    state = (cost[states - 2] < cost[states - 1]) ? (states - 2) : (states - 1) ;
+    /* Label the frames from the last back to the first. */
+    seen.assign( tokens.size(), false ) ;
+    for( f = frames ; f > 0 ; f-- ){
+        if( state % 2 == 1 ){
+            sample.gesture = gestures[f - 1] ;
+            sample.label = tokenText[state / 2] ;
+            held.push_back( sample ) ;
+            if( dist[(size_t)(f - 1) * n + tokens[state / 2]] <= FOREST_GAP_DISTANCE )
+                seen[state / 2] = true ;
+        }
+        state -= back[(size_t)(f - 1) * states + state] ;
+    }
+    for( i = 0 ; i < tokens.size() ; i++ ){
+        if( !seen[i] ){
+            error = "the letter \"" + tokenText[i] + "\" of \"" + label + "\" was not found" ;
+            return false ;
+        }
+    }
+    samples.insert( samples.end(), held.rbegin(), held.rend() ) ;
+
+    return true ;
+
+}
+
+/*----------read_labelled------------------------------------------------------------
+
+  PURPOSE:  Function to read the labelled gestures of a file of sensor frames.
+
+            A file with a label next to it, as written by tools/make_session.py, is a
+            session, and its frames are labelled by align_session().
+
+            Any other file is a capture, such as those converted from alphabet_xml
+            and numbers_xml by tools/xml_to_frames.py, and each of its frames is
+            labelled with the name of the file. Captures hold a single frame, so
+            each frame is added as captured and then copies - 1 more times with
+            jitter_frame() applied.
+
+  INPUT PARAMETERS: fName   -- the capture or session.
+                    index   -- the gesture index, for labelling sessions.
+                    copies  -- the number of copies of each captured frame.
+                    samples -- receives the labelled gestures.
+                    error   -- set to the reason the file could not be read.
+
+  RETURN VALUE:  true if the file was read
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool read_labelled( const char* fName, const GestureIndex &index, unsigned int copies, vector<Labelled> &samples, string &error ){
+
+    ifstream input( fName, ios::binary ) ;  /* The file. */
+    stringstream contents ;                  /* The contents of the file. */
+    string bytes ;                           /* The contents of the file. */
+    struct sensor_frame frame ;              /* The next frame. */
+    struct sensor_frame copy ;               /* A disturbed copy of the frame. */
+    size_t pos = 0 ;                         /* Position of the next frame. */
+    Hand hands[NUM_HANDS] ;                  /* The hands read from the next frame. */
+    ImuFusion fusion[NUM_HANDS] ;            /* Tracks the orientation of each hand. */
+    string status ;                          /* The sensor status, unused. */
+    string version ;                         /* The sensor data version, unused. */
+    string convert ;                         /* The conversion status, unused. */
+    string label ;                           /* The label of the session. */
+    vector<Gesture> gestures ;               /* The gestures of the session. */
+    Labelled sample ;                        /* The next labelled gesture. */
+    unsigned int frames = 0 ;                /* Number of frames read. */
+    unsigned int i ;                         /* An iterator. */
+
+    if( !input.is_open() ){
+        error = "unable to open the file" ;
+        return false ;
+    }
+    contents << input.rdbuf() ;
+    bytes = contents.str() ;
+    if( session_label(fName, label) ){
+        while( next_frame(bytes.data(), bytes.size(), pos, frame) ){
+            frames++ ;
+            if( !get_frame(hands, &frame, status, version, convert) )
+                continue ;
+            for( i = 0 ; i < NUM_HANDS ; i++ ){
+                fusion[i].Update( hands[i], frame.timestamp ) ;
+            }
+            gestures.push_back( Gesture(hands[0], hands[1]) ) ;
+        }
+        if( !gestures.empty() && !align_session(gestures, index, label, samples, error) )
+            return false ;
+    }
+    else{
+        string name = fName ;
+        size_t slash = name.rfind( '/' ) ;
+        size_t dot ;
+        if( slash != string::npos )
+            name.erase( 0, slash + 1 ) ;
+        if( (dot = name.rfind('.')) != string::npos )
+            name.erase( dot ) ;
+        sample.label = name ;
+        while( next_frame(bytes.data(), bytes.size(), pos, frame) ){
+            frames++ ;
+            for( i = 0 ; i < copies ; i++ ){
+                copy = frame ;
+                if( i > 0 )
+                    jitter_frame( copy ) ;
+                if( !get_frame(hands, &copy, status, version, convert) )
+                    break ;
+                sample.gesture = Gesture( hands[0], hands[1] ) ;
+                samples.push_back( sample ) ;
+            }
+        }
+    }
+    if( frames == 0 ){
+        error = "no frames were found" ;
+        return false ;
+    }
+
+    return true ;
+
+}
+
+/*----------read_labelled_row--------------------------------------------------------
+
+  PURPOSE:  Function to add the gesture of a row of the gesture table, such as the
+            pause between words, which has no capture, as a capture would be added:
+            the row is written into a frame, as tools/make_session.py does, and the
+            frame is added copies times, all but the first with jitter_frame()
+            applied. The thumb flex value is not kept in a row and reads zero.
+
+  INPUT PARAMETERS: row     -- the row.
+                    copies  -- the number of copies of the frame.
+                    samples -- receives the labelled gestures.
+
+-----------------------------------------------------------------------------------*/
+
+void read_labelled_row( const Row &row, unsigned int copies, vector<Labelled> &samples ){
+
+    struct sensor_frame frame ;              /* The row, as a frame. */
+    struct sensor_frame copy ;               /* A disturbed copy of the frame. */
+    Hand hands[NUM_HANDS] ;                  /* The hands read from the frame. */
+    string status ;                          /* The sensor status, unused. */
+    string version ;                         /* The sensor data version, unused. */
+    string convert ;                         /* The conversion status, unused. */
+    Labelled sample ;                        /* The next labelled gesture. */
+    unsigned int side = row.right ? 1 : 0 ;  /* The hand of the row. */
+    unsigned int i ;                         /* An iterator. */
+    unsigned int j ;                         /* An iterator. */
+
+    memset( &frame, 0, sizeof(frame) ) ;
+    frame.magic = FRAME_MAGIC ;
+    frame.version = FRAME_VERSION ;
+    frame.size = FRAME_SIZE ;
+    frame.flags = FRAME_CONNECTED | (row.right ? FRAME_RIGHT_PRESENT : FRAME_LEFT_PRESENT) ;
+    struct frame_hand &hand = frame.hands[side] ;
+    for( i = 0 ; i < INDEX_NUM_FLEX ; i++ ){
+        hand.flex[i + 1] = (uint8_t)row.flex[i] ;
+    }
+    for( i = 0 ; i < INDEX_NUM_CONTACTS ; i++ ){
+        if( row.contact[i] )
+            hand.contact |= (uint16_t)(1 << i) ;
+    }
+    for( i = 0 ; i < INDEX_NUM_LSM303 ; i++ ){
+        for( j = 0 ; j < INDEX_LSM303_VALS ; j++ ){
+            hand.lsm303[i][j] = (int16_t)row.lsm303[i][j] ;
+        }
+    }
+    for( i = 0 ; i < INDEX_NUM_LSM9DOF ; i++ ){
+        for( j = 0 ; j < INDEX_LSM9DOF_VALS ; j++ ){
+            hand.lsm9dof[i][j] = (int16_t)row.lsm9dof[i][j] ;
+        }
+    }
+    frame.crc = frame_crc32( &frame, offsetof(struct sensor_frame, crc) ) ;
+    sample.label = row.gest ;
+    for( i = 0 ; i < copies ; i++ ){
+        copy = frame ;
+        if( i > 0 )
+            jitter_frame( copy ) ;
+        if( !get_frame(hands, &copy, status, version, convert) )
+            break ;
+        sample.gesture = Gesture( hands[0], hands[1] ) ;
+        samples.push_back( sample ) ;
+    }
+
+    return ;
+
+}
+
+/*----------read_labelled_path-------------------------------------------------------
+
+  PURPOSE:  Function to read the labelled gestures of a capture or session, or of
+            every .frm file in a directory, in name order. Sessions that can not be
+            labelled are skipped with a warning.
+
+  INPUT PARAMETERS: path     -- the file or directory.
+                    index    -- the gesture index, for labelling sessions.
+                    copies   -- the copies of each captured frame.
+                    optional -- true if a missing directory is not an error.
+                    samples  -- receives the labelled gestures.
+
+  RETURN VALUE:  true if the path was read
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool read_labelled_path( const char* path, const GestureIndex &index, unsigned int copies, bool optional, vector<Labelled> &samples ){
+
+    struct stat info ;         /* The type of the path. */
+    DIR* dir ;                 /* The directory. */
+    struct dirent* entry ;     /* The next file. */
+    vector<string> names ;     /* The files to read. */
+    string error ;             /* The reason a file could not be read. */
+    unsigned int i ;           /* An iterator. */
+
+    if( stat(path, &info) == -1 ){
+        if( !optional )
+            fprintf( stderr, "*** Unable to read %s ***\n", path ) ;
+        return optional ;
+    }
+    if( S_ISDIR(info.st_mode) ){
+        if( (dir = opendir(path)) == NULL ){
+            fprintf( stderr, "*** Unable to read %s ***\n", path ) ;
+            return false ;
+        }
+        while( (entry = readdir(dir)) != NULL ){
+            string name = entry->d_name ;
+            if( (name.size() > 4) && (name.compare(name.size() - 4, 4, ".frm") == 0) )
+                names.push_back( string(path) + "/" + name ) ;
+        }
+        closedir( dir ) ;
+        sort( names.begin(), names.end() ) ;
+    }
+    else{
+        names.push_back( path ) ;
+    }
+    for( i = 0 ; i < names.size() ; i++ ){
+        if( !read_labelled(names[i].c_str(), index, copies, samples, error) )
+            fprintf( stderr, "Skipped %s: %s\n", names[i].c_str(), error.c_str() ) ;
+    }
+
+    return true ;
+
+}
@@ -0,0 +1,44 @@
+/***********forest_data.h***********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the type "Labelled", a gesture together with the
+            text it should be recognized as, and supplies the prototypes of
+            read_labelled(), read_labelled_row(), and read_labelled_path(), which
+            read the labelled gestures of captures, sessions, and rows of the
+            gesture table for training and measuring the decision forest. Forest_train.cpp and forest_bench.cpp include this
+            file.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef FOREST_DATA_H
+#define FOREST_DATA_H
+
+#include <string>
+#include <vector>
+#include "../GestureIndex.h"
+#include "gesture_dump.h"
+
+using namespace std ;
+
+#define FOREST_JITTER_FLEX     15   /* Chance of moving each flex value of a capture copy by one step, in percent. */
+#define FOREST_JITTER_CONTACT   1   /* Chance of flipping each contact sensor of a capture copy, in percent. */
+#define FOREST_JITTER_ACCEL    60   /* Largest change to each accelerometer value of a capture copy, in counts. */
+#define FOREST_GAP_DISTANCE     4   /* Cost of a session frame between letters, as a distance in flex steps. */
+
+struct Labelled {                /* A gesture and the text it should be recognized as. */
+    Gesture gesture ;
+    string label ;
+} ;
+
+bool read_labelled( const char* fName, const GestureIndex &index, unsigned int copies, vector<Labelled> &samples, string &error ) ;
+void read_labelled_row( const Row &row, unsigned int copies, vector<Labelled> &samples ) ;
+bool read_labelled_path( const char* path, const GestureIndex &index, unsigned int copies, bool optional, vector<Labelled> &samples ) ;
+
+#endif
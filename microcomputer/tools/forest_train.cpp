@@ -0,0 +1,518 @@
+/***********forest_train.cpp********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  Trains the decision forest that gesture_to_text() falls back on when a
+            pose matches no gesture exactly, and writes it out as the C++ tables of
+            GestureForestModel.cpp, so that it is compiled into sign2speech. The
+            labelled gestures are read by read_labelled(): captures are labelled with
+            their file name, and sessions with the letters of their label, aligned to
+            the gestures of the gesture table. A directory stands for every .frm file
+            in it. A gesture of the table with no capture, such as the pause between
+            words, is trained on from its row of the table.
+
+            Each tree is grown on a bootstrap sample of the gestures, splitting each
+            node on the best of a random FOREST_TRY_FEATURES features by information
+            gain, until it is pure or FOREST_DEPTH levels deep. The gestures left out
+            of each tree's sample give the out of bag accuracy, and the forest
+            written is loaded back through GestureForest and checked against every
+            gesture before returning. Both flatter the forest, as the jittered copies
+            of a frame are left out of a sample one at a time, so the accuracy that
+            counts is the one on the held out files given with -t, which are read
+            as recorded and not trained on.
+
+            Usage: forest_train [-d gesture_db.sql] [-o GestureForestModel.cpp] [-c copies] [-s seed] [-t held out] [file or directory ...]
+
+            -d  the gesture table, a MySQL dump, that sessions are aligned to.
+            -o  the tables to write.
+            -c  the copies of each captured frame, all but the first with jitter.
+            -s  the seed for the bootstrap samples, features, and jitter.
+            -t  a file or directory to measure the forest on instead of training on
+                it. May be given more than once.
+
+            Without files, the alphabet and numbers captures and any sessions in
+            ../gesture_data/sessions are trained on, aligned to tools/gesture_db.sql,
+            as "make forest" does from the microcomputer directory.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include <unistd.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+#include "../GestureForest.h"
+#include "gesture_dump.h"
+#include "forest_data.h"
+
+#define FOREST_COPIES       200  /* Default copies of each captured frame. */
+#define FOREST_TRY_FEATURES   8  /* Features tried at each node, about the square root of FOREST_FEATURES. */
+#define FOREST_MIN_SPLIT      2  /* Fewest gestures a node must hold to be split. */
+
+using namespace std ;
+
+struct Trainer {                         /* The gestures being trained on. */
+    vector<int16_t> features ;           /* FOREST_FEATURES features of each gesture. */
+    vector<uint8_t> labels ;             /* The class of each gesture. */
+    unsigned int classes ;               /* Number of classes. */
+    vector<ForestNode> nodes ;           /* The nodes of every tree. */
+    vector<uint8_t> leaves ;             /* The leaves of every tree. */
+} ;
+
+void grow( Trainer &trainer, unsigned int tree, unsigned int node, unsigned int depth, vector<unsigned int> &members ) ;
+void fill( Trainer &trainer, unsigned int tree, unsigned int node, unsigned int depth, uint8_t label ) ;
+bool best_split( const Trainer &trainer, const vector<unsigned int> &members, unsigned int feature,
+                 double &score, int16_t &threshold ) ;
+bool write_model( const char* fName, const Trainer &trainer, const vector<string> &text, double oob ) ;
+
+int main( int argc, char* argv[] ){
+
+    const char* dbFName = "tools/gesture_db.sql" ;    /* The gesture table. */
+    const char* outfName = "GestureForestModel.cpp" ;  /* The tables to write. */
+    const char* defaultPaths[] = { "../gesture_data/alphabet_frames", "../gesture_data/numbers_frames" } ;
+    unsigned int copies = FOREST_COPIES ;    /* Copies of each captured frame. */
+    unsigned int seed = 1 ;                  /* Seed for the random choices. */
+    GestureIndex index ;                     /* The gesture table. */
+    vector<Row> rows ;                       /* The rows of the gesture table. */
+    map<string, unsigned int> rowsOf ;       /* Number of rows of each gesture. */
+    vector<Labelled> samples ;               /* The labelled gestures. */
+    vector<const char*> testPaths ;          /* The held out files. */
+    vector<Labelled> heldOut ;               /* The labelled gestures of the held out files. */
+    unsigned int heldOutHits = 0 ;           /* Number of held out gestures the written forest gets right. */
+    map<string, unsigned int> classOf ;      /* The class of each label. */
+    vector<string> text ;                    /* The label of each class. */
+    Trainer trainer ;                        /* The gestures being trained on. */
+    vector<unsigned int> members ;           /* The bootstrap sample of a tree. */
+    vector<bool> inBag ;                     /* True for each gesture in the bootstrap sample. */
+    vector<uint8_t> oobVotes ;               /* Votes for each class from the trees each gesture was left out of. */
+    unsigned int oobCounted = 0 ;            /* Number of gestures left out of at least one tree. */
+    unsigned int oobHits = 0 ;               /* Number of those the trees they were left out of got right. */
+    unsigned int hits = 0 ;                  /* Number of gestures the written forest gets right. */
+    ForestModel model ;                      /* The trained forest. */
+    ForestResult result ;                    /* The class of a gesture. */
+    double oob ;                             /* Out of bag accuracy, in percent. */
+    size_t n ;                               /* Number of gestures. */
+    unsigned int i ;                         /* An iterator. */
+    unsigned int j ;                         /* An iterator. */
+    unsigned int t ;                         /* An iterator over the trees. */
+    int opt ;                                /* The next command line option. */
+
+    while( (opt = getopt(argc, argv, "d:o:c:s:t:")) != -1 ){
+        switch( opt ){
+            case 'd': dbFName = optarg ; break ;
+            case 'o': outfName = optarg ; break ;
+            case 'c': copies = atoi( optarg ) ; break ;
+            case 's': seed = atoi( optarg ) ; break ;
+            case 't': testPaths.push_back( optarg ) ; break ;
+            default:
+                fprintf( stderr, "Usage: %s [-d gesture_db.sql] [-o GestureForestModel.cpp] [-c copies] [-s seed] [-t held out] [file or directory ...]\n", argv[0] ) ;
+                return EXIT_FAILURE ;
+        }
+    }
+    if( copies == 0 )
+        copies = 1 ;
+    if( !load_dump(dbFName, index) ){
+        fprintf( stderr, "*** Unable to read gestures from %s ***\n", dbFName ) ;
+        return EXIT_FAILURE ;
+    }
+    srand( seed ) ;
+    if( optind < argc ){
+        for( opt = optind ; opt < argc ; opt++ ){
+            if( !read_labelled_path(argv[opt], index, copies, false, samples) )
+                return EXIT_FAILURE ;
+        }
+    }
+    else{
+        for( i = 0 ; i < (sizeof(defaultPaths) / sizeof(defaultPaths[0])) ; i++ ){
+            if( !read_labelled_path(defaultPaths[i], index, copies, false, samples) )
+                return EXIT_FAILURE ;
+        }
+        read_labelled_path( "../gesture_data/sessions", index, copies, true, samples ) ;
+    }
+    /* Gestures of the table that nothing was read for, such as the pause between words,
+       are trained on from their row. A two-handed sign has two rows, and is left out. */
+    for( i = 0 ; i < samples.size() ; i++ ){
+        classOf[samples[i].label] = 0 ;
+    }
+    if( read_dump(dbFName, rows) ){
+        for( i = 0 ; i < rows.size() ; i++ ){
+            rowsOf[rows[i].gest]++ ;
+        }
+        for( i = 0 ; i < rows.size() ; i++ ){
+            if( !classOf.count(rows[i].gest) && (rowsOf[rows[i].gest] == 1) )
+                read_labelled_row( rows[i], copies, samples ) ;
+        }
+    }
+    if( samples.empty() ){
+        fprintf( stderr, "*** No labelled gestures were read ***\n" ) ;
+        return EXIT_FAILURE ;
+    }
+    for( i = 0 ; i < testPaths.size() ; i++ ){
+        if( !read_labelled_path(testPaths[i], index, 1, false, heldOut) )
+            return EXIT_FAILURE ;
+    }
+    /* Number the classes in label order. */
+    for( i = 0 ; i < samples.size() ; i++ ){
+        classOf[samples[i].label] = 0 ;
+    }
+    if( classOf.size() > FOREST_MAX_CLASSES ){
+        fprintf( stderr, "*** %u labels is more than the %u classes a forest can hold ***\n", (unsigned int)classOf.size(),
+                 FOREST_MAX_CLASSES ) ;
+        return EXIT_FAILURE ;
+    }
+    for( map<string, unsigned int>::iterator it = classOf.begin() ; it != classOf.end() ; ++it ){
+        it->second = text.size() ;
+        text.push_back( it->first ) ;
+    }
+    n = samples.size() ;
+    trainer.classes = text.size() ;
+    trainer.features.resize( n * FOREST_FEATURES ) ;
+    trainer.labels.resize( n ) ;
+    for( i = 0 ; i < n ; i++ ){
+        GestureForest::Features( samples[i].gesture, &trainer.features[i * FOREST_FEATURES] ) ;
+        trainer.labels[i] = classOf[samples[i].label] ;
+    }
+    trainer.nodes.resize( FOREST_TREES * FOREST_NODES ) ;
+    trainer.leaves.resize( FOREST_TREES * FOREST_LEAVES ) ;
+    oobVotes.assign( n * trainer.classes, 0 ) ;
+    for( t = 0 ; t < FOREST_TREES ; t++ ){
+        members.clear() ;
+        inBag.assign( n, false ) ;
+        for( i = 0 ; i < n ; i++ ){
+            j = (unsigned int)(((double)rand() / ((double)RAND_MAX + 1.0)) * n) ;
+            members.push_back( j ) ;
+            inBag[j] = true ;
+        }
+        grow( trainer, t, 0, 0, members ) ;
+        /* Let the gestures left out of the sample vote through this tree alone. */
+        for( i = 0 ; i < n ; i++ ){
+            if( inBag[i] )
+                continue ;
+            const ForestNode* nodes = &trainer.nodes[t * FOREST_NODES] ;
+            const int16_t* f = &trainer.features[i * FOREST_FEATURES] ;
+            unsigned int node = 0 ;
+            for( j = 0 ; j < FOREST_DEPTH ; j++ ){
+                node = 2 * node + 1 + (f[nodes[node].feature] > nodes[node].threshold) ;
+            }
+            oobVotes[i * trainer.classes + trainer.leaves[t * FOREST_LEAVES + (node - FOREST_NODES)]]++ ;
+        }
+    }
+    for( i = 0 ; i < n ; i++ ){
+        const uint8_t* votes = &oobVotes[i * trainer.classes] ;
+        unsigned int best = 0 ;
+        for( j = 1 ; j < trainer.classes ; j++ ){
+            best = (votes[j] > votes[best]) ? j : best ;
+        }
+        if( votes[best] == 0 )
+            continue ;
+        oobCounted++ ;
+        if( best == trainer.labels[i] )
+            oobHits++ ;
+    }
+    oob = oobCounted ? (100.0 * oobHits) / oobCounted : 0.0 ;
+    /* Check the tables through the classifier sign2speech uses. */
+    vector<const char*> names( text.size() ) ;
+    for( i = 0 ; i < text.size() ; i++ ){
+        names[i] = text[i].c_str() ;
+    }
+    model.classes = trainer.classes ;
+    model.text = &names[0] ;
+    model.nodes = &trainer.nodes[0] ;
+    model.leaves = &trainer.leaves[0] ;
+    GestureForest forest( model ) ;
+    for( i = 0 ; i < n ; i++ ){
+        if( forest.Classify(samples[i].gesture, result) && (result.label == trainer.labels[i]) )
+            hits++ ;
+    }
+    for( i = 0 ; i < heldOut.size() ; i++ ){
+        if( forest.Classify(heldOut[i].gesture, result) && (heldOut[i].label == forest.Text(result.label)) )
+            heldOutHits++ ;
+    }
+    if( !write_model(outfName, trainer, text, oob) ){
+        fprintf( stderr, "*** Unable to write %s ***\n", outfName ) ;
+        return EXIT_FAILURE ;
+    }
+    fprintf( stdout, "Gestures:\t%u (%u classes)\n", (unsigned int)n, trainer.classes ) ;
+    fprintf( stdout, "Forest:\t\t%u trees, %u levels, %u bytes of tables\n", FOREST_TREES, FOREST_DEPTH,
+             (unsigned int)(trainer.nodes.size() * sizeof(ForestNode) + trainer.leaves.size()) ) ;
+    fprintf( stdout, "Out of bag:\t%5.1f%% correct\n", oob ) ;
+    fprintf( stdout, "Training:\t%5.1f%% correct\n", (100.0 * hits) / n ) ;
+    if( !heldOut.empty() )
+        fprintf( stdout, "Held out:\t%5.1f%% correct on %u gestures\n", (100.0 * heldOutHits) / heldOut.size(),
+                 (unsigned int)heldOut.size() ) ;
+    fprintf( stdout, "Wrote:\t\t%s\n", outfName ) ;
+
+    return EXIT_SUCCESS ;
+
+}
+
+/*----------grow---------------------------------------------------------------------
+
+  PURPOSE:  Function to grow a node of a tree, and the nodes below it, from the
+            gestures that reach it. A node that is pure, too deep, or can not be
+            split becomes a leaf of its most common class.
+
+  INPUT PARAMETERS: trainer -- the gestures, and the tree being grown.
+                    tree    -- the tree.
+                    node    -- the node, as a position in the tree's heap.
+                    depth   -- the level of the node, 0 for the root.
+                    members -- the gestures that reach the node. Reordered.
+
+-----------------------------------------------------------------------------------*/
+
+void grow( Trainer &trainer, unsigned int tree, unsigned int node, unsigned int depth, vector<unsigned int> &members ){
+
+    unsigned int counts[FOREST_MAX_CLASSES] = { 0 } ;  /* Gestures of each class. */
+    unsigned int order[FOREST_FEATURES] ;    /* The features, in the order they are tried. */
+    unsigned int majority = 0 ;              /* The most common class. */
+    unsigned int bestFeature = 0 ;           /* The feature of the best split. */
+    int16_t bestThreshold = 0 ;              /* The threshold of the best split. */
+    double bestScore = 0.0 ;                 /* The score of the best split, higher is better. */
+    double score ;                           /* The score of a split. */
+    int16_t threshold ;                      /* The threshold of a split. */
+    unsigned int tried ;                     /* Number of features tried that split the node. */
+    unsigned int i ;                         /* An iterator. */
+    unsigned int j ;                         /* An iterator. */
+
+    for( i = 0 ; i < members.size() ; i++ ){
+        counts[trainer.labels[members[i]]]++ ;
+    }
+    for( i = 1 ; i < trainer.classes ; i++ ){
+        majority = (counts[i] > counts[majority]) ? i : majority ;
+    }
+    if( (depth == FOREST_DEPTH) || (counts[majority] == members.size()) || (members.size() < FOREST_MIN_SPLIT) ){
+        fill( trainer, tree, node, depth, majority ) ;
+        return ;
+    }
+    /* Try FOREST_TRY_FEATURES features at random. Features that are the same for every gesture
+       at the node, such as those of a hand that was not worn, do not count. */
+    for( i = 0 ; i < FOREST_FEATURES ; i++ ){
+        order[i] = i ;
+    }
+    for( i = 0, tried = 0 ; (i < FOREST_FEATURES) && (tried < FOREST_TRY_FEATURES) ; i++ ){
+        j = i + (unsigned int)(((double)rand() / ((double)RAND_MAX + 1.0)) * (FOREST_FEATURES - i)) ;
+        swap( order[i], order[j] ) ;
+        if( !best_split(trainer, members, order[i], score, threshold) )
+            continue ;
+        if( (tried++ == 0) || (score > bestScore) ){
+            bestScore = score ;
+            bestFeature = order[i] ;
+            bestThreshold = threshold ;
+        }
+    }
+    if( tried == 0 ){
+        fill( trainer, tree, node, depth, majority ) ;
+        return ;
+    }
+    ForestNode &split = trainer.nodes[tree * FOREST_NODES + node] ;
+    split.feature = bestFeature ;
+    split.threshold = bestThreshold ;
+    split.reserved = 0 ;
+    vector<unsigned int> left ;
+    vector<unsigned int> right ;
+    for( i = 0 ; i < members.size() ; i++ ){
+        if( trainer.features[members[i] * FOREST_FEATURES + bestFeature] > bestThreshold )
+            right.push_back( members[i] ) ;
+        else
+            left.push_back( members[i] ) ;
+    }
+    members.clear() ;
+    grow( trainer, tree, 2 * node + 1, depth + 1, left ) ;
+    grow( trainer, tree, 2 * node + 2, depth + 1, right ) ;
+
+    return ;
+
+}
+
+/*----------fill---------------------------------------------------------------------
+
+  PURPOSE:  Function to make a node a leaf of a class. A node above the last level
+            becomes a node that always goes left, with every leaf below it set to the
+            class, so the classifier walks every tree to the same depth.
+
+-----------------------------------------------------------------------------------*/
+
+void fill( Trainer &trainer, unsigned int tree, unsigned int node, unsigned int depth, uint8_t label ){
+
+    if( depth == FOREST_DEPTH ){
+        trainer.leaves[tree * FOREST_LEAVES + (node - FOREST_NODES)] = label ;
+        return ;
+    }
+    ForestNode &padding = trainer.nodes[tree * FOREST_NODES + node] ;
+    padding.feature = 0 ;
+    padding.threshold = INT16_MAX ;
+    padding.reserved = 0 ;
+    fill( trainer, tree, 2 * node + 1, depth + 1, label ) ;
+    fill( trainer, tree, 2 * node + 2, depth + 1, label ) ;
+
+    return ;
+
+}
+
+/*----------xlogx-------------------------------------------------------------------
+
+  PURPOSE:  Function to find x log x, taken as 0 for 0, for the entropy of a split.
+
+-----------------------------------------------------------------------------------*/
+
+static inline double xlogx( double x ){
+
+    return (x > 0.0) ? x * log( x ) : 0.0 ;
+
+}
+
+/*----------best_split---------------------------------------------------------------
+
+  PURPOSE:  Function to find the threshold on a feature that best splits the gestures
+            that reach a node, by information gain. The score is the negated sum
+            over both sides of the count of the side times its entropy, which is
+            highest for the split with the least weighted entropy. Unlike Gini
+            impurity, which with this many classes prefers to split a single class
+            off at a time and so runs out of levels, entropy favours splits that
+            halve the classes left.
+
+  INPUT PARAMETERS: trainer   -- the gestures.
+                    members   -- the gestures that reach the node.
+                    feature   -- the feature to split on.
+                    score     -- set to the score of the best split.
+                    threshold -- set to the largest value that goes left.
+
+  RETURN VALUE:  true if the feature takes more than one value at the node
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool best_split( const Trainer &trainer, const vector<unsigned int> &members, unsigned int feature,
+                 double &score, int16_t &threshold ){
+
+    vector< pair<int16_t, uint8_t> > values ;          /* The value and class of each gesture. */
+    unsigned int leftCounts[FOREST_MAX_CLASSES] = { 0 } ;   /* Gestures of each class left of the threshold. */
+    unsigned int rightCounts[FOREST_MAX_CLASSES] = { 0 } ;  /* Gestures of each class right of the threshold. */
+    double leftSum = 0.0 ;                             /* Sum of count log count over the classes on the left. */
+    double rightSum = 0.0 ;                            /* Sum of count log count over the classes on the right. */
+    double s ;                                         /* The score of a threshold. */
+    bool found = false ;                               /* True once a threshold has been scored. */
+    size_t n = members.size() ;                        /* Number of gestures. */
+    size_t i ;                                         /* An iterator. */
+    unsigned int c ;                                   /* The class of a gesture. */
+
+    values.reserve( n ) ;
+    for( i = 0 ; i < n ; i++ ){
+        values.push_back( make_pair(trainer.features[members[i] * FOREST_FEATURES + feature], trainer.labels[members[i]]) ) ;
+        rightCounts[values[i].second]++ ;
+    }
+    sort( values.begin(), values.end() ) ;
+    if( values.front().first == values.back().first )
+        return false ;
+    for( c = 0 ; c < trainer.classes ; c++ ){
+        rightSum += xlogx( rightCounts[c] ) ;
+    }
+    for( i = 0 ; (i + 1) < n ; i++ ){
+        c = values[i].second ;
+        leftSum += xlogx( leftCounts[c] + 1 ) - xlogx( leftCounts[c] ) ;
+        rightSum += xlogx( rightCounts[c] - 1 ) - xlogx( rightCounts[c] ) ;
+        leftCounts[c]++ ;
+        rightCounts[c]-- ;
+        if( values[i].first == values[i + 1].first )
+            continue ;
+        /* n H = n log n - sum of count log count, for each side. */
+        s = (leftSum - xlogx(i + 1)) + (rightSum - xlogx(n - i - 1)) ;
+        if( !found || (s > score) ){
+            score = s ;
+            threshold = values[i].first ;
+            found = true ;
+        }
+    }
+
+    return found ;
+
+}
+
+/*----------write_model--------------------------------------------------------------
+
+  PURPOSE:  Function to write the trained forest as the C++ tables compiled into
+            sign2speech. The tables only compile against the same forest layout.
+
+  RETURN VALUE:  true if the tables were written
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool write_model( const char* fName, const Trainer &trainer, const vector<string> &text, double oob ){
+
+    FILE* fp = fopen( fName, "w" ) ;   /* The tables. */
+    const char* base = strrchr( fName, '/' ) ;  /* The name of the file, without its directory. */
+    char date[16] ;                    /* Today's date. */
+    time_t now = time( NULL ) ;        /* The current time. */
+    size_t i ;                         /* An iterator. */
+    size_t j ;                         /* An iterator. */
+
+    if( fp == NULL )
+        return false ;
+    base = (base != NULL) ? base + 1 : fName ;
+    strftime( date, sizeof(date), "%m/%d/%Y", localtime(&now) ) ;
+    fprintf( fp, "/***********%s", base ) ;
+    for( i = strlen(base) + 11 ; i < 84 ; i++ ){
+        fputc( '*', fp ) ;
+    }
+    fprintf( fp, "\n\n"
+                 "  By:       Timothy Miskell\n"
+                 "            Virinchi Balabhadrapatruni\n"
+                 "            16.499 Capstone Proposal\n"
+                 "            ECE Department\n"
+                 "            Umass Lowell\n\n"
+                 "  PURPOSE:  The decision forest compiled into sign2speech, as trained by\n"
+                 "            tools/forest_train on %u labelled gestures of %u classes, with an\n"
+                 "            out of bag accuracy of %.1f%%. Written by \"make forest\"; do not edit.\n\n"
+                 "  CHANGES:  %s\n\n"
+                 "************************************************************************************/\n\n"
+                 "#include \"GestureForest.h\"\n\n"
+                 "/* The tables only hold a forest of the layout they were trained for. */\n"
+                 "typedef char forest_layout_check[((FOREST_TREES == %u) && (FOREST_DEPTH == %u) && (FOREST_FEATURES == %u)) ? 1 : -1] ;\n\n",
+             (unsigned int)trainer.labels.size(), trainer.classes, oob, date, FOREST_TREES, FOREST_DEPTH, FOREST_FEATURES ) ;
+    fprintf( fp, "static const char* const forestText[%u] = {", trainer.classes ) ;
+    for( i = 0 ; i < text.size() ; i++ ){
+        fprintf( fp, "%s\"", (i % 12) ? " " : "\n    " ) ;
+        for( j = 0 ; j < text[i].size() ; j++ ){
+            if( (text[i][j] == '"') || (text[i][j] == '\\') )
+                fputc( '\\', fp ) ;
+            fputc( text[i][j], fp ) ;
+        }
+        fprintf( fp, "\"%s", ((i + 1) < text.size()) ? "," : "" ) ;
+    }
+    fprintf( fp, "\n} ;\n\n" ) ;
+    fprintf( fp, "static const ForestNode forestNodes[FOREST_TREES * FOREST_NODES] = {" ) ;
+    for( i = 0 ; i < trainer.nodes.size() ; i++ ){
+        if( (i % FOREST_NODES) == 0 )
+            fprintf( fp, "\n    /* Tree %u */", (unsigned int)(i / FOREST_NODES) ) ;
+        if( ((i % FOREST_NODES) % 6) == 0 )
+            fprintf( fp, "\n   " ) ;
+        fprintf( fp, " { %d, %u, 0 }%s", trainer.nodes[i].threshold, trainer.nodes[i].feature,
+                 ((i + 1) < trainer.nodes.size()) ? "," : "" ) ;
+    }
+    fprintf( fp, "\n} ;\n\n" ) ;
+    fprintf( fp, "static const uint8_t forestLeaves[FOREST_TREES * FOREST_LEAVES] = {" ) ;
+    for( i = 0 ; i < trainer.leaves.size() ; i++ ){
+        if( (i % FOREST_LEAVES) == 0 )
+            fprintf( fp, "\n    /* Tree %u */", (unsigned int)(i / FOREST_LEAVES) ) ;
+        if( ((i % FOREST_LEAVES) % 16) == 0 )
+            fprintf( fp, "\n   " ) ;
+        fprintf( fp, " %u%s", trainer.leaves[i], ((i + 1) < trainer.leaves.size()) ? "," : "" ) ;
+    }
+    fprintf( fp, "\n} ;\n\n" ) ;
+    fprintf( fp, "const ForestModel gestureForestModel = { %u, forestText, forestNodes, forestLeaves } ;\n", trainer.classes ) ;
+
+    return fclose( fp ) == 0 ;
+
+}
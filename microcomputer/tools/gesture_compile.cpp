@@ -0,0 +1,311 @@
+/***********gesture_compile.cpp******************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  Compiles the gesture captures into the file that sign2speech maps at
+            startup in place of querying the gesture database, and loads again
+            whenever it is replaced while running. The gestures are
+            read from a MySQL dump such as gesture_db.sql and from every XML capture
+            in the given directories, as xml_import.py does; a capture replaces the
+            dump's gesture of the same name and hand. A capture whose hands both
+            hold values is compiled as a two-handed gesture. They are built
+            into a GestureIndex, so that the file holds exactly the tables the
+            program would otherwise build itself, and the file is loaded back and
+            compared before returning.
+
+            Usage: gesture_compile [-d gesture_db.sql] [-o gestures.idx] [xml_dir ...]
+
+            Without arguments, tools/gesture_db.sql and the alphabet_xml and
+            numbers_xml captures are compiled into ../gesture_data/gestures.idx.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "../lib/rapidxml/rapidxml.hpp"
+#include "../lib/rapidxml/rapidxml_utils.hpp"
+#include "gesture_dump.h"
+
+using namespace std ;
+using namespace rapidxml ;
+
+bool read_captures( const char* dName, vector<Row> &rows ) ;
+void merge_row( const Row &row, vector<Row> &rows ) ;
+bool read_capture( const string &fName, const string &gest, bool right, Row &row, bool &present ) ;
+bool same_entries( const GestureIndex &a, const GestureIndex &b ) ;
+
+int main( int argc, char* argv[] ){
+
+    const char* dumpFName = NULL ;                            /* The MySQL dump to compile, if any. */
+    const char* outfName = "../gesture_data/gestures.idx" ;   /* The compiled gesture file. */
+    const char* defaultDirs[] = { "../gesture_data/alphabet_xml", "../gesture_data/numbers_xml" } ;
+    vector<const char*> dirs ;                                /* The directories of XML captures to compile. */
+    vector<Row> rows ;                                        /* The gestures to compile. */
+    GestureIndex index ;                                      /* The gestures, as sign2speech builds them. */
+    GestureIndex loaded ;                                     /* The gestures, as loaded from the compiled file. */
+    struct timespec t0 ;                                      /* Start of the load. */
+    struct timespec t1 ;                                      /* End of the load. */
+    unsigned int conflicts = 0 ;                              /* Number of gestures sharing keys with the one before. */
+    size_t i ;                                                /* An iterator. */
+    int opt ;                                                 /* The next command line option. */
+
+    while( (opt = getopt(argc, argv, "d:o:")) != -1 ){
+        switch( opt ){
+            case 'd': dumpFName = optarg ; break ;
+            case 'o': outfName = optarg ; break ;
+            default:
+                fprintf( stderr, "Usage: %s [-d gesture_db.sql] [-o gestures.idx] [xml_dir ...]\n", argv[0] ) ;
+                return EXIT_FAILURE ;
+        }
+    }
+    for( opt = optind ; opt < argc ; opt++ ){
+        dirs.push_back( argv[opt] ) ;
+    }
+    if( (dumpFName == NULL) && dirs.empty() ){
+        dumpFName = "tools/gesture_db.sql" ;
+        dirs.assign( defaultDirs, defaultDirs + (sizeof(defaultDirs) / sizeof(defaultDirs[0])) ) ;
+    }
+    if( (dumpFName != NULL) && !read_dump(dumpFName, rows) ){
+        fprintf( stderr, "*** Unable to read gestures from %s ***\n", dumpFName ) ;
+        return EXIT_FAILURE ;
+    }
+    for( i = 0 ; i < dirs.size() ; i++ ){
+        if( !read_captures(dirs[i], rows) ){
+            fprintf( stderr, "*** Unable to read captures from %s ***\n", dirs[i] ) ;
+            return EXIT_FAILURE ;
+        }
+    }
+    if( rows.empty() ){
+        fprintf( stderr, "*** No gestures to compile ***\n" ) ;
+        return EXIT_FAILURE ;
+    }
+    for( i = 0 ; i < rows.size() ; i++ ){
+        index.Add( rows[i].right, rows[i].flex, rows[i].contact, rows[i].lsm303, rows[i].lsm9dof, rows[i].gest ) ;
+    }
+    index.Build() ;
+    /* Gestures that share a key can only be told apart by their accelerometer values. */
+    for( i = 1 ; i < index.Size() ; i++ ){
+        const GestureEntry &x = index.Entry( i ) ;
+        const GestureEntry &y = index.Entry( i - 1 ) ;
+        if( (x.hands == y.hands) && (memcmp(x.key, y.key, sizeof(x.key)) == 0) ){
+            fprintf( stderr, "Warning: \"%s\" has the same flex and contact values as \"%s\"\n",
+                     index.Text(i).c_str(), index.Text(i - 1).c_str() ) ;
+            conflicts++ ;
+        }
+    }
+    if( !index.Save(outfName) ){
+        fprintf( stderr, "*** Unable to write %s ***\n", outfName ) ;
+        return EXIT_FAILURE ;
+    }
+    clock_gettime( CLOCK_MONOTONIC, &t0 ) ;
+    if( !loaded.Load(outfName) ){
+        fprintf( stderr, "*** Unable to load %s after writing it ***\n", outfName ) ;
+        return EXIT_FAILURE ;
+    }
+    clock_gettime( CLOCK_MONOTONIC, &t1 ) ;
+    if( !same_entries(index, loaded) ){
+        fprintf( stderr, "*** %s does not hold the gestures it was compiled from ***\n", outfName ) ;
+        return EXIT_FAILURE ;
+    }
+    printf( "Compiled %u gestures into %s (%u sharing a key), loaded in %.1f us\n", (unsigned int)index.Size(), outfName,
+            conflicts, ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / 1000.0 ) ;
+
+    return EXIT_SUCCESS ;
+
+}
+
+/*----------read_captures------------------------------------------------------------
+
+  PURPOSE:  Function to read every XML capture in a directory. The gesture is named
+            after the file, so "A.xml" is the letter A and "space.xml" is a space.
+            Each hand with any nonzero value is read as a row of its own, and
+            GestureIndex::Build() pairs the rows of a two-handed gesture. Captures in
+            an older layout, such as one contact sensor per finger, are skipped with
+            a warning, as they are not in the gesture database either.
+
+  RETURN VALUE:  true if the directory was read
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool read_captures( const char* dName, vector<Row> &rows ){
+
+    DIR* dir = opendir( dName ) ;   /* The directory of captures. */
+    struct dirent* entry ;          /* The next file. */
+    vector<string> names ;          /* The captures, sorted by name. */
+    string gest ;                   /* The gesture of the next capture. */
+    Row row ;                       /* The next gesture. */
+    bool present ;                  /* True if the hand was used in the capture. */
+    size_t i ;                      /* An iterator. */
+    int side ;                      /* An iterator over the hands, right first. */
+
+    if( dir == NULL )
+        return false ;
+    while( (entry = readdir(dir)) != NULL ){
+        string name = entry->d_name ;
+        if( (name.size() > 4) && (name.compare(name.size() - 4, 4, ".xml") == 0) )
+            names.push_back( name ) ;
+    }
+    closedir( dir ) ;
+    sort( names.begin(), names.end() ) ;
+    for( i = 0 ; i < names.size() ; i++ ){
+        gest = names[i].substr( 0, names[i].size() - 4 ) ;
+        if( gest == "space" )
+            gest = " " ;
+        for( side = 1 ; side >= 0 ; side-- ){
+            if( !read_capture(string(dName) + "/" + names[i], gest, (side == 1), row, present) ){
+                fprintf( stderr, "Warning: skipping %s, its %s hand is not in the capture layout\n", names[i].c_str(),
+                         (side == 1) ? "right" : "left" ) ;
+                break ;
+            }
+            if( present )
+                merge_row( row, rows ) ;
+        }
+    }
+
+    return true ;
+
+}
+
+/*----------merge_row----------------------------------------------------------------
+
+  PURPOSE:  Function to add a gesture, replacing any gesture already read for the same
+            text and hand.
+
+-----------------------------------------------------------------------------------*/
+
+void merge_row( const Row &row, vector<Row> &rows ){
+
+    size_t i ;   /* An iterator. */
+
+    for( i = 0 ; i < rows.size() ; i++ ){
+        if( (rows[i].gest == row.gest) && (rows[i].right == row.right) ){
+            rows[i] = row ;
+            return ;
+        }
+    }
+    rows.push_back( row ) ;
+
+}
+
+/*----------read_capture-------------------------------------------------------------
+
+  PURPOSE:  Function to read one hand of an XML capture. The values are taken
+            in document order: the index to pinky flex sensors (the thumb has none
+            in the database), the contact sensors in the same order as
+            Hand::ContactSignature(), then the LSM303 and LSM9DOF values. A hand
+            that was not worn is captured as all zeros.
+
+  RETURN VALUE:  true if every value was found
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool read_capture( const string &fName, const string &gest, bool right, Row &row, bool &present ){
+
+    unsigned int flex = 0 ;      /* Number of flex values read, including the thumb. */
+    unsigned int contact = 0 ;   /* Number of contact values read. */
+    unsigned int lsm303 = 0 ;    /* Number of LSM303 values read. */
+    unsigned int lsm9dof = 0 ;   /* Number of LSM9DOF values read. */
+    unsigned int i ;             /* An iterator. */
+    xml_document<> doc ;         /* The capture. */
+    const char* side = right ? "right" : "left" ;   /* The hand to read. */
+    xml_node<>* hand ;           /* The hand. */
+    xml_node<>* part ;           /* A finger, fold, or accelerometer. */
+    xml_node<>* value ;          /* A sensor value. */
+
+    try{
+        file<> xmlFile( fName.c_str() ) ;
+        doc.parse<0>( xmlFile.data() ) ;
+        hand = doc.first_node( "gestures" )->first_node( "gesture" )->first_node( "hand" ) ;
+        while( (hand != NULL) && (strcmp(hand->first_attribute("side")->value(), side) != 0) )
+            hand = hand->next_sibling( "hand" ) ;
+        if( hand == NULL )
+            return false ;
+        for( part = hand->first_node() ; part != NULL ; part = part->next_sibling() ){
+            for( value = part->first_node() ; value != NULL ; value = value->next_sibling() ){
+                if( strcmp(part->name(), "lsm303") == 0 ){
+                    if( lsm303 < (INDEX_NUM_LSM303 * INDEX_LSM303_VALS) ){
+                        row.lsm303[lsm303 / INDEX_LSM303_VALS][lsm303 % INDEX_LSM303_VALS] = atof( value->value() ) ;
+                        lsm303++ ;
+                    }
+                }
+                else if( strcmp(part->name(), "lsm9dof") == 0 ){
+                    if( lsm9dof < (INDEX_NUM_LSM9DOF * INDEX_LSM9DOF_VALS) ){
+                        row.lsm9dof[lsm9dof / INDEX_LSM9DOF_VALS][lsm9dof % INDEX_LSM9DOF_VALS] = atof( value->value() ) ;
+                        lsm9dof++ ;
+                    }
+                }
+                else if( strcmp(value->name(), "flex") == 0 ){
+                    /* The first flex value is the thumb's. */
+                    if( (flex > 0) && (flex <= INDEX_NUM_FLEX) )
+                        row.flex[flex - 1] = atof( value->value() ) ;
+                    flex++ ;
+                }
+                else if( strncmp(value->name(), "contact-", strlen("contact-")) == 0 ){
+                    if( contact < INDEX_NUM_CONTACTS )
+                        row.contact[contact] = (strcmp(value->value(), "true") == 0) ;
+                    contact++ ;
+                }
+            }
+        }
+    } catch( ... ){
+        return false ;
+    }
+    present = false ;
+    for( i = 0 ; i < INDEX_NUM_FLEX ; i++ )
+        present = present || (row.flex[i] != 0) ;
+    for( i = 0 ; i < INDEX_NUM_CONTACTS ; i++ )
+        present = present || row.contact[i] ;
+    for( i = 0 ; i < (INDEX_NUM_LSM303 * INDEX_LSM303_VALS) ; i++ )
+        present = present || (row.lsm303[i / INDEX_LSM303_VALS][i % INDEX_LSM303_VALS] != 0) ;
+    for( i = 0 ; i < (INDEX_NUM_LSM9DOF * INDEX_LSM9DOF_VALS) ; i++ )
+        present = present || (row.lsm9dof[i / INDEX_LSM9DOF_VALS][i % INDEX_LSM9DOF_VALS] != 0) ;
+    row.right = right ;
+    row.gest = gest ;
+
+    return (flex == (INDEX_NUM_FLEX + 1)) && (contact == INDEX_NUM_CONTACTS) &&
+           (lsm303 == (INDEX_NUM_LSM303 * INDEX_LSM303_VALS)) && (lsm9dof == (INDEX_NUM_LSM9DOF * INDEX_LSM9DOF_VALS)) ;
+
+}
+
+/*----------same_entries-------------------------------------------------------------
+
+  PURPOSE:  Function to check that two indexes hold the same gestures in the same order.
+
+  RETURN VALUE:  true if they do
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool same_entries( const GestureIndex &a, const GestureIndex &b ){
+
+    size_t i ;   /* An iterator. */
+
+    if( a.Size() != b.Size() )
+        return false ;
+    for( i = 0 ; i < a.Size() ; i++ ){
+        const GestureEntry &x = a.Entry( i ) ;
+        const GestureEntry &y = b.Entry( i ) ;
+        if( (memcmp(x.key, y.key, sizeof(x.key)) != 0) || (x.hands != y.hands) || (x.signature != y.signature) || (x.gest != y.gest) ||
+            (memcmp(x.flex, y.flex, sizeof(x.flex)) != 0) || (memcmp(x.lsm303, y.lsm303, sizeof(x.lsm303)) != 0) ||
+            (memcmp(x.lsm9dof, y.lsm9dof, sizeof(x.lsm9dof)) != 0) )
+            return false ;
+    }
+
+    return true ;
+
+}
@@ -0,0 +1,112 @@
+/***********gesture_dump.cpp********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  The read_dump() and load_dump() functions are defined in this module.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <string.h>
+#include <fstream>
+#include <sstream>
+#include "gesture_dump.h"
+
+/*----------read_dump----------------------------------------------------------------
+
+  PURPOSE:  Function to read the gesture table from the VALUES(...) clauses of a
+            MySQL dump written by xml_import.py. The column order is hand, th_flex,
+            in_flex, mi_flex, ri_flex, pi_flex, the 13 contact sensors in the same
+            order as Hand::ContactSignature(), the LSM303 values, the LSM9DOF
+            values, and gest.
+
+-----------------------------------------------------------------------------------*/
+
+bool read_dump( const char* fName, vector<Row> &rows ){
+
+    ifstream input( fName ) ;   /* The MySQL dump. */
+    stringstream contents ;     /* The contents of the dump. */
+    string text ;               /* The contents of the dump. */
+    size_t pos = 0 ;            /* The current position within the dump. */
+    unsigned int i ;            /* An iterator. */
+    unsigned int j ;            /* An iterator. */
+
+    if( !input.is_open() )
+        return false ;
+    contents << input.rdbuf() ;
+    text = contents.str() ;
+    while( (pos = text.find("VALUES(", pos)) != string::npos ){
+        size_t end = text.find( ");", pos ) ;
+        if( end == string::npos )
+            return false ;
+        string values = text.substr( pos + strlen("VALUES("), end - pos - strlen("VALUES(") ) ;
+        for( i = 0 ; i < values.size() ; i++ ){
+            if( (values[i] == ',') || (values[i] == '\n') || (values[i] == '\t') )
+                values[i] = ' ' ;
+        }
+        istringstream fields( values ) ;
+        Row row ;
+        string hand ;
+        double thFlex ;
+        fields >> hand >> thFlex ;
+        row.right = (hand == "\"right\"") ;
+        for( i = 0 ; i < INDEX_NUM_FLEX ; i++ )
+            fields >> row.flex[i] ;
+        for( i = 0 ; i < INDEX_NUM_CONTACTS ; i++ ){
+            int c ;
+            fields >> c ;
+            row.contact[i] = (c != 0) ;
+        }
+        for( i = 0 ; i < INDEX_NUM_LSM303 ; i++ )
+            for( j = 0 ; j < INDEX_LSM303_VALS ; j++ )
+                fields >> row.lsm303[i][j] ;
+        for( i = 0 ; i < INDEX_NUM_LSM9DOF ; i++ )
+            for( j = 0 ; j < INDEX_LSM9DOF_VALS ; j++ )
+                fields >> row.lsm9dof[i][j] ;
+        getline( fields, row.gest ) ;
+        size_t q0 = row.gest.find( '"' ) ;
+        size_t q1 = row.gest.rfind( '"' ) ;
+        if( fields.fail() || (q0 == string::npos) || (q1 == q0) )
+            return false ;
+        row.gest = row.gest.substr( q0 + 1, q1 - q0 - 1 ) ;
+        rows.push_back( row ) ;
+        pos = end ;
+    }
+
+    return true ;
+
+}
+
+/*----------load_dump----------------------------------------------------------------
+
+  PURPOSE:  Function to read the gesture table from a MySQL dump into a gesture index,
+            as load_gesture_database() does from the database. A compiled gesture
+            file written by gesture_compile is loaded as is.
+
+  RETURN VALUE:  true if at least one gesture was read
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool load_dump( const char* fName, GestureIndex &index ){
+
+    vector<Row> rows ;  /* The gesture table. */
+    unsigned int i ;    /* An iterator. */
+
+    if( index.Load(fName) )
+        return index.Size() > 0 ;
+    if( !read_dump(fName, rows) || rows.empty() )
+        return false ;
+    for( i = 0 ; i < rows.size() ; i++ ){
+        index.Add( rows[i].right, rows[i].flex, rows[i].contact, rows[i].lsm303, rows[i].lsm9dof, rows[i].gest ) ;
+    }
+    index.Build() ;
+
+    return true ;
+
+}
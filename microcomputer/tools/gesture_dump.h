@@ -0,0 +1,39 @@
+/***********gesture_dump.h**********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  This header file defines the type "Row", a row of the gesture table, and
+            supplies the prototype of read_dump(), which reads the gesture table from
+            a MySQL dump so that the tools can build a gesture index without a
+            database server. Match_bench.cpp and replay.cpp include this file.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#ifndef GESTURE_DUMP_H
+#define GESTURE_DUMP_H
+
+#include <string>
+#include <vector>
+#include "../GestureIndex.h"
+
+using namespace std ;
+
+struct Row {                     /* A single row of the gesture table. */
+    bool right ;
+    double flex[INDEX_NUM_FLEX] ;
+    bool contact[INDEX_NUM_CONTACTS] ;
+    double lsm303[INDEX_NUM_LSM303][INDEX_LSM303_VALS] ;
+    double lsm9dof[INDEX_NUM_LSM9DOF][INDEX_LSM9DOF_VALS] ;
+    string gest ;
+} ;
+
+bool read_dump( const char* fName, vector<Row> &rows ) ;
+bool load_dump( const char* fName, GestureIndex &index ) ;
+
+#endif
@@ -0,0 +1,297 @@
+/***********lexicon_compile.cpp*****************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  Compiles a word list into the lexicon that the word decoder of
+            sign2speech maps at startup. The list is either Festival's part of
+            speech lexicon, such as wsj.wp39.poslexR in festlex_POSLEX.tar, or a
+            plain list with one word per line, optionally followed by its count.
+
+            The part of speech lexicon holds log P(word | tag). The count of each
+            tag is taken from its rarest word, which was seen once, so the count of
+            a word is the sum over its tags of P(word | tag) times the count of the
+            tag. A plain list without counts is taken to be in order of frequency,
+            and the counts follow Zipf's law.
+
+            Only words spelled with the letters A to Z are kept, in upper case, as
+            only those can be fingerspelled. Word pairs are counted from the text
+            files given with -b, if any. The lexicon is loaded back and compared
+            before returning.
+
+            Usage: lexicon_compile [-o lexicon.idx] [-n words] [-b text ...] word_list
+
+            The word list may be "-" to read from standard input, as "make lexicon"
+            does to read the lexicon straight out of festlex_POSLEX.tar.
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <unistd.h>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../Lexicon.h"
+
+#define DEFAULT_WORDS 20000   /* Number of words kept, unless given with -n. */
+
+using namespace std ;
+
+bool spelled_word( const string &word, string &upper ) ;
+bool read_word_list( istream &input, Lexicon &lexicon, unsigned int &read ) ;
+bool read_pairs( const char* fName, Lexicon &lexicon ) ;
+bool same_lexicon( const Lexicon &a, const Lexicon &b ) ;
+
+int main( int argc, char* argv[] ){
+
+    const char* outfName = "../gesture_data/lexicon.idx" ;   /* The compiled lexicon file. */
+    vector<const char*> pairFNames ;                         /* The text files to count word pairs in. */
+    unsigned int maxWords = DEFAULT_WORDS ;                  /* Number of words kept. */
+    unsigned int read = 0 ;                                  /* Number of words read. */
+    Lexicon lexicon ;                                        /* The words, as sign2speech decodes them. */
+    Lexicon loaded ;                                         /* The words, as loaded from the compiled file. */
+    ifstream file ;                                          /* The word list, unless read from standard input. */
+    size_t i ;                                               /* An iterator. */
+    int opt ;                                                /* The next command line option. */
+
+    while( (opt = getopt(argc, argv, "o:n:b:")) != -1 ){
+        switch( opt ){
+            case 'o': outfName = optarg ; break ;
+            case 'n': maxWords = (unsigned int)atoi( optarg ) ; break ;
+            case 'b': pairFNames.push_back( optarg ) ; break ;
+            default:
+                fprintf( stderr, "Usage: %s [-o lexicon.idx] [-n words] [-b text ...] word_list\n", argv[0] ) ;
+                return EXIT_FAILURE ;
+        }
+    }
+    if( optind != (argc - 1) ){
+        fprintf( stderr, "Usage: %s [-o lexicon.idx] [-n words] [-b text ...] word_list\n", argv[0] ) ;
+        return EXIT_FAILURE ;
+    }
+    if( strcmp(argv[optind], "-") != 0 ){
+        file.open( argv[optind] ) ;
+        if( !file.is_open() ){
+            fprintf( stderr, "*** Unable to open %s ***\n", argv[optind] ) ;
+            return EXIT_FAILURE ;
+        }
+    }
+    if( !read_word_list(file.is_open() ? file : cin, lexicon, read) ){
+        fprintf( stderr, "*** No words read from %s ***\n", argv[optind] ) ;
+        return EXIT_FAILURE ;
+    }
+    for( i = 0 ; i < pairFNames.size() ; i++ ){
+        if( !read_pairs(pairFNames[i], lexicon) ){
+            fprintf( stderr, "*** Unable to read %s ***\n", pairFNames[i] ) ;
+            return EXIT_FAILURE ;
+        }
+    }
+    lexicon.Build( maxWords ) ;
+    if( !lexicon.Save(outfName) ){
+        fprintf( stderr, "*** Unable to write %s ***\n", outfName ) ;
+        return EXIT_FAILURE ;
+    }
+    if( !loaded.Load(outfName) ){
+        fprintf( stderr, "*** Unable to load %s after writing it ***\n", outfName ) ;
+        return EXIT_FAILURE ;
+    }
+    if( !same_lexicon(lexicon, loaded) ){
+        fprintf( stderr, "*** %s does not hold the words it was compiled from ***\n", outfName ) ;
+        return EXIT_FAILURE ;
+    }
+    printf( "Compiled %u of %u words into %s\n", (unsigned int)lexicon.Size(), read, outfName ) ;
+
+    return EXIT_SUCCESS ;
+
+}
+
+/*----------spelled_word-------------------------------------------------------------
+
+  PURPOSE:  Function to check that a word can be fingerspelled, and convert it to
+            upper case.
+
+  RETURN VALUE:  true if the word is spelled with the letters A to Z only
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool spelled_word( const string &word, string &upper ){
+
+    size_t i ;   /* An iterator. */
+
+    upper = word ;
+    for( i = 0 ; i < upper.size() ; i++ ){
+        if( !isalpha((unsigned char)upper[i]) || ((unsigned char)upper[i] > 0x7F) )
+            return false ;
+        upper[i] = (char)toupper( (unsigned char)upper[i] ) ;
+    }
+
+    return !upper.empty() ;
+
+}
+
+/*----------read_word_list-----------------------------------------------------------
+
+  PURPOSE:  Function to add the words of a word list to the lexicon, in either of the
+            formats described above. Lines of the part of speech lexicon start with
+            a parenthesis, for example ("hello" ((uh -3.379) ) () ).
+
+  RETURN VALUE:  true if any word was read
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool read_word_list( istream &input, Lexicon &lexicon, unsigned int &read ){
+
+    vector<pair<string, vector<pair<string, double> > > > tagged ;  /* The words of the part of speech lexicon, with their tags. */
+    map<string, double> rarest ;   /* The log probability of the rarest word of each tag. */
+    string line ;                  /* The next line. */
+    string word ;                  /* The next word. */
+    string upper ;                 /* The word, in upper case. */
+    string tag ;                   /* The next tag. */
+    double logProb ;               /* The log probability of the word given the tag. */
+    double count ;                 /* The count of the word. */
+    unsigned int rank = 0 ;        /* The position of the word in a plain list. */
+    size_t open ;                  /* Position of the next tag. */
+    size_t i ;                     /* An iterator. */
+    size_t j ;                     /* An iterator. */
+
+    read = 0 ;
+    while( getline(input, line) ){
+        if( (line.size() > 2) && (line[0] == '(') && (line[1] == '"') ){
+            size_t quote = line.find( '"', 2 ) ;
+            if( quote == string::npos )
+                continue ;
+            word = line.substr( 2, quote - 2 ) ;
+            if( !spelled_word(word, upper) )
+                continue ;
+            tagged.push_back( make_pair(upper, vector<pair<string, double> >()) ) ;
+            open = line.find( "((", quote ) ;
+            if( open == string::npos )
+                continue ;
+            open++ ;
+            while( (open = line.find('(', open)) != string::npos ){
+                istringstream fields( line.substr(open + 1, line.find(')', open) - open - 1) ) ;
+                if( !(fields >> tag >> logProb) )
+                    break ;
+                tagged.back().second.push_back( make_pair(tag, logProb) ) ;
+                if( (rarest.count(tag) == 0) || (logProb < rarest[tag]) )
+                    rarest[tag] = logProb ;
+                open++ ;
+            }
+            continue ;
+        }
+        istringstream fields( line ) ;
+        if( !(fields >> word) || !spelled_word(word, upper) )
+            continue ;
+        rank++ ;
+        if( !(fields >> count) )
+            count = 1e6 / rank ;
+        lexicon.Add( upper, count ) ;
+        read++ ;
+    }
+    for( i = 0 ; i < tagged.size() ; i++ ){
+        count = 0.0 ;
+        for( j = 0 ; j < tagged[i].second.size() ; j++ ){
+            count += exp( tagged[i].second[j].second - rarest[tagged[i].second[j].first] ) ;
+        }
+        lexicon.Add( tagged[i].first, count ) ;
+        read++ ;
+    }
+
+    return read > 0 ;
+
+}
+
+/*----------read_pairs---------------------------------------------------------------
+
+  PURPOSE:  Function to count the word pairs of a text file. Anything but a letter or
+            an apostrophe separates words, and a word that can not be fingerspelled
+            breaks the pair.
+
+  RETURN VALUE:  true if the file was read
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool read_pairs( const char* fName, Lexicon &lexicon ){
+
+    ifstream input( fName ) ;   /* The text file. */
+    string prev ;               /* The previous word, empty after a break. */
+    string word ;               /* The next word. */
+    string upper ;              /* The word, in upper case. */
+    char c ;                    /* The next character. */
+
+    if( !input.is_open() )
+        return false ;
+    while( input.get(c) || !word.empty() ){
+        if( input && (isalpha((unsigned char)c) || (c == '\'')) ){
+            word += c ;
+            continue ;
+        }
+        if( word.empty() )
+            continue ;
+        if( spelled_word(word, upper) ){
+            if( !prev.empty() )
+                lexicon.AddPair( prev, upper, 1.0 ) ;
+            prev = upper ;
+        }
+        else
+            prev.clear() ;
+        word.clear() ;
+        if( !input )
+            break ;
+    }
+
+    return true ;
+
+}
+
+/*----------same_lexicon-------------------------------------------------------------
+
+  PURPOSE:  Function to check that two lexicons hold the same trie, words, and word
+            pairs.
+
+  RETURN VALUE:  true if they do
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool same_lexicon( const Lexicon &a, const Lexicon &b ){
+
+    vector<pair<uint32_t, uint32_t> > stack ;   /* The nodes left to compare. */
+    uint32_t i ;                                /* An iterator. */
+
+    if( a.Size() != b.Size() )
+        return false ;
+    for( i = 0 ; i < a.Size() ; i++ ){
+        if( (strcmp(a.WordText(i), b.WordText(i)) != 0) || (a.WordCost(i) != b.WordCost(i)) ||
+            (a.PairCost(0, i) != b.PairCost(0, i)) )
+            return false ;
+    }
+    stack.push_back( make_pair((uint32_t)LEXICON_ROOT, (uint32_t)LEXICON_ROOT) ) ;
+    while( !stack.empty() ){
+        const LexiconNode &x = a.Node( stack.back().first ) ;
+        const LexiconNode &y = b.Node( stack.back().second ) ;
+        stack.pop_back() ;
+        if( memcmp(&x, &y, sizeof(LexiconNode)) != 0 )
+            return false ;
+        for( i = 0 ; i < x.numChildren ; i++ ){
+            stack.push_back( make_pair(x.firstChild + i, y.firstChild + i) ) ;
+        }
+    }
+
+    return true ;
+
+}
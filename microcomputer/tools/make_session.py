@@ -0,0 +1,203 @@
+#!/usr/bin/python
+from __future__ import with_statement
+
+import sys
+import os
+import re
+import math
+import random
+import struct
+import zlib
+import argparse
+
+from xml_to_frames import FRAME_MAGIC, FRAME_VERSION, FRAME_FORMAT, FRAME_SIZE, FRAME_CONNECTED, FRAME_PRESENT, read_frames
+
+# Session timing defaults, in seconds.
+RATE = 100.0          # Frames per second, the rate i2c_transfer samples at.
+HOLD = 0.5            # Time each letter is held.
+MOVE = 0.25           # Time spent moving from one letter to the next.
+KEY_HOLD = 0.05       # Time each keyframe of a letter that involves motion is held.
+KEY_MOVE = 0.1        # Time spent moving between keyframes.
+START_NS = 1000000000 # Capture time of the first frame. Non-zero so that replay uses the timestamps.
+GYRO_SCALE = 1.527e-4 # LSM9DOF gyrometer rate per count, in radians per second (8.75 mdps).
+
+def read_gestures( f_name ):
+    """ Reads the right hand poses from the VALUES(...) clauses of a MySQL dump written by xml_import.py. """
+
+    gestures = {}
+    with open( f_name ) as input_file:
+        text = input_file.read()
+    for values in re.findall( r"VALUES\((.*?)\);", text, re.S ):
+        fields = [field.strip() for field in values.replace( "\n", " " ).split( "," )]
+        if fields[0] != '"right"':
+            continue
+        numbers = [float(field) for field in fields[1:-1]]
+        gest = fields[-1][1:-1]
+        # Contact bits follow the gesture database column order, as in xml_to_frames.py.
+        contact = 0
+        for bit in range( 13 ):
+            if numbers[5 + bit]:
+                contact |= (1 << bit)
+        gestures[gest] = (numbers[0:5], contact, numbers[18:30], numbers[30:48])
+
+    return gestures
+
+def spell( phrase, gestures ):
+    """ Converts a phrase into a list of (keyframes, is_motion) tokens. """
+
+    tokens = []
+    for c in phrase.upper():
+        if c in gestures:
+            tokens.append( ([c], False) )
+        elif (c + "1") in gestures:
+            # Letters that involve motion, such as J and Z, are signed as a sequence of keyframes.
+            keys = []
+            while (c + str(len(keys) + 1)) in gestures:
+                keys.append( c + str(len(keys) + 1) )
+            tokens.append( (keys, True) )
+        else:
+            raise ValueError( "No gesture for '" + c + "'" )
+
+    return tokens
+
+def relaxed( pose ):
+    """ Returns the pose with the fingers half straightened and no contact, used between letters. """
+
+    flex, contact, lsm303, lsm9dof = pose
+
+    return ([value / 2.0 for value in flex], 0, lsm303, lsm9dof)
+
+def blend( a, b, t ):
+    """ Returns the pose a fraction t of the way from pose a to pose b. """
+
+    mix = lambda x, y: [x[i] + (y[i] - x[i]) * t for i in range( len(x) )]
+    contact = a[1] if t < 0.5 else b[1]
+
+    return (mix(a[0], b[0]), contact, mix(a[2], b[2]), mix(a[3], b[3]))
+
+def move( a, b, count, through ):
+    """ Returns the poses moving from a to b over count frames, passing through a third pose if given. """
+
+    poses = []
+    for i in range( 1, count + 1 ):
+        t = float( i ) / (count + 1)
+        if through is None:
+            poses.append( blend(a, b, t) )
+        elif t < 0.5:
+            poses.append( blend(a, through, 2.0 * t) )
+        else:
+            poses.append( blend(through, b, 2.0 * t - 1.0) )
+
+    return poses
+
+def turn( poses, rate ):
+    """ Returns the poses with the LSM9DOF gyrometers reading the rate at which each accelerometer turns.
+
+        The gesture database holds the gyrometer at rest. Between poses, gravity turns in the frame of each
+        LSM9DOF by the angle between its readings, about the axis across them, and the gyrometer reads
+        that rate on top of its value at rest, so the orientation fused from the session follows the hand.
+    """
+
+    unit = lambda v: [x / max(1e-9, sum([y * y for y in v]) ** 0.5) for x in v]
+    cross = lambda u, v: [u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0]]
+    turned = poses[:1]
+    for seq in range( 1, len(poses) ):
+        flex, contact, lsm303, lsm9dof = poses[seq]
+        lsm9dof = list( lsm9dof )
+        for imu in range( 0, len(lsm9dof), 9 ):
+            before = unit( poses[seq - 1][3][imu:imu + 3] )
+            after = unit( lsm9dof[imu:imu + 3] )
+            axis = cross( after, before )
+            sine = sum( [x * x for x in axis] ) ** 0.5
+            if sine < 1e-9:
+                continue
+            cosine = sum( [after[i] * before[i] for i in range( 3 )] )
+            speed = math.atan2( sine, cosine ) * rate / GYRO_SCALE
+            for i in range( 3 ):
+                lsm9dof[imu + 6 + i] += axis[i] / sine * speed
+        turned.append( (flex, contact, lsm303, lsm9dof) )
+
+    return turned
+
+def make_frame( pose, seq, timestamp, jitter, rng ):
+    """ Packs a right hand pose into a binary sensor frame, with optional sensor noise. """
+
+    flex, contact, lsm303, lsm9dof = pose
+    clamp = lambda value, low, high: int( max(low, min(high, round(value))) )
+    flex = [clamp(value + rng.gauss(0, jitter), 0, 255) for value in flex]
+    lsm303 = [clamp(value + rng.gauss(0, 10 * jitter), -32768, 32767) for value in lsm303]
+    lsm9dof = [clamp(value + rng.gauss(0, 10 * jitter), -32768, 32767) for value in lsm9dof]
+    left = [0] * 5 + [0, 0] + [0] * 12 + [0] * 18
+    right = flex + [0, contact] + lsm303 + lsm9dof
+    flags = FRAME_CONNECTED | FRAME_PRESENT[1]
+    values = [FRAME_MAGIC, FRAME_VERSION, FRAME_SIZE, seq, flags, timestamp] + left + right + [0]
+    frame = struct.pack( FRAME_FORMAT[:-1], *values )
+
+    return frame + struct.pack( "<I", zlib.crc32(frame) & 0xFFFFFFFF )
+
+def make_session( phrase, gestures, options ):
+    """ Returns the frames of a session signing the phrase. """
+
+    rng = random.Random( options.seed )
+    frames = []
+    previous = None
+    hold = int( options.hold * options.rate )
+    change = int( options.move * options.rate )
+    key_hold = int( KEY_HOLD * options.rate )
+    key_move = int( KEY_MOVE * options.rate )
+    poses = []
+    for keys, motion in spell( phrase, gestures ):
+        first = gestures[keys[0]]
+        if previous is not None:
+            poses += move( previous, first, change, relaxed(previous) )
+        for i in range( len(keys) ):
+            pose = gestures[keys[i]]
+            if i > 0:
+                poses += move( previous, pose, key_move, None )
+            poses += [pose] * (key_hold if motion else hold)
+            previous = pose
+    poses = turn( poses, options.rate )
+    for seq in range( len(poses) ):
+        timestamp = START_NS + int( seq * 1e9 / options.rate )
+        frames.append( make_frame(poses[seq], seq, timestamp, options.jitter, rng) )
+
+    return frames
+
+def main( args ):
+    """ Main program. Usage: make_session.py [options] session.frm phrase ... """
+
+    parser = argparse.ArgumentParser( description="Spells a phrase as a labelled session file for tools/replay." )
+    parser.add_argument( "-d", dest="db", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "gesture_db.sql"),
+                         help="the gesture table, as dumped from MySQL" )
+    parser.add_argument( "--rate", type=float, default=RATE, help="frames per second" )
+    parser.add_argument( "--hold", type=float, default=HOLD, help="seconds each letter is held" )
+    parser.add_argument( "--move", type=float, default=MOVE, help="seconds spent moving between letters" )
+    parser.add_argument( "--jitter", type=float, default=0.0, help="standard deviation of the flex sensor noise, in flex units" )
+    parser.add_argument( "--seed", type=int, default=1, help="seed for the sensor noise" )
+    parser.add_argument( "--prefix", type=int, default=0,
+                         help="sign only the first letters of each word, leaving the rest to the word decoder to complete" )
+    parser.add_argument( "session", help="the session file to write; the label is written next to it as .txt" )
+    parser.add_argument( "phrase", nargs="+", help="the text to sign" )
+    options = parser.parse_args( args[1:] )
+    phrase = " ".join( options.phrase ).upper()
+    signed = phrase
+    if options.prefix > 0:
+        signed = " ".join( [word[:options.prefix] for word in phrase.split( " " )] )
+    ret_val = os.EX_OK  # Return status code
+
+    try:
+        frames = make_session( signed, read_gestures(options.db), options )
+        with open( options.session, 'wb' ) as output_file:
+            output_file.write( b"".join(frames) )
+        read_frames( options.session )
+        with open( os.path.splitext(options.session)[0] + ".txt", 'w' ) as label_file:
+            label_file.write( phrase + "\n" )
+        sys.stdout.write( "Wrote " + str(len(frames)) + " frames to " + options.session + "\n" )
+    except (IOError, OSError, ValueError) as e:
+        sys.stderr.write( "*** " + str(e) + " ***\n" )
+        ret_val = os.EX_DATAERR
+
+    return ret_val
+
+if __name__ == "__main__":
+    sys.exit( main(sys.argv) )
@@ -0,0 +1,181 @@
+/***********match_bench.cpp**********************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  Microbenchmark comparing the exact match used by gesture_to_text() with
+            the nearest gesture search. The gesture table is read from a MySQL dump
+            such as gesture_db.sql. Each gesture is replayed with random single step
+            flex jitter and contact sensor flips to measure both speed and how often
+            the correct gesture is still found. Both gloves are worn: some of the
+            gestures are made two-handed, and for the rest the left hand holds an
+            unrelated pose that must not affect the result. Both hands are matched
+            in one pass, which is compared against looking each hand up on its own.
+
+            Usage: match_bench [gesture_db.sql] [iterations] [jitter percent]
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../recognize.h"
+#include "gesture_dump.h"
+
+using namespace std ;
+
+#define TWO_HANDED_EVERY 4   /* One in every TWO_HANDED_EVERY gestures is made two-handed. */
+
+Hand make_hand( const Row &row, unsigned int jitter ) ;
+double now_ns( ) ;
+
+int main( int argc, char* argv[] ){
+
+    const char* fName = (argc > 1) ? argv[1] : "gesture_db.sql" ;   /* The gesture table. */
+    unsigned int iterations = (argc > 2) ? atoi( argv[2] ) : 100000 ; /* Number of lookups to time. */
+    unsigned int jitter = (argc > 3) ? atoi( argv[3] ) : 10 ;        /* Chance of disturbing each sensor, in percent. */
+    vector<Row> rows ;             /* The gesture table. */
+    vector<Row> lefts ;            /* The left hand of each two-handed gesture. */
+    vector<int> pair ;             /* The left hand of each gesture within lefts, or -1 for a one-handed gesture. */
+    vector<Gesture> gestures ;     /* The pairs of hands to look up. */
+    vector<unsigned int> expect ;  /* The row each right hand was made from. */
+    GestureIndex index ;           /* The gesture index. */
+    GestureMatch match ;           /* The result of a nearest gesture search. */
+    string gest ;                  /* The result of an exact match. */
+    unsigned int exactHits = 0 ;   /* Number of correct exact matches. */
+    unsigned int nearHits = 0 ;    /* Number of correct nearest matches. */
+    unsigned int splitHits = 0 ;   /* Number of gestures matched by one of the separate lookups. */
+    unsigned int i ;               /* An iterator. */
+    double start ;                 /* Start time, in nanoseconds. */
+    double exactNs ;               /* Time spent on exact matches, in nanoseconds. */
+    double nearNs ;                /* Time spent on nearest searches, in nanoseconds. */
+    double splitNs ;               /* Time spent on separate lookups for each hand, in nanoseconds. */
+
+    if( !read_dump(fName, rows) || rows.empty() ){
+        fprintf( stderr, "*** Unable to read gestures from %s ***\n", fName ) ;
+        return EXIT_FAILURE ;
+    }
+    /* The table has no two-handed gestures yet, so every TWO_HANDED_EVERY right handed
+       gesture is given the left hand of the next gesture. */
+    pair.assign( rows.size(), -1 ) ;
+    for( i = 0 ; i < rows.size() ; i += TWO_HANDED_EVERY ){
+        if( !rows[i].right )
+            continue ;
+        Row left = rows[(i + 1) % rows.size()] ;
+        left.right = false ;
+        left.gest = rows[i].gest ;
+        pair[i] = (int)lefts.size() ;
+        lefts.push_back( left ) ;
+    }
+    for( i = 0 ; i < rows.size() ; i++ ){
+        index.Add( rows[i].right, rows[i].flex, rows[i].contact, rows[i].lsm303, rows[i].lsm9dof, rows[i].gest ) ;
+    }
+    for( i = 0 ; i < lefts.size() ; i++ ){
+        index.Add( lefts[i].right, lefts[i].flex, lefts[i].contact, lefts[i].lsm303, lefts[i].lsm9dof, lefts[i].gest ) ;
+    }
+    index.Build() ;
+    srand( 1 ) ;
+    for( i = 0 ; i < iterations ; i++ ){
+        expect.push_back( rand() % rows.size() ) ;
+        Hand hand = make_hand( rows[expect.back()], jitter ) ;
+        /* For a one-handed gesture, the other glove is worn in an unrelated pose. */
+        const Row &other = (pair[expect.back()] >= 0) ? lefts[pair[expect.back()]] : rows[rand() % rows.size()] ;
+        gestures.push_back( rows[expect.back()].right ? Gesture(make_hand(other, jitter), hand) : Gesture(hand, Hand()) ) ;
+    }
+    /* The exact match is what gesture_to_text() does for every frame. */
+    start = now_ns() ;
+    for( i = 0 ; i < iterations ; i++ ){
+        if( index.Match(gestures[i], false, LSM303_TOL, LSM9DOF_TOL, gest) && (gest == rows[expect[i]].gest) )
+            exactHits++ ;
+    }
+    exactNs = now_ns() - start ;
+    start = now_ns() ;
+    for( i = 0 ; i < iterations ; i++ ){
+        if( index.Nearest(gestures[i], match) && (index.Text(match.entry) == rows[expect[i]].gest) )
+            nearHits++ ;
+    }
+    nearNs = now_ns() - start ;
+    /* For comparison, look each hand up on its own, as a pair of single hand indexes would. */
+    start = now_ns() ;
+    for( i = 0 ; i < iterations ; i++ ){
+        bool left = index.Match( Gesture(gestures[i].Left(), Hand()), false, LSM303_TOL, LSM9DOF_TOL, gest ) && (gest == rows[expect[i]].gest) ;
+        bool right = index.Match( Gesture(Hand(), gestures[i].Right()), false, LSM303_TOL, LSM9DOF_TOL, gest ) && (gest == rows[expect[i]].gest) ;
+        if( left || right )
+            splitHits++ ;
+    }
+    splitNs = now_ns() - start ;
+    fprintf( stdout, "Gestures:\t%u (%u two-handed)\n", (unsigned int)index.Size(), (unsigned int)lefts.size() ) ;
+    fprintf( stdout, "Lookups:\t%u (jitter %u%%)\n", iterations, jitter ) ;
+    fprintf( stdout, "Exact match:\t%8.1f ns/lookup\t%5.1f%% correct\n", exactNs / iterations, (100.0 * exactHits) / iterations ) ;
+    fprintf( stdout, "Nearest:\t%8.1f ns/lookup\t%5.1f%% correct\n", nearNs / iterations, (100.0 * nearHits) / iterations ) ;
+    fprintf( stdout, "Per hand:\t%8.1f ns/lookup\t%5.1f%% correct\n", splitNs / iterations, (100.0 * splitHits) / iterations ) ;
+
+    return EXIT_SUCCESS ;
+
+}
+
+/*----------make_hand----------------------------------------------------------------
+
+  PURPOSE:  Function to build a "Hand" from a row of the gesture table, moving flex
+            values by one step and flipping contact sensors at random.
+
+-----------------------------------------------------------------------------------*/
+
+Hand make_hand( const Row &row, unsigned int jitter ){
+
+    double flex[INDEX_NUM_FLEX] ;         /* The disturbed flex values. */
+    bool c[INDEX_NUM_CONTACTS] ;          /* The disturbed contact values. */
+    Lsm303 lsm303[INDEX_NUM_LSM303] ;     /* The LSM303 values. */
+    Lsm9dof lsm9dof[INDEX_NUM_LSM9DOF] ;  /* The LSM9DOF values. */
+    Hand hand ;                           /* The resulting hand. */
+    unsigned int i ;                      /* An iterator. */
+
+    for( i = 0 ; i < INDEX_NUM_FLEX ; i++ ){
+        flex[i] = row.flex[i] ;
+        if( (unsigned int)(rand() % 100) < jitter )
+            flex[i] += (rand() % 2) ? FLEX_STEP : -FLEX_STEP ;
+        if( flex[i] < 0 )
+            flex[i] = 0 ;
+    }
+    for( i = 0 ; i < INDEX_NUM_CONTACTS ; i++ ){
+        c[i] = row.contact[i] ;
+        if( (unsigned int)(rand() % 100) < (jitter / 4) )
+            c[i] = !c[i] ;
+    }
+    for( i = 0 ; i < INDEX_NUM_LSM303 ; i++ ){
+        const double* v = row.lsm303[i] ;
+        lsm303[i] = Lsm303( v[0], v[1], v[2], v[3], v[4], v[5], (LsmSide)i ) ;
+    }
+    for( i = 0 ; i < INDEX_NUM_LSM9DOF ; i++ ){
+        const double* v = row.lsm9dof[i] ;
+        lsm9dof[i] = Lsm9dof( v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[8], (LsmSide)i ) ;
+    }
+    hand.Set( Finger(0, c[0], false), Finger(flex[0], c[1], c[2]), Finger(flex[1], c[3], c[4]),
+              Finger(flex[2], c[5], c[6]), Finger(flex[3], c[7], c[8]),
+              Fold(c[9]), Fold(c[10]), Fold(c[11]), Fold(c[12]),
+              lsm303[0], lsm303[1], lsm9dof[0], lsm9dof[1] ) ;
+
+    return hand ;
+
+}
+
+double now_ns( ){
+
+    struct timespec t ;  /* The current time. */
+
+    clock_gettime( CLOCK_MONOTONIC, &t ) ;
+
+    return ((double)t.tv_sec * 1e9) + (double)t.tv_nsec ;
+
+}
@@ -0,0 +1,521 @@
+/***********replay.cpp***************************************************************
+
+  By:       Timothy Miskell
+            Virinchi Balabhadrapatruni
+            16.499 Capstone Proposal
+            ECE Department
+            Umass Lowell
+
+  PURPOSE:  Replays recorded session files through the same decode and classify code
+            as the sign2speech pipeline, with each stage on its own thread connected
+            by the same queues, so that changes to the recognizers can be measured
+            without the glove attached. Sessions are recorded by sign2speech when
+            SIGN2SPEECH_RECORD is set, or spelled out by tools/make_session.py.
+
+            For each session, reports the frames per second, the percentiles of the
+            time each stage spent on a frame and of the time from a frame being read
+            to its text being appended, and, for labelled sessions, how much of the
+            expected text was recognized. The label is given with -e, or read from a
+            file next to the session with the extension .txt. With a lexicon, the
+            letters are decoded into words as sign2speech does, and the words
+            signed per minute and the gestures signed per word are also reported.
+
+            Usage: replay [-d gesture_db.sql] [-l lexicon.idx] [-r] [-s speed] [-e text] [-p port] [-g settings] session ...
+
+            -d  the gesture table, as dumped from MySQL.
+            -l  the compiled lexicon, as written by tools/lexicon_compile.
+            -r  replay at the speed the frames were captured, instead of as fast as
+                possible.
+            -s  speed up or slow down a real time replay by this factor.
+            -e  the text the sessions should produce.
+            -p  serve the status page on this port while replaying, as sign2speech
+                does, so browsers and other clients can be tried against it. The
+                commands posted to it are printed.
+            -g  the pose segmenter settings, as SIGN2SPEECH_SEGMENT gives them to
+                sign2speech, such as "window=8,hold-flex=3".
+
+  CHANGES:  10/16/2026
+
+************************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../frames.h"
+#include "../recognize.h"
+#include "../StatusServer.h"
+#include "gesture_dump.h"
+
+#define REPLAY_FRAME_NS 10000000ULL  /* Time between frames that carry no timestamp, such as converted captures. */
+#define REPLAY_WAIT_MS  10           /* Longest wait for a queue before checking whether the replay has finished. */
+
+using namespace std ;
+
+struct Replay {                                              /* The state shared by the replay threads. */
+    vector<struct sensor_frame> frames ;                     /* The frames of the session. */
+    bool realTime ;                                          /* True to replay at capture speed. */
+    double speed ;                                           /* Speed up factor for a real time replay. */
+    SpscQueue<RawSample, PIPELINE_RAW_SLOTS> raw ;           /* ingest -> decode */
+    SpscQueue<GestureSample, PIPELINE_SAMPLE_SLOTS> decoded ;    /* decode -> classify */
+    SpscQueue<GestureSample, PIPELINE_SAMPLE_SLOTS> classified ; /* classify -> text */
+    atomic<bool> ingestDone ;                                /* Set once every frame has been queued. */
+    atomic<bool> decodeDone ;                                /* Set once every frame has been decoded. */
+    atomic<bool> classifyDone ;                              /* Set once every frame has been classified. */
+    LatencyHistogram service[NUM_STAGES] ;                   /* Time each stage spent on a frame. */
+    LatencyHistogram total ;                                 /* Time from a frame being read to its text being appended. */
+    GestureIndex* index ;                                    /* The gesture index. */
+    MotionRecognizer* motionRec ;                            /* The motion recognizer. */
+    PoseSegmenter segmenter ;                                /* The pose segmenter. */
+    WordDecoder decoder ;                                    /* Decodes the letters into words, if a lexicon was given. */
+    string text ;                                            /* The recognized text. */
+    StatusServer* status ;                                   /* Serves the status page, NULL if not serving. */
+} ;
+
+bool read_session( const char* fName, vector<struct sensor_frame> &frames ) ;
+bool read_label( const char* fName, string &label ) ;
+void ingest_stage( Replay* replay ) ;
+void decode_stage( Replay* replay ) ;
+void classify_stage( Replay* replay ) ;
+void text_stage( Replay* replay ) ;
+unsigned int edit_distance( const string &a, const string &b ) ;
+void print_latency( const char* name, const LatencyHistogram &hist ) ;
+
+int main( int argc, char* argv[] ){
+
+    const char* dbFName = "gesture_db.sql" ;  /* The gesture table. */
+    const char* lexiconFName = NULL ;         /* The compiled lexicon, NULL to use the letters as recognized. */
+    const char* expected = NULL ;             /* The text every session should produce. */
+    bool realTime = false ;                   /* True to replay at capture speed. */
+    int port = -1 ;                           /* The port to serve the status page on, -1 if not serving. */
+    SegmentConfig segmentConfig ;             /* The pose segmenter settings. */
+    StatusServer status ;                     /* Serves the status page. */
+    double speed = 1.0 ;                      /* Speed up factor for a real time replay. */
+    GestureIndex index ;                      /* The gesture index. */
+    MotionRecognizer motionRec ;              /* The motion recognizer. */
+    Lexicon lexicon ;                         /* The words the letters are decoded into. */
+    unsigned long allFrames = 0 ;             /* Number of frames replayed, over all sessions. */
+    uint64_t allNs = 0 ;                      /* Time spent replaying, over all sessions. */
+    unsigned long allChars = 0 ;              /* Length of the expected text, over all labelled sessions. */
+    unsigned long allEdits = 0 ;              /* Edits from the recognized to the expected text. */
+    unsigned int sessions = 0 ;               /* Number of sessions replayed. */
+    int opt ;                                 /* The next command line option. */
+    int i ;                                   /* An iterator. */
+
+    segmentConfig = PoseSegmenter::Defaults() ;
+    while( (opt = getopt(argc, argv, "d:l:rs:e:p:g:")) != -1 ){
+        switch( opt ){
+            case 'd': dbFName = optarg ; break ;
+            case 'l': lexiconFName = optarg ; break ;
+            case 'r': realTime = true ; break ;
+            case 's': speed = atof( optarg ) ; break ;
+            case 'e': expected = optarg ; break ;
+            case 'p': port = atoi( optarg ) ; break ;
+            case 'g':
+                if( !PoseSegmenter::ParseConfig(optarg, segmentConfig) ){
+                    fprintf( stderr, "*** Unable to read pose segmenter settings %s ***\n", optarg ) ;
+                    return EXIT_FAILURE ;
+                }
+                break ;
+            default:
+                fprintf( stderr, "Usage: %s [-d gesture_db.sql] [-l lexicon.idx] [-r] [-s speed] [-e text] [-p port] [-g settings] session ...\n", argv[0] ) ;
+                return EXIT_FAILURE ;
+        }
+    }
+    if( (optind >= argc) || (speed <= 0.0) ){
+        fprintf( stderr, "Usage: %s [-d gesture_db.sql] [-l lexicon.idx] [-r] [-s speed] [-e text] [-p port] [-g settings] session ...\n", argv[0] ) ;
+        return EXIT_FAILURE ;
+    }
+    if( !load_dump(dbFName, index) ){
+        fprintf( stderr, "*** Unable to read gestures from %s ***\n", dbFName ) ;
+        return EXIT_FAILURE ;
+    }
+    motionRec.Build( index ) ;
+    if( (lexiconFName != NULL) && !lexicon.Load(lexiconFName) ){
+        fprintf( stderr, "*** Unable to load the lexicon from %s ***\n", lexiconFName ) ;
+        return EXIT_FAILURE ;
+    }
+    if( port >= 0 ){
+        if( !status.Start((unsigned short)port, [](StatusCommand command){
+                fprintf( stdout, "Command:\t%s\n", (command == STATUS_SPEAK) ? "speak" : "reset" ) ;
+                fflush( stdout ) ;
+            }) ){
+            fprintf( stderr, "*** Unable to serve the status page on port %d ***\n", port ) ;
+            return EXIT_FAILURE ;
+        }
+        fprintf( stdout, "Serving:\tport %u\n", (unsigned int)status.Port() ) ;
+        fflush( stdout ) ;
+    }
+    for( i = optind ; i < argc ; i++ ){
+        Replay* replay = new Replay ;  /* The queues are too large for the stack. */
+        string label ;                 /* The text the session should produce. */
+        bool labelled ;                /* True if the session has a label. */
+        uint64_t start ;               /* Start of the replay. */
+        uint64_t elapsed ;             /* Length of the replay. */
+
+        if( !read_session(argv[i], replay->frames) ){
+            fprintf( stderr, "*** Unable to read frames from %s ***\n", argv[i] ) ;
+            delete replay ;
+            return EXIT_FAILURE ;
+        }
+        labelled = (expected != NULL) || read_label( argv[i], label ) ;
+        if( expected != NULL )
+            label = expected ;
+        replay->realTime = realTime ;
+        replay->speed = speed ;
+        replay->ingestDone = false ;
+        replay->decodeDone = false ;
+        replay->classifyDone = false ;
+        replay->index = &index ;
+        replay->motionRec = &motionRec ;
+        replay->segmenter.Configure( segmentConfig ) ;
+        replay->decoder.SetLexicon( (lexiconFName != NULL) ? &lexicon : NULL ) ;
+        replay->status = (port >= 0) ? &status : NULL ;
+        motionRec.Reset() ;
+        /* Run the stages as the worker does, with the text stage on this thread. */
+        start = pipeline_now_ns() ;
+        thread ingest( ingest_stage, replay ) ;
+        thread decode( decode_stage, replay ) ;
+        thread classify( classify_stage, replay ) ;
+        text_stage( replay ) ;
+        ingest.join() ;
+        decode.join() ;
+        classify.join() ;
+        elapsed = pipeline_now_ns() - start ;
+        fprintf( stdout, "Session:\t%s\n", argv[i] ) ;
+        fprintf( stdout, "Replayed:\t%lu frames in %.1f ms, %.0f frames/s (%s)\n", (unsigned long)replay->frames.size(),
+                 elapsed / 1e6, replay->frames.size() / (elapsed / 1e9), realTime ? "real time" : "as fast as possible" ) ;
+        fprintf( stdout, "\t\t     p50 us     p90 us     p99 us     max us\n" ) ;
+        print_latency( "decode", replay->service[STAGE_DECODE] ) ;
+        print_latency( "classify", replay->service[STAGE_CLASSIFY] ) ;
+        print_latency( "text", replay->service[STAGE_TEXT] ) ;
+        print_latency( "total", replay->total ) ;
+        fprintf( stdout, "Text:\t\t\"%s\"\n", replay->text.c_str() ) ;
+        if( replay->decoder.Words() > 0 )
+            fprintf( stdout, "Throughput:\t%.1f words/min, %.1f gestures/word\n", replay->decoder.WordsPerMinute(),
+                     (double)replay->decoder.Letters() / replay->decoder.Words() ) ;
+        if( labelled ){
+            unsigned int edits = edit_distance( replay->text, label ) ;
+            double accuracy = label.empty() ? 0.0 : 100.0 * (1.0 - (double)edits / label.size()) ;
+            fprintf( stdout, "Expected:\t\"%s\"\n", label.c_str() ) ;
+            fprintf( stdout, "Accuracy:\t%.1f%% (%u edits)\n", (accuracy > 0.0) ? accuracy : 0.0, edits ) ;
+            allChars += label.size() ;
+            allEdits += edits ;
+        }
+        fprintf( stdout, "\n" ) ;
+        allFrames += replay->frames.size() ;
+        allNs += elapsed ;
+        sessions++ ;
+        delete replay ;
+    }
+    if( sessions > 1 ){
+        fprintf( stdout, "Sessions:\t%u, %lu frames, %.0f frames/s\n", sessions, allFrames, allFrames / (allNs / 1e9) ) ;
+        if( allChars > 0 ){
+            double accuracy = 100.0 * (1.0 - (double)allEdits / allChars) ;
+            fprintf( stdout, "Accuracy:\t%.1f%% (%lu edits in %lu characters)\n", (accuracy > 0.0) ? accuracy : 0.0,
+                     allEdits, allChars ) ;
+        }
+    }
+
+    return EXIT_SUCCESS ;
+
+}
+
+/*----------read_session-------------------------------------------------------------
+
+  PURPOSE:  Function to read every valid frame in a session file, or in a session log
+            written by SessionJournal. Damaged frames and the text records of a log
+            are skipped.
+
+  RETURN VALUE:  true if at least one frame was read
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool read_session( const char* fName, vector<struct sensor_frame> &frames ){
+
+    ifstream input( fName, ios::binary ) ;  /* The session file. */
+    stringstream contents ;                  /* The contents of the file. */
+    string bytes ;                           /* The contents of the file. */
+    struct sensor_frame frame ;              /* The next frame. */
+    size_t pos = 0 ;                         /* Position of the next frame. */
+
+    if( !input.is_open() )
+        return false ;
+    contents << input.rdbuf() ;
+    bytes = contents.str() ;
+    while( next_frame(bytes.data(), bytes.size(), pos, frame) ){
+        frames.push_back( frame ) ;
+    }
+
+    return !frames.empty() ;
+
+}
+
+/*----------read_label---------------------------------------------------------------
+
+  PURPOSE:  Function to read the expected text of a session from the file of the same
+            name with the extension .txt. A trailing newline is removed.
+
+  RETURN VALUE:  true if the label was read
+                 false otherwise.
+
+-----------------------------------------------------------------------------------*/
+
+bool read_label( const char* fName, string &label ){
+
+    string lName = fName ;  /* The name of the label file. */
+    size_t dot = lName.rfind( '.' ) ;
+
+    if( (dot != string::npos) && (lName.find('/', dot) == string::npos) )
+        lName.erase( dot ) ;
+    lName += ".txt" ;
+    ifstream input( lName.c_str() ) ;
+    if( !input.is_open() || !getline(input, label) )
+        return false ;
+    if( !label.empty() && (label[label.size() - 1] == '\r') )
+        label.erase( label.size() - 1 ) ;
+
+    return true ;
+
+}
+
+/*----------push_wait----------------------------------------------------------------
+
+  PURPOSE:  Function to queue a value for the next stage, waiting while the queue is
+            full.
+
+-----------------------------------------------------------------------------------*/
+
+template <typename T, unsigned int N>
+static void push_wait( SpscQueue<T, N> &queue, const T &value ){
+
+    while( !queue.TryPush(value) ){
+        queue.WaitForSpace( REPLAY_WAIT_MS ) ;
+    }
+
+    return ;
+
+}
+
+/*----------ingest_stage-------------------------------------------------------------
+
+  PURPOSE:  Function to queue the frames of the session for decoding, either at once or
+            at the times they were captured.
+
+-----------------------------------------------------------------------------------*/
+
+void ingest_stage( Replay* replay ){
+
+    RawSample raw ;                                   /* The next frame. */
+    uint64_t first = replay->frames[0].timestamp ;    /* Capture time of the first frame. */
+    uint64_t start = pipeline_now_ns() ;              /* Start of the replay. */
+    uint64_t offset ;                                 /* Time of the next frame from the start of the session. */
+    struct timespec due ;                             /* Time to queue the next frame. */
+    size_t i ;                                        /* An iterator. */
+
+    raw.fromFile = false ;
+    for( i = 0 ; i < replay->frames.size() ; i++ ){
+        if( replay->realTime ){
+            if( (first != 0) && (replay->frames[i].timestamp >= first) )
+                offset = replay->frames[i].timestamp - first ;
+            else
+                offset = i * REPLAY_FRAME_NS ;
+            offset = (uint64_t)(offset / replay->speed) + start ;
+            due.tv_sec = offset / 1000000000ULL ;
+            due.tv_nsec = offset % 1000000000ULL ;
+            while( clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &due, NULL) != 0 ){
+            }
+        }
+        raw.frame = replay->frames[i] ;
+        raw.ingested = pipeline_now_ns() ;
+        raw.queued = raw.ingested ;
+        push_wait( replay->raw, raw ) ;
+    }
+    replay->ingestDone = true ;
+
+    return ;
+
+}
+
+/*----------decode_stage-------------------------------------------------------------
+
+  PURPOSE:  Function to convert each frame into a pair of hands, as the decode stage of
+            the worker does.
+
+-----------------------------------------------------------------------------------*/
+
+void decode_stage( Replay* replay ){
+
+    Hand hands[NUM_HANDS] ;  /* The hands read from the next frame. */
+    ImuFusion fusion[NUM_HANDS] ;  /* Tracks the orientation of each hand from frame to frame. */
+    GestureSample sample ;   /* The next decoded frame. */
+    RawSample* raw ;         /* The next frame. */
+    uint64_t begin ;         /* Time the stage started on the frame. */
+    unsigned int i ;         /* An iterator. */
+
+    sample.source = "replay" ;
+    while( true ){
+        raw = replay->raw.Front() ;
+        if( raw == NULL ){
+            if( replay->ingestDone && (replay->raw.Depth() == 0) )
+                break ;
+            replay->raw.WaitForData( REPLAY_WAIT_MS ) ;
+            continue ;
+        }
+        begin = pipeline_now_ns() ;
+        sample.acquired = raw->frame.timestamp ;
+        sample.valid = get_frame( hands, &raw->frame, sample.sensorStatus, sample.xmlVersion, sample.convert ) ;
+        sample.ingested = raw->ingested ;
+        replay->raw.Pop() ;
+        if( sample.valid ){
+            for( i = 0 ; i < NUM_HANDS ; i++ ){
+                fusion[i].Update( hands[i], sample.acquired ) ;
+            }
+            sample.gesture = Gesture( hands[0], hands[1] ) ;
+        }
+        sample.letters.clear() ;
+        sample.convertFailed = false ;
+        sample.queued = pipeline_now_ns() ;
+        replay->service[STAGE_DECODE].Record( sample.queued - begin ) ;
+        push_wait( replay->decoded, sample ) ;
+    }
+    replay->decodeDone = true ;
+
+    return ;
+
+}
+
+/*----------classify_stage-----------------------------------------------------------
+
+  PURPOSE:  Function to convert each decoded frame to text with classify_sample(), as
+            the classify stage of the worker does.
+
+-----------------------------------------------------------------------------------*/
+
+void classify_stage( Replay* replay ){
+
+    GestureSample* sample ;  /* The next decoded frame. */
+    uint64_t begin ;         /* Time the stage started on the frame. */
+
+    while( true ){
+        sample = replay->decoded.Front() ;
+        if( sample == NULL ){
+            if( replay->decodeDone && (replay->decoded.Depth() == 0) )
+                break ;
+            replay->decoded.WaitForData( REPLAY_WAIT_MS ) ;
+            continue ;
+        }
+        begin = pipeline_now_ns() ;
+        classify_sample( *sample, *replay->index, *replay->motionRec, replay->segmenter ) ;
+        sample->queued = pipeline_now_ns() ;
+        replay->service[STAGE_CLASSIFY].Record( sample->queued - begin ) ;
+        push_wait( replay->classified, *sample ) ;
+        replay->decoded.Pop() ;
+    }
+    replay->classifyDone = true ;
+
+    return ;
+
+}
+
+/*----------text_stage---------------------------------------------------------------
+
+  PURPOSE:  Function to append the recognized text, and measure the time from each
+            frame being read to its text being appended. The word being signed when
+            the session ends is decoded as if the signer had stopped there.
+
+-----------------------------------------------------------------------------------*/
+
+void text_stage( Replay* replay ){
+
+    GestureSample* sample ;  /* The next classified frame. */
+    uint64_t begin ;         /* Time the stage started on the frame. */
+    uint64_t now ;           /* Time the stage finished with the frame. */
+    unsigned int i ;         /* An iterator. */
+
+    while( true ){
+        sample = replay->classified.Front() ;
+        if( sample == NULL ){
+            if( replay->classifyDone && (replay->classified.Depth() == 0) )
+                break ;
+            replay->classified.WaitForData( REPLAY_WAIT_MS ) ;
+            continue ;
+        }
+        begin = pipeline_now_ns() ;
+        if( sample->valid && replay->decoder.Active() ){
+            for( i = 0 ; i < sample->numSegments ; i++ ){
+                replay->decoder.Push( sample->segments[i], replay->text ) ;
+            }
+        }
+        else if( sample->valid && !sample->letters.empty() )
+            replay->text += sample->letters ;
+        if( (replay->status != NULL) && sample->valid )
+            replay->status->Post( replay->text, sample->gesture, sample->sensorStatus, sample->xmlVersion ) ;
+        now = pipeline_now_ns() ;
+        replay->service[STAGE_TEXT].Record( now - begin ) ;
+        replay->total.Record( now - sample->ingested ) ;
+        replay->classified.Pop() ;
+    }
+    replay->decoder.Flush( replay->text ) ;
+    if( replay->status != NULL )
+        replay->status->PostText( replay->text ) ;
+
+    return ;
+
+}
+
+/*----------edit_distance------------------------------------------------------------
+
+  PURPOSE:  Function to count the fewest characters that must be inserted, deleted, or
+            changed to turn one string into another.
+
+-----------------------------------------------------------------------------------*/
+
+unsigned int edit_distance( const string &a, const string &b ){
+
+    vector<unsigned int> prev( b.size() + 1 ) ;  /* Distances for the previous character of a. */
+    vector<unsigned int> cur( b.size() + 1 ) ;   /* Distances for the current character of a. */
+    size_t i ;                                   /* An iterator. */
+    size_t j ;                                   /* An iterator. */
+
+    for( j = 0 ; j <= b.size() ; j++ ){
+        prev[j] = j ;
+    }
+    for( i = 1 ; i <= a.size() ; i++ ){
+        cur[0] = i ;
+        for( j = 1 ; j <= b.size() ; j++ ){
+            unsigned int change = prev[j - 1] + ((a[i - 1] == b[j - 1]) ? 0 : 1) ;
+            unsigned int remove = prev[j] + 1 ;
+            unsigned int insert = cur[j - 1] + 1 ;
+            cur[j] = min( change, min(remove, insert) ) ;
+        }
+        prev.swap( cur ) ;
+    }
+
+    return prev[b.size()] ;
+
+}
+
+/*----------print_latency------------------------------------------------------------
+
+  PURPOSE:  Function to print the percentiles of a latency histogram, in microseconds.
+
+-----------------------------------------------------------------------------------*/
+
+void print_latency( const char* name, const LatencyHistogram &hist ){
+
+    fprintf( stdout, "\t%-9s %10.1f %10.1f %10.1f %10.1f\n", name, hist.Percentile(50) / 1e3, hist.Percentile(90) / 1e3,
+             hist.Percentile(99) / 1e3, hist.MaxNs() / 1e3 ) ;
+
+    return ;
+
+}
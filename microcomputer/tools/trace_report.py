@@ -0,0 +1,114 @@
+#!/usr/bin/python
+from __future__ import with_statement
+
+import sys
+import os
+import json
+import argparse
+
+# Frames whose spans are further apart than this are treated as different frames that
+# happen to share a sequence number, as when i2c_transfer is restarted.
+MAX_GAP_US = 60e6
+PERCENTILES = [50, 95, 99]
+
+def read_spans( f_name ):
+    """ Reads the trace events of a Chrome trace JSON file written by i2c_transfer --trace or by sign2speech. """
+
+    with open( f_name ) as input_file:
+        trace = json.load( input_file )
+
+    return trace["traceEvents"] if isinstance( trace, dict ) else trace
+
+def group_frames( events ):
+    """ Returns the spans of each frame, sorted by the time they ended. """
+
+    spans = {}
+    for event in events:
+        if (event.get( "ph" ) != "X") or ("frame" not in event.get( "args", {} )):
+            continue
+        spans.setdefault( event["args"]["frame"], [] ).append( event )
+    frames = []
+    for frame in spans.values():
+        frame.sort( key=lambda span: span["ts"] + span["dur"] )
+        group = [frame[0]]
+        for span in frame[1:]:
+            if span["ts"] - (group[-1]["ts"] + group[-1]["dur"]) > MAX_GAP_US:
+                frames.append( group )
+                group = []
+            group.append( span )
+        frames.append( group )
+
+    return frames
+
+def percentile( values, percent ):
+    """ Returns the nearest rank percentile of a sorted list. """
+
+    rank = int( round(percent / 100.0 * len(values) + 0.5) ) - 1
+
+    return values[max( 0, min(len(values) - 1, rank) )]
+
+def summarize( frames ):
+    """ Returns the latencies of each stage, in microseconds. A stage's latency runs from the end of the
+        previous stage of the same frame to the end of its own span, so it includes the time the frame
+        waited in the queue or ring before the stage; the first stage's latency is its own span. """
+
+    latency = {}
+    work = {}
+    offset = {}
+    total = []
+    for frame in frames:
+        start = frame[0]["ts"]
+        previous = None
+        for span in frame:
+            end = span["ts"] + span["dur"]
+            latency.setdefault( span["name"], [] ).append( end - previous if previous is not None else span["dur"] )
+            work.setdefault( span["name"], [] ).append( span["dur"] )
+            offset.setdefault( span["name"], [] ).append( end - start )
+            previous = end
+        if len( frame ) > 1:
+            total.append( previous - start )
+    # List the stages in the order a frame usually reaches them.
+    names = sorted( latency, key=lambda name: percentile(sorted(offset[name]), 50) )
+
+    return [(name, sorted(latency[name]), sorted(work[name])) for name in names], sorted( total )
+
+def print_summary( stages, total ):
+    """ Prints the latency percentiles of each stage. """
+
+    header = "%-10s %8s" % ("stage", "frames") + "".join( "%10s" % ("p%d us" % p) for p in PERCENTILES ) + "%12s" % "work p50"
+    sys.stdout.write( header + "\n" )
+    for name, latency, work in stages:
+        sys.stdout.write( "%-10s %8d" % (name, len(latency)) + "".join( "%10.1f" % percentile(latency, p) for p in PERCENTILES ) +
+                          "%12.1f\n" % percentile(work, 50) )
+    if total:
+        sys.stdout.write( "%-10s %8d" % ("total", len(total)) + "".join( "%10.1f" % percentile(total, p) for p in PERCENTILES ) + "\n" )
+
+def main( args ):
+    """ Main program. Usage: trace_report.py [-o merged.json] trace.json ... """
+
+    parser = argparse.ArgumentParser( description="Summarizes the stage latencies of i2c_transfer and sign2speech traces." )
+    parser.add_argument( "-o", dest="output", help="also write the traces merged into one file, for chrome://tracing" )
+    parser.add_argument( "traces", nargs="+", help="traces written by i2c_transfer --trace and SIGN2SPEECH_TRACE" )
+    options = parser.parse_args( args[1:] )
+    ret_val = os.EX_OK  # Return status code
+
+    try:
+        events = []
+        for f_name in options.traces:
+            events += read_spans( f_name )
+        frames = group_frames( events )
+        if not frames:
+            raise ValueError( "No frames traced" )
+        stages, total = summarize( frames )
+        print_summary( stages, total )
+        if options.output:
+            with open( options.output, 'w' ) as output_file:
+                json.dump( {"traceEvents": events, "displayTimeUnit": "ns"}, output_file )
+    except (IOError, OSError, ValueError, KeyError) as e:
+        sys.stderr.write( "*** " + str(e) + " ***\n" )
+        ret_val = os.EX_DATAERR
+
+    return ret_val
+
+if __name__ == "__main__":
+    sys.exit( main(sys.argv) )
@@ -0,0 +1,145 @@
+#!/usr/bin/python
+from __future__ import with_statement
+
+import sys
+import os
+import struct
+import zlib
+import xml.etree.ElementTree as ElementTree
+
+# Layout of a binary sensor frame. Must match microcontroller/sensor_frame.h.
+FRAME_MAGIC = 0x4D524653
+FRAME_VERSION = 2
+FRAME_HEADER = "<IHHIIQ"                 # magic, version, size, seq, flags, timestamp
+FRAME_HAND = "5BBH12h18h"                # flex, reserved, contact, lsm303, lsm9dof
+FRAME_FORMAT = FRAME_HEADER + FRAME_HAND + FRAME_HAND + "II"  # ..., acq_us, crc
+FRAME_SIZE = struct.calcsize( FRAME_FORMAT )
+FRAME_CONNECTED = 0x01
+FRAME_PRESENT = [0x02, 0x04]             # Left, right.
+HAND_SIDES = ["left", "right"]
+FINGER_NAMES = ["thumb", "index", "middle", "ring", "pinky"]
+FOLD_NAMES = ["thumb-index", "index-middle", "middle-ring", "ring-pinky"]
+LSM303_NAMES = ["accel-x", "accel-y", "accel-z", "mag-x", "mag-y", "mag-z"]
+LSM9DOF_NAMES = LSM303_NAMES + ["gyro-x", "gyro-y", "gyro-z"]
+
+def read_hand( hand ):
+    """ Reads the sensor values of a single hand node. """
+
+    flex = []
+    contact = 0
+    bit = 0
+    lsm303 = []
+    lsm9dof = []
+    # Contact bits follow the gesture database column order:
+    # th_con_t, in_con_t, in_con_m, mi_con_t, mi_con_m, ri_con_t, ri_con_m, pi_con_t, pi_con_m, ti_con_t, im_con_t, mr_con_t, rp_con_t
+    for name in FINGER_NAMES:
+        finger = hand.find( name )
+        flex.append( int(float(finger.findtext("flex"))) )
+        for contact_name in ["contact-tip", "contact-mid"]:
+            if (name == "thumb") and (contact_name == "contact-mid"):
+                # The thumb only has a tip contact sensor.
+                continue
+            if finger.findtext( contact_name ).strip() == "true":
+                contact |= (1 << bit)
+            bit += 1
+    for name in FOLD_NAMES:
+        if hand.find( name ).findtext( "contact-tip" ).strip() == "true":
+            contact |= (1 << bit)
+        bit += 1
+    for lsm in hand.findall( "lsm303" ):
+        lsm303 += [int(float(lsm.findtext(name))) for name in LSM303_NAMES]
+    for lsm in hand.findall( "lsm9dof" ):
+        lsm9dof += [int(float(lsm.findtext(name))) for name in LSM9DOF_NAMES]
+
+    return flex, contact, lsm303, lsm9dof
+
+def xml_to_frame( f_name, seq ):
+    """ Converts a single XML capture into a binary sensor frame. """
+
+    root = ElementTree.parse( f_name ).getroot()
+    gesture = root.find( "gesture" )
+    flags = 0
+    values = []
+    if root.findtext( "status", "" ).strip() == "connected":
+        flags |= FRAME_CONNECTED
+    hands = dict( (hand.get("side"), hand) for hand in gesture.findall("hand") )
+    for i in range( len(HAND_SIDES) ):
+        try:
+            flex, contact, lsm303, lsm9dof = read_hand( hands[HAND_SIDES[i]] )
+        except (KeyError, AttributeError):
+            raise ValueError( os.path.basename(f_name) + " is not in the current capture format" )
+        if (len(lsm303) != 12) or (len(lsm9dof) != 18):
+            raise ValueError( os.path.basename(f_name) + " is missing accelerometer values" )
+        if any( flex ) or contact or any( lsm303 ) or any( lsm9dof ):
+            flags |= FRAME_PRESENT[i]
+        values += flex + [0, contact] + lsm303 + lsm9dof
+    # Captures carry no timing information, so the timestamp and acquisition time are zero.
+    values = [FRAME_MAGIC, FRAME_VERSION, FRAME_SIZE, seq, flags, 0] + values + [0]
+    frame = struct.pack( FRAME_FORMAT[:-1], *values )
+
+    return frame + struct.pack( "<I", zlib.crc32(frame) & 0xFFFFFFFF )
+
+def read_frames( f_name ):
+    """ Reads back the frames in a file, checking each CRC. """
+
+    frames = []
+    with open( f_name, 'rb' ) as input_file:
+        data = input_file.read()
+    for i in range( 0, len(data) - FRAME_SIZE + 1, FRAME_SIZE ):
+        frame = data[i:i + FRAME_SIZE]
+        if struct.unpack( "<I", frame[-4:] )[0] != (zlib.crc32(frame[:-4]) & 0xFFFFFFFF):
+            raise ValueError( "CRC mismatch in " + f_name )
+        frames.append( struct.unpack(FRAME_FORMAT, frame) )
+
+    return frames
+
+def convert_dir( in_dir, out_dir ):
+    """ Converts every XML capture in a directory into a frame file of the same name. """
+
+    suffix = ".xml"  # Suffix of the input files.
+    count = 0
+
+    if not os.path.isdir( out_dir ):
+        os.makedirs( out_dir )
+    f_names = sorted( [content for content in os.listdir(in_dir) if content.endswith(suffix)] )
+    for content in f_names:
+        out_name = os.path.join( out_dir, content[:-len(suffix)] + ".frm" )
+        try:
+            frame = xml_to_frame( os.path.join(in_dir, content), count )
+        except ValueError as e:
+            # Older captures predate the accelerometers and cannot be converted.
+            sys.stderr.write( "*** Skipping " + str(e) + " ***\n" )
+            continue
+        sys.stdout.write( "Writing:\t" + out_name + "\n" )
+        with open( out_name, 'wb' ) as output_file:
+            output_file.write( frame )
+        read_frames( out_name )
+        count += 1
+
+    return count
+
+def main( args ):
+    """ Main program. Usage: xml_to_frames.py [xml_dir out_dir] ... """
+
+    data_dir = os.path.join( os.path.dirname(os.path.abspath(__file__)), "..", "..", "gesture_data" )
+    dirs = [(os.path.join(data_dir, "alphabet_xml"), os.path.join(data_dir, "alphabet_frames")),
+            (os.path.join(data_dir, "numbers_xml"), os.path.join(data_dir, "numbers_frames"))]
+    ret_val = os.EX_OK  # Return status code
+
+    if len( args ) > 1:
+        if (len(args) % 2) != 1:
+            sys.stderr.write( "Usage: " + args[0] + " [xml_dir out_dir] ...\n" )
+            return os.EX_USAGE
+        dirs = [(args[i], args[i + 1]) for i in range( 1, len(args), 2 )]
+    try:
+        for in_dir, out_dir in dirs:
+            sys.stdout.write( "Converting:\t" + in_dir + "\n" )
+            sys.stdout.write( "Converted " + str(convert_dir(in_dir, out_dir)) + " captures\n" )
+    except (IOError, OSError, ValueError) as e:
+        sys.stderr.write( "*** " + str(e) + " ***\n" )
+        ret_val = os.EX_DATAERR
+
+    return ret_val
+
+if __name__ == "__main__":
+    sys.exit( main(sys.argv) )
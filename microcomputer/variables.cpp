@@ -1,37 +1,33 @@
 #include "variables.h"
 
-Gesture nextGesture ;                                            /* The next gesture to be read in. */
-    Hand nextHand[NUM_HANDS] ;                                       /* The next pair of hands to be read in. */
     const char* fName   = "../gesture_data/gesture_data_init.xml" ;  /* The XML file containing sensor data. */
     const char* intfName = "../gesture_data/gesture_data_read.xml" ; /* The XML file containing sensor data to be read. */
     const char* newfName = "../gesture_data/gesture_data.complete" ; /* The parsed XML file containing sensor data. */
-    const char* outfName = "../gesture_data/gesture_data.xml" ;      /* The XML file that was just read. */
+    const char* outfName = "../gesture_data/gesture_data.xml" ;      /* The XML snapshot of the latest sample. */
     const char* dbName   = "gesture" ;                               /* The database name to use. */
+    const char* indexFName = "../gesture_data/gestures.idx" ;        /* The compiled gesture file, used in place of the database. */
+    const char* lexiconFName = "../gesture_data/lexicon.idx" ;       /* The compiled lexicon file, used to decode letters into words. */
     int result = EXIT_SUCCESS ;                                      /* Indicates whether program terminated successfully. */ 
     Driver* driver = NULL ;                                          /* The SQL driver. */
     Connection* db = NULL ;                                          /* The connection to the database. */
+    GestureLibrary gestureLibrary ;                                  /* Publishes the gestures recognized, and reloads them as they change. */
+    MotionRecognizer motionRecognizer ;                              /* Recognizes letters that involve motion, such as J and Z, with the templates of the current gestures. */
+    PoseSegmenter poseSegmenter ;                                    /* Finds the frames where the hand settles into a pose. */
+    const char* segmentSpec = getenv( "SIGN2SPEECH_SEGMENT" ) ;      /* The pose segmenter settings, NULL to use the defaults. */
+    Lexicon lexicon ;                                                /* The words the letters are decoded into. */
+    struct sample_ring* sampleRing = NULL ;                          /* The shared memory ring written by i2c_transfer. */
     const char* dbURL = "tcp://127.0.0.1:3306" ;                     /* The database location. */
     const char* un = "sign2speech" ;                                 /* The database username. */
     const char* pw = "sign2speech" ;                                 /* The database password. */
     string ttsScript = "festival" ;                                  /* Location of the text to speech script. */
-    string xmlVersion ;                                              /* The XML version. */
-    string sensorStatus ;                                            /* An indicator of the sensor status. */
+    SpeechService speechService ;                                    /* The Festival server used to speak the text. */
+    bool speakWords = true ;                                         /* Speak each word as soon as it is completed. */
+    const char* sessionFName = getenv( "SIGN2SPEECH_RECORD" ) ;      /* The session log to record sensor frames and text to, NULL if not recording. */
+    SessionJournal sessionJournal ;                                  /* Writes the session log and the XML snapshot from its own thread. */
+    const char* traceFName = getenv( "SIGN2SPEECH_TRACE" ) ;         /* The file to write the stage trace to, NULL if not tracing. */
+    Tracer tracer ;                                                  /* Records how long each stage spends on each frame. */
+    unsigned short statusPort = STATUS_PORT ;                        /* The port the status page is served on. */
+    StatusServer statusServer ;                                      /* Serves the status page and pushes the text to browsers. */
     const char* tfName = "speech.txt" ;                              /* Name of the file to write to. */
     ScreenText scrText ;                                             /* The collection of text to display on the screen. */
-    xml_document<> doc ;                                             /* The contents of the most recent XML document. */
-    string convert ="false" ;                                        /*Used to track whether gesture conversion should be performed.*/
     struct timespec t1 ;                                             /* The amount of time to sleep in nanoseconds. */
-    struct timespec t2 ;                                             /* The time residual. */
-    struct timespec t3 ; /* The amount of time to sleep in nanoseconds. */
-    struct timespec t4 ; /* The time residual. */
-bool motion = false ;                                            /* An indicator if the current gesture involves motion. */
-const string completed_j = "J1J2J3" ;                            /* A completed J gesture. */
-const string completed_z = "Z1Z2Z3Z4" ;                          /* A completed Z gesture. */
-const string invalid_j = "J3" ;
-    const string invalid_z = "Z4" ;
-    const string j_motion[NUM_J_MOTION] = { "J1J2",                  /* Array of intermediate gestures that involve the letter J. */
-                                            "J1" } ;
-    const string z_motion[NUM_Z_MOTION] = { "Z1Z2Z3",                /* Array of intermediate gestures that involve the letter Z. */
-                                            "Z1Z2",
-                                            "Z1" } ;
-bool added_text = false ;
@@ -6,39 +6,46 @@
 #include "parser.h"
 #include <iostream>
 #include "battery_indicator.h"
+#include "Pipeline.h"
+#include "SpeechService.h"
+#include "SessionJournal.h"
+#include "Tracer.h"
+#include "Lexicon.h"
+#include "StatusServer.h"
+#include "GestureLibrary.h"
+#include <atomic>
 
-extern Gesture nextGesture ;                                           /* The next gesture to be read in. */
-extern Hand nextHand[NUM_HANDS] ;                                      /* The next pair of hands to be read in. */
 extern const char* fName; 					       /* The XML file containing sensor data. */
 extern const char* intfName;                                           /* The XML file containing sensor data to be read. */
 extern const char* newfName;                                           /* The parsed XML file containing sensor data. */
-extern const char* outfName;                                           /* The XML file that was just read. */
+extern const char* outfName;                                           /* The XML snapshot of the latest sample. */
 extern const char* dbName;                                             /* The database name to use. */
+extern const char* indexFName ;                                        /* The compiled gesture file, used in place of the database. */
+extern const char* lexiconFName ;                                      /* The compiled lexicon file, used to decode letters into words. */
 extern int result ;                                                    /* Indicates whether program terminated successfully. */ 
 extern Driver* driver;                                                 /* The SQL driver. */
 extern Connection* db;                                                 /* The connection to the database. */
+extern GestureLibrary gestureLibrary ;                                 /* Publishes the gestures recognized, and reloads them as they change. */
+extern MotionRecognizer motionRecognizer ;                             /* Recognizes letters that involve motion, such as J and Z, with the templates of the current gestures. */
+extern PoseSegmenter poseSegmenter ;                                   /* Finds the frames where the hand settles into a pose. */
+extern const char* segmentSpec ;                                       /* The pose segmenter settings, NULL to use the defaults. */
+extern Lexicon lexicon ;                                               /* The words the letters are decoded into. */
+extern struct sample_ring* sampleRing ;                                /* The shared memory ring written by i2c_transfer. */
 extern const char* dbURL;                                              /* The database location. */
 extern const char* un;                                                 /* The database username. */
 extern const char* pw;                                                 /* The database password. */
 extern string ttsScript;                                               /* Location of the text to speech script. */
-extern string xmlVersion ;                                             /* The XML version. */
-extern string sensorStatus ;                                           /* An indicator of the sensor status. */
+extern SpeechService speechService ;                                   /* The Festival server used to speak the text. */
+extern bool speakWords ;                                               /* Speak each word as soon as it is completed. */
+extern const char* sessionFName ;                                      /* The session log to record sensor frames and text to, NULL if not recording. */
+extern SessionJournal sessionJournal ;                                 /* Writes the session log and the XML snapshot from its own thread. */
+extern const char* traceFName ;                                        /* The file to write the stage trace to, NULL if not tracing. */
+extern Tracer tracer ;                                                 /* Records how long each stage spends on each frame. */
+extern unsigned short statusPort ;                                     /* The port the status page is served on. */
+extern StatusServer statusServer ;                                     /* Serves the status page and pushes the text to browsers. */
 extern const char* tfName;                                             /* Name of the file to write to. */
 extern ScreenText scrText ;                                            /* The collection of text to display on the screen. */
-extern xml_document<> doc ;                                          /* The contents of the most recent XML document. */
-extern string convert;                                               /*Used to track whether gesture conversion should be performed.*/
 extern struct timespec t1 ;                                            /* The amount of time to sleep in nanoseconds. */
-extern struct timespec t2 ;                                            /* The time residual. */
-extern bool motion;                                            /* An indicator if the current gesture involves motion. */
-extern const string completed_j;                            /* A completed J gesture. */
-extern const string completed_z;                          /* A completed Z gesture. */
-extern const string invalid_j;
-extern const string invalid_z;
-extern const string j_motion[NUM_J_MOTION];
-extern const string z_motion[NUM_Z_MOTION];
-extern bool added_text;
-extern struct timespec t3 ; /* The amount of time to sleep in nanoseconds. */
-extern struct timespec t4 ; /* The time residual. */
 
 class ExampleWindow;
 
@@ -47,24 +54,40 @@ class ExampleWorker
 public:
   ExampleWorker();
 
-  // Thread function.
+  // Thread function. Runs the text stage itself and the other stages on their own threads.
   void do_work(ExampleWindow *caller);
 
   void get_data(string* text_done, Glib::ustring* message) const;
-  string get_data_2();
-  void set_data(string text_done);
+  void reset_text();
+  void speak_text();
   void stop_work();
   bool has_stopped() const;
 
 private:
+  // Pipeline stages.
+  void ingest_stage();
+  void decode_stage();
+  void classify_stage();
+  void text_stage(ExampleWindow *caller);
+  void speech_stage();
+
   // Synchronizes access to member data.
   mutable Glib::Threads::Mutex m_Mutex;
 
   // Data used by both GUI thread and worker thread.
-  bool m_shall_stop;
   bool m_has_stopped;
   string m_text_done;
   Glib::ustring m_message;
+
+  // Data used by the pipeline stages, which do not take the mutex.
+  std::atomic<bool> m_shall_stop;
+  std::atomic<unsigned int> m_request;     // Reset and speak requests from the GUI thread.
+  std::atomic<unsigned int> m_generation;  // Incremented each time the text is cleared.
+  SpscQueue<RawSample, PIPELINE_RAW_SLOTS> m_raw;               // ingest -> decode
+  SpscQueue<GestureSample, PIPELINE_SAMPLE_SLOTS> m_decoded;    // decode -> classify
+  SpscQueue<GestureSample, PIPELINE_SAMPLE_SLOTS> m_classified; // classify -> text
+  SpscQueue<SpeechRequest, PIPELINE_SPEECH_SLOTS> m_speech;     // text -> speech
+  PipelineStats m_stats;
 };
 
 class ExampleWindow : public Gtk::Window
@@ -82,7 +105,7 @@ private:
   void on_output_button_clicked();
   void on_reset_button_clicked();
   void on_quit_button_clicked();
-  bool update_battery();
+  void update_battery(int chargelevel);
 
   void update_widgets();
 
@@ -101,9 +124,11 @@ private:
   Gtk::ProgressBar m_bar;
 
   Glib::Dispatcher m_Dispatcher;
+  Glib::Dispatcher m_SpeakDispatcher;  // Emitted by the status server, so its commands run as the buttons do.
+  Glib::Dispatcher m_ResetDispatcher;
   ExampleWorker m_Worker;
   Glib::Threads::Thread* m_WorkerThread;
-  sigc::connection m_connection_timeout;
+  BatteryMonitor m_Battery;
 };
 
 
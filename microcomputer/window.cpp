@@ -13,6 +13,8 @@ ExampleWindow::ExampleWindow() :
   m_box2(Gtk::ORIENTATION_HORIZONTAL),
   m_box3(Gtk::ORIENTATION_HORIZONTAL),
   m_Dispatcher(),
+  m_SpeakDispatcher(),
+  m_ResetDispatcher(),
   m_Worker(),
   m_WorkerThread(nullptr)
   
@@ -21,25 +23,82 @@ ExampleWindow::ExampleWindow() :
     /* Perform initialization. */
     if( !init( scrText ) ){
         scrText.SetStatus( "*** Error during initialization ***\n" ) ;
-	output_to_display( scrText, true ) ;
+	output_to_display( scrText ) ;
         result = EXIT_FAILURE ;
         exit( result ) ;
     }
     t1.tv_sec = 0 ;
     t1.tv_nsec = 10000000L ;
-    t3.tv_sec = 2 ;
-    t3.tv_nsec = 0 ;
     scrText.SetStatus( "Initialized\n" ) ;
-    output_to_display( scrText, true ) ;
-    /* Connect to the gesture database. */
-    if( !load_gesture_database( driver, db, dbURL, un, pw, dbName, scrText ) ){
-        //scrText.SetStatus( "*** Error connecting to database ***\n" ) ;
-	//output_to_display( scrText, true ) ;
-        result = EXIT_FAILURE ;
-        exit( result ) ;    
+    output_to_display( scrText ) ;
+    /* Map the compiled gesture file written by tools/gesture_compile. Connect to the gesture database only if it is unavailable.
+       Letters that involve motion are recognized from their keyframes in either. */
+    GestureSet* gestures = new GestureSet ;
+    if( gestures->Load( indexFName ) ){
+        scrText.SetStatus( "Loaded compiled gestures:\t" + string(indexFName) + "\n" ) ;
+    }
+    else{
+        if( !load_gesture_database( driver, db, dbURL, un, pw, dbName, gestures->Gestures(), scrText ) ){
+            //scrText.SetStatus( "*** Error connecting to database ***\n" ) ;
+	    //output_to_display( scrText ) ;
+            result = EXIT_FAILURE ;
+            exit( result ) ;    
+        }
+        gestures->Build( dbName ) ;
+        scrText.SetStatus( "Loaded gesture database\n" ) ;
+    }
+    gestureLibrary.Publish( gestures ) ;
+    output_to_display( scrText ) ;
+    /* Load the compiled gesture file again in the background whenever it is replaced, so gestures can be changed without a restart. */
+    gestureLibrary.Start( indexFName ) ;
+    /* Map the lexicon written by tools/lexicon_compile. Without it, the letters are used as recognized. */
+    if( lexicon.Load( lexiconFName ) ){
+        scrText.SetStatus( "Loaded lexicon:\t" + string(lexiconFName) + "\n" ) ;
+    }
+    else{
+        scrText.SetStatus( "Unable to load lexicon, using letters as recognized:\t" + string(lexiconFName) + "\n" ) ;
+    }
+    output_to_display( scrText ) ;
+    /* Start the Festival server now, so its voices are loaded before the first utterance. */
+    if( !speechService.Start( ttsScript ) ){
+        scrText.SetStatus( "Unable to start speech server, speaking with:\t" + ttsScript + " --tts\n" ) ;
+        output_to_display( scrText ) ;
+    }
+    /* Map the shared memory ring written by i2c_transfer. Fall back to polling the XML file if it is unavailable. */
+    sampleRing = sample_ring_open( SAMPLE_RING_NAME ) ;
+    if( sampleRing == NULL ){
+        scrText.SetStatus( "Unable to open shared memory ring, reading:\t" + string(fName) + "\n" ) ;
+        output_to_display( scrText ) ;
+    }
+    /* Record the sensor frames and text when SIGN2SPEECH_RECORD names a session log. */
+    if( sessionFName != NULL ){
+        if( sessionJournal.Open( sessionFName ) )
+            scrText.SetStatus( "Recording sensor frames and text to:\t" + string(sessionFName) + "\n" ) ;
+        else
+            scrText.SetStatus( "Unable to record sensor frames and text to:\t" + string(sessionFName) + "\n" ) ;
+        output_to_display( scrText ) ;
+    }
+    /* Write the log and the XML snapshot from their own thread, so the stages never wait on the disk. */
+    sessionJournal.Start( outfName ) ;
+    /* Trace each frame through the stages when SIGN2SPEECH_TRACE names a trace file. It is written when the conversion stops. */
+    if( traceFName != NULL ){
+        if( tracer.Open( traceFName ) )
+            scrText.SetStatus( "Tracing stages to:\t" + string(traceFName) + "\n" ) ;
+        else
+            scrText.SetStatus( "Unable to trace stages to:\t" + string(traceFName) + "\n" ) ;
+        output_to_display( scrText ) ;
+    }
+    /* Tune when a hold starts and ends when SIGN2SPEECH_SEGMENT gives the pose segmenter settings, such as "window=8,hold-flex=3". */
+    if( segmentSpec != NULL ){
+        SegmentConfig segmentConfig = PoseSegmenter::Defaults() ;
+        if( PoseSegmenter::ParseConfig( segmentSpec, segmentConfig ) ){
+            poseSegmenter.Configure( segmentConfig ) ;
+            scrText.SetStatus( "Segmenting poses with:\t" + string(segmentSpec) + "\n" ) ;
+        }
+        else
+            scrText.SetStatus( "Unable to read pose segmenter settings, using the defaults:\t" + string(segmentSpec) + "\n" ) ;
+        output_to_display( scrText ) ;
     }
-    scrText.SetStatus( "Loaded gesture database\n" ) ;
-    output_to_display( scrText, true ) ;
 
     fullscreen();
     m_box1.pack_start(m_box3);
@@ -72,8 +131,8 @@ ExampleWindow::ExampleWindow() :
     m_bar.set_show_text(true);
     
 
-    m_connection_timeout = Glib::signal_timeout().connect(sigc::mem_fun(*this,
-              &ExampleWindow::update_battery), 50 );
+    // The bar is updated only when the charge level changes.
+    m_Battery.Start(sigc::mem_fun(*this, &ExampleWindow::update_battery));
 
       // Connect the signal handlers to the buttons.
     m_ButtonStart.signal_clicked().connect(sigc::mem_fun(*this, &ExampleWindow::on_start_button_clicked));
@@ -84,8 +143,25 @@ ExampleWindow::ExampleWindow() :
     // Connect the handler to the dispatcher.
     m_Dispatcher.connect(sigc::mem_fun(*this, &ExampleWindow::on_notification_from_worker_thread));  
 
+    // Serve the status page. Its commands arrive on the server's thread, so they are
+    // passed to the GUI thread and handled as the Output and Reset buttons are. A
+    // reload is only handed to the gesture library's thread.
+    m_SpeakDispatcher.connect(sigc::mem_fun(*this, &ExampleWindow::on_output_button_clicked));
+    m_ResetDispatcher.connect(sigc::mem_fun(*this, &ExampleWindow::on_reset_button_clicked));
+    if (statusServer.Start(statusPort, [this](StatusCommand command) {
+          if (command == STATUS_SPEAK)
+            m_SpeakDispatcher.emit();
+          else if (command == STATUS_RESET)
+            m_ResetDispatcher.emit();
+          else
+            gestureLibrary.Reload();
+        }))
+      scrText.SetStatus("Serving status page on port:\t" + std::to_string(statusServer.Port()) + "\n");
+    else
+      scrText.SetStatus("Unable to serve status page on port:\t" + std::to_string(statusPort) + "\n");
+    output_to_display(scrText);
+
     add(m_box1);
-    m_bar.set_fraction(0.0);
 
     show_all_children();
 }
@@ -104,14 +180,10 @@ void ExampleWindow::on_start_button_clicked()
   }
 }
 
-bool ExampleWindow::update_battery() {
-
-  int chargelevel = getBatteryState();
+void ExampleWindow::update_battery(int chargelevel) {
 
   m_bar.set_fraction(chargelevel / 100.0);
 
-  return true;
-
 }
 
 void ExampleWindow::on_stop_button_clicked()
@@ -129,34 +201,28 @@ void ExampleWindow::on_stop_button_clicked()
 
 void ExampleWindow::on_reset_button_clicked()
 {
-  if (m_WorkerThread)
+  // The text stage clears the text and resets the recognizers on its next pass.
+  m_Worker.reset_text();
+  m_Label.set_text("");
+  if (!m_WorkerThread)
   {
-    m_Worker.stop_work();
-    usleep(10);
-    m_Worker.set_data("");
-    motion = false;
-    m_Label.set_text("");
-  }
     // Start a new worker thread.
     m_WorkerThread = Glib::Threads::Thread::create(
       sigc::bind(sigc::mem_fun(m_Worker, &ExampleWorker::do_work), this));
+  }
 }
 
 void ExampleWindow::on_output_button_clicked() {
 cout << "Output Clicked" << endl;
-if (m_WorkerThread)
+  // The speech stage speaks the text without blocking the GUI, then it is cleared.
+  m_Worker.speak_text();
+  m_Label.set_text("");
+  if (!m_WorkerThread)
   {
-    m_Worker.stop_work();
-    usleep(10);
-    m_Worker.set_data("");
-    m_Label.set_text("");
-    motion = false;
-  }
-    system ("festival --tts speech.txt");
     // Start a new worker thread.
     m_WorkerThread = Glib::Threads::Thread::create(
       sigc::bind(sigc::mem_fun(m_Worker, &ExampleWorker::do_work), this));
-
+  }
 }
 
 void ExampleWindow::update_widgets()
@@ -165,19 +231,23 @@ void ExampleWindow::update_widgets()
   Glib::ustring message_from_worker_thread;
   m_Worker.get_data(&text_done, &message_from_worker_thread);
   m_Label.set_text(text_done);
-  ofstream outputFile ;
-  try{
-        /* Write text to new file. */
-        outputFile.open( "speech.txt" ) ;
-        outputFile << text_done ;
-        outputFile.close() ;
-    }catch( ... ){
-    }
-
 }
 
 void ExampleWindow::on_quit_button_clicked()
 {
+  if (m_WorkerThread)
+  {
+    // Stop the stages before exit() destroys the globals they use, such as the gesture
+    // sets. The worker writes what they have traced and logged once they have stopped.
+    m_Worker.stop_work();
+    m_WorkerThread->join();
+    m_WorkerThread = nullptr;
+  }
+  else
+  {
+    tracer.Write();
+    sessionJournal.Flush();
+  }
   exit(0);
 }
 
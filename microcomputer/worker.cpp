@@ -1,16 +1,38 @@
 #include "variables.h"
 #include <sstream>
 #include <iostream>
+#include <fstream>
+#include <thread>
+
+#define REQUEST_RESET 0x01  /* Clear the text. */
+#define REQUEST_SPEAK 0x02  /* Speak the text, then clear it. */
 
 ExampleWorker::ExampleWorker() :
   m_Mutex(),
-  m_shall_stop(false),
   m_has_stopped(false),
   m_text_done("Welcome to sign2speech!"),
-  m_message()
+  m_message(),
+  m_shall_stop(false),
+  m_request(0),
+  m_generation(0)
 {
 }
 
+// Queues a value for the next stage, waiting while the queue is full. The wait is what
+// slows the earlier stages down when a later one falls behind; once the shared memory
+// ring fills up, i2c_transfer counts the frames it has to drop.
+template <typename Queue, typename Value>
+static bool push_wait(Queue& queue, const Value& value, const std::atomic<bool>& stop)
+{
+  while (!queue.TryPush(value))
+  {
+    if (stop)
+      return false;
+    queue.WaitForSpace(RING_WAIT_MS);
+  }
+  return true;
+}
+
 // Accesses to these data are synchronized by a mutex.
 // Some microseconds can be saved by getting all data at once, instead of having
 // separate get_fraction_done() and get_message() methods.
@@ -25,23 +47,20 @@ void ExampleWorker::get_data(string* text_done, Glib::ustring* message) const
     *message = m_message;
 }
 
-string ExampleWorker::get_data_2() {
-
-  return m_text_done;
-
+// The text belongs to the text stage, so clearing it is only requested here, as are
+// the recognizer resets that go with it.
+void ExampleWorker::reset_text()
+{
+  m_request |= REQUEST_RESET;
 }
 
-void ExampleWorker::set_data(string text_done) {
-  Glib::Threads::Mutex::Lock lock(m_Mutex);
-  
-  m_text_done = text_done;
-
-
+void ExampleWorker::speak_text()
+{
+  m_request |= REQUEST_SPEAK;
 }
 
 void ExampleWorker::stop_work()
 {
-  Glib::Threads::Mutex::Lock lock(m_Mutex);
   m_shall_stop = true;
 }
 
@@ -60,72 +79,385 @@ void ExampleWorker::do_work(ExampleWindow* caller)
     m_message = "";
   } // The mutex is unlocked here by lock's destructor.
 
-  // Simulate a long calculation.
-  /* Start sign to speech conversion. */
-    while( true ){
-        Glib::Threads::Mutex::Lock lock(m_Mutex);
-        /* Check if sensor data is available. */
-        if( file_exists(fName) ){
-	    /* Collect next set of data and store it as a gesture. */ 
-  	    scrText.SetStatus( "Reading:\t" + string(fName) + "\n" ) ;
-   	    output_to_display( scrText, true ) ;
-            /* Add delay to make sure file has finished being written to before attempting to read. */
-  	    nanosleep( &t1, &t2 ) ;
-            if( rename(fName, intfName) != 0 ){
-       	        scrText.SetStatus( "Unable to rename file:\t" + string(fName) + "\n" ) ;
-	    }
-            if( get_gesture( nextHand, intfName, scrText, doc, sensorStatus, xmlVersion, convert ) ){
-                /* Store the next gesture set of data. */
-                nextGesture = Gesture( nextHand[0], nextHand[1] ) ;     
-                /* Update display for the next set of sensor values. */
-  	        scrText.SetGestureData( nextGesture.AsString() ) ;
-                /* Indicate file was successfully read. */
-		scrText.SetStatus( "Successfully read:\t" + string(fName) + "\n" ) ;
-                /* Rename the file so as not to re-read it. */
-                if( rename(intfName, newfName) != 0 ){
-  	   	    scrText.SetStatus( "Unable to rename file:\t" + string(intfName) + "\n" ) ;
-		}
-   	        output_to_display( scrText, true ) ;
-	    }
-	    else{
-  	        scrText.SetStatus( "*** Error reading file. Attempting to continue ***\n" ) ;
-        	output_to_display( scrText, true ) ;
-		continue ;
-	    }
-            /* Convert the gesture to text. */
-            if( gesture_to_text(nextGesture, db, m_text_done, scrText, motion, added_text) ){
-		motion = false ;
-  	        if( motion_gesture( m_text_done, j_motion, invalid_j, completed_j, NUM_J_MOTION, "J" ) || 
-                    motion_gesture( m_text_done, z_motion, invalid_z, completed_z, NUM_Z_MOTION, "Z" ) ){
-  	  	    motion = true ;
-  	        }
-                /* Output the text to display */
-  	        scrText.SetGestureConv( m_text_done + "\n" ) ;
-		if( added_text ){
-		    nanosleep( &t3, &t4 ) ;
-		}
-            	lock.release();
-    		caller->notify();
-                output_to_display( scrText, true ) ;
-	    }
-	    else{
-	        /* Gesture to text error. */
-	        scrText.SetStatus( "*** Unable to convert gesture to text. Attempting to continue ***\n" ) ;
-                output_to_display( scrText, true ) ;
-		continue ;
-	    }
-  	    scrText.SetStatus( "Wrote:\t" + string(outfName) + "\n" ) ;
-            /* Update XML file. */
-            if( !output_xml(outfName, m_text_done, nextGesture, sensorStatus, xmlVersion) ){
-  	        scrText.SetStatus( "Error while writing:\t" + string(outfName) + "\n" ) ;
-	    }
-   	    output_to_display( scrText, true ) ;
-	}
+  /* Start sign to speech conversion. Every stage runs until stop_work() is called. */
+  std::thread ingest(&ExampleWorker::ingest_stage, this);
+  std::thread decode(&ExampleWorker::decode_stage, this);
+  std::thread classify(&ExampleWorker::classify_stage, this);
+  std::thread speech(&ExampleWorker::speech_stage, this);
+  text_stage(caller);
+  ingest.join();
+  decode.join();
+  classify.join();
+  speech.join();
+  sessionJournal.Flush();
+  tracer.Write();
 
-    }
   Glib::Threads::Mutex::Lock lock(m_Mutex);
   m_shall_stop = false;
   m_has_stopped = true;
   lock.release();
   caller->notify();
 }
+
+// Copies each frame out of the shared memory ring as soon as it is published, so the
+// slot goes straight back to i2c_transfer. Without the ring, polls the XML file instead.
+void ExampleWorker::ingest_stage()
+{
+  RawSample raw;
+  struct timespec residual;
+  uint32_t fileSamples = 0;
+  uint64_t start;
+
+  tracer.Name("ingest");
+  while (!m_shall_stop)
+  {
+    if (sampleRing != NULL)
+    {
+      /* Sleep until i2c_transfer publishes the next sample. */
+      if (!sample_ring_wait(sampleRing, RING_WAIT_MS))
+        continue;
+      start = pipeline_now_ns();
+      raw.frame = *sample_ring_peek(sampleRing);
+      sample_ring_release(sampleRing);
+      raw.fromFile = false;
+      raw.seq = raw.frame.seq;
+    }
+    else if (file_exists(fName))
+    {
+      start = pipeline_now_ns();
+      /* Add delay to make sure file has finished being written to before attempting to read. */
+      nanosleep(&t1, &residual);
+      if (rename(fName, intfName) != 0)
+        continue;
+      ifstream inputFile(intfName);
+      stringstream contents;
+      contents << inputFile.rdbuf();
+      raw.xml = contents.str();
+      /* Rename the file so as not to re-read it. */
+      rename(intfName, newfName);
+      raw.fromFile = true;
+      /* XML samples carry no sequence number, so number them apart from the frames. */
+      raw.seq = TRACE_LOCAL_FRAME | (fileSamples++ & ~TRACE_LOCAL_FRAME);
+    }
+    else
+    {
+      nanosleep(&t1, &residual);
+      continue;
+    }
+    raw.ingested = pipeline_now_ns();
+    m_stats.Stage(STAGE_INGEST).Record(raw.fromFile ? 0 : raw.frame.timestamp, raw.ingested);
+    raw.queued = pipeline_now_ns();
+    tracer.Span("ingest", raw.seq, start, raw.queued);
+    push_wait(m_raw, raw, m_shall_stop);
+  }
+}
+
+// Converts each frame or XML document into a pair of hands.
+void ExampleWorker::decode_stage()
+{
+  Hand hands[NUM_HANDS];
+  ImuFusion fusion[NUM_HANDS];  // Tracks the orientation of each hand from frame to frame.
+  xml_document<> xmlDoc;  /* Parsed into by this thread only. */
+  GestureSample sample;
+  RawSample* raw;
+
+  tracer.Name("decode");
+  while (!m_shall_stop)
+  {
+    raw = m_raw.Front();
+    if (raw == NULL)
+    {
+      m_raw.WaitForData(RING_WAIT_MS);
+      continue;
+    }
+    uint64_t start = pipeline_now_ns();
+    if (raw->fromFile)
+    {
+      sample.source = fName;
+      sample.acquired = 0;
+      try
+      {
+        sample.valid = parse_gesture(hands, &raw->xml[0], xmlDoc, sample.sensorStatus, sample.xmlVersion, sample.convert);
+      }
+      catch (const parse_error&)
+      {
+        sample.valid = false;
+      }
+    }
+    else
+    {
+      sample.source = SAMPLE_RING_NAME;
+      sample.acquired = raw->frame.timestamp;
+      sample.valid = get_frame(hands, &raw->frame, sample.sensorStatus, sample.xmlVersion, sample.convert);
+      /* Log the frame for tools/replay, if recording. The journal thread writes it. */
+      sessionJournal.Frame(raw->frame);
+    }
+    sample.ingested = raw->ingested;
+    sample.seq = raw->seq;
+    uint64_t queued = raw->queued;
+    m_raw.Pop();
+    if (sample.valid)
+    {
+      // Fuse the accelerometers at the full frame rate, before any frame is skipped by a hold.
+      for (unsigned int i = 0; i < NUM_HANDS; i++)
+        fusion[i].Update(hands[i], sample.acquired);
+      sample.gesture = Gesture(hands[0], hands[1]);
+    }
+    sample.letters.clear();
+    sample.convertFailed = false;
+    sample.queued = pipeline_now_ns();
+    m_stats.Stage(STAGE_DECODE).Record(queued, sample.queued);
+    tracer.Span("decode", sample.seq, start, sample.queued);
+    push_wait(m_decoded, sample, m_shall_stop);
+  }
+}
+
+// Finds the holds and motions in the stream of hands and converts them to text. Only this
+// thread uses the segmenter and motion recognizer while the pipeline is running. The
+// gestures are read from the library's current set on every frame, so a reload takes
+// effect on the next frame without this thread ever waiting for it.
+void ExampleWorker::classify_stage()
+{
+  GestureSample* sample;
+  unsigned int generation = m_generation;
+  unsigned long gestureGeneration = 0;  /* The set the motion templates were copied from. */
+
+  tracer.Name("classify");
+  while (!m_shall_stop)
+  {
+    sample = m_decoded.Front();
+    if (sample == NULL)
+    {
+      m_decoded.WaitForData(RING_WAIT_MS);
+      continue;
+    }
+    uint64_t start = pipeline_now_ns();
+    if (generation != m_generation)
+    {
+      /* The text was cleared, so forget any partial motion or hold. */
+      generation = m_generation;
+      motionRecognizer.Reset();
+      poseSegmenter.Reset();
+    }
+    const GestureSet& gestures = gestureLibrary.Enter();
+    if (gestures.Generation() != gestureGeneration)
+    {
+      /* New gestures were published. Any partial motion is forgotten with the old templates. */
+      gestureGeneration = gestures.Generation();
+      motionRecognizer = gestures.Motion();
+    }
+    classify_sample(*sample, gestures.Index(), motionRecognizer, poseSegmenter);
+    uint64_t queued = sample->queued;
+    sample->queued = pipeline_now_ns();
+    m_stats.Stage(STAGE_CLASSIFY).Record(queued, sample->queued);
+    tracer.Span("classify", sample->seq, start, sample->queued);
+    push_wait(m_classified, *sample, m_shall_stop);
+    m_decoded.Pop();
+  }
+  gestureLibrary.Leave();
+}
+
+// Finds the words in text[spoken..] that have been completed by a space gesture.
+// Returns false if there are none. Otherwise sets words to them, without the final
+// space, and end to the position just after that space.
+static bool completed_words(const string& text, size_t spoken, string& words, size_t& end)
+{
+  size_t space = text.find_last_of(' ');
+
+  if ((space == string::npos) || (space < spoken))
+    return false;
+  end = space + 1;
+  words = text.substr(spoken, space - spoken);
+  return true;
+}
+
+// Appends the recognized text and hands it to the window; this is the only stage that
+// takes the mutex. Also owns the terminal display, logs the text as it changes, and posts
+// the text and hands to the status server, or to the XML snapshot if it is not running.
+void ExampleWorker::text_stage(ExampleWindow* caller)
+{
+  GestureSample* sample;
+  SpeechRequest speech;
+  string text;
+  size_t spoken = 0;        /* Length of the text already queued for speech. */
+  size_t end;
+  uint64_t wordOrigin = 0;  /* Time the frame that completed the last word was read. */
+  uint32_t wordSeq = TRACE_NO_FRAME;  /* Sequence number of that frame. */
+  WordDecoder decoder;      /* Decodes the letters into words, if the lexicon was loaded. */
+  string pending;           /* The word being signed, as the decoder would complete it. */
+  char rate[64];
+  char loaded[96];
+  unsigned int i;
+  string report;
+  uint64_t reportNs = 0;
+  unsigned int depth[NUM_STAGES];
+  unsigned int capacity[NUM_STAGES] = {SAMPLE_RING_SLOTS, m_raw.Capacity(), m_decoded.Capacity(),
+                                       m_classified.Capacity(), m_speech.Capacity()};
+
+  tracer.Name("text");
+  decoder.SetLexicon(&lexicon);
+  while (!m_shall_stop)
+  {
+    unsigned int request = m_request.exchange(0);
+    if (request != 0)
+    {
+      {
+        Glib::Threads::Mutex::Lock lock(m_Mutex);
+        m_text_done = "";
+      }
+      if (request & REQUEST_SPEAK)
+      {
+        /* The word being signed is spoken as the decoder would complete it. */
+        decoder.Flush(text);
+        /* Only the words not already streamed are left to speak. */
+        speech.text = text.substr(spoken);
+        speech.queued = pipeline_now_ns();
+        speech.origin = 0;
+        speech.seq = TRACE_NO_FRAME;
+        push_wait(m_speech, speech, m_shall_stop);
+      }
+      text = "";
+      spoken = 0;
+      decoder.Reset();
+      pending = "";
+      m_generation++;
+      scrText.SetGestureConv("\n");
+      statusServer.PostText("");
+      sessionJournal.Text("", pipeline_now_ns());
+      caller->notify();
+    }
+    /* Queue each completed word for speech while the next one is being signed. If the
+       speech queue is full, the words wait and go out together on a later pass. */
+    if (speakWords && completed_words(text, spoken, speech.text, end))
+    {
+      speech.queued = pipeline_now_ns();
+      speech.origin = wordOrigin;
+      speech.seq = wordSeq;
+      if ((speech.text.find_first_not_of(' ') == string::npos) || m_speech.TryPush(speech))
+        spoken = end;
+    }
+    sample = m_classified.Front();
+    if (sample == NULL)
+    {
+      m_classified.WaitForData(RING_WAIT_MS);
+      continue;
+    }
+    uint64_t start = pipeline_now_ns();
+    if (!sample->valid)
+    {
+      scrText.SetStatus("*** Error reading sample. Attempting to continue ***\n");
+      output_to_display(scrText);
+      uint64_t now = pipeline_now_ns();
+      m_stats.Stage(STAGE_TEXT).Record(sample->queued, now);
+      tracer.Span("text", sample->seq, start, now);
+      m_classified.Pop();
+      continue;
+    }
+    /* Update display for the next set of sensor values. */
+    scrText.SetGestureData(sample->gesture.AsString());
+    if (decoder.Active() ? (sample->numSegments > 0) : !sample->letters.empty())
+    {
+      if (decoder.Active())
+      {
+        /* A word is only appended once the space after it is signed, so a misread
+           letter can still be corrected by the word it belongs to. */
+        for (i = 0; i < sample->numSegments; i++)
+        {
+          if (decoder.Push(sample->segments[i], text))
+          {
+            wordOrigin = sample->acquired ? sample->acquired : sample->ingested;
+            wordSeq = sample->seq;
+          }
+        }
+        decoder.Pending(pending);
+      }
+      else
+      {
+        text += sample->letters;
+        if (sample->letters.find(' ') != string::npos)
+        {
+          wordOrigin = sample->acquired ? sample->acquired : sample->ingested;
+          wordSeq = sample->seq;
+        }
+      }
+      {
+        Glib::Threads::Mutex::Lock lock(m_Mutex);
+        m_text_done = text + pending;
+      }
+      caller->notify();
+      /* Output the text to display, with the word being signed */
+      scrText.SetGestureConv(text + pending + "\n");
+      sessionJournal.Text(text + pending, pipeline_now_ns());
+    }
+    if (statusServer.Running())
+    {
+      /* Browsers are sent the text and hands as they change, so no file is written. */
+      statusServer.Post(text + pending, sample->gesture, sample->sensorStatus, sample->xmlVersion);
+      scrText.SetStatus("Serving:\tport " + std::to_string(statusServer.Port()) + "\n");
+    }
+    else
+    {
+      /* The journal thread writes the XML snapshot, at most JOURNAL_SNAPSHOT_HZ times a second. */
+      sessionJournal.Snapshot(text + pending, sample->gesture, sample->sensorStatus, sample->xmlVersion);
+      scrText.SetStatus("Writing:\t" + string(outfName) + "\n");
+    }
+    if (sample->convertFailed)
+      scrText.SetStatus("*** Unable to convert gesture to text. Attempting to continue ***\n");
+    uint64_t now = pipeline_now_ns();
+    m_stats.Stage(STAGE_TEXT).Record(sample->queued, now);
+    m_stats.Total().Record(sample->acquired ? sample->acquired : sample->ingested, now);
+    tracer.Span("text", sample->seq, start, now);
+    m_classified.Pop();
+    if ((now - reportNs) >= PIPELINE_REPORT_NS)
+    {
+      depth[STAGE_INGEST] = (sampleRing != NULL) ? sample_ring_depth(sampleRing) : 0;
+      depth[STAGE_DECODE] = m_raw.Depth();
+      depth[STAGE_CLASSIFY] = m_decoded.Depth();
+      depth[STAGE_TEXT] = m_classified.Depth();
+      depth[STAGE_SPEECH] = m_speech.Depth();
+      report = m_stats.Report(depth, capacity, now);
+      reportNs = now;
+    }
+    if (decoder.Words() > 0)
+    {
+      snprintf(rate, sizeof(rate), "Signing:\t%.1f words/min, %.1f gestures/word\n",
+               decoder.WordsPerMinute(), (double)decoder.Letters() / decoder.Words());
+      scrText.SetStatus(scrText.Status() + rate);
+    }
+    if ((gestureLibrary.Generation() > 1) || (gestureLibrary.Failures() > 0))
+    {
+      /* Only shown once the gestures have been reloaded, or have failed to. */
+      snprintf(loaded, sizeof(loaded), "Gestures:\t%u, reloaded %lu times, %lu failed\n",
+               (unsigned int)gestureLibrary.Size(), gestureLibrary.Generation() - 1, gestureLibrary.Failures());
+      scrText.SetStatus(scrText.Status() + loaded);
+    }
+    scrText.SetStatus(scrText.Status() + report);
+    output_to_display(scrText);
+  }
+}
+
+// Speaks each utterance handed over by the text stage, so the GUI never waits on festival.
+// Falls back to running festival once per utterance if the server cannot be reached.
+void ExampleWorker::speech_stage()
+{
+  SpeechRequest* speech;
+
+  tracer.Name("speech");
+  while (!m_shall_stop)
+  {
+    speech = m_speech.Front();
+    if (speech == NULL)
+    {
+      m_speech.WaitForData(RING_WAIT_MS);
+      continue;
+    }
+    uint64_t start = pipeline_now_ns();
+    if (!speechService.Speak(speech->text))
+      text_to_speech(speech->text, ttsScript, tfName);
+    uint64_t now = pipeline_now_ns();
+    m_stats.Stage(STAGE_SPEECH).Record(speech->queued, now);
+    m_stats.Spoken().Record(speech->origin, now);
+    tracer.Span("speech", speech->seq, start, now);
+    m_speech.Pop();
+  }
+}
@@ -0,0 +1,255 @@
+/* Flex sensor calibration declared in flex_calib.h: loading and saving profiles, compiling
+   them into lookup tables, and the guided calibration. */
+
+/* Includes */
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include "flex_calib.h"
+/* Define constants. */
+#define FLEX_MAX_ADC (FLEX_LUT_SIZE - 1)        /* The maximum 10-bit ADC value. */
+#define FLEX_LINE_LEN 256                       /* Longest line of a profile. */
+#define FLEX_NSEC_PER_SEC 1000000000ULL         /* Nanoseconds per second. */
+
+static const char* const flex_name[FLEX_FINGERS] = {"ind", "mid", "ri", "pi", "th"} ; /* Finger names used in a profile. */
+
+double flex_adjust( unsigned int x, unsigned int lb, unsigned int ub ){
+  /* Function to adjust flex sensor values from a 0-1024 scale to a 0-100 quantized scale. Only used
+     to build the lookup tables; the acquisition loop reads them with flex_lut_value(). */
+
+  const unsigned int MIN_VAL = 0 ;       /* Minimum adjusted value. */
+  const unsigned int MAX_VAL = FLEX_MAX_VAL ;  /* Maximum adjusted value. */
+  const unsigned int NUM_STEPS = FLEX_STEPS ;  /* Resolution. */
+  unsigned int i ;                       /* An iterator. */
+  double dx = ((double)ub - (double)lb) / (double)(NUM_STEPS - 2) ; /* X increment. */
+  double dy = (double)MAX_VAL / (double)NUM_STEPS ;                 /* Y increment. */
+  double y = (double)MIN_VAL ;                                      /* Adjusted flex sensor value. */
+
+  if( x == 0 ){
+    y = (double)MIN_VAL ;
+  }
+  else if( x == FLEX_MAX_ADC ){
+    y = (double)MAX_VAL - dy ;
+  }
+  else if( x < lb ){
+    y = (double)MIN_VAL ;
+  }
+  else if( x >= ub ){
+    y = (double)MAX_VAL - dy ;
+  }
+  else{
+    /* MIN_VAL and MAX_VAL account for two out of the total number of steps.
+       Therefore start at 1 and go to NUM_STEPS - 1. */
+    for( i = 1 ; i < (NUM_STEPS - 1) ; i++ ){
+      if( (double)x < ((double)lb + ((double)i * dx)) ){
+        y = ((double)i * dy) ;
+        break ;
+      }
+    }
+  }
+  return y ;
+
+}
+
+void flex_profile_uncalibrated( struct flex_profile* profile ){
+  /* Function to set every finger to the full ADC range, as the thumb is when it has no flex sensor. */
+
+  unsigned int i ;  /* An iterator. */
+
+  for( i = 0 ; i < FLEX_FINGERS ; i++ ){
+    profile->lb[i] = 0 ;
+    profile->ub[i] = FLEX_MAX_ADC ;
+  }
+
+  return ;
+
+}
+
+int flex_profile_load( struct flex_profile* profile, const char* f_name ){
+  /* Function to read a profile. Every finger must be given once, with its lower bound below its upper
+     bound. Returns -1 and sets errno on error, EINVAL if the file is not a valid profile, in which case
+     the profile is left unchanged. */
+
+  FILE* fp ;                          /* The profile file. */
+  char line[FLEX_LINE_LEN] ;          /* The next line. */
+  char name[FLEX_LINE_LEN] ;          /* The finger named on the line. */
+  unsigned int lb ;                   /* The lower bound on the line. */
+  unsigned int ub ;                   /* The upper bound on the line. */
+  struct flex_profile read ;          /* The profile read so far. */
+  unsigned int seen = 0 ;             /* Bit set for each finger read. */
+  unsigned int i ;                    /* An iterator. */
+  int result = 0 ;                    /* -1 once the file is found to be invalid. */
+
+  fp = fopen( f_name, "r" ) ;
+  if( fp == NULL )
+    return -1 ;
+  while( (result == 0) && (fgets(line, sizeof(line), fp) != NULL) ){
+    if( (sscanf(line, " %s", name) != 1) || (name[0] == '#') )
+      /* Blank line or comment. */
+      continue ;
+    if( sscanf(line, " %s %u %u", name, &lb, &ub) != 3 ){
+      result = -1 ;
+      break ;
+    }
+    for( i = 0 ; (i < FLEX_FINGERS) && (strcmp(name, flex_name[i]) != 0) ; i++ ) ;
+    if( (i == FLEX_FINGERS) || (seen & (1u << i)) || (lb >= ub) || (ub > FLEX_MAX_ADC) ){
+      result = -1 ;
+      break ;
+    }
+    read.lb[i] = lb ;
+    read.ub[i] = ub ;
+    seen |= 1u << i ;
+  }
+  fclose( fp ) ;
+  if( (result == -1) || (seen != ((1u << FLEX_FINGERS) - 1)) ){
+    errno = EINVAL ;
+    return -1 ;
+  }
+  *profile = read ;
+
+  return 0 ;
+
+}
+
+int flex_profile_save( const struct flex_profile* profile, const char* f_name ){
+  /* Function to write a profile. It is written to a temporary file first and renamed over the old one,
+     so a reload never reads a partial profile. Returns -1 and sets errno on error. */
+
+  char tmp_f_name[FILENAME_MAX] ;     /* The temporary file. */
+  FILE* fp ;                          /* The temporary file. */
+  unsigned int i ;                    /* An iterator. */
+  int result = 0 ;                    /* -1 if a write failed. */
+  int saved_errno ;                   /* errno of the failed write. */
+
+  if( snprintf(tmp_f_name, sizeof(tmp_f_name), "%s.tmp", f_name) >= (int)sizeof(tmp_f_name) ){
+    errno = ENAMETOOLONG ;
+    return -1 ;
+  }
+  fp = fopen( tmp_f_name, "w" ) ;
+  if( fp == NULL )
+    return -1 ;
+  if( fprintf(fp, "# Flex calibration: finger, lower bound, upper bound, in ADC counts.\n") < 0 )
+    result = -1 ;
+  for( i = 0 ; (result == 0) && (i < FLEX_FINGERS) ; i++ ){
+    if( fprintf(fp, "%s %u %u\n", flex_name[i], profile->lb[i], profile->ub[i]) < 0 )
+      result = -1 ;
+  }
+  if( fclose(fp) != 0 )
+    result = -1 ;
+  if( (result == -1) || (rename(tmp_f_name, f_name) == -1) ){
+    saved_errno = errno ;
+    remove( tmp_f_name ) ;
+    errno = saved_errno ;
+    return -1 ;
+  }
+
+  return 0 ;
+
+}
+
+void flex_lut_build( struct flex_lut* lut, const struct flex_profile* profile ){
+  /* Function to compile a profile into the adjusted value of every ADC count of every finger. */
+
+  unsigned int i ;  /* An iterator. */
+  unsigned int x ;  /* An iterator over the ADC counts. */
+
+  for( i = 0 ; i < FLEX_FINGERS ; i++ ){
+    for( x = 0 ; x < FLEX_LUT_SIZE ; x++ ){
+      lut->bin[i][x] = (uint8_t)flex_adjust( x, profile->lb[i], profile->ub[i] ) ;
+    }
+  }
+
+  return ;
+
+}
+
+void flex_cal_start( struct flex_calibration* cal ){
+  /* Function to start a guided calibration. The first step starts with the next sample. */
+
+  memset( cal, 0, sizeof(struct flex_calibration) ) ;
+  cal->phase = FLEX_CAL_OPEN_SETTLE ;
+
+  return ;
+
+}
+
+enum flex_cal_phase flex_cal_add( struct flex_calibration* cal, const unsigned int flex[FLEX_FINGERS], uint64_t now_ns ){
+  /* Function to add the raw flex counts of a hand to a guided calibration, moving on to the next step once
+     the current one has run its time and telling the user what to do. May be called for each hand read
+     in a frame. Returns the current step. */
+
+  static const char* const prompt[FLEX_CAL_DONE] = {
+    "Calibrating: hold your hands open, fingers straight",
+    "Calibrating: keep your hands open",
+    "Calibrating: close your hands into fists",
+    "Calibrating: keep your hands closed"
+  } ;
+  uint64_t length ;   /* Time the current step runs for. */
+  unsigned int i ;    /* An iterator. */
+  unsigned int k ;    /* The pose being captured. */
+
+  if( cal->phase == FLEX_CAL_DONE )
+    return cal->phase ;
+  if( cal->phase_ns == 0 ){
+    cal->phase_ns = now_ns ;
+    fprintf( stdout, "%s\n", prompt[cal->phase] ) ;
+    fflush( stdout ) ;
+  }
+  length = (((cal->phase == FLEX_CAL_OPEN) || (cal->phase == FLEX_CAL_BENT)) ? FLEX_CAL_CAPTURE_S : FLEX_CAL_SETTLE_S) *
+           FLEX_NSEC_PER_SEC ;
+  if( (now_ns - cal->phase_ns) >= length ){
+    cal->phase++ ;
+    cal->phase_ns = now_ns ;
+    if( cal->phase != FLEX_CAL_DONE ){
+      fprintf( stdout, "%s\n", prompt[cal->phase] ) ;
+      fflush( stdout ) ;
+    }
+  }
+  if( (cal->phase == FLEX_CAL_OPEN) || (cal->phase == FLEX_CAL_BENT) ){
+    k = (cal->phase == FLEX_CAL_OPEN) ? 0 : 1 ;
+    for( i = 0 ; i < FLEX_FINGERS ; i++ ){
+      cal->hist[k][i][(flex[i] < FLEX_LUT_SIZE) ? flex[i] : FLEX_MAX_ADC]++ ;
+    }
+    cal->samples[k]++ ;
+  }
+
+  return cal->phase ;
+
+}
+
+unsigned int flex_cal_derive( const struct flex_calibration* cal, struct flex_profile* profile ){
+  /* Function to set the bounds of each finger from a finished guided calibration: the lower bound just above
+     all but FLEX_CAL_TAIL of the counts captured open, and the upper bound at the count below which only
+     FLEX_CAL_TAIL of those captured bent fall. Fingers whose bounds would be closer than FLEX_CAL_MIN_SPAN
+     keep the bounds they had. Returns the number of fingers calibrated. */
+
+  unsigned long keep[2] ;     /* Samples of each pose inside its bound. */
+  unsigned long count ;       /* Samples counted so far. */
+  unsigned int lb ;           /* The derived lower bound. */
+  unsigned int ub ;           /* The derived upper bound. */
+  unsigned int calibrated = 0 ; /* Number of fingers calibrated. */
+  unsigned int i ;            /* An iterator. */
+
+  if( (cal->phase != FLEX_CAL_DONE) || (cal->samples[0] == 0) || (cal->samples[1] == 0) )
+    return 0 ;
+  keep[0] = (unsigned long)((1.0 - FLEX_CAL_TAIL) * (double)cal->samples[0]) ;
+  keep[1] = (unsigned long)(FLEX_CAL_TAIL * (double)cal->samples[1]) ;
+  for( i = 0 ; i < FLEX_FINGERS ; i++ ){
+    for( lb = 0, count = cal->hist[0][i][0] ; (count < keep[0]) && (lb < FLEX_MAX_ADC) ; count += cal->hist[0][i][++lb] ) ;
+    for( ub = 0, count = cal->hist[1][i][0] ; (count <= keep[1]) && (ub < FLEX_MAX_ADC) ; count += cal->hist[1][i][++ub] ) ;
+    /* The open hand should read below the lower bound. */
+    lb++ ;
+    if( (ub <= lb) || ((ub - lb) < FLEX_CAL_MIN_SPAN) ){
+      fprintf( stdout, "%s flex left at %u - %u, it moved too little to calibrate\n", flex_name[i],
+               profile->lb[i], profile->ub[i] ) ;
+      continue ;
+    }
+    profile->lb[i] = lb ;
+    profile->ub[i] = ub ;
+    fprintf( stdout, "%s flex calibrated to %u - %u\n", flex_name[i], lb, ub ) ;
+    calibrated++ ;
+  }
+
+  return calibrated ;
+
+}
@@ -0,0 +1,76 @@
+/* Flex sensor calibration used by i2c_transfer. A profile holds, for each finger, the ADC
+   counts at which its flex sensor reads open (lb) and fully bent (ub). Profiles are kept one
+   per user as small text files, one finger per line, in the order the calibration used to
+   be given on the command line:
+
+     # Flex calibration
+     ind 550 675
+     mid 525 650
+     ri 525 650
+     pi 525 700
+     th 0 1023
+
+   A profile is compiled into a table of FLEX_LUT_SIZE entries per finger holding the
+   adjusted value (0-95, in steps of FLEX_STEP) of every ADC count, so quantizing a sample
+   is a single load instead of a search through the steps.
+
+   A guided calibration derives a profile from a few seconds of each hand held open and then
+   closed into a fist: each finger's lower bound is set just above the counts seen open and
+   its upper bound just below the counts seen bent, from histograms of the raw counts. Fingers
+   that hardly move, such as the thumb, which has no flex sensor, keep their bounds. */
+#ifndef FLEX_CALIB_H
+#define FLEX_CALIB_H
+
+/* Includes */
+#include <stdint.h>
+/* Define constants. */
+#define FLEX_FINGERS 5                          /* Fingers per hand, in the order ind, mid, ri, pi, th. */
+#define FLEX_LUT_SIZE 1024                      /* Entries per finger, one per 10-bit ADC count. */
+#define FLEX_MAX_VAL 100                        /* Adjusted value above the last step. */
+#define FLEX_STEPS 20                           /* Resolution of the adjusted value. */
+#define FLEX_STEP (FLEX_MAX_VAL / FLEX_STEPS)   /* Adjusted value of one step. */
+#define FLEX_CAL_SETTLE_S 2                     /* Seconds given to take up each pose before it is captured. */
+#define FLEX_CAL_CAPTURE_S 3                    /* Seconds each pose is captured for. */
+#define FLEX_CAL_TAIL 0.05                      /* Fraction of samples of each pose left outside its bound, as noise. */
+#define FLEX_CAL_MIN_SPAN 20                    /* Fewest ADC counts between the open and bent bounds of a calibrated finger. */
+
+/* Custom type definitions. */
+enum flex_cal_phase{   /* The steps of a guided calibration. */
+  FLEX_CAL_OPEN_SETTLE,                                /* Waiting for the hand to be held open. */
+  FLEX_CAL_OPEN,                                       /* Capturing the open hand. */
+  FLEX_CAL_BENT_SETTLE,                                /* Waiting for the hand to close into a fist. */
+  FLEX_CAL_BENT,                                       /* Capturing the fist. */
+  FLEX_CAL_DONE                                        /* The profile has been derived. */
+} ;
+struct flex_profile{   /* The calibration of a user's gloves. */
+  unsigned int lb[FLEX_FINGERS] ;                      /* ADC counts below which a finger reads open. */
+  unsigned int ub[FLEX_FINGERS] ;                      /* ADC counts from which a finger reads fully bent. */
+} ;
+struct flex_lut{       /* A profile compiled into the adjusted value of every ADC count. */
+  uint8_t bin[FLEX_FINGERS][FLEX_LUT_SIZE] ;
+} ;
+struct flex_calibration{ /* A guided calibration in progress. */
+  enum flex_cal_phase phase ;                          /* The current step. */
+  uint64_t phase_ns ;                                  /* Time the current step started, 0 before the first sample. */
+  unsigned long samples[2] ;                           /* Samples captured open and bent. */
+  uint32_t hist[2][FLEX_FINGERS][FLEX_LUT_SIZE] ;      /* Counts of each ADC value captured open and bent. */
+} ;
+
+/* Function declarations. */
+double flex_adjust( unsigned int x, unsigned int lb, unsigned int ub ) ;
+void flex_profile_uncalibrated( struct flex_profile* profile ) ;
+int flex_profile_load( struct flex_profile* profile, const char* f_name ) ;
+int flex_profile_save( const struct flex_profile* profile, const char* f_name ) ;
+void flex_lut_build( struct flex_lut* lut, const struct flex_profile* profile ) ;
+void flex_cal_start( struct flex_calibration* cal ) ;
+enum flex_cal_phase flex_cal_add( struct flex_calibration* cal, const unsigned int flex[FLEX_FINGERS], uint64_t now_ns ) ;
+unsigned int flex_cal_derive( const struct flex_calibration* cal, struct flex_profile* profile ) ;
+
+static inline unsigned int flex_lut_value( const struct flex_lut* lut, unsigned int finger, unsigned int x ){
+  /* Function to quantize the ADC counts of a finger. Counts past the 10-bit range read as the largest. */
+
+  return lut->bin[finger][(x < FLEX_LUT_SIZE) ? x : (FLEX_LUT_SIZE - 1)] ;
+
+}
+
+#endif
@@ -0,0 +1,626 @@
+/* Backends for the I2C transport declared in i2c_bus.h: the Linux I2C device, and a
+   simulated glove that serves the ATmega register layout. */
+
+/* Includes */
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c-dev.h>
+#include "i2c_bus.h"
+#include "sensor_frame.h"
+/* Define constants. */
+#define SIM_MAX_ADC 1023                        /* The maximum 10-bit ADC value. */
+#define SIM_FLEX_STEPS 20                       /* Steps used by flex_adjust() in flex_calib.c. */
+#define SIM_FLEX_STEP 5                         /* Adjusted flex value of one step. */
+#define SIM_CONTACT_LEVEL 0.7                   /* Flex level above which a scripted fingertip makes contact. */
+#define SIM_BITS_PER_BYTE 9                     /* Eight data bits and an acknowledge. */
+#define SIM_NSEC_PER_SEC 1000000000ULL          /* Nanoseconds per second. */
+#define SIM_SPEC_LEN 1023                       /* Longest configuration string. */
+
+/* Custom type definitions. */
+struct i2c_sim{        /* A simulated glove. */
+  unsigned char regs[I2C_SIM_REG_LEN] ;                /* The latched register image. */
+  unsigned int ptr ;                                   /* The microcontroller internal pointer. */
+  unsigned int addr ;                                  /* The address the glove answers to. */
+  int open ;                                           /* Non-zero while the bus is open. */
+  struct sensor_frame* frames ;                        /* The recorded waveform, or NULL for the scripted one. */
+  size_t num_frames ;                                  /* Number of recorded frames. */
+  double rate ;                                        /* Samples per second of the waveform. */
+  double wave ;                                        /* Cycles per second of the scripted waveform. */
+  uint64_t clock_hz ;                                  /* Simulated bus clock, 0 for instant transactions. */
+  double err ;                                         /* Probability that a transaction fails. */
+  double corrupt ;                                     /* Probability that a bit of the data read is flipped. */
+  uint32_t rng ;                                       /* State of the random number generator. */
+  unsigned int lb[I2C_SIM_FLEX] ;                      /* Flex calibration, used to turn recorded values back into ADC counts. */
+  unsigned int ub[I2C_SIM_FLEX] ;
+  uint64_t start_ns ;                                  /* Time the waveform started. */
+  unsigned long transactions ;                         /* Number of transactions served. */
+  unsigned long latches ;                              /* Number of times new values were latched. */
+  unsigned long errors ;                               /* Number of transactions failed on purpose. */
+  unsigned long corrupted ;                            /* Number of transactions with a flipped bit. */
+} ;
+
+/* Function declarations. */
+static int dev_open( struct i2c_bus* bus, const char* f_name, int oflags, mode_t mode ) ;
+static int dev_set_addr( struct i2c_bus* bus, unsigned int addr ) ;
+static ssize_t dev_read( struct i2c_bus* bus, void* buffer, size_t num_bytes ) ;
+static ssize_t dev_write( struct i2c_bus* bus, const void* buffer, size_t num_bytes ) ;
+static int dev_transfer( struct i2c_bus* bus, struct i2c_msg* msgs, unsigned int nmsgs ) ;
+static int dev_close( struct i2c_bus* bus ) ;
+static int sim_open( struct i2c_bus* bus, const char* f_name, int oflags, mode_t mode ) ;
+static int sim_set_addr( struct i2c_bus* bus, unsigned int addr ) ;
+static ssize_t sim_read( struct i2c_bus* bus, void* buffer, size_t num_bytes ) ;
+static ssize_t sim_write( struct i2c_bus* bus, const void* buffer, size_t num_bytes ) ;
+static int sim_transfer( struct i2c_bus* bus, struct i2c_msg* msgs, unsigned int nmsgs ) ;
+static int sim_close( struct i2c_bus* bus ) ;
+static int sim_configure( struct i2c_sim* sim, const char* spec ) ;
+static int sim_load( struct i2c_sim* sim, const char* f_name ) ;
+static void sim_latch( struct i2c_sim* sim ) ;
+static void sim_scripted( struct i2c_sim* sim, double t, unsigned int flex[I2C_SIM_FLEX], uint16_t* contact,
+                          int16_t lsm303[I2C_SIM_NUM_303][I2C_SIM_303_VALS], int16_t lsm9dof[I2C_SIM_NUM_9DOF][I2C_SIM_9DOF_VALS] ) ;
+static unsigned int sim_flex_adc( unsigned int value, unsigned int lb, unsigned int ub ) ;
+static int sim_fail( struct i2c_sim* sim, unsigned int nmsgs ) ;
+static void sim_corrupt( struct i2c_sim* sim, unsigned char* buffer, size_t num_bytes ) ;
+static void sim_wait( struct i2c_sim* sim, uint64_t start_ns, const struct i2c_msg* msgs, unsigned int nmsgs ) ;
+static double sim_random( struct i2c_sim* sim ) ;
+static uint64_t sim_now_ns( void ) ;
+
+static const struct i2c_bus_ops dev_ops = { dev_open, dev_set_addr, dev_read, dev_write, dev_transfer, dev_close } ;
+static const struct i2c_bus_ops sim_ops = { sim_open, sim_set_addr, sim_read, sim_write, sim_transfer, sim_close } ;
+
+void i2c_bus_device( struct i2c_bus* bus ){
+  /* Function to set up a bus that talks to the Linux I2C device. */
+
+  bus->ops = &dev_ops ;
+  bus->fd = -1 ;
+  bus->addr = 0 ;
+  bus->sim = NULL ;
+
+  return ;
+
+}
+
+int i2c_bus_simulate( struct i2c_bus* bus, const char* spec, unsigned int addr,
+                      const unsigned int lb[I2C_SIM_FLEX], const unsigned int ub[I2C_SIM_FLEX] ){
+  /* Function to set up a bus that talks to a simulated glove answering at addr, configured by spec
+     (see i2c_bus.h). The flex calibration is used to turn recorded flex values back into ADC counts.
+     Returns -1 on error. */
+
+  struct i2c_sim* sim ;   /* The simulated glove. */
+  unsigned int i ;        /* An iterator. */
+
+  sim = (struct i2c_sim*)calloc( 1, sizeof(struct i2c_sim) ) ;
+  if( sim == NULL )
+    return -1 ;
+  sim->addr = addr ;
+  sim->rate = 100.0 ;
+  sim->wave = 0.5 ;
+  sim->rng = 1 ;
+  for( i = 0 ; i < I2C_SIM_FLEX ; i++ ){
+    sim->lb[i] = lb[i] ;
+    sim->ub[i] = ub[i] ;
+  }
+  if( sim_configure(sim, spec) == -1 ){
+    free( sim->frames ) ;
+    free( sim ) ;
+    return -1 ;
+  }
+  sim->start_ns = sim_now_ns() ;
+  sim_latch( sim ) ;
+  bus->ops = &sim_ops ;
+  bus->fd = -1 ;
+  bus->addr = 0 ;
+  bus->sim = sim ;
+
+  return 0 ;
+
+}
+
+void i2c_bus_free( struct i2c_bus* bus ){
+  /* Function to release a simulated glove. The bus must be set up again before it is used. */
+
+  if( bus->sim != NULL ){
+    free( bus->sim->frames ) ;
+    free( bus->sim ) ;
+    bus->sim = NULL ;
+  }
+
+  return ;
+
+}
+
+void i2c_sim_reset( struct i2c_sim* sim ){
+  /* Function to reset the simulated glove, as pulsing the reset line resets the ATmega. */
+
+  sim->ptr = 0 ;
+  sim_latch( sim ) ;
+
+  return ;
+
+}
+
+void i2c_sim_report( const struct i2c_sim* sim ){
+  /* Function to print what the simulated glove has served. */
+
+  fprintf( stdout, "Simulated glove: %lu transactions, %lu samples latched, %lu errors and %lu corrupted reads injected\n",
+           sim->transactions, sim->latches, sim->errors, sim->corrupted ) ;
+
+  return ;
+
+}
+
+static int dev_open( struct i2c_bus* bus, const char* f_name, int oflags, mode_t mode ){
+  /* Function to open the I2C device. */
+
+  bus->fd = open( f_name, oflags, mode ) ;
+
+  return (bus->fd == -1) ? -1 : 0 ;
+
+}
+
+static int dev_set_addr( struct i2c_bus* bus, unsigned int addr ){
+  /* Function to address a device on the I2C bus. */
+
+  bus->addr = addr ;
+
+  return (ioctl(bus->fd, I2C_SLAVE, addr) < 0) ? -1 : 0 ;
+
+}
+
+static ssize_t dev_read( struct i2c_bus* bus, void* buffer, size_t num_bytes ){
+  /* Function to read from the addressed device. */
+
+  return read( bus->fd, buffer, num_bytes ) ;
+
+}
+
+static ssize_t dev_write( struct i2c_bus* bus, const void* buffer, size_t num_bytes ){
+  /* Function to write to the addressed device. */
+
+  return write( bus->fd, buffer, num_bytes ) ;
+
+}
+
+static int dev_transfer( struct i2c_bus* bus, struct i2c_msg* msgs, unsigned int nmsgs ){
+  /* Function to perform a combined transaction on the I2C device. */
+
+  struct i2c_rdwr_ioctl_data transaction ;   /* The combined transaction. */
+
+  transaction.msgs = msgs ;
+  transaction.nmsgs = nmsgs ;
+
+  return (ioctl(bus->fd, I2C_RDWR, &transaction) < 0) ? -1 : 0 ;
+
+}
+
+static int dev_close( struct i2c_bus* bus ){
+  /* Function to close the I2C device. */
+
+  int result = close( bus->fd ) ;   /* Result of closing the device. */
+
+  bus->fd = -1 ;
+
+  return result ;
+
+}
+
+static int sim_open( struct i2c_bus* bus, const char* f_name, int oflags, mode_t mode ){
+  /* Function to open the simulated bus. The device name and flags are ignored. */
+
+  bus->sim->open = 1 ;
+
+  return 0 ;
+
+}
+
+static int sim_set_addr( struct i2c_bus* bus, unsigned int addr ){
+  /* Function to address a device on the simulated bus. As with the I2C device, a wrong address is only
+     noticed when nothing acknowledges a read or write. */
+
+  if( !bus->sim->open ){
+    errno = EBADF ;
+    return -1 ;
+  }
+  bus->addr = addr ;
+
+  return 0 ;
+
+}
+
+static ssize_t sim_read( struct i2c_bus* bus, void* buffer, size_t num_bytes ){
+  /* Function to read from the simulated glove. */
+
+  struct i2c_msg msg ;   /* The read, as a single message transaction. */
+
+  msg.addr = bus->addr ;
+  msg.flags = I2C_M_RD ;
+  msg.len = num_bytes ;
+  msg.buf = (unsigned char*)buffer ;
+
+  return (sim_transfer(bus, &msg, 1) == -1) ? -1 : (ssize_t)num_bytes ;
+
+}
+
+static ssize_t sim_write( struct i2c_bus* bus, const void* buffer, size_t num_bytes ){
+  /* Function to write to the simulated glove. */
+
+  struct i2c_msg msg ;   /* The write, as a single message transaction. */
+
+  msg.addr = bus->addr ;
+  msg.flags = 0 ;
+  msg.len = num_bytes ;
+  msg.buf = (unsigned char*)buffer ;
+
+  return (sim_transfer(bus, &msg, 1) == -1) ? -1 : (ssize_t)num_bytes ;
+
+}
+
+static int sim_transfer( struct i2c_bus* bus, struct i2c_msg* msgs, unsigned int nmsgs ){
+  /* Function to perform a combined transaction with the simulated glove. Each read returns the next bytes
+     of the register image, and bytes past its end read as an idle bus. Writing 0 resets the pointer and
+     latches new values. An injected error stops the transaction part way, leaving the pointer wherever
+     the messages before it left it, as a NAK from the ATmega would. */
+
+  struct i2c_sim* sim = bus->sim ;   /* The simulated glove. */
+  uint64_t start_ns = sim_now_ns() ; /* Start of the transaction. */
+  int fail ;                         /* The message that fails, or -1. */
+  unsigned int i ;                   /* An iterator. */
+  unsigned int j ;                   /* An iterator. */
+
+  if( !sim->open ){
+    errno = EBADF ;
+    return -1 ;
+  }
+  sim->transactions++ ;
+  fail = sim_fail( sim, nmsgs ) ;
+  for( i = 0 ; i < nmsgs ; i++ ){
+    if( (msgs[i].addr != sim->addr) || ((int)i == fail) ){
+      /* Nothing acknowledged the address. */
+      sim_wait( sim, start_ns, msgs, i + 1 ) ;
+      errno = EREMOTEIO ;
+      return -1 ;
+    }
+    if( msgs[i].flags & I2C_M_RD ){
+      for( j = 0 ; j < msgs[i].len ; j++ ){
+        msgs[i].buf[j] = (sim->ptr < I2C_SIM_REG_LEN) ? sim->regs[sim->ptr++] : 0xFF ;
+      }
+      sim_corrupt( sim, msgs[i].buf, msgs[i].len ) ;
+    }
+    else if( (msgs[i].len > 0) && (msgs[i].buf[0] == 0) ){
+      sim->ptr = 0 ;
+      sim_latch( sim ) ;
+    }
+  }
+  sim_wait( sim, start_ns, msgs, nmsgs ) ;
+
+  return 0 ;
+
+}
+
+static int sim_close( struct i2c_bus* bus ){
+  /* Function to close the simulated bus. */
+
+  if( !bus->sim->open ){
+    errno = EBADF ;
+    return -1 ;
+  }
+  bus->sim->open = 0 ;
+
+  return 0 ;
+
+}
+
+static int sim_configure( struct i2c_sim* sim, const char* spec ){
+  /* Function to apply the key=value settings of spec. Returns -1 if a setting is not recognized or the
+     capture can not be read. */
+
+  char copy[SIM_SPEC_LEN + 1] ;   /* A copy of spec, split up by strtok_r(). */
+  char* save ;                    /* Position within copy. */
+  char* key ;                     /* The next setting. */
+  char* value ;                   /* Its value. */
+
+  if( (spec == NULL) || (spec[0] == '\0') )
+    return 0 ;
+  strncpy( copy, spec, SIM_SPEC_LEN ) ;
+  copy[SIM_SPEC_LEN] = '\0' ;
+  for( key = strtok_r(copy, ",", &save) ; key != NULL ; key = strtok_r(NULL, ",", &save) ){
+    value = strchr( key, '=' ) ;
+    if( value == NULL ){
+      fprintf( stderr, "*** Simulated glove setting has no value: %s ***\n", key ) ;
+      errno = EINVAL ;
+      return -1 ;
+    }
+    *value++ = '\0' ;
+    if( strcmp(key, "file") == 0 ){
+      if( sim_load(sim, value) == -1 ){
+        perror( "*** Unable to read simulated glove capture " ) ;
+        return -1 ;
+      }
+    }
+    else if( strcmp(key, "rate") == 0 )
+      sim->rate = atof( value ) ;
+    else if( strcmp(key, "wave") == 0 )
+      sim->wave = atof( value ) ;
+    else if( strcmp(key, "clock") == 0 )
+      sim->clock_hz = strtoull( value, NULL, 10 ) ;
+    else if( strcmp(key, "err") == 0 )
+      sim->err = atof( value ) ;
+    else if( strcmp(key, "corrupt") == 0 )
+      sim->corrupt = atof( value ) ;
+    else if( strcmp(key, "seed") == 0 )
+      sim->rng = (uint32_t)strtoul( value, NULL, 10 ) ;
+    else{
+      fprintf( stderr, "*** Unknown simulated glove setting: %s ***\n", key ) ;
+      errno = EINVAL ;
+      return -1 ;
+    }
+  }
+  if( sim->rate <= 0.0 )
+    sim->rate = 100.0 ;
+  if( sim->rng == 0 )
+    /* Zero is a fixed point of the generator. */
+    sim->rng = 1 ;
+
+  return 0 ;
+
+}
+
+static int sim_load( struct i2c_sim* sim, const char* f_name ){
+  /* Function to read every valid frame of a capture file. Returns -1 if it holds none. */
+
+  FILE* fp ;                   /* File handle. */
+  unsigned char* bytes ;       /* Contents of the file. */
+  long len ;                   /* Length of the file. */
+  long pos = 0 ;               /* Position of the next frame. */
+  size_t count = 0 ;           /* Number of frames found. */
+
+  fp = fopen( f_name, "rb" ) ;
+  if( fp == NULL )
+    return -1 ;
+  fseek( fp, 0, SEEK_END ) ;
+  len = ftell( fp ) ;
+  fseek( fp, 0, SEEK_SET ) ;
+  bytes = (unsigned char*)malloc( (len > 0) ? len : 1 ) ;
+  if( (bytes == NULL) || (len <= 0) || (fread(bytes, 1, len, fp) != (size_t)len) ){
+    free( bytes ) ;
+    fclose( fp ) ;
+    errno = EINVAL ;
+    return -1 ;
+  }
+  fclose( fp ) ;
+  free( sim->frames ) ;
+  sim->frames = (struct sensor_frame*)malloc( ((size_t)len / FRAME_SIZE + 1) * sizeof(struct sensor_frame) ) ;
+  if( sim->frames == NULL ){
+    free( bytes ) ;
+    return -1 ;
+  }
+  /* Skip anything that is not a valid frame, as sign2speech does. */
+  while( (pos + FRAME_SIZE) <= len ){
+    memcpy( &sim->frames[count], bytes + pos, FRAME_SIZE ) ;
+    if( frame_valid(&sim->frames[count]) ){
+      count++ ;
+      pos += FRAME_SIZE ;
+    }
+    else
+      pos++ ;
+  }
+  free( bytes ) ;
+  sim->num_frames = count ;
+  if( count == 0 ){
+    free( sim->frames ) ;
+    sim->frames = NULL ;
+    errno = EINVAL ;
+    return -1 ;
+  }
+  fprintf( stdout, "Simulated glove replaying %lu frames from:\t%s\n", (unsigned long)count, f_name ) ;
+
+  return 0 ;
+
+}
+
+static void sim_latch( struct i2c_sim* sim ){
+  /* Function to store the waveform sample due at the current time in the register image, encoded as the
+     ATmega sends it: big endian words, and contact bits that are clear on contact. */
+
+  double t = (double)(sim_now_ns() - sim->start_ns) / (double)SIM_NSEC_PER_SEC ;  /* Waveform time, in seconds. */
+  unsigned int flex[I2C_SIM_FLEX] ;                          /* Flex sensors, in ADC counts, index to pinky. */
+  uint16_t contact = 0 ;                                     /* Contact sensors, in the frame bit order. */
+  int16_t lsm303[I2C_SIM_NUM_303][I2C_SIM_303_VALS] ;        /* LSM303 values. */
+  int16_t lsm9dof[I2C_SIM_NUM_9DOF][I2C_SIM_9DOF_VALS] ;     /* LSM9DOF values. */
+  uint16_t bits = 0xFFFF ;                                   /* Contact sensors, as served. */
+  unsigned char* r = sim->regs ;                             /* Next register. */
+  const struct frame_hand* hand ;                            /* The recorded hand. */
+  unsigned int i ;                                           /* An iterator. */
+  unsigned int j ;                                           /* An iterator. */
+  unsigned int f ;                                           /* Frame bit of a served contact bit. */
+
+  if( sim->frames != NULL ){
+    hand = &sim->frames[(size_t)(t * sim->rate) % sim->num_frames].hands[FRAME_RIGHT] ;
+    /* The frame orders the fingers from the thumb. */
+    for( i = 0 ; i < I2C_SIM_FLEX ; i++ ){
+      flex[i] = sim_flex_adc( hand->flex[i + 1], sim->lb[i], sim->ub[i] ) ;
+    }
+    contact = hand->contact ;
+    memcpy( lsm303, hand->lsm303, sizeof(lsm303) ) ;
+    memcpy( lsm9dof, hand->lsm9dof, sizeof(lsm9dof) ) ;
+  }
+  else
+    sim_scripted( sim, t, flex, &contact, lsm303, lsm9dof ) ;
+  for( i = 0 ; i < I2C_SIM_FLEX ; i++ ){
+    *r++ = (unsigned char)(flex[i] >> 8) ;
+    *r++ = (unsigned char)(flex[i] & 0xFF) ;
+  }
+  /* The ATmega sends the finger contacts from the index finger, then the thumb tip, then the folds. */
+  for( i = 0 ; i < I2C_SIM_CONTACTS ; i++ ){
+    f = (i < 8) ? i + 1 : (i == 8) ? FRAME_TH_CON_T : i ;
+    if( contact & (1 << f) )
+      bits &= (uint16_t)~(1 << i) ;
+  }
+  *r++ = (unsigned char)(bits & 0xFF) ;
+  *r++ = (unsigned char)(bits >> 8) ;
+  for( i = 0 ; i < I2C_SIM_NUM_303 ; i++ ){
+    for( j = 0 ; j < I2C_SIM_303_VALS ; j++ ){
+      *r++ = (unsigned char)((uint16_t)lsm303[i][j] >> 8) ;
+      *r++ = (unsigned char)((uint16_t)lsm303[i][j] & 0xFF) ;
+    }
+  }
+  for( i = 0 ; i < I2C_SIM_NUM_9DOF ; i++ ){
+    for( j = 0 ; j < I2C_SIM_9DOF_VALS ; j++ ){
+      *r++ = (unsigned char)((uint16_t)lsm9dof[i][j] >> 8) ;
+      *r++ = (unsigned char)((uint16_t)lsm9dof[i][j] & 0xFF) ;
+    }
+  }
+  sim->latches++ ;
+
+  return ;
+
+}
+
+static void sim_scripted( struct i2c_sim* sim, double t, unsigned int flex[I2C_SIM_FLEX], uint16_t* contact,
+                          int16_t lsm303[I2C_SIM_NUM_303][I2C_SIM_303_VALS], int16_t lsm9dof[I2C_SIM_NUM_9DOF][I2C_SIM_9DOF_VALS] ){
+  /* Function to compute the scripted waveform at time t: each finger curls and straightens in turn, touching
+     its tip once it is mostly curled, while the hand tilts back and forth. The waveform is sampled at the
+     configured rate, so it holds each value between samples as a real sensor would. */
+
+  double w = 2.0 * M_PI * sim->wave ;                         /* Angular frequency of the waveform. */
+  double ts = floor( t * sim->rate ) / sim->rate ;            /* Time of the current sample. */
+  double level ;                                              /* How far a finger is curled, 0-1. */
+  double tilt = 0.5 * sin( w * ts ) ;                         /* Tilt of the hand, in radians. */
+  double rate = 0.5 * w * cos( w * ts ) ;                     /* Rate of tilt, in radians per second. */
+  double x ;                                                  /* A flex sensor value, in ADC counts. */
+  unsigned int i ;                                            /* An iterator. */
+
+  *contact = 0 ;
+  for( i = 0 ; i < I2C_SIM_FLEX ; i++ ){
+    level = 0.5 * (1.0 - cos( (w * ts) - (i * M_PI / 4.0) )) ;
+    x = (double)sim->lb[i] + (level * ((double)sim->ub[i] - (double)sim->lb[i])) ;
+    flex[i] = (x < 0.0) ? 0 : (x > SIM_MAX_ADC) ? SIM_MAX_ADC : (unsigned int)x ;
+    if( level > SIM_CONTACT_LEVEL )
+      *contact |= (uint16_t)(1 << (FRAME_IN_CON_T + (i * 2))) ;
+  }
+  /* Accelerometers in thousandths of g, magnetometers in milligauss and gyrometers in hundredths of a
+     degree per second. The bottom sensors are mounted upside down. */
+  for( i = 0 ; i < I2C_SIM_NUM_303 ; i++ ){
+    lsm303[i][0] = (int16_t)(1000.0 * sin( tilt )) ;
+    lsm303[i][1] = 0 ;
+    lsm303[i][2] = (int16_t)((i == 0 ? 1000.0 : -1000.0) * cos( tilt )) ;
+    lsm303[i][3] = (int16_t)(400.0 * cos( tilt )) ;
+    lsm303[i][4] = (int16_t)(400.0 * sin( tilt )) ;
+    lsm303[i][5] = -200 ;
+  }
+  for( i = 0 ; i < I2C_SIM_NUM_9DOF ; i++ ){
+    lsm9dof[i][0] = lsm303[i][0] ;
+    lsm9dof[i][1] = lsm303[i][1] ;
+    lsm9dof[i][2] = lsm303[i][2] ;
+    lsm9dof[i][3] = lsm303[i][3] ;
+    lsm9dof[i][4] = lsm303[i][4] ;
+    lsm9dof[i][5] = lsm303[i][5] ;
+    lsm9dof[i][6] = 0 ;
+    lsm9dof[i][7] = (int16_t)(rate * 180.0 / M_PI * 100.0) ;
+    lsm9dof[i][8] = 0 ;
+  }
+
+  return ;
+
+}
+
+static unsigned int sim_flex_adc( unsigned int value, unsigned int lb, unsigned int ub ){
+  /* Function to turn an adjusted flex value (0-95) back into ADC counts that flex_adjust() in flex_calib.c
+     maps to the same value, using the middle of its step. */
+
+  unsigned int step = (value + (SIM_FLEX_STEP / 2)) / SIM_FLEX_STEP ;     /* Step the value falls in. */
+  double dx = ((double)ub - (double)lb) / (double)(SIM_FLEX_STEPS - 2) ;  /* ADC counts per step. */
+  double x ;                                                              /* ADC counts. */
+
+  if( step == 0 )
+    x = (lb > 0) ? (double)lb - 1.0 : 0.0 ;
+  else if( step >= (SIM_FLEX_STEPS - 1) )
+    x = (double)ub ;
+  else
+    x = (double)lb + (((double)step - 0.5) * dx) ;
+  if( x < 0.0 )
+    x = 0.0 ;
+  if( x > SIM_MAX_ADC )
+    x = SIM_MAX_ADC ;
+
+  return (unsigned int)x ;
+
+}
+
+static int sim_fail( struct i2c_sim* sim, unsigned int nmsgs ){
+  /* Function to decide whether a transaction of nmsgs messages fails. Returns the message that fails, or -1. */
+
+  if( (sim->err <= 0.0) || (nmsgs == 0) || (sim_random(sim) >= sim->err) )
+    return -1 ;
+  sim->errors++ ;
+
+  return (int)(sim_random( sim ) * nmsgs) ;
+
+}
+
+static void sim_corrupt( struct i2c_sim* sim, unsigned char* buffer, size_t num_bytes ){
+  /* Function to flip a random bit of the data read, as noise on the bus would. */
+
+  size_t bit ;  /* The bit to flip. */
+
+  if( (sim->corrupt <= 0.0) || (num_bytes == 0) || (sim_random(sim) >= sim->corrupt) )
+    return ;
+  sim->corrupted++ ;
+  bit = (size_t)(sim_random( sim ) * (num_bytes * 8)) ;
+  buffer[bit / 8] ^= (unsigned char)(1 << (bit % 8)) ;
+
+  return ;
+
+}
+
+static void sim_wait( struct i2c_sim* sim, uint64_t start_ns, const struct i2c_msg* msgs, unsigned int nmsgs ){
+  /* Function to hold the caller for as long as the messages would take on a bus of the configured clock:
+     nine bits for each address and data byte, plus a start and a stop. */
+
+  uint64_t bits = 2 ;        /* Bits on the wire. */
+  uint64_t end_ns ;          /* Time the transaction would finish. */
+  struct timespec t ;        /* The same, as a timespec. */
+  unsigned int i ;           /* An iterator. */
+
+  if( sim->clock_hz == 0 )
+    return ;
+  for( i = 0 ; i < nmsgs ; i++ ){
+    bits += (1 + (uint64_t)msgs[i].len) * SIM_BITS_PER_BYTE ;
+  }
+  end_ns = start_ns + ((bits * SIM_NSEC_PER_SEC) / sim->clock_hz) ;
+  t.tv_sec = end_ns / SIM_NSEC_PER_SEC ;
+  t.tv_nsec = end_ns % SIM_NSEC_PER_SEC ;
+  while( clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &t, NULL) == EINTR ) ;
+
+  return ;
+
+}
+
+static double sim_random( struct i2c_sim* sim ){
+  /* Function to return a pseudo-random number in [0, 1), using xorshift32 so runs with the same seed
+     inject the same errors. */
+
+  sim->rng ^= sim->rng << 13 ;
+  sim->rng ^= sim->rng >> 17 ;
+  sim->rng ^= sim->rng << 5 ;
+
+  return (double)sim->rng / 4294967296.0 ;
+
+}
+
+static uint64_t sim_now_ns( void ){
+  /* Function to read the monotonic clock, in nanoseconds. */
+
+  struct timespec t ; /* The current time. */
+
+  clock_gettime( CLOCK_MONOTONIC, &t ) ;
+
+  return ((uint64_t)t.tv_sec * SIM_NSEC_PER_SEC) + (uint64_t)t.tv_nsec ;
+
+}
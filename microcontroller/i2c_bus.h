@@ -0,0 +1,108 @@
+/* Transport used by i2c_transfer to reach the ATmega. A bus is either the Linux I2C device
+   (/dev/i2c-N), or a simulated glove that serves the same register layout as the ATmega
+   from a scripted or recorded waveform, so the acquisition loop can be load tested without
+   the board. The calls mirror open(), ioctl(I2C_SLAVE), read(), write(), ioctl(I2C_RDWR)
+   and close(): they return -1 and set errno on failure, so callers can report errors with
+   perror() whichever backend is in use.
+
+   The simulated glove keeps the ATmega's internal pointer: writing 0 resets the pointer and
+   latches a new set of values, and each read returns the next bytes of the register image
+   (the flex and contact block, then each LSM303 block, then each LSM9DOF block). It is
+   configured by a comma separated list of key=value settings:
+
+     file=capture.frm  replay the right hand of a capture (written by --frames or
+                       tools/make_session.py), looping at the end. Without it, every
+                       finger flexes in turn and the hand tilts back and forth.
+     rate=100          samples per second of the waveform.
+     wave=0.5          cycles per second of the scripted waveform.
+     clock=400000      simulated bus clock in Hz, so transactions take as long as they
+                       would on the wire. 0 (the default) makes them instant.
+     err=0.001         probability that a transaction fails part way, as a NAK would.
+     corrupt=0.001     probability that a bit of the data read is flipped.
+     seed=1            seed for the injected errors. */
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+/* Includes */
+#include <stdint.h>
+#include <sys/types.h>
+#include <linux/i2c.h>
+/* Define constants. */
+#define I2C_SIM_FLEX 4                          /* Number of flex words served. The thumb has no flex sensor. */
+#define I2C_SIM_CONTACTS 13                     /* Number of contact bits served. */
+#define I2C_SIM_NUM_303 2                       /* Number of LSM303 blocks served. */
+#define I2C_SIM_303_VALS 6                      /* Words per LSM303 block. */
+#define I2C_SIM_NUM_9DOF 2                      /* Number of LSM9DOF blocks served. */
+#define I2C_SIM_9DOF_VALS 9                     /* Words per LSM9DOF block. */
+#define I2C_SIM_REG_LEN ((I2C_SIM_FLEX * 2) + 2 + (I2C_SIM_NUM_303 * I2C_SIM_303_VALS * 2) + \
+                         (I2C_SIM_NUM_9DOF * I2C_SIM_9DOF_VALS * 2)) /* Bytes in the register image. */
+
+/* Custom type definitions. */
+struct i2c_bus ;
+struct i2c_sim ;
+struct i2c_bus_ops{    /* The calls a backend provides. */
+  int (*open)( struct i2c_bus* bus, const char* f_name, int oflags, mode_t mode ) ;
+  int (*set_addr)( struct i2c_bus* bus, unsigned int addr ) ;
+  ssize_t (*read)( struct i2c_bus* bus, void* buffer, size_t num_bytes ) ;
+  ssize_t (*write)( struct i2c_bus* bus, const void* buffer, size_t num_bytes ) ;
+  int (*transfer)( struct i2c_bus* bus, struct i2c_msg* msgs, unsigned int nmsgs ) ;
+  int (*close)( struct i2c_bus* bus ) ;
+} ;
+struct i2c_bus{        /* An I2C bus. */
+  const struct i2c_bus_ops* ops ;                      /* The backend. */
+  int fd ;                                             /* The open device, or -1. */
+  unsigned int addr ;                                  /* The addressed device. */
+  struct i2c_sim* sim ;                                /* The simulated glove, or NULL for the device. */
+} ;
+
+/* Function declarations. */
+void i2c_bus_device( struct i2c_bus* bus ) ;
+int i2c_bus_simulate( struct i2c_bus* bus, const char* spec, unsigned int addr,
+                      const unsigned int lb[I2C_SIM_FLEX], const unsigned int ub[I2C_SIM_FLEX] ) ;
+void i2c_bus_free( struct i2c_bus* bus ) ;
+void i2c_sim_reset( struct i2c_sim* sim ) ;
+void i2c_sim_report( const struct i2c_sim* sim ) ;
+
+static inline int i2c_bus_open( struct i2c_bus* bus, const char* f_name, int oflags, mode_t mode ){
+  /* Function to open the bus. Returns -1 on error. */
+
+  return bus->ops->open( bus, f_name, oflags, mode ) ;
+
+}
+
+static inline int i2c_bus_set_addr( struct i2c_bus* bus, unsigned int addr ){
+  /* Function to address a device for the following reads and writes. Returns -1 on error. */
+
+  return bus->ops->set_addr( bus, addr ) ;
+
+}
+
+static inline ssize_t i2c_bus_read( struct i2c_bus* bus, void* buffer, size_t num_bytes ){
+  /* Function to read from the addressed device. Returns the number of bytes read, or -1 on error. */
+
+  return bus->ops->read( bus, buffer, num_bytes ) ;
+
+}
+
+static inline ssize_t i2c_bus_write( struct i2c_bus* bus, const void* buffer, size_t num_bytes ){
+  /* Function to write to the addressed device. Returns the number of bytes written, or -1 on error. */
+
+  return bus->ops->write( bus, buffer, num_bytes ) ;
+
+}
+
+static inline int i2c_bus_transfer( struct i2c_bus* bus, struct i2c_msg* msgs, unsigned int nmsgs ){
+  /* Function to perform a combined transaction, with repeated starts between the messages. Returns -1 on error. */
+
+  return bus->ops->transfer( bus, msgs, nmsgs ) ;
+
+}
+
+static inline int i2c_bus_close( struct i2c_bus* bus ){
+  /* Function to close the bus. Returns -1 on error. */
+
+  return bus->ops->close( bus ) ;
+
+}
+
+#endif
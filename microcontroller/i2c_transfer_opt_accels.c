@@ -11,6 +11,12 @@
 #include <signal.h>
 #include <string.h>
 #include <time.h>
+#include <math.h>
+#include <stdint.h>
+#include <sys/timerfd.h>
+#include "sample_ring.h"
+#include "i2c_bus.h"
+#include "flex_calib.h"
 /* Define constants. */
 #define MAX_CHAR 1023                           /* Number of characters in buffer. */
 #define ATMEGA_ADDR 0x04                        /* Atmega I2C address. */
@@ -34,7 +40,15 @@
 #define TOTAL_NUM_9DOF NUM_9DOF * NUM_9DOF_VALS /* Total number of LSM9DOF values. */
 #define SEP_NUM_9DOF TOTAL_NUM_9DOF / 3         /* Number of LSM9DOF values for a given type (accelerometer, magnetometer, or gyrometer). */
 #define NUM_9DOF_NAMES 4                        /* The number of LSM9DOF value names. */
-#define NUM_ARGS ((NUM_FINGERS * 2) + 1) + 2    /* The number of command line arguments. */
+#define NUM_ARGS ((NUM_FINGERS * 2) + 1) + 2    /* The number of required command line arguments. */
+#define FLEX_CONTACT_LEN ((FLEX_BYTES * (NUM_FINGERS - 1)) + CONTACT_BYTES) /* Bytes in the flex and contact sensor block. */
+#define LSM303_LEN (LSM303_BYTES * NUM_303_VALS)                         /* Bytes in an LSM303 block. */
+#define LSM9DOF_LEN (LSM9DOF_BYTES * NUM_9DOF_VALS)                      /* Bytes in an LSM9DOF block. */
+#define NUM_BLOCKS (1 + NUM_303 + NUM_9DOF)                              /* Number of blocks read per frame. */
+#define NSEC_PER_SEC 1000000000ULL              /* Nanoseconds per second. */
+#define REPORT_PERIOD_S 5                       /* Seconds between rate and jitter reports. */
+#define XML_PERIOD_MS 50                        /* Milliseconds between XML files at a fixed rate. sign2speech reads them about this often. */
+#define TRACE_SPANS 65536                       /* Spans kept for --trace, the oldest being overwritten. Must be a power of two. */
 /* Custom type definitions. */
 typedef enum{ false, true } bool ; /* Used to define boolean values. */
 struct Finger{  /* Structure to store finger related data. */
@@ -69,21 +83,59 @@ struct Hand{    /* Structure to store hand related data. */
   struct LSM303 lsm303[NUM_303] ;  
   struct LSM9DOF lsm9dof[NUM_9DOF] ;  
 } ;
+struct RateStats{ /* Structure to store acquisition timing statistics. */
+  unsigned long frames ;     /* Number of frames acquired. */
+  unsigned long overruns ;   /* Number of periods missed because a frame took too long. */
+  double jitter_sum ;        /* Sum of wake-up delays past the scheduled time, in microseconds. */
+  double jitter_sq_sum ;     /* Sum of squared wake-up delays. */
+  double jitter_max ;        /* Largest wake-up delay. */
+  double acq_sum ;           /* Sum of I2C transfer times, in microseconds. */
+  double acq_max ;           /* Largest I2C transfer time. */
+  uint64_t start_ns ;        /* Time the statistics were last reset. */
+} ;
+struct TraceSpan{ /* Structure to store the time spent on one step of a frame, for --trace. */
+  const char* name ;         /* The step. */
+  uint32_t frame ;           /* The frame's sequence number. */
+  uint64_t start_ns ;        /* Start of the step, in CLOCK_MONOTONIC nanoseconds. */
+  uint64_t end_ns ;          /* End of the step. */
+} ;
+struct Trace{     /* Structure to store the latest spans, written out as Chrome trace JSON at exit. */
+  struct TraceSpan* spans ;  /* The spans, NULL if not tracing. */
+  uint64_t count ;           /* Number of spans added. */
+  char* f_name ;             /* The trace file. */
+} ;
 /* Global variables. */
 volatile sig_atomic_t kb_flag = 0 ; /* Keyboard interrupt flag. */
+volatile sig_atomic_t reload_flag = 0 ; /* Set by SIGHUP to reload the flex calibration profile. */
 /* Function declarations. */
 bool i2c_read( const char* f_name, char buffer[MAX_CHAR], unsigned int num_bytes, const unsigned int addr,
-	       int* fd, bool open_file, bool close_file, int oflags, mode_t mode ) ;
+	       struct i2c_bus* bus, bool open_file, bool close_file, int oflags, mode_t mode ) ;
 bool i2c_write( const char* f_name, char buffer[MAX_CHAR], unsigned int num_bytes, const unsigned int addr, 
-		int* fd, bool open_file, bool close_file, int oflags, mode_t mode ) ;
+		struct i2c_bus* bus, bool open_file, bool close_file, int oflags, mode_t mode ) ;
 void data_init( struct Hand hands[NUM_HANDS], unsigned int left_flex[NUM_FINGERS], unsigned int right_flex[NUM_FINGERS], 
                 bool left_contact[TOTAL_NUM_CONTACTS], bool right_contact[TOTAL_NUM_CONTACTS], 
                 double left_303_accel[SEP_NUM_303], double left_303_mag[SEP_NUM_303],
                 double right_303_accel[SEP_NUM_303], double right_303_mag[SEP_NUM_303],
                 double left_9dof_accel[SEP_NUM_9DOF], double left_9dof_mag[SEP_NUM_9DOF], double left_9dof_gyro[SEP_NUM_9DOF],
                 double right_9dof_accel[SEP_NUM_9DOF], double right_9dof_mag[SEP_NUM_9DOF], double right_9dof_gyro[SEP_NUM_9DOF] ) ;
-bool write_file( char f_name[MAX_CHAR], struct Hand hands[NUM_HANDS], char status[MAX_CHAR], 
-                 unsigned int lb[NUM_FINGERS], unsigned int ub[NUM_FINGERS] ) ;
+bool write_file( char f_name[MAX_CHAR], struct Hand hands[NUM_HANDS], char status[MAX_CHAR], const struct flex_lut* lut ) ;
+void fill_frame( struct sensor_frame* frame, struct Hand hands[NUM_HANDS], char status[MAX_CHAR], const struct flex_lut* lut,
+                 uint32_t seq, uint64_t timestamp, uint32_t acq_us, bool left_present ) ;
+bool parse_flex_contact( const char* buffer, unsigned int flex[NUM_FINGERS], bool contact[TOTAL_NUM_CONTACTS] ) ;
+void parse_lsm303( const char* buffer, unsigned int i, double accel303[SEP_NUM_303], double mag303[SEP_NUM_303] ) ;
+void parse_lsm9dof( const char* buffer, unsigned int i, double accel9dof[SEP_NUM_9DOF], double mag9dof[SEP_NUM_9DOF],
+                    double gyro9dof[SEP_NUM_9DOF] ) ;
+bool i2c_transfer_all( struct i2c_bus* bus, const unsigned int addr, char buffer[MAX_CHAR] ) ;
+bool read_left( struct i2c_bus* bus, const unsigned int addr, char buffer[MAX_CHAR], unsigned int flex[NUM_FINGERS],
+                bool contact[TOTAL_NUM_CONTACTS], double accel303[SEP_NUM_303], double mag303[SEP_NUM_303],
+                double accel9dof[SEP_NUM_9DOF], double mag9dof[SEP_NUM_9DOF], double gyro9dof[SEP_NUM_9DOF] ) ;
+bool i2c_trigger( struct i2c_bus* bus, const unsigned int addr ) ;
+int start_timer( uint64_t period_ns ) ;
+unsigned long wait_timer( int tfd, uint64_t period_ns, uint64_t* deadline_ns, struct RateStats* stats ) ;
+void report_stats( struct RateStats* stats, uint64_t period_ns, struct sample_ring* ring ) ;
+uint64_t now_ns( void ) ;
+void trace_span( struct Trace* trace, const char* name, uint32_t frame, uint64_t start_ns, uint64_t end_ns ) ;
+bool write_trace( struct Trace* trace ) ;
 void store_data( struct Hand hands[NUM_HANDS], unsigned int flex[NUM_FINGERS], bool contact[TOTAL_NUM_CONTACTS], 
                  double accel303[SEP_NUM_303], double mag303[SEP_NUM_303], double accel9dof[SEP_NUM_9DOF], double mag9dof[SEP_NUM_9DOF],
                  double gyro9dof[SEP_NUM_9DOF], unsigned int i ) ;
@@ -95,7 +147,6 @@ void group_data( struct Hand hands[NUM_HANDS], unsigned int left_flex[NUM_FINGER
                  double right_9dof_accel[SEP_NUM_9DOF], double right_9dof_mag[SEP_NUM_9DOF], double right_9dof_gyro[SEP_NUM_9DOF] ) ;
 void print_values( struct Hand hands[NUM_HANDS] ) ;
 bool reset_sensor( char* f_name ) ;
-double adjust_flex( unsigned int x, unsigned int lb, unsigned int ub ) ;
 void print_table( char border[MAX_CHAR], char header[MAX_CHAR], char entry[NUM_HANDS][MAX_CHAR] ) ;
 void add_border( char border[MAX_CHAR], int border_len, char c_div, char v_div ) ;
 void signal_handler( int sig ) ;
@@ -115,7 +166,8 @@ int main( int argc, char* argv[] ){
   bool close_file = true ;                  /* An indicator if a file should be closed. */
   int oflags = O_RDWR ;                     /* Flags to use when opening a file. */
   mode_t mode = S_IWUSR | S_IRUSR ;         /* Permissions to use when opening a file. */
-  int fd ;                                  /* File handle. */
+  struct i2c_bus bus ;                      /* The I2C bus, or the simulated glove. */
+  char* sim_spec = NULL ;                   /* Settings of the simulated glove, if one is used instead of the bus. */
   int result = EXIT_SUCCESS ;               /* Indicator if the program exited successfully. */
   unsigned int left_flex[NUM_FINGERS] ;     /* Array to store the left hand flex sensor data. */
   unsigned int right_flex[NUM_FINGERS] ;    /* Array to store the right hand flex sensor data. */
@@ -140,9 +192,35 @@ int main( int argc, char* argv[] ){
   char* un = getenv( "USER" ) ;             /* The current user name. */
   char f_name[MAX_CHAR] ;                   /* File to store data. */
   char* gpio_f_name = "/sys/class/gpio/gpio27/value" ; /* File handle used to reset microcontroller. */
-  unsigned int lb[NUM_FINGERS] ;            /* The lower bounds to use for calibrating the flex sensors. Ranges from 0-1023. */
-  unsigned int ub[NUM_FINGERS] ;            /* The upper bounds to use for calibrating the flex sensors. Ranges from 0-1023.*/
+  struct flex_profile profile ;             /* The bounds to use for calibrating the flex sensors. Ranges from 0-1023. */
+  struct flex_lut lut ;                     /* The profile compiled into the adjusted flex value of each ADC count. */
+  char* profile_f_name = NULL ;             /* The profile file, NULL if the calibration was given on the command line. */
+  bool calibrate = false ;                  /* An indicator if a guided calibration should be run and saved to the profile. */
+  struct flex_calibration cal ;             /* The guided calibration, while it runs. */
   bool reset = true ;                       /* An indicator if the microcontroller should be reset. */
+  bool use_ring = true ;                    /* An indicator if samples should be written to the shared memory ring. */
+  bool use_xml = false ;                    /* An indicator if samples should also be written to the XML file. */
+  struct sample_ring* ring = NULL ;         /* The shared memory ring read by sign2speech. */
+  struct sensor_frame* frame ;              /* The binary frame holding the current sensor data. */
+  struct sensor_frame local_frame ;         /* Used when the shared memory ring is unavailable or full. */
+  bool ring_full = false ;                  /* An indicator if the shared memory ring was full for the last frame. */
+  uint32_t dropped_before = 0 ;             /* Number of samples dropped before the ring last became full. */
+  FILE* frames_fp = NULL ;                  /* File to append binary frames to. */
+  uint64_t period_ns = 0 ;                  /* Acquisition period when running at a fixed rate, 0 otherwise. */
+  uint64_t deadline_ns = 0 ;                /* Time the current period was scheduled to start. */
+  uint64_t trigger_ns = 0 ;                 /* Time the microcontroller was last asked to update its values. */
+  uint64_t capture_ns ;                     /* Capture time of the current frame. */
+  uint64_t acq_ns ;                         /* Time taken to read the sensors for the current frame. */
+  uint64_t acq_end_ns ;                     /* Time the sensors were read for the current frame. */
+  uint32_t frame_seq ;                      /* Sequence number of the current frame. */
+  struct Trace trace = { NULL, 0, NULL } ;  /* The spans traced for each frame, if --trace was given. */
+  uint64_t report_ns = 0 ;                  /* Time of the last rate and jitter report. */
+  uint64_t xml_ns = 0 ;                     /* Time the XML file was last written. */
+  int tfd = -1 ;                            /* Timer used to schedule fixed rate acquisition. */
+  unsigned int left_addr = 0 ;              /* I2C address of the left glove's microcontroller, 0 if there is none. */
+  bool left_present = false ;               /* An indicator if the left glove was read for the current frame. */
+  struct RateStats stats ;                  /* Acquisition timing statistics. */
+  uint32_t seq = 0 ;                        /* The sample number. */
   char* finger_name[NUM_FINGERS] = {"ind",  /* A list of names for the flex sensors. */
                                     "mid", 
                                     "ri", 
@@ -152,22 +230,39 @@ int main( int argc, char* argv[] ){
 
   fprintf( stdout, "Initializing\n" ) ;
   fprintf( stdout, "Applying calibration settings\n" ) ;
-  if( argc != NUM_ARGS ){
-    fprintf( stderr, "Usage: %s in_lb in_ub mid_lb mid_ub ri_lb ri_ub pi_lb pi_ub th_lb th_ub update_delay_ms read_delay_ms\n", argv[0] ) ;
+  if( (argc > 1) && (strcmp(argv[1], "--profile") == 0) ){
+    /* The calibration is read from a profile file, which SIGHUP reloads. */
+    if( argc < 5 ){
+      argc = 0 ;
+    }
+    else{
+      profile_f_name = argv[2] ;
+      j = 3 ;
+    }
+  }
+  else if( argc >= NUM_ARGS ){
+    j = 1 ;
+  }
+  else{
+    argc = 0 ;
+  }
+  if( argc == 0 ){
+    fprintf( stderr, "Usage: %s {in_lb in_ub mid_lb mid_ub ri_lb ri_ub pi_lb pi_ub th_lb th_ub | --profile file} "
+                     "update_delay_ms read_delay_ms [--calibrate] [--xml] [--no-ring] [--frames file] [--rate hz] [--left addr] "
+                     "[--sim [settings]] [--trace file]\n", argv[0] ) ;
     return EXIT_FAILURE ;
   }
-  j = 1 ;
   /* Parse calibration settings. */
-  for( i = 0 ; i < NUM_FINGERS ; i++ ){
+  for( i = 0 ; (profile_f_name == NULL) && (i < NUM_FINGERS) ; i++ ){
     if( !valid_int(argv[j]) )
       fprintf( stderr, "*** Invalid calibration setting for flex sensor lower bound: %s ***\n", argv[j] ) ;
     fprintf( stdout, "%s flex lower bound threshold set to: %s\n", finger_name[i], argv[j] ) ;
-    lb[i] = atoi( argv[j++] ) ;
+    profile.lb[i] = atoi( argv[j++] ) ;
     if( !valid_int(argv[j]) )
       fprintf( stderr, "*** Invalid calibration setting for flex sensor upper bound: %s ***\n", argv[j] ) ;
     fprintf( stdout, "%s flex upper bound threshold set to: %s\n", finger_name[i], argv[j] ) ;
-    ub[i] = atoi( argv[j++] ) ;
-    if( lb[i] == ub[i] )
+    profile.ub[i] = atoi( argv[j++] ) ;
+    if( profile.lb[i] == profile.ub[i] )
       fprintf( stderr, "*** Invalid calibration setting: Lower bound and upper bound should not be equal. ***" ) ;
   }
   /* Parse delay settings. */
@@ -181,31 +276,200 @@ int main( int argc, char* argv[] ){
   fprintf( stdout, "I2C read delay: %s ms\n", argv[j] ) ;
   read_t.tv_sec = atoi( argv[j] ) / 1000 ;
   read_t.tv_nsec = (unsigned long int)((atoi( argv[j++] ) % 1000) * 1000000 ) ;
+  /* Parse output options. */
+  for( ; j < argc ; j++ ){
+    if( strcmp(argv[j], "--xml") == 0 )
+      use_xml = true ;
+    else if( strcmp(argv[j], "--calibrate") == 0 )
+      calibrate = true ;
+    else if( strcmp(argv[j], "--no-ring") == 0 )
+      use_ring = false ;
+    else if( (strcmp(argv[j], "--rate") == 0) && (j + 1 < argc) ){
+      if( (atof(argv[j + 1]) <= 0.0) || (atof(argv[j + 1]) > 10000.0) )
+        fprintf( stderr, "*** Invalid acquisition rate: %s ***\n", argv[j + 1] ) ;
+      else
+        period_ns = (uint64_t)((double)NSEC_PER_SEC / atof(argv[j + 1])) ;
+      j++ ;
+    }
+    else if( (strcmp(argv[j], "--left") == 0) && (j + 1 < argc) ){
+      /* The left glove has its own microcontroller, at an address such as 0x05. */
+      left_addr = (unsigned int)strtoul( argv[++j], NULL, 0 ) ;
+      if( (left_addr < 0x03) || (left_addr > 0x77) || (left_addr == ATMEGA_ADDR) ){
+        fprintf( stderr, "*** Invalid left glove address: %s ***\n", argv[j] ) ;
+        left_addr = 0 ;
+      }
+    }
+    else if( strcmp(argv[j], "--sim") == 0 ){
+      /* The settings are optional, so only take the next argument if it is one. */
+      sim_spec = "" ;
+      if( (j + 1 < argc) && (strchr(argv[j + 1], '=') != NULL) )
+        sim_spec = argv[++j] ;
+    }
+    else if( (strcmp(argv[j], "--trace") == 0) && (j + 1 < argc) ){
+      trace.f_name = argv[++j] ;
+      trace.spans = (struct TraceSpan*)calloc( TRACE_SPANS, sizeof(struct TraceSpan) ) ;
+      if( trace.spans == NULL )
+        perror( "*** Unable to allocate trace " ) ;
+      else
+        fprintf( stdout, "Tracing frames to:\t%s\n", trace.f_name ) ;
+    }
+    else if( (strcmp(argv[j], "--frames") == 0) && (j + 1 < argc) ){
+      frames_fp = fopen( argv[++j], "ab" ) ;
+      if( frames_fp == NULL )
+        perror( "*** Unable to open frame capture file " ) ;
+      else
+        fprintf( stdout, "Appending sensor frames to:\t%s\n", argv[j] ) ;
+    }
+    else
+      fprintf( stderr, "*** Unknown option: %s ***\n", argv[j] ) ;
+  }
+  if( (left_addr != 0) && ((period_ns == 0) || (sim_spec != NULL)) ){
+    /* Only the combined transaction is quick enough to read both gloves in one frame, and the simulated
+       glove only answers at ATMEGA_ADDR. */
+    fprintf( stderr, "*** The left glove is only read at a fixed rate on the I2C bus, ignoring --left ***\n" ) ;
+    left_addr = 0 ;
+  }
+  else if( left_addr != 0 )
+    fprintf( stdout, "Left glove at I2C address:\t0x%02x\n", left_addr ) ;
+  if( profile_f_name != NULL ){
+    if( flex_profile_load(&profile, profile_f_name) == 0 ){
+      fprintf( stdout, "Flex calibration read from:\t%s\n", profile_f_name ) ;
+    }
+    else if( calibrate && (errno == ENOENT) ){
+      /* A new user, whose profile the guided calibration will write. */
+      flex_profile_uncalibrated( &profile ) ;
+    }
+    else{
+      perror( "*** Unable to read flex calibration profile " ) ;
+      return EXIT_FAILURE ;
+    }
+  }
+  else if( calibrate ){
+    fprintf( stderr, "*** --calibrate saves to a profile, so needs --profile file ***\n" ) ;
+    calibrate = false ;
+  }
+  flex_lut_build( &lut, &profile ) ;
+  if( calibrate )
+    flex_cal_start( &cal ) ;
   /* Register keyboard interrupt handler. */
   signal( SIGINT, signal_handler ) ;
+  /* stop.sh uses kill, so also finish cleanly on SIGTERM, writing the statistics and trace. */
+  signal( SIGTERM, signal_handler ) ;
+  /* switch_user.sh changes the profile and sends SIGHUP, so the calibration changes without a restart. */
+  signal( SIGHUP, signal_handler ) ;
   /* Initialize status and command. */
   memset( status, '\0', sizeof(char) * MAX_CHAR ) ;
   memset( cmd, '\0', sizeof(char) * MAX_CHAR ) ;
   /* Initialize output file name. */
   sprintf( f_name, "/home/%s/CapstoneProject/gesture_data/gesture_data_init.xml", un ) ;
+  /* Map the shared memory ring. Fall back to the XML file if it is unavailable. */
+  if( use_ring ){
+    ring = sample_ring_open( SAMPLE_RING_NAME ) ;
+    if( ring == NULL ){
+      perror( "*** Unable to open shared memory ring, writing XML instead " ) ;
+      use_xml = true ;
+    }
+    else{
+      fprintf( stdout, "Writing sensor data to shared memory:\t%s\n", SAMPLE_RING_NAME ) ;
+    }
+  }
+  else{
+    use_xml = true ;
+  }
+  /* Talk to the ATmega, or to a simulated glove when testing without the board. */
+  i2c_bus_device( &bus ) ;
+  if( sim_spec != NULL ){
+    if( i2c_bus_simulate(&bus, sim_spec, ATMEGA_ADDR, profile.lb, profile.ub) == -1 ){
+      perror( "*** Unable to set up simulated glove " ) ;
+      result = EXIT_FAILURE ;
+    }
+    else
+      fprintf( stdout, "Reading sensor data from a simulated glove\n" ) ;
+  }
   /* Initialize data. */
   data_init( hands, left_flex, right_flex, left_contact, right_contact, 
              left_303_accel, left_303_mag, right_303_accel, right_303_mag,
              left_9dof_accel, left_9dof_mag, left_9dof_gyro, right_9dof_accel, right_9dof_mag, right_9dof_gyro ) ;
-  /* Continually read current sensor data. */
-  while( true ){
+  if( (result == EXIT_SUCCESS) && (period_ns > 0) ){
+    /* Fixed rate acquisition keeps the I2C bus open and reads every block in one combined transaction. */
+    fprintf( stdout, "Acquiring at %.1f Hz\n", (double)NSEC_PER_SEC / (double)period_ns ) ;
+    if( i2c_bus_open(&bus, I2C_FILE, oflags, mode) == -1 ){
+      perror( "*** Unable to open I2C connection " ) ;
+      result = EXIT_FAILURE ;
+    }
+    else if( (tfd = start_timer(period_ns)) == -1 ){
+      perror( "*** Unable to start acquisition timer " ) ;
+      i2c_bus_close( &bus ) ;
+      result = EXIT_FAILURE ;
+    }
+    else{
+      deadline_ns = now_ns() ;
+      memset( &stats, 0, sizeof(stats) ) ;
+      stats.start_ns = deadline_ns ;
+      report_ns = deadline_ns ;
+    }
+  }
+  /* Continually read current sensor data. If the glove, the bus, or the timer could not be set up, go
+     straight to the clean up, so the ring is unmapped and the frames and trace are closed as on SIGINT. */
+  while( result == EXIT_SUCCESS ){
     if( reset ){
       /* Reset microcontroller. */
       fprintf( stdout, "Reseting microcontroller.\n" ) ;
-      if( !reset_sensor(gpio_f_name) )
+      if( bus.sim != NULL )
+        i2c_sim_reset( bus.sim ) ;
+      else if( !reset_sensor(gpio_f_name) )
         perror( "*** Unable to reset sensor " ) ;
       reset = false ;
+      if( period_ns > 0 ){
+        /* Ask for the first set of values, since each transaction collects the values requested by the previous one. */
+        i2c_trigger( &bus, ATMEGA_ADDR ) ;
+        if( left_addr != 0 )
+          i2c_trigger( &bus, left_addr ) ;
+        trigger_ns = now_ns() ;
+      }
     }
     strcpy( status, "connected" ) ;
+    if( period_ns > 0 ){
+      /* Sleep until the next period starts. */
+      stats.overruns += wait_timer( tfd, period_ns, &deadline_ns, &stats ) ;
+      /* The values being read were sampled when the previous transaction asked for them. */
+      capture_ns = trigger_ns ;
+      acq_ns = now_ns() ;
+      memset( buffer, '\0', sizeof(char) * MAX_CHAR ) ;
+      if( !i2c_transfer_all(&bus, ATMEGA_ADDR, buffer) ){
+        /* I2C bus error. */
+        strcpy( status, "disconnected" ) ;
+        reset = true ;
+      }
+      trigger_ns = now_ns() ;
+      if( !parse_flex_contact(buffer, right_flex, right_contact) ){
+        reset = true ;
+      }
+      for( i = 0 ; i < NUM_303 ; i++ ){
+        parse_lsm303( buffer + FLEX_CONTACT_LEN + (i * LSM303_LEN), i, right_303_accel, right_303_mag ) ;
+      }
+      for( i = 0 ; i < NUM_9DOF ; i++ ){
+        parse_lsm9dof( buffer + FLEX_CONTACT_LEN + (NUM_303 * LSM303_LEN) + (i * LSM9DOF_LEN), i,
+                       right_9dof_accel, right_9dof_mag, right_9dof_gyro ) ;
+      }
+      if( left_addr != 0 ){
+        /* A missing left glove does not disconnect the right one, its hand is just left out of the frame. */
+        left_present = read_left( &bus, left_addr, buffer, left_flex, left_contact, left_303_accel, left_303_mag,
+                                  left_9dof_accel, left_9dof_mag, left_9dof_gyro ) ;
+      }
+      acq_end_ns = now_ns() ;
+      acq_ns = acq_end_ns - acq_ns ;
+      stats.frames++ ;
+      stats.acq_sum += (double)acq_ns / 1000.0 ;
+      if( ((double)acq_ns / 1000.0) > stats.acq_max )
+        stats.acq_max = (double)acq_ns / 1000.0 ;
+    }
+    else{ /* Read each block separately, reopening the bus as configured. */
+    capture_ns = now_ns() ;
     /* Reset microcontroller internal pointer. */
     cmd[0] = 0 ;
     num_bytes = 1 ;
-    if( !i2c_write(I2C_FILE, cmd, num_bytes, ATMEGA_ADDR, &fd, open_file, close_file, oflags, mode) ){
+    if( !i2c_write(I2C_FILE, cmd, num_bytes, ATMEGA_ADDR, &bus, open_file, close_file, oflags, mode) ){
       /* I2C bus write error. */
       strcpy( status, "disconnected" ) ;
       reset = true ;
@@ -217,88 +481,142 @@ int main( int argc, char* argv[] ){
     /* Allow sufficient time between reads. */
     num_bytes = (FLEX_BYTES * ( NUM_FINGERS - 1 )) + CONTACT_BYTES ;
     memset( buffer, '\0', sizeof(char) * MAX_CHAR ) ;
-    if( !i2c_read(I2C_FILE, buffer, num_bytes, ATMEGA_ADDR, &fd, open_file, close_file, oflags, mode) ){
+    if( !i2c_read(I2C_FILE, buffer, num_bytes, ATMEGA_ADDR, &bus, open_file, close_file, oflags, mode) ){
       /* I2C bus read error. */
       strcpy( status, "disconnected" ) ;
       reset = true ;
       break ;
     }
-    for( i = 0 ; i < (NUM_FINGERS - 1) ; i++ ){ /* Note the thumb currently doesn't have a flex sensor. */
-      right_flex[i] = (unsigned int)((buffer[i*2] << 8) | buffer[(i*2)+1]) ; /* Currently there is only a right handed glove. */
-      if( right_flex[i] > MAX_ADC ){
-	fprintf( stderr, "*** Flex sensor value %u exceeds %u, attempting to reset microcontroller.\n", right_flex[i], MAX_ADC ) ;
-	reset = true ;
-      }
-    }
-    /* Read contact sensors. */
-    for( i = 0 ; i < TOTAL_NUM_CONTACTS ; i++ ){
-      if( i < 8 )
-        right_contact[i] = (bool)((buffer[FLEX_BYTES*(NUM_FINGERS-1)] >> i) & 0x01 );
-      else
-        right_contact[i] = (bool)((buffer[(FLEX_BYTES*(NUM_FINGERS-1))+1] >> (i % 8)) & 0x01 );
-      /* Invert the value so that contact is true, and no contact is false. */
-      if( right_contact[i] == true )
-        right_contact[i] = false ;
-      else
-	right_contact[i] = true ;
-    }
+    /* Currently there is only a right handed glove. */
+    if( !parse_flex_contact(buffer, right_flex, right_contact) )
+      reset = true ;
     nanosleep( &read_t, &read_t_rem ) ;
     /* Read accelerometers. */
     fprintf( stdout, "Reading LSM303 accelerometers\n" ) ; 
     num_bytes = LSM303_BYTES * NUM_303_VALS ;
     for( i = 0 ; i < NUM_303 ; i++ ){
       memset( buffer, '\0', sizeof(char) * MAX_CHAR ) ;
-      if( !i2c_read(I2C_FILE, buffer, num_bytes, ATMEGA_ADDR, &fd, open_file, close_file, oflags, mode) ){
+      if( !i2c_read(I2C_FILE, buffer, num_bytes, ATMEGA_ADDR, &bus, open_file, close_file, oflags, mode) ){
         /* I2C bus read error. */
         strcpy( status, "disconnected" ) ;
         reset = true ;
         break ;
       }
       /* Currently there is a right handed glove. */
-      for( j = 0 ; j < (NUM_303_VALS / 2) ; j++ ){
-        right_303_accel[(i*(NUM_303_VALS/2))+j] = (double)((signed short)((buffer[j*2] << 8) | (buffer[(j*2)+1]))) ; 
-      }
-      for( ; j < NUM_303_VALS ; j++ ){
-        right_303_mag[(i*(NUM_303_VALS/2))+(j%(NUM_303_VALS/2))] = (double)((signed short)((buffer[j*2] << 8) | (buffer[(j*2)+1]))) ;
-      }
+      parse_lsm303( buffer, i, right_303_accel, right_303_mag ) ;
       nanosleep( &read_t, &read_t_rem ) ;
     }
     fprintf( stdout, "Reading LSM9DOF accelerometers\n" ) ; 
     num_bytes = LSM9DOF_BYTES * NUM_9DOF_VALS ;
     for( i = 0 ; i < NUM_9DOF ; i++ ){
       memset( buffer, '\0', sizeof(char) * MAX_CHAR ) ;
-      if( !i2c_read(I2C_FILE, buffer, num_bytes, ATMEGA_ADDR, &fd, open_file, close_file, oflags, mode) ){
+      if( !i2c_read(I2C_FILE, buffer, num_bytes, ATMEGA_ADDR, &bus, open_file, close_file, oflags, mode) ){
         /* I2C bus read error. */
         strcpy( status, "disconnected" ) ;
         reset = true ;
         break ;
       }
       nanosleep( &read_t, &read_t_rem ) ;
-      for( j = 0 ; j < (NUM_9DOF_VALS / 3) ; j++ ){
-        /* Currently there is only a right handed glove. */
-        right_9dof_accel[(i*(NUM_9DOF_VALS/3))+j] = (double)((signed short)((buffer[j*2] << 8) | (buffer[(j*2)+1]))) ; 
-      }
-      for( ; j < ((NUM_9DOF_VALS * 2) / 3) ; j++ ){
-        right_9dof_mag[(i*(NUM_9DOF_VALS/3))+(j%(NUM_9DOF_VALS/3))] = (double)((signed short)((buffer[j*2] << 8) | (buffer[(j*2)+1]))) ; 
-      }
-      for( ; j < NUM_9DOF_VALS ; j++ ){
-        right_9dof_gyro[(i*(NUM_9DOF_VALS/3))+(j%(NUM_9DOF_VALS/3))] = (double)((signed short)((buffer[j*2] << 8) | (buffer[(j*2)+1]))) ; 
-      }
+      /* Currently there is only a right handed glove. */
+      parse_lsm9dof( buffer, i, right_9dof_accel, right_9dof_mag, right_9dof_gyro ) ;
       nanosleep( &read_t, &read_t_rem ) ;
     }
+    acq_end_ns = now_ns() ;
+    acq_ns = acq_end_ns - capture_ns ;
+    }
     /* Group the data. */
     group_data( hands, left_flex, right_flex, left_contact, right_contact, 
                 left_303_accel, left_303_mag, right_303_accel, right_303_mag,
                 left_9dof_accel, left_9dof_mag, left_9dof_gyro, right_9dof_accel, right_9dof_mag, right_9dof_gyro ) ;
-    print_values( hands ) ;
-    /* Output current sensor data to file. */
-    fprintf( stdout, "Writing sensor data to:\t%s\n", f_name ) ;
-    if( !write_file(f_name, hands, status, lb, ub) )
-      perror( "*** Error writing sensor data " ) ;
+    if( period_ns == 0 )
+      /* Printing every frame would limit the acquisition rate. */
+      print_values( hands ) ;
+    if( reload_flag ){
+      /* Reload the profile between frames, so no frame mixes two calibrations. */
+      reload_flag = 0 ;
+      if( profile_f_name == NULL )
+        fprintf( stderr, "*** The flex calibration was given on the command line, so there is no profile to reload ***\n" ) ;
+      else if( flex_profile_load(&profile, profile_f_name) == -1 )
+        perror( "*** Unable to reload flex calibration profile, keeping the current one " ) ;
+      else{
+        flex_lut_build( &lut, &profile ) ;
+        fprintf( stdout, "Flex calibration reloaded from:\t%s\n", profile_f_name ) ;
+      }
+    }
+    if( calibrate ){
+      /* The raw counts of each glove read are captured until the calibration is done. */
+      if( left_present )
+        flex_cal_add( &cal, left_flex, acq_end_ns ) ;
+      if( flex_cal_add(&cal, right_flex, acq_end_ns) == FLEX_CAL_DONE ){
+        calibrate = false ;
+        if( flex_cal_derive(&cal, &profile) == 0 )
+          fprintf( stderr, "*** No finger could be calibrated, the profile was not saved ***\n" ) ;
+        else if( flex_profile_save(&profile, profile_f_name) == -1 )
+          perror( "*** Unable to save flex calibration profile " ) ;
+        else
+          fprintf( stdout, "Flex calibration saved to:\t%s\n", profile_f_name ) ;
+        flex_lut_build( &lut, &profile ) ;
+      }
+    }
+    /* Hand the current sensor data to sign2speech as a binary frame, built in place in the ring. */
+    frame = (ring != NULL) ? sample_ring_reserve( ring ) : NULL ;
+    /* The ring stays full until sign2speech is started, so a run of drops is reported once, when it begins and ends. */
+    if( (ring != NULL) && (frame == NULL) && !ring_full ){
+      ring_full = true ;
+      dropped_before = __atomic_load_n( &ring->dropped, __ATOMIC_RELAXED ) - 1 ;
+      fprintf( stderr, "*** Shared memory ring full, dropping samples until sign2speech reads them ***\n" ) ;
+    }
+    else if( (frame != NULL) && ring_full ){
+      ring_full = false ;
+      fprintf( stderr, "*** Shared memory ring drained, %u samples dropped ***\n",
+               __atomic_load_n(&ring->dropped, __ATOMIC_RELAXED) - dropped_before ) ;
+    }
+    if( frame == NULL )
+      frame = &local_frame ;
+    frame_seq = seq++ ;
+    fill_frame( frame, hands, status, &lut, frame_seq, capture_ns, (uint32_t)(acq_ns / 1000), left_present ) ;
+    if( (frames_fp != NULL) && (fwrite(frame, sizeof(struct sensor_frame), 1, frames_fp) != 1) )
+      perror( "*** Error writing sensor frame " ) ;
+    if( frame != &local_frame )
+      sample_ring_commit( ring ) ;
+    /* Output current sensor data to file. At a fixed rate, writing every frame would put the file
+       system in the acquisition loop, so only the latest frame is written every XML_PERIOD_MS. */
+    if( use_xml && ((period_ns == 0) || ((now_ns() - xml_ns) >= (XML_PERIOD_MS * NSEC_PER_SEC / 1000))) ){
+      if( period_ns == 0 )
+        fprintf( stdout, "Writing sensor data to:\t%s\n", f_name ) ;
+      if( !write_file(f_name, hands, status, &lut) )
+        perror( "*** Error writing sensor data " ) ;
+      xml_ns = now_ns() ;
+    }
+    if( trace.spans != NULL ){
+      /* At a fixed rate, the values wait in the microcontroller from the previous transaction until this one. */
+      if( acq_end_ns - acq_ns > capture_ns )
+        trace_span( &trace, "sample", frame_seq, capture_ns, acq_end_ns - acq_ns ) ;
+      trace_span( &trace, "i2c", frame_seq, acq_end_ns - acq_ns, acq_end_ns ) ;
+      trace_span( &trace, "publish", frame_seq, acq_end_ns, now_ns() ) ;
+    }
+    if( (period_ns > 0) && ((now_ns() - report_ns) >= (REPORT_PERIOD_S * NSEC_PER_SEC)) ){
+      report_stats( &stats, period_ns, ring ) ;
+      report_ns = now_ns() ;
+    }
     if( kb_flag )
       /* Keyboard interrupt pressed. Perform clean up. */
       break ;
   }
+  if( tfd != -1 ){
+    report_stats( &stats, period_ns, ring ) ;
+    close( tfd ) ;
+    i2c_bus_close( &bus ) ;
+  }
+  if( bus.sim != NULL )
+    i2c_sim_report( bus.sim ) ;
+  i2c_bus_free( &bus ) ;
+  sample_ring_close( ring ) ;
+  if( frames_fp != NULL )
+    fclose( frames_fp ) ;
+  if( (trace.spans != NULL) && !write_trace(&trace) )
+    perror( "*** Error writing trace " ) ;
+  free( trace.spans ) ;
   fprintf( stdout, "\nExiting\n" ) ;
 
   return result ;
@@ -306,34 +624,33 @@ int main( int argc, char* argv[] ){
 }
 
 bool i2c_read( const char* f_name, char buffer[MAX_CHAR], unsigned int num_bytes, const unsigned int addr,
-                      int* fd, bool open_file, bool close_file, int oflags, mode_t mode ){
+                      struct i2c_bus* bus, bool open_file, bool close_file, int oflags, mode_t mode ){
   /* Function to read from an I2C device. */
 
   if( open_file ){
-    *fd = open( f_name, oflags, mode ) ; /* File pointer. O_RDONLY, S_IRUSR */
+    /* O_RDONLY, S_IRUSR */
     /* Verify file opened successfully. */
-    if( *fd == -1 ){
+    if( i2c_bus_open(bus, f_name, oflags, mode) == -1 ){
       /* File did not open successfully.  */
       perror( "*** Unable to open I2C connection " ) ;
-      close(*fd) ;
       return false ;
     }
   }
   /* Address device. */
-  if( ioctl(*fd, I2C_SLAVE, addr) < 0 ){
+  if( i2c_bus_set_addr(bus, addr) == -1 ){
     perror( "*** Unable to address I2C device " ) ;
-    close(*fd) ;
+    i2c_bus_close( bus ) ;
     return false ;
   }
   /* Read byte(s) from register. */
-  if( read(*fd, buffer, num_bytes) != num_bytes  ){
+  if( i2c_bus_read(bus, buffer, num_bytes) != num_bytes  ){
     perror( "*** Unable to read from I2C bus " ) ;
-    close(*fd) ;
+    i2c_bus_close( bus ) ;
     return false ;
   }
   if( close_file ){
     /* Close connection to device. */
-    if( close(*fd) == -1 ){
+    if( i2c_bus_close(bus) == -1 ){
       /* File did not close successfully.  */
       perror( "*** Unable to close I2C connection " ) ;
       return false ;
@@ -346,34 +663,33 @@ bool i2c_read( const char* f_name, char buffer[MAX_CHAR], unsigned int num_bytes
 }
 
 bool i2c_write( const char* f_name, char buffer[MAX_CHAR], unsigned int num_bytes, const unsigned int addr, 
-		int* fd, bool open_file, bool close_file, int oflags, mode_t mode ){
+		struct i2c_bus* bus, bool open_file, bool close_file, int oflags, mode_t mode ){
   /* Function to write to an I2C device. */
 
   if( open_file ){
-    *fd = open( f_name, oflags, mode ) ; /* File pointer. O_WRONLY, S_IWUSR */
+    /* O_WRONLY, S_IWUSR */
     /* Verify file opened successfully. */
-    if( *fd == -1 ){
+    if( i2c_bus_open(bus, f_name, oflags, mode) == -1 ){
       /* File did not open successfully.  */
       perror( "*** Unable to open I2C connection " ) ;
-      close(*fd) ;
       return false ;
     }
   }
   /* Address device. */
-  if( ioctl(*fd, I2C_SLAVE, addr) < 0 ){
+  if( i2c_bus_set_addr(bus, addr) == -1 ){
     perror( "*** Unable to address I2C device " ) ;
-    close(*fd) ;
+    i2c_bus_close( bus ) ;
     return false ;
   }
   /* Write to device. */
-  if( write(*fd, buffer, num_bytes) != num_bytes ){
+  if( i2c_bus_write(bus, buffer, num_bytes) != num_bytes ){
     perror( "*** Unable to write to I2C bus " ) ;
-    close(*fd) ;
+    i2c_bus_close( bus ) ;
     return false ;
   }
   if( close_file ){
     /* Close connection to device. */
-    if( close(*fd) == -1 ){
+    if( i2c_bus_close(bus) == -1 ){
       /* File did not close successfully.  */
       perror( "*** Unable to close I2C connection " ) ;
       return false ;
@@ -525,8 +841,7 @@ void group_data( struct Hand hands[NUM_HANDS], unsigned int left_flex[NUM_FINGER
 
 }
 
-bool write_file( char f_name[MAX_CHAR], struct Hand hands[NUM_HANDS], char status[MAX_CHAR], 
-                 unsigned int lb[NUM_FINGERS], unsigned int ub[NUM_FINGERS] ){
+bool write_file( char f_name[MAX_CHAR], struct Hand hands[NUM_HANDS], char status[MAX_CHAR], const struct flex_lut* lut ){
   /* Function to generate an output XML file. */
 
   FILE* fp ;                                   /* File handle. */
@@ -577,7 +892,7 @@ bool write_file( char f_name[MAX_CHAR], struct Hand hands[NUM_HANDS], char statu
       /* Write the next set of finger data. */
       fprintf( fp, "\t\t\t<%s>\n", finger_name[j] ) ;
       /* Express flex sensor values in range 0-100.*/
-      flex_adjust = adjust_flex( hands[i].fingers[j].flex, lb[j], ub[j] ) ;
+      flex_adjust = flex_lut_value( lut, j, hands[i].fingers[j].flex ) ;
       fprintf( fp, "\t\t\t\t<flex>%u</flex>\n", flex_adjust ) ; 
       for( k = 0 ; k < NUM_FINGER_CONTACTS ; k++ ){
 	if( (strcmp(finger_name[j], "thumb") == 0) && (k == (NUM_FINGER_CONTACTS - 1)) ){
@@ -653,6 +968,336 @@ bool write_file( char f_name[MAX_CHAR], struct Hand hands[NUM_HANDS], char statu
 
 }
 
+void fill_frame( struct sensor_frame* frame, struct Hand hands[NUM_HANDS], char status[MAX_CHAR], const struct flex_lut* lut,
+                 uint32_t seq, uint64_t timestamp, uint32_t acq_us, bool left_present ){
+  /* Function to store the sensor data as a binary frame. The frame orders the fingers from the thumb. */
+
+  unsigned int i ;  /* An iterator. */
+  unsigned int j ;  /* An iterator. */
+  unsigned int k ;  /* An iterator. */
+  unsigned int f ;  /* Position of the finger within the frame. */
+
+  memset( frame, 0, sizeof(struct sensor_frame) ) ;
+  frame->seq = seq ;
+  frame->timestamp = timestamp ;
+  frame->acq_us = acq_us ;
+  /* The right glove is always worn, the left glove only when it was read. */
+  frame->flags = FRAME_RIGHT_PRESENT ;
+  if( left_present )
+    frame->flags |= FRAME_LEFT_PRESENT ;
+  if( strcmp(status, "connected") == 0 )
+    frame->flags |= FRAME_CONNECTED ;
+  for( i = 0 ; i < NUM_HANDS ; i++ ){
+    for( j = 0 ; j < NUM_FINGERS ; j++ ){
+      f = (j == (NUM_FINGERS - 1)) ? 0 : j + 1 ;
+      /* Express flex sensor values in range 0-100.*/
+      frame->hands[i].flex[f] = (uint8_t)flex_lut_value( lut, j, hands[i].fingers[j].flex ) ;
+      for( k = 0 ; k < NUM_FINGER_CONTACTS ; k++ ){
+        if( j == (NUM_FINGERS - 1) ){
+          /* Currently the thumb has only one contact sensor. */
+          if( hands[i].fingers[j].contact[k] )
+            frame->hands[i].contact |= (uint16_t)(1 << FRAME_TH_CON_T) ;
+          break ;
+        }
+        if( hands[i].fingers[j].contact[k] )
+          frame->hands[i].contact |= (uint16_t)(1 << (FRAME_IN_CON_T + (j * NUM_FINGER_CONTACTS) + k)) ;
+      }
+    }
+    for( j = 0 ; j < NUM_FOLDS ; j++ ){
+      if( hands[i].fold[j].contact )
+        frame->hands[i].contact |= (uint16_t)(1 << (FRAME_TI_CON_T + j)) ;
+    }
+    for( j = 0 ; j < NUM_303 ; j++ ){
+      frame->hands[i].lsm303[j][0] = (int16_t)hands[i].lsm303[j].accel_x ;
+      frame->hands[i].lsm303[j][1] = (int16_t)hands[i].lsm303[j].accel_y ;
+      frame->hands[i].lsm303[j][2] = (int16_t)hands[i].lsm303[j].accel_z ;
+      frame->hands[i].lsm303[j][3] = (int16_t)hands[i].lsm303[j].mag_x ;
+      frame->hands[i].lsm303[j][4] = (int16_t)hands[i].lsm303[j].mag_y ;
+      frame->hands[i].lsm303[j][5] = (int16_t)hands[i].lsm303[j].mag_z ;
+    }
+    for( j = 0 ; j < NUM_9DOF ; j++ ){
+      frame->hands[i].lsm9dof[j][0] = (int16_t)hands[i].lsm9dof[j].accel_x ;
+      frame->hands[i].lsm9dof[j][1] = (int16_t)hands[i].lsm9dof[j].accel_y ;
+      frame->hands[i].lsm9dof[j][2] = (int16_t)hands[i].lsm9dof[j].accel_z ;
+      frame->hands[i].lsm9dof[j][3] = (int16_t)hands[i].lsm9dof[j].mag_x ;
+      frame->hands[i].lsm9dof[j][4] = (int16_t)hands[i].lsm9dof[j].mag_y ;
+      frame->hands[i].lsm9dof[j][5] = (int16_t)hands[i].lsm9dof[j].mag_z ;
+      frame->hands[i].lsm9dof[j][6] = (int16_t)hands[i].lsm9dof[j].gyro_x ;
+      frame->hands[i].lsm9dof[j][7] = (int16_t)hands[i].lsm9dof[j].gyro_y ;
+      frame->hands[i].lsm9dof[j][8] = (int16_t)hands[i].lsm9dof[j].gyro_z ;
+    }
+  }
+  frame_seal( frame ) ;
+
+  return ;
+
+}
+
+bool parse_flex_contact( const char* buffer, unsigned int flex[NUM_FINGERS], bool contact[TOTAL_NUM_CONTACTS] ){
+  /* Function to decode the flex and contact sensor block. Returns false if a flex sensor value is out of range. */
+
+  const unsigned char* b = (const unsigned char*)buffer ; /* The block, as unsigned bytes. */
+  bool result = true ;                                    /* An indicator if the values are in range. */
+  unsigned int i ;                                        /* An iterator. */
+
+  for( i = 0 ; i < (NUM_FINGERS - 1) ; i++ ){ /* Note the thumb currently doesn't have a flex sensor. */
+    flex[i] = (unsigned int)((b[i*2] << 8) | b[(i*2)+1]) ;
+    if( flex[i] > MAX_ADC ){
+      fprintf( stderr, "*** Flex sensor value %u exceeds %u, attempting to reset microcontroller.\n", flex[i], MAX_ADC ) ;
+      result = false ;
+    }
+  }
+  for( i = 0 ; i < TOTAL_NUM_CONTACTS ; i++ ){
+    /* Invert the value so that contact is true, and no contact is false. */
+    if( i < 8 )
+      contact[i] = (((b[FLEX_BYTES*(NUM_FINGERS-1)] >> i) & 0x01) == 0) ? true : false ;
+    else
+      contact[i] = (((b[(FLEX_BYTES*(NUM_FINGERS-1))+1] >> (i % 8)) & 0x01) == 0) ? true : false ;
+  }
+
+  return result ;
+
+}
+
+void parse_lsm303( const char* buffer, unsigned int i, double accel303[SEP_NUM_303], double mag303[SEP_NUM_303] ){
+  /* Function to decode the block of LSM303 accelerometer i. */
+
+  const unsigned char* b = (const unsigned char*)buffer ; /* The block, as unsigned bytes. */
+  unsigned int j ;                                        /* An iterator. */
+
+  for( j = 0 ; j < (NUM_303_VALS / 2) ; j++ ){
+    accel303[(i*(NUM_303_VALS/2))+j] = (double)((signed short)((b[j*2] << 8) | (b[(j*2)+1]))) ; 
+  }
+  for( ; j < NUM_303_VALS ; j++ ){
+    mag303[(i*(NUM_303_VALS/2))+(j%(NUM_303_VALS/2))] = (double)((signed short)((b[j*2] << 8) | (b[(j*2)+1]))) ;
+  }
+
+  return ;
+
+}
+
+void parse_lsm9dof( const char* buffer, unsigned int i, double accel9dof[SEP_NUM_9DOF], double mag9dof[SEP_NUM_9DOF],
+                    double gyro9dof[SEP_NUM_9DOF] ){
+  /* Function to decode the block of LSM9DOF accelerometer i. */
+
+  const unsigned char* b = (const unsigned char*)buffer ; /* The block, as unsigned bytes. */
+  unsigned int j ;                                        /* An iterator. */
+
+  for( j = 0 ; j < (NUM_9DOF_VALS / 3) ; j++ ){
+    accel9dof[(i*(NUM_9DOF_VALS/3))+j] = (double)((signed short)((b[j*2] << 8) | (b[(j*2)+1]))) ; 
+  }
+  for( ; j < ((NUM_9DOF_VALS * 2) / 3) ; j++ ){
+    mag9dof[(i*(NUM_9DOF_VALS/3))+(j%(NUM_9DOF_VALS/3))] = (double)((signed short)((b[j*2] << 8) | (b[(j*2)+1]))) ; 
+  }
+  for( ; j < NUM_9DOF_VALS ; j++ ){
+    gyro9dof[(i*(NUM_9DOF_VALS/3))+(j%(NUM_9DOF_VALS/3))] = (double)((signed short)((b[j*2] << 8) | (b[(j*2)+1]))) ; 
+  }
+
+  return ;
+
+}
+
+bool i2c_transfer_all( struct i2c_bus* bus, const unsigned int addr, char buffer[MAX_CHAR] ){
+  /* Function to read every sensor block in one combined I2C transaction, using repeated starts between
+     the blocks. The transaction ends by resetting the microcontroller internal pointer, which also asks
+     it to update its values in time for the next transaction. */
+
+  struct i2c_msg msgs[NUM_BLOCKS + 1] ;      /* The messages making up the transaction. */
+  unsigned char cmd = 0 ;                    /* The command that resets the microcontroller internal pointer. */
+  unsigned int len[NUM_BLOCKS] = { FLEX_CONTACT_LEN, LSM303_LEN, LSM303_LEN, LSM9DOF_LEN, LSM9DOF_LEN } ;
+  unsigned int offset = 0 ;                  /* Position of the next block within the buffer. */
+  unsigned int i ;                           /* An iterator. */
+
+  for( i = 0 ; i < NUM_BLOCKS ; i++ ){
+    msgs[i].addr = addr ;
+    msgs[i].flags = I2C_M_RD ;
+    msgs[i].len = len[i] ;
+    msgs[i].buf = (unsigned char*)buffer + offset ;
+    offset += len[i] ;
+  }
+  msgs[NUM_BLOCKS].addr = addr ;
+  msgs[NUM_BLOCKS].flags = 0 ;
+  msgs[NUM_BLOCKS].len = 1 ;
+  msgs[NUM_BLOCKS].buf = &cmd ;
+  if( i2c_bus_transfer(bus, msgs, NUM_BLOCKS + 1) == -1 ){
+    perror( "*** Unable to perform combined I2C transaction " ) ;
+    return false ;
+  }
+
+  return true ;
+
+}
+
+bool read_left( struct i2c_bus* bus, const unsigned int addr, char buffer[MAX_CHAR], unsigned int flex[NUM_FINGERS],
+                bool contact[TOTAL_NUM_CONTACTS], double accel303[SEP_NUM_303], double mag303[SEP_NUM_303],
+                double accel9dof[SEP_NUM_9DOF], double mag9dof[SEP_NUM_9DOF], double gyro9dof[SEP_NUM_9DOF] ){
+  /* Function to read the left glove's microcontroller in one combined I2C transaction, in the same layout
+     as the right glove. If it does not answer, it is asked to update its values for the next frame. */
+
+  unsigned int i ;  /* An iterator. */
+
+  memset( buffer, '\0', sizeof(char) * MAX_CHAR ) ;
+  if( !i2c_transfer_all(bus, addr, buffer) ){
+    i2c_trigger( bus, addr ) ;
+    return false ;
+  }
+  if( !parse_flex_contact(buffer, flex, contact) )
+    return false ;
+  for( i = 0 ; i < NUM_303 ; i++ )
+    parse_lsm303( buffer + FLEX_CONTACT_LEN + (i * LSM303_LEN), i, accel303, mag303 ) ;
+  for( i = 0 ; i < NUM_9DOF ; i++ )
+    parse_lsm9dof( buffer + FLEX_CONTACT_LEN + (NUM_303 * LSM303_LEN) + (i * LSM9DOF_LEN), i, accel9dof, mag9dof, gyro9dof ) ;
+
+  return true ;
+
+}
+
+bool i2c_trigger( struct i2c_bus* bus, const unsigned int addr ){
+  /* Function to reset the microcontroller internal pointer on an open I2C bus. */
+
+  struct i2c_msg msg ;                       /* The reset command. */
+  unsigned char cmd = 0 ;                    /* The command that resets the microcontroller internal pointer. */
+
+  msg.addr = addr ;
+  msg.flags = 0 ;
+  msg.len = 1 ;
+  msg.buf = &cmd ;
+  if( i2c_bus_transfer(bus, &msg, 1) == -1 ){
+    perror( "*** Unable to write to I2C bus " ) ;
+    return false ;
+  }
+
+  return true ;
+
+}
+
+int start_timer( uint64_t period_ns ){
+  /* Function to start a periodic timer on the monotonic clock. Returns the timer handle, or -1 on error. */
+
+  int tfd ;                  /* Timer handle. */
+  struct itimerspec spec ;   /* Timer period. */
+
+  tfd = timerfd_create( CLOCK_MONOTONIC, 0 ) ;
+  if( tfd == -1 )
+    return -1 ;
+  spec.it_interval.tv_sec = period_ns / NSEC_PER_SEC ;
+  spec.it_interval.tv_nsec = period_ns % NSEC_PER_SEC ;
+  spec.it_value = spec.it_interval ;
+  if( timerfd_settime(tfd, 0, &spec, NULL) == -1 ){
+    close( tfd ) ;
+    return -1 ;
+  }
+
+  return tfd ;
+
+}
+
+unsigned long wait_timer( int tfd, uint64_t period_ns, uint64_t* deadline_ns, struct RateStats* stats ){
+  /* Function to sleep until the timer expires and record how late the wake up was.
+     Returns the number of periods that were missed. */
+
+  uint64_t expirations = 0 ;  /* Number of periods since the last wait. */
+  double late ;               /* Wake up delay, in microseconds. */
+
+  while( read(tfd, &expirations, sizeof(expirations)) != sizeof(expirations) ){
+    if( errno != EINTR ){
+      perror( "*** Unable to read acquisition timer " ) ;
+      return 0 ;
+    }
+  }
+  /* The schedule is fixed, so a late frame does not push back the following ones. */
+  *deadline_ns += expirations * period_ns ;
+  late = (double)(int64_t)(now_ns() - *deadline_ns) / 1000.0 ;
+  if( late < 0.0 )
+    late = 0.0 ;
+  stats->jitter_sum += late ;
+  stats->jitter_sq_sum += late * late ;
+  if( late > stats->jitter_max )
+    stats->jitter_max = late ;
+
+  return (unsigned long)(expirations - 1) ;
+
+}
+
+void report_stats( struct RateStats* stats, uint64_t period_ns, struct sample_ring* ring ){
+  /* Function to print the achieved acquisition rate and jitter, then reset the statistics. */
+
+  double elapsed = (double)(now_ns() - stats->start_ns) / (double)NSEC_PER_SEC ;  /* Seconds since the last report. */
+  double mean ;                                                                  /* Mean wake up delay. */
+  double sd ;                                                                    /* Standard deviation of the wake up delay. */
+
+  if( (stats->frames == 0) || (elapsed <= 0.0) )
+    return ;
+  mean = stats->jitter_sum / (double)stats->frames ;
+  sd = sqrt( fabs((stats->jitter_sq_sum / (double)stats->frames) - (mean * mean)) ) ;
+  fprintf( stdout, "Rate: %.1f Hz (target %.1f Hz)  Jitter: mean %.1f us, sd %.1f us, max %.1f us  "
+                   "I2C: mean %.1f us, max %.1f us  Overruns: %lu  Dropped: %u\n",
+           (double)stats->frames / elapsed, (double)NSEC_PER_SEC / (double)period_ns, mean, sd, stats->jitter_max,
+           stats->acq_sum / (double)stats->frames, stats->acq_max, stats->overruns,
+           (ring != NULL) ? __atomic_load_n(&ring->dropped, __ATOMIC_RELAXED) : 0 ) ;
+  memset( stats, 0, sizeof(struct RateStats) ) ;
+  stats->start_ns = now_ns() ;
+
+  return ;
+
+}
+
+uint64_t now_ns( void ){
+  /* Function to read the monotonic clock, in nanoseconds. */
+
+  struct timespec t ; /* The current time. */
+
+  clock_gettime( CLOCK_MONOTONIC, &t ) ;
+
+  return ((uint64_t)t.tv_sec * NSEC_PER_SEC) + (uint64_t)t.tv_nsec ;
+
+}
+
+void trace_span( struct Trace* trace, const char* name, uint32_t frame, uint64_t start_ns, uint64_t end_ns ){
+  /* Function to record a step of a frame, overwriting the oldest span once the trace is full. */
+
+  struct TraceSpan* span = &trace->spans[trace->count & (TRACE_SPANS - 1)] ;  /* The span to fill in. */
+
+  span->name = name ;
+  span->frame = frame ;
+  span->start_ns = start_ns ;
+  span->end_ns = end_ns ;
+  trace->count++ ;
+
+  return ;
+
+}
+
+bool write_trace( struct Trace* trace ){
+  /* Function to write the spans as Chrome trace JSON, in the same form as sign2speech, so that
+     tools/trace_report.py can follow each frame from one program into the other. */
+
+  FILE* fp ;                                    /* File handle. */
+  struct TraceSpan* span ;                      /* The next span. */
+  unsigned long pid = (unsigned long)getpid() ; /* The process id, also used as the thread id. */
+  uint64_t i ;                                  /* An iterator. */
+
+  fp = fopen( trace->f_name, "w" ) ;
+  if( fp == NULL )
+    return false ;
+  fprintf( fp, "{\"traceEvents\":[\n" ) ;
+  fprintf( fp, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%lu,\"args\":{\"name\":\"i2c_transfer\"}},\n", pid ) ;
+  fprintf( fp, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%lu,\"tid\":%lu,\"args\":{\"name\":\"acquire\"}}", pid, pid ) ;
+  for( i = (trace->count > TRACE_SPANS) ? trace->count - TRACE_SPANS : 0 ; i < trace->count ; i++ ){
+    span = &trace->spans[i & (TRACE_SPANS - 1)] ;
+    fprintf( fp, ",\n{\"name\":\"%s\",\"cat\":\"i2c_transfer\",\"ph\":\"X\",\"pid\":%lu,\"tid\":%lu,"
+                 "\"ts\":%llu.%03llu,\"dur\":%llu.%03llu,\"args\":{\"frame\":%u}}",
+             span->name, pid, pid,
+             (unsigned long long)(span->start_ns / 1000), (unsigned long long)(span->start_ns % 1000),
+             (unsigned long long)((span->end_ns - span->start_ns) / 1000),
+             (unsigned long long)((span->end_ns - span->start_ns) % 1000), span->frame ) ;
+  }
+  fprintf( fp, "\n],\"displayTimeUnit\":\"ns\"}\n" ) ;
+
+  return (fclose( fp ) == 0) ? true : false ;
+
+}
+
 bool reset_sensor( char* f_name ){
   /* Function to reset the microcontroller and attached sensors. */
 
@@ -858,46 +1503,12 @@ void print_values( struct Hand hands[NUM_HANDS] ){
 
 }
 
-double adjust_flex( unsigned int x, unsigned int lb, unsigned int ub ){
-  /* Function to adjust flex sensor values from a 0-1024 scale to a 0-100 quantized scale. */
-
-  const unsigned int MIN_VAL = 0 ;       /* Minimum adjusted value. */
-  const unsigned int MAX_VAL = 100 ;     /* Maximum adjusted value. */
-  const unsigned int NUM_STEPS = 20 ;    /* Resolution. */
-  unsigned int i ;                       /* An iterator. */
-  double dx = ((double)ub - (double)lb) / (double)(NUM_STEPS - 2) ; /* X increment. */
-  double dy = (double)MAX_VAL / (double)NUM_STEPS ;                 /* Y increment. */
-  double y ;                                                        /* Adjusted flex sensor value. */
-
-  if( x == 0 ){
-    y = (double)MIN_VAL ;   
-  }
-  else if( x == MAX_ADC ){
-    y = (double)MAX_VAL - dy ;   
-  }
-  else if( x < lb ){
-    y = (double)MIN_VAL ;   
-  }
-  else if( x >= ub ){
-    y = (double)MAX_VAL - dy ;   
-  }
-  else{
-    /* MIN_VAL and MAX_VAL account for two out of the total number of steps.
-       Therefore start at 1 and go to NUM_STEPS - 1. */
-    for( i = 1 ; i < (NUM_STEPS - 1) ; i++ ){
-      if( (double)x < ((double)lb + ((double)i * dx)) ){
-        y = ((double)i * dy) ;
-        break ;
-      }
-    }  
-  }
-  return y ;
-
-}
-
 void signal_handler( int sig ){ 
 
-    kb_flag = 1 ; 
+    if( sig == SIGHUP )
+      reload_flag = 1 ;
+    else
+      kb_flag = 1 ; 
 
     return ;
 
@@ -0,0 +1,183 @@
+/* Shared memory ring buffer used to pass sensor samples from i2c_transfer to sign2speech.
+   A single producer (i2c_transfer) and a single consumer (sign2speech) map the same
+   POSIX shared memory object. Samples are written and read in place, and the consumer
+   sleeps on a futex until the producer publishes the next sample. Each slot holds one
+   sensor frame (see sensor_frame.h). This header is shared by the C and C++ programs,
+   so it only relies on GCC atomic builtins. */
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+/* Includes */
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include "sensor_frame.h"
+/* Define constants. */
+#define SAMPLE_RING_NAME "/sign2speech_samples" /* Name of the shared memory object. */
+#define SAMPLE_RING_MAGIC 0x52533253            /* Identifies an initialized ring ("S2SR"). */
+#define SAMPLE_RING_VERSION 3                   /* Incremented whenever the ring or frame layout changes. */
+#define SAMPLE_RING_SLOTS 64                    /* Number of records in the ring. Must be a power of two. */
+#define SAMPLE_RING_INIT_WAIT 1000              /* Number of 1 ms waits for another process to initialize the ring. */
+/* Ring states. */
+#define SAMPLE_RING_EMPTY 0                     /* Newly created, all zeros. */
+#define SAMPLE_RING_INIT 1                      /* Being initialized by one of the processes. */
+#define SAMPLE_RING_READY 2                     /* Ready for use. */
+
+/* Custom type definitions. */
+struct sample_ring{    /* The shared memory layout. */
+  uint32_t magic ;                                     /* SAMPLE_RING_MAGIC once initialized. */
+  uint32_t version ;                                   /* SAMPLE_RING_VERSION. */
+  uint32_t record_size ;                               /* sizeof(struct sensor_frame). */
+  uint32_t slots ;                                     /* SAMPLE_RING_SLOTS. */
+  uint32_t state ;                                     /* One of the ring states. */
+  uint32_t wakeup ;                                    /* Futex word, incremented after every sample. */
+  uint32_t waiting ;                                   /* Number of consumers sleeping on the futex. */
+  uint32_t dropped ;                                   /* Number of samples dropped because the ring was full. */
+  uint64_t head __attribute__((aligned(64))) ;         /* Next slot to write. Only written by the producer. */
+  uint64_t tail __attribute__((aligned(64))) ;         /* Next slot to read. Only written by the consumer. */
+  struct sensor_frame records[SAMPLE_RING_SLOTS] __attribute__((aligned(64))) ;
+} ;
+
+static inline struct sample_ring* sample_ring_open( const char* name ){
+  /* Function to map the ring, creating and initializing it if neither process has yet. */
+
+  int fd ;                                  /* Shared memory handle. */
+  struct stat st ;                          /* Size of the shared memory object. */
+  struct sample_ring* ring ;                /* The mapped ring. */
+  uint32_t state = SAMPLE_RING_EMPTY ;      /* The expected ring state. */
+  struct timespec t = { 0, 1000000 } ;      /* Time to wait for another process to finish initializing. */
+  unsigned int i ;                          /* An iterator. */
+
+  fd = shm_open( name, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR ) ;
+  if( fd == -1 )
+    return NULL ;
+  if( (fstat(fd, &st) == -1) ||
+      (((size_t)st.st_size < sizeof(struct sample_ring)) && (ftruncate(fd, sizeof(struct sample_ring)) == -1)) ){
+    close( fd ) ;
+    return NULL ;
+  }
+  ring = (struct sample_ring*)mmap( NULL, sizeof(struct sample_ring), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 ) ;
+  close( fd ) ;
+  if( ring == MAP_FAILED )
+    return NULL ;
+  if( __atomic_compare_exchange_n(&ring->state, &state, SAMPLE_RING_INIT, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ){
+    /* This process created the ring. */
+    ring->magic = SAMPLE_RING_MAGIC ;
+    ring->version = SAMPLE_RING_VERSION ;
+    ring->record_size = sizeof(struct sensor_frame) ;
+    ring->slots = SAMPLE_RING_SLOTS ;
+    ring->wakeup = 0 ;
+    ring->waiting = 0 ;
+    ring->dropped = 0 ;
+    ring->head = 0 ;
+    ring->tail = 0 ;
+    __atomic_store_n( &ring->state, SAMPLE_RING_READY, __ATOMIC_RELEASE ) ;
+  }
+  for( i = 0 ; (i < SAMPLE_RING_INIT_WAIT) && (__atomic_load_n(&ring->state, __ATOMIC_ACQUIRE) != SAMPLE_RING_READY) ; i++ )
+    nanosleep( &t, NULL ) ;
+  if( (__atomic_load_n(&ring->state, __ATOMIC_ACQUIRE) != SAMPLE_RING_READY) || (ring->magic != SAMPLE_RING_MAGIC) ||
+      (ring->version != SAMPLE_RING_VERSION) || (ring->record_size != sizeof(struct sensor_frame)) ||
+      (ring->slots != SAMPLE_RING_SLOTS) ){
+    /* Another version of the program created the ring. */
+    munmap( ring, sizeof(struct sample_ring) ) ;
+    errno = EPROTO ;
+    return NULL ;
+  }
+
+  return ring ;
+
+}
+
+static inline void sample_ring_close( struct sample_ring* ring ){
+  /* Function to unmap the ring. */
+
+  if( ring != NULL )
+    munmap( ring, sizeof(struct sample_ring) ) ;
+
+  return ;
+
+}
+
+static inline struct sensor_frame* sample_ring_reserve( struct sample_ring* ring ){
+  /* Function to get the next free slot so the producer can fill it in place. Returns NULL if the ring is full. */
+
+  uint64_t head = __atomic_load_n( &ring->head, __ATOMIC_RELAXED ) ;
+  uint64_t tail = __atomic_load_n( &ring->tail, __ATOMIC_ACQUIRE ) ;
+
+  if( (head - tail) >= SAMPLE_RING_SLOTS ){
+    __atomic_add_fetch( &ring->dropped, 1, __ATOMIC_RELAXED ) ;
+    return NULL ;
+  }
+
+  return &ring->records[head & (SAMPLE_RING_SLOTS - 1)] ;
+
+}
+
+static inline void sample_ring_commit( struct sample_ring* ring ){
+  /* Function to publish the slot returned by sample_ring_reserve() and wake the consumer. */
+
+  __atomic_store_n( &ring->head, __atomic_load_n(&ring->head, __ATOMIC_RELAXED) + 1, __ATOMIC_RELEASE ) ;
+  __atomic_add_fetch( &ring->wakeup, 1, __ATOMIC_SEQ_CST ) ;
+  if( __atomic_load_n(&ring->waiting, __ATOMIC_SEQ_CST) != 0 )
+    syscall( SYS_futex, &ring->wakeup, FUTEX_WAKE, INT_MAX, NULL, NULL, 0 ) ;
+
+  return ;
+
+}
+
+static inline const struct sensor_frame* sample_ring_peek( struct sample_ring* ring ){
+  /* Function to get the oldest unread sample without copying it. Returns NULL if the ring is empty. */
+
+  uint64_t tail = __atomic_load_n( &ring->tail, __ATOMIC_RELAXED ) ;
+
+  if( __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) == tail )
+    return NULL ;
+
+  return &ring->records[tail & (SAMPLE_RING_SLOTS - 1)] ;
+
+}
+
+static inline void sample_ring_release( struct sample_ring* ring ){
+  /* Function to hand the slot returned by sample_ring_peek() back to the producer. */
+
+  __atomic_store_n( &ring->tail, __atomic_load_n(&ring->tail, __ATOMIC_RELAXED) + 1, __ATOMIC_RELEASE ) ;
+
+  return ;
+
+}
+
+static inline unsigned int sample_ring_depth( struct sample_ring* ring ){
+  /* Function to count the samples waiting to be read. */
+
+  return (unsigned int)(__atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE)) ;
+
+}
+
+static inline int sample_ring_wait( struct sample_ring* ring, unsigned int timeout_ms ){
+  /* Function to sleep until a sample is available or the timeout expires. Returns 1 if a sample is available. */
+
+  uint32_t seen = __atomic_load_n( &ring->wakeup, __ATOMIC_SEQ_CST ) ;  /* The futex value before checking the ring. */
+  struct timespec t ;                                                  /* The amount of time to wait. */
+
+  if( sample_ring_peek(ring) != NULL )
+    return 1 ;
+  t.tv_sec = timeout_ms / 1000 ;
+  t.tv_nsec = (long)(timeout_ms % 1000) * 1000000 ;
+  __atomic_add_fetch( &ring->waiting, 1, __ATOMIC_SEQ_CST ) ;
+  /* Returns immediately if a sample was committed after "seen" was read. */
+  syscall( SYS_futex, &ring->wakeup, FUTEX_WAIT, seen, &t, NULL, 0 ) ;
+  __atomic_sub_fetch( &ring->waiting, 1, __ATOMIC_SEQ_CST ) ;
+
+  return sample_ring_peek( ring ) != NULL ;
+
+}
+
+#endif
@@ -0,0 +1,107 @@
+/* Binary sensor frame shared by i2c_transfer and sign2speech. A frame holds one sample of
+   both hands and replaces the XML document that used to be written for every sample. Frames
+   are fixed-size, stored in host (little-endian) byte order, and end with a CRC-32 of all
+   preceding bytes, so they can be written back to back to a capture file and found again
+   by scanning for FRAME_MAGIC. Increment FRAME_VERSION whenever the layout changes. */
+#ifndef SENSOR_FRAME_H
+#define SENSOR_FRAME_H
+
+/* Includes */
+#include <stdint.h>
+#include <stddef.h>
+/* Define constants. */
+#define FRAME_MAGIC 0x4D524653                  /* Marks the start of a frame ("SFRM"). */
+#define FRAME_VERSION 2                         /* The frame layout version. */
+#define FRAME_SIZE 168                          /* sizeof(struct sensor_frame). */
+#define FRAME_HANDS 2                           /* Number of hands. */
+#define FRAME_LEFT 0                            /* Position of the left hand. */
+#define FRAME_RIGHT 1                           /* Position of the right hand. */
+#define FRAME_FINGERS 5                         /* Number of flex sensors, in the order thumb, index, middle, ring, pinky. */
+#define FRAME_CONTACTS 13                       /* Number of contact sensors per hand. */
+#define FRAME_NUM_303 2                         /* Number of LSM303 accelerometers per hand, top then bottom. */
+#define FRAME_303_VALS 6                        /* accel-x, accel-y, accel-z, mag-x, mag-y, mag-z. */
+#define FRAME_NUM_9DOF 2                        /* Number of LSM9DOF accelerometers per hand, top then bottom. */
+#define FRAME_9DOF_VALS 9                       /* accel-x/y/z, mag-x/y/z, gyro-x/y/z. */
+/* Frame flags. */
+#define FRAME_CONNECTED 0x01                    /* The sensors were read successfully. */
+#define FRAME_LEFT_PRESENT 0x02                 /* The left hand holds sensor data. */
+#define FRAME_RIGHT_PRESENT 0x04                /* The right hand holds sensor data. */
+/* Contact sensor bits, in the same order as the gesture database columns. */
+#define FRAME_TH_CON_T 0                        /* Thumb tip. */
+#define FRAME_IN_CON_T 1                        /* Index tip. */
+#define FRAME_IN_CON_M 2                        /* Index mid. */
+#define FRAME_MI_CON_T 3                        /* Middle tip. */
+#define FRAME_MI_CON_M 4                        /* Middle mid. */
+#define FRAME_RI_CON_T 5                        /* Ring tip. */
+#define FRAME_RI_CON_M 6                        /* Ring mid. */
+#define FRAME_PI_CON_T 7                        /* Pinky tip. */
+#define FRAME_PI_CON_M 8                        /* Pinky mid. */
+#define FRAME_TI_CON_T 9                        /* Thumb-index fold. */
+#define FRAME_IM_CON_T 10                       /* Index-middle fold. */
+#define FRAME_MR_CON_T 11                       /* Middle-ring fold. */
+#define FRAME_RP_CON_T 12                       /* Ring-pinky fold. */
+
+/* Custom type definitions. */
+struct frame_hand{     /* Sensor values for a single hand. */
+  uint8_t flex[FRAME_FINGERS] ;                        /* Adjusted flex sensor values, 0-95. */
+  uint8_t reserved ;                                   /* Always zero. */
+  uint16_t contact ;                                   /* Contact sensors, bit set on contact. See FRAME_*_CON_*. */
+  int16_t lsm303[FRAME_NUM_303][FRAME_303_VALS] ;      /* LSM303 values. */
+  int16_t lsm9dof[FRAME_NUM_9DOF][FRAME_9DOF_VALS] ;   /* LSM9DOF values. */
+} ;
+struct sensor_frame{   /* A single sample of both hands. */
+  uint32_t magic ;                                     /* FRAME_MAGIC. */
+  uint16_t version ;                                   /* FRAME_VERSION. */
+  uint16_t size ;                                      /* FRAME_SIZE. */
+  uint32_t seq ;                                       /* Sample number, incremented by the producer. */
+  uint32_t flags ;                                     /* Frame flags. */
+  uint64_t timestamp ;                                 /* Capture time, in CLOCK_MONOTONIC nanoseconds. 0 if unknown. */
+  struct frame_hand hands[FRAME_HANDS] ;               /* Left and right hand. */
+  uint32_t acq_us ;                                    /* Time taken to read the sensors, in microseconds. */
+  uint32_t crc ;                                       /* CRC-32 of all preceding bytes. */
+} ;
+/* Fails to compile if the layout has padding the documented size does not account for. */
+typedef char frame_size_check[(sizeof(struct sensor_frame) == FRAME_SIZE) ? 1 : -1] ;
+
+static inline uint32_t frame_crc32( const void* data, size_t len ){
+  /* Function to compute the CRC-32 (as used by zlib) of a block of memory, four bits at a time. */
+
+  static const uint32_t table[16] = { 0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+                                      0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+                                      0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+                                      0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C } ;
+  const uint8_t* p = (const uint8_t*)data ;  /* The next byte. */
+  uint32_t crc = 0xFFFFFFFF ;                /* The running CRC. */
+  size_t i ;                                 /* An iterator. */
+
+  for( i = 0 ; i < len ; i++ ){
+    crc ^= p[i] ;
+    crc = (crc >> 4) ^ table[crc & 0x0F] ;
+    crc = (crc >> 4) ^ table[crc & 0x0F] ;
+  }
+
+  return ~crc ;
+
+}
+
+static inline void frame_seal( struct sensor_frame* frame ){
+  /* Function to fill in the frame header and CRC once the sensor values have been stored. */
+
+  frame->magic = FRAME_MAGIC ;
+  frame->version = FRAME_VERSION ;
+  frame->size = FRAME_SIZE ;
+  frame->crc = frame_crc32( frame, offsetof(struct sensor_frame, crc) ) ;
+
+  return ;
+
+}
+
+static inline int frame_valid( const struct sensor_frame* frame ){
+  /* Function to check the frame header and CRC. Returns 1 if the frame is valid. */
+
+  return (frame->magic == FRAME_MAGIC) && (frame->version == FRAME_VERSION) && (frame->size == FRAME_SIZE) &&
+         (frame->crc == frame_crc32(frame, offsetof(struct sensor_frame, crc))) ;
+
+}
+
+#endif
@@ -5,17 +5,8 @@ export GESTURE_DIR=gesture_data
 export CONVERT_DIR=microcomputer
 export I2C_DIR=microcontroller
 export LOG_DIR=log
-# Setup calibration settings for each finger.
-IN_LB=550
-IN_UB=675
-MID_LB=525
-MID_UB=650
-RI_LB=525
-RI_UB=650
-PI_LB=525
-PI_UB=700
-TH_LB=0
-TH_UB=1023
+# Setup the flex calibration profile. switch_user.sh points it at another user's profile.
+PROFILE=$GESTURE_DIR/profiles/current.cal
 UP_DEL=125
 RD_DEL=100
 # Setup the IP address for the server.
@@ -35,10 +26,13 @@ sleep 1
 cd $BASE_DIR
 # Start I2C transfers.
 echo "Starting I2C transfers from sensors"
-$I2C_DIR/i2c_transfer $IN_LB $IN_UB $MID_LB $MID_UB $RI_LB $RI_UB $PI_LB $PI_UB $TH_LB $TH_UB $UP_DEL $RD_DEL > $LOG_DIR/transfer.log 2> $LOG_DIR/transfer_error.log &
+if [ ! -e $PROFILE ] ; then
+  ln -s default.cal $PROFILE
+fi
+$I2C_DIR/i2c_transfer --profile $PROFILE $UP_DEL $RD_DEL > $LOG_DIR/transfer.log 2> $LOG_DIR/transfer_error.log &
 sleep 1
-echo "Starting web server at:" $IP_ADDR:8080
-# Start sign to speech conversion.
+# Start sign to speech conversion. It serves the status page itself.
+echo "Serving status page at:" $IP_ADDR:8080
 cd $CONVERT_DIR
 gnome-terminal -e ./sign2speech
 sleep 1
@@ -53,13 +47,6 @@ sleep 1
 #sleep 1
 # Return to base directory and perform clean up.
 cd $BASE_DIR
-# Stop web server.
-PID=$(pgrep server.py)
-if ! [[ -z "$PID" ]] ; then
-  echo "Stopping web server"
-  kill $PID
-  sleep 1
-fi
 # Stop sign to speech conversion.
 PID=$(pgrep sign2speech)
 if ! [[ -z "$PID" ]] ; then
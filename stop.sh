@@ -1,12 +1,5 @@
 export BASE_DIR=/home/$USER/CapstoneProject_No_GUI
 export GESTURE_DIR=gesture_data
-# Stop web server.
-PID=$(pgrep server.py)
-if ! [[ -z "$PID" ]] ; then
-  echo "Stopping web server"
-  kill $PID
-  sleep 1
-fi
 # Stop I2C transfers.
 PID=$(pgrep i2c_transfer)
 if ! [[ -z "$PID" ]] ; then
@@ -0,0 +1,19 @@
+#/bin/sh
+# Switch the flex calibration to another user's profile without restarting.
+# Usage: switch_user.sh name, for gesture_data/profiles/name.cal. A new user's profile is
+# written by a guided calibration, with i2c_transfer stopped:
+#   microcontroller/i2c_transfer --profile gesture_data/profiles/name.cal 125 100 --calibrate
+export BASE_DIR=/home/$USER/CapstoneProject_No_GUI/CapstoneProject
+export GESTURE_DIR=gesture_data
+cd $BASE_DIR
+if [ ! -f $GESTURE_DIR/profiles/$1.cal ] ; then
+  echo "No calibration profile for:" $1
+  exit 1
+fi
+ln -sfn $1.cal $GESTURE_DIR/profiles/current.cal
+# Have i2c_transfer read the profile again.
+PID=$(pgrep i2c_transfer)
+if ! [[ -z "$PID" ]] ; then
+  echo "Switching flex calibration to:" $1
+  kill -HUP $PID
+fi